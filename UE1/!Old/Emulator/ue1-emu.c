@@ -0,0 +1,882 @@
+/* UE1 emulator.
+
+   License: Public Domain
+
+   Runs UE1 paper tape images (the .BIN files in UE1/Software/Binaries) on the
+   UE14500 core shared with the UE14500 emulator, with no display, as fast as
+   the host will go. Only the standard C library is needed. The CPU lives in
+   ue14500-core.h (and its lookup tables in ue14500-table.h), which must be in
+   the same directory but is simply included.
+   Build and run instructions (there are many ways - use these as a guide):
+
+   Linux:
+     - Ensure GCC is installed.
+     - gcc -O2 -o ue1-emu ue1-emu.c
+     - ./ue1-emu ... (see below)
+
+   Mac:
+     - Ensure Xcode is installed.
+     - clang -O2 -o ue1-emu ue1-emu.c
+     - ./ue1-emu ... (see below)
+
+   Windows:
+     - Install MSYS2 (https://www.msys2.org) including the base dev package.
+     - gcc -O2 -o ue1-emu ue1-emu.c
+     - ./ue1-emu.exe ... (see below)
+
+   The machine: each byte of the tape is one instruction, the opcode in the
+   upper 4 bits and the address in the lower 4 bits. The opcodes are those of
+   the UE14500 except that JMP drives the I/O control line, which rings the
+   bell on the UE1 (IOC). The address selects the data bit:
+     0-7  = scratch register SR0-SR7, read and written.
+     8-15 = output register OR0-OR7 when written by STO/STOC, and when read,
+            the result register (8) looped back or the input switches IR1-IR7
+            (9-15).
+   The tape is a loop, so after the last byte the first is read again with
+   the registers as they were. All registers power up cleared. A NOPF (FLGF)
+   halts the machine, as the UE1 stops the tape reader on Flag F.
+
+   Command line:
+     ue1-emu [OPTIONS] BINFILE
+
+     - BINFILE is the tape image.
+     - The options are:
+         --input BITS = set the input switches. BITS is up to 7 binary digits,
+                        IR7 first (so the last digit is IR1). Default all off.
+         --loops N = stop after N passes of the tape (default 1, 0 for no
+                     limit).
+         --nohalt = do not stop on NOPF; carry on as though the machine were
+                    restarted at once.
+         --quiet = do not print each change to the output register.
+         --table = execute by lookup in the generated tables of
+                   ue14500-table.h instead of the core's switch, taking two
+                   instructions per lookup where the second does not depend
+                   on the first. Same results, fewer branches.
+         --fast = jump straight to the end of --loops N passes instead of
+                  running each one (needs --nohalt and a loop count, and
+                  implies --quiet). The state at the start of a pass is only
+                  21 bits (SR, OR, RR, carry, IEN, OEN and skip), so a pass is
+                  a function on that state. Its results are memoized, passes of
+                  2, 4, 8... are built by composing those, and N passes take
+                  O(log N) compositions, so billions of passes are instant.
+         --cycle = stop as soon as the machine is back in a state it was in
+                   at the start of an earlier pass, since from then on it can
+                   only repeat itself. Brent's algorithm is used, so this
+                   takes no extra memory however long the run. The report
+                   gives the passes before the cycle starts, the period and
+                   what the output does over one period. Usually given with
+                   --loops 0. Cannot be used with --fast.
+
+   Output: each time the output register changes, a line with the instruction
+   count and the new value (OR7 first) is printed, as is each ring of the
+   bell. The run ends with a summary of the final state and the speed.
+*/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "ue14500-core.h"
+#include "ue14500-table.h"
+
+/* Instruction byte fields. */
+#define UE1_OP(byte) ((unsigned)(byte) >> 4)
+#define UE1_ADDR(byte) ((unsigned)(byte) & 0xf)
+
+/* State of the machine. */
+typedef struct ue1_state_
+{
+  /* The CPU. With --table, its registers are kept packed in regs instead
+     (see table_state()). */
+  cpu_state cpu;
+  unsigned regs;
+
+  /* Scratch, output and input registers. Input bit 0 is unused (address 8
+     reads the result register). */
+  unsigned sr;
+  unsigned out;
+  unsigned in;
+
+  /* Tape and position on it. */
+  const unsigned char *tape;
+  size_t tape_len;
+  size_t pos;
+
+  /* With --table, nonzero for each tape position that can be run as a pair
+     with the next. */
+  unsigned char *pair_ok;
+
+  /* Counters. */
+  unsigned long long instructions;
+  unsigned long long loops;
+  unsigned long long bells;
+  unsigned long long halts;
+} ue1_state;
+
+/* Command line settings. */
+typedef struct ue1_options_
+{
+  const char *in_name;
+  unsigned in;
+  unsigned long long loops;
+  unsigned nohalt;
+  unsigned quiet;
+  unsigned table;
+  unsigned fast;
+  unsigned cycle;
+} ue1_options;
+
+/* Events from one instruction. */
+typedef enum ue1_event_
+{
+  ue_write = 0x01, /* The output register changed. */
+  ue_bell = 0x02,  /* IOC rang the bell. */
+  ue_halt = 0x04,  /* NOPF halted the machine. */
+  ue_loop = 0x08   /* The end of the tape was passed. */
+} ue1_event;
+
+/* Packed machine state at the start of a pass: SR in bits 0-7, OR in bits
+   8-15 and the CPU registers (see table_state()) in bits 16-20. */
+#define UE1_PACK(ue1) ((ue1)->sr | (ue1)->out << 8 | (ue1)->regs << 16)
+#define UE1_UNPACK(ue1, state)         \
+  ((ue1)->sr = (state) & 0xff,          \
+   (ue1)->out = ((state) >> 8) & 0xff,  \
+   (ue1)->regs = (state) >> 16)
+
+/* Result of 2^level passes of the tape from a given state. */
+typedef struct pass_entry_
+{
+  unsigned long long key; /* (level << 32 | state) + 1, or 0 if unused. */
+  unsigned state;
+  unsigned long long bells;
+  unsigned long long halts;
+} pass_entry;
+
+/* Memo of pass results, an open-addressed hash table. */
+typedef struct pass_memo_
+{
+  pass_entry *entries;
+  size_t size;
+  size_t used;
+} pass_memo;
+
+/* Helper functions. */
+static int init_args(ue1_options *opts, int argc, char **argv);
+static unsigned char *load_tape(const char *name, size_t *len);
+static unsigned char *find_pairs(const unsigned char *tape, size_t len);
+static const pass_entry *run_passes(pass_memo *memo, ue1_state *ue1,
+                                    unsigned level, unsigned state);
+static int fast_forward(ue1_state *ue1, unsigned long long loops);
+static void report_cycle(const ue1_state *start, unsigned table,
+                         unsigned long long period);
+static void print_bits(unsigned value, FILE *out);
+
+/* Store a bit to the scratch or output register. Returns ue_write if the
+   output register changed. */
+static inline unsigned ue1_store(ue1_state *ue1, unsigned addr, unsigned bus)
+{
+  unsigned bit = 1u << (addr & 7);
+  unsigned out = ue1->out;
+
+  if (addr < 8)
+  {
+    ue1->sr = bus ? ue1->sr | bit : ue1->sr & ~bit;
+    return 0;
+  }
+  ue1->out = bus ? ue1->out | bit : ue1->out & ~bit;
+  return out != ue1->out ? ue_write : 0;
+}
+
+/* Execute the instruction under the read head and advance the tape. Returns
+   the ue1_event bits for what happened. */
+static inline unsigned ue1_step(ue1_state *ue1)
+{
+  unsigned byte = ue1->tape[ue1->pos];
+  unsigned addr = UE1_ADDR(byte);
+  unsigned events = 0;
+  unsigned read;
+
+  /* What each address reads: SR0-7, then RR and IR1-7. */
+  read = ue1->sr | ((ue1->in & 0xfe) << 8) | (ue1->cpu.rr << 8);
+
+  ue1->cpu = cpu_clock_high(ue1->cpu, UE1_OP(byte), (read >> addr) & 1);
+  if (ue1->cpu.outputs & co_write)
+  {
+    events |= ue1_store(ue1, addr, ue1->cpu.bus);
+  }
+  if (ue1->cpu.outputs & co_jump)
+  {
+    events |= ue_bell;
+    ++ue1->bells;
+  }
+  if (ue1->cpu.outputs & co_flgf)
+  {
+    events |= ue_halt;
+    ++ue1->halts;
+  }
+  ue1->cpu = cpu_clock_low(ue1->cpu);
+
+  /* Advance the tape, looping at the end. */
+  ++ue1->instructions;
+  if (++ue1->pos == ue1->tape_len)
+  {
+    ue1->pos = 0;
+    ++ue1->loops;
+    events |= ue_loop;
+  }
+
+  return events;
+}
+
+/* The same as ue1_step(), by table lookup on the packed registers. */
+static inline unsigned ue1_step_table(ue1_state *ue1)
+{
+  unsigned byte = ue1->tape[ue1->pos];
+  unsigned addr = UE1_ADDR(byte);
+  unsigned read = ue1->sr | ((ue1->in & 0xfe) << 8) | ((ue1->regs & 1) << 8);
+  unsigned entry = table_step[TABLE_INDEX(ue1->regs, UE1_OP(byte),
+                                          (read >> addr) & 1)];
+  unsigned outputs = TABLE_OUTPUTS(entry);
+  unsigned events = 0;
+
+  ue1->regs = entry & TABLE_STATE;
+  if (outputs & co_write)
+  {
+    events |= ue1_store(ue1, addr, TABLE_BUS(entry));
+  }
+  if (outputs & co_jump)
+  {
+    events |= ue_bell;
+    ++ue1->bells;
+  }
+  if (outputs & co_flgf)
+  {
+    events |= ue_halt;
+    ++ue1->halts;
+  }
+
+  ++ue1->instructions;
+  if (++ue1->pos == ue1->tape_len)
+  {
+    ue1->pos = 0;
+    ++ue1->loops;
+    events |= ue_loop;
+  }
+
+  return events;
+}
+
+/* Run the instruction under the read head and the next with one lookup. Only
+   for positions find_pairs() allowed: the first instruction can only change
+   the registers and scratch register, and the second reads nothing the first
+   can change. */
+static inline unsigned ue1_pair_table(ue1_state *ue1)
+{
+  unsigned byte1 = ue1->tape[ue1->pos];
+  unsigned byte2 = ue1->tape[ue1->pos + 1];
+  unsigned addr1 = UE1_ADDR(byte1);
+  unsigned addr2 = UE1_ADDR(byte2);
+  unsigned read = ue1->sr | ((ue1->in & 0xfe) << 8) | ((ue1->regs & 1) << 8);
+  uint32_t entry = table_pair[TABLE_PAIR_INDEX(ue1->regs, UE1_OP(byte1),
+                                               (read >> addr1) & 1,
+                                               UE1_OP(byte2),
+                                               (read >> addr2) & 1)];
+  unsigned outputs = TABLE_OUTPUTS2(entry);
+  unsigned events = 0;
+
+  ue1->regs = (unsigned)entry & TABLE_STATE;
+  if (TABLE_OUTPUTS(entry) & co_write)
+  {
+    ue1_store(ue1, addr1, TABLE_BUS(entry));
+  }
+  if (outputs & co_write)
+  {
+    events |= ue1_store(ue1, addr2, TABLE_BUS2(entry));
+  }
+  if (outputs & co_jump)
+  {
+    events |= ue_bell;
+    ++ue1->bells;
+  }
+  if (outputs & co_flgf)
+  {
+    events |= ue_halt;
+    ++ue1->halts;
+  }
+
+  /* Pairs never span the end of the tape. */
+  ue1->instructions += 2;
+  if ((ue1->pos += 2) == ue1->tape_len)
+  {
+    ue1->pos = 0;
+    ++ue1->loops;
+    events |= ue_loop;
+  }
+
+  return events;
+}
+
+/* Run the next instruction (or two) by whichever method is selected. */
+static inline unsigned ue1_next(ue1_state *ue1, unsigned table)
+{
+  if (!table)
+  {
+    return ue1_step(ue1);
+  }
+  return ue1->pair_ok[ue1->pos] ? ue1_pair_table(ue1) : ue1_step_table(ue1);
+}
+
+/* Packed state whichever method is selected. */
+static inline unsigned ue1_packed(const ue1_state *ue1, unsigned table)
+{
+  return ue1->sr | ue1->out << 8 |
+         (table ? ue1->regs : table_state(&ue1->cpu)) << 16;
+}
+
+int main(int argc, char **argv)
+{
+  ue1_options opts;
+  ue1_state ue1;
+  ue1_state power_on;
+  unsigned char *tape;
+  unsigned events;
+  unsigned halted = 0;
+  unsigned tortoise = 0;
+  unsigned long long power = 1;
+  unsigned long long period = 0;
+  clock_t start;
+  double secs;
+
+  /* Initialize arguments and load the tape. */
+  if (init_args(&opts, argc, argv) != 0)
+  {
+    return 1;
+  }
+  memset(&ue1, 0, sizeof(ue1));
+  tape = load_tape(opts.in_name, &ue1.tape_len);
+  if (tape == NULL)
+  {
+    return 1;
+  }
+
+  /* Power on with everything cleared. */
+  ue1.tape = tape;
+  ue1.cpu = cpu_power_on(0);
+  ue1.regs = table_state(&ue1.cpu);
+  ue1.in = opts.in;
+  if (opts.table || opts.fast)
+  {
+    ue1.pair_ok = find_pairs(tape, ue1.tape_len);
+    if (ue1.pair_ok == NULL)
+    {
+      free(tape);
+      return 1;
+    }
+  }
+
+  /* Run until halted or the tape has gone round enough times. */
+  power_on = ue1;
+  tortoise = ue1_packed(&ue1, opts.table);
+  start = clock();
+  if (opts.fast && fast_forward(&ue1, opts.loops) != 0)
+  {
+    free(ue1.pair_ok);
+    free(tape);
+    return 1;
+  }
+  while (opts.loops == 0 || ue1.loops < opts.loops)
+  {
+    events = ue1_next(&ue1, opts.table);
+    if (events == 0)
+    {
+      continue;
+    }
+    if (!opts.quiet && (events & ue_write))
+    {
+      printf("%llu: OR ", ue1.instructions);
+      print_bits(ue1.out, stdout);
+      putchar('\n');
+    }
+    if (!opts.quiet && (events & ue_bell))
+    {
+      printf("%llu: bell\n", ue1.instructions);
+    }
+    if ((events & ue_halt) && !opts.nohalt)
+    {
+      halted = 1;
+      break;
+    }
+
+    /* Brent's cycle detection: compare the state at the start of each pass
+       with the one saved at the last power of two passes. */
+    if (opts.cycle && (events & ue_loop))
+    {
+      ++period;
+      if (ue1_packed(&ue1, opts.table) == tortoise)
+      {
+        break;
+      }
+      if (period == power)
+      {
+        tortoise = ue1_packed(&ue1, opts.table);
+        power *= 2;
+        period = 0;
+      }
+    }
+  }
+  secs = (double)(clock() - start) / CLOCKS_PER_SEC;
+  if (opts.table || opts.fast)
+  {
+    ue1.cpu.rr = ue1.regs & 1;
+    ue1.cpu.cr = (ue1.regs >> 1) & 1;
+    ue1.cpu.ien = (ue1.regs >> 2) & 1;
+    ue1.cpu.oen = (ue1.regs >> 3) & 1;
+  }
+
+  /* Summary. */
+  if (opts.cycle && !halted && (opts.loops == 0 || ue1.loops < opts.loops))
+  {
+    report_cycle(&power_on, opts.table, period);
+  }
+  if (halted)
+  {
+    printf("Halted by NOPF at tape position %lu", (unsigned long)
+           (ue1.pos ? ue1.pos - 1 : ue1.tape_len - 1));
+  }
+  else
+  {
+    printf("Stopped");
+  }
+  printf(" after %llu instructions (%llu loops of %lu bytes).\n",
+         ue1.instructions, ue1.loops, (unsigned long)ue1.tape_len);
+  printf("OR ");
+  print_bits(ue1.out, stdout);
+  printf(", SR ");
+  print_bits(ue1.sr, stdout);
+  printf(", RR %u, carry %u, IEN %u, OEN %u, %llu bells, %llu halts.\n",
+         ue1.cpu.rr, ue1.cpu.cr, ue1.cpu.ien, ue1.cpu.oen, ue1.bells,
+         ue1.halts);
+  if (opts.fast)
+  {
+    printf("%.3f s, fast-forwarded.\n", secs);
+  }
+  else if (secs > 0)
+  {
+    printf("%.3f s, %.1f million instructions per second.\n", secs,
+           (double)ue1.instructions / secs / 1e6);
+  }
+
+  free(ue1.pair_ok);
+  free(tape);
+  return 0;
+}
+
+static int init_args(ue1_options *opts, int argc, char **argv)
+{
+  int i;
+  const char *p;
+  char *end;
+
+  memset(opts, 0, sizeof(*opts));
+  opts->loops = 1;
+
+  /* Options come first. */
+  for (i = 1; i < argc && strncmp(argv[i], "--", 2) == 0; ++i)
+  {
+    if (strcmp(argv[i], "--input") == 0 && i + 1 < argc)
+    {
+      /* IR7 first, so shift each digit in from the bottom, above bit 0. */
+      for (p = argv[++i]; *p != '\0'; ++p)
+      {
+        if ((*p != '0' && *p != '1') || p - argv[i] >= 7)
+        {
+          fputs("The input switches must be up to 7 binary digits.\n",
+                stderr);
+          return 1;
+        }
+        opts->in = ((opts->in << 1) | (unsigned)(*p - '0') << 1) & 0xfe;
+      }
+    }
+    else if (strcmp(argv[i], "--loops") == 0 && i + 1 < argc)
+    {
+      p = argv[++i];
+      opts->loops = strtoull(p, &end, 10);
+      if (*p < '0' || *p > '9' || *end != '\0')
+      {
+        fputs("The --loops count must be a number.\n", stderr);
+        return 1;
+      }
+    }
+    else if (strcmp(argv[i], "--nohalt") == 0)
+    {
+      opts->nohalt = 1;
+    }
+    else if (strcmp(argv[i], "--quiet") == 0)
+    {
+      opts->quiet = 1;
+    }
+    else if (strcmp(argv[i], "--table") == 0)
+    {
+      opts->table = 1;
+    }
+    else if (strcmp(argv[i], "--cycle") == 0)
+    {
+      opts->cycle = 1;
+    }
+    else if (strcmp(argv[i], "--fast") == 0)
+    {
+      opts->fast = 1;
+      opts->quiet = 1;
+    }
+    else
+    {
+      fprintf(stderr, "Unknown option: %s\n", argv[i]);
+      return 1;
+    }
+  }
+
+  /* Then the tape. */
+  if (i + 1 != argc)
+  {
+    fputs("Usage: ue1-emu [OPTIONS] BINFILE\n", stderr);
+    return 1;
+  }
+  opts->in_name = argv[i];
+
+  /* Fast-forwarding cannot stop part way. */
+  if (opts->fast && (!opts->nohalt || opts->loops == 0))
+  {
+    fputs("The --fast option needs --nohalt and a --loops count.\n", stderr);
+    return 1;
+  }
+  if (opts->fast && opts->cycle)
+  {
+    fputs("The --fast and --cycle options cannot be used together.\n",
+          stderr);
+    return 1;
+  }
+  return 0;
+}
+
+static unsigned char *load_tape(const char *name, size_t *len)
+{
+  FILE *in_file;
+  unsigned char *tape = NULL;
+  unsigned char *grown;
+  size_t max_len = 0;
+  size_t got;
+
+  in_file = fopen(name, "rb");
+  if (in_file == NULL)
+  {
+    fputs("Error opening input file.\n", stderr);
+    return NULL;
+  }
+
+  /* Read the whole file, growing the buffer as needed. */
+  *len = 0;
+  do
+  {
+    if (*len == max_len)
+    {
+      max_len = max_len ? max_len * 2 : 4096;
+      grown = realloc(tape, max_len);
+      if (grown == NULL)
+      {
+        fputs("Out of memory.\n", stderr);
+        free(tape);
+        fclose(in_file);
+        return NULL;
+      }
+      tape = grown;
+    }
+    got = fread(tape + *len, 1, max_len - *len, in_file);
+    *len += got;
+  }
+  while (got != 0);
+
+  if (ferror(in_file))
+  {
+    fputs("Error reading input file.\n", stderr);
+    free(tape);
+    fclose(in_file);
+    return NULL;
+  }
+  fclose(in_file);
+
+  if (*len == 0)
+  {
+    fputs("The tape is empty.\n", stderr);
+    free(tape);
+    return NULL;
+  }
+  return tape;
+}
+
+static unsigned char *find_pairs(const unsigned char *tape, size_t len)
+{
+  size_t i;
+  unsigned op1;
+  unsigned addr1;
+  unsigned addr2;
+  unsigned char *pair_ok = calloc(len, 1);
+
+  if (pair_ok == NULL)
+  {
+    fputs("Out of memory.\n", stderr);
+    return NULL;
+  }
+
+  /* The last byte never starts a pair, so a pair never spans the loop. */
+  for (i = 0; i + 1 < len; ++i)
+  {
+    op1 = UE1_OP(tape[i]);
+    addr1 = UE1_ADDR(tape[i]);
+    addr2 = UE1_ADDR(tape[i + 1]);
+
+    /* The first instruction must not have any event of its own (output
+       write, bell or halt), as those are reported by instruction count. */
+    if (((op1 == i_sto || op1 == i_stoc) && addr1 >= 8) ||
+        op1 == i_jmp || op1 == i_nopf)
+    {
+      continue;
+    }
+
+    /* The second must not read RR or a scratch bit the first stores. */
+    if (addr2 == 8 ||
+        ((op1 == i_sto || op1 == i_stoc) && addr1 == addr2))
+    {
+      continue;
+    }
+
+    pair_ok[i] = 1;
+  }
+
+  return pair_ok;
+}
+
+/* Return the result of 2^level passes from state, computing it from two
+   2^(level-1) passes (or by running the tape for level 0) if it is not in the
+   memo already. Returns NULL if out of memory. */
+static const pass_entry *run_passes(pass_memo *memo, ue1_state *ue1,
+                                    unsigned level, unsigned state)
+{
+  size_t i;
+  size_t j;
+  pass_entry *entries;
+  pass_entry result;
+  const pass_entry *half;
+  unsigned long long bells;
+  unsigned long long halts;
+  unsigned long long key = ((unsigned long long)level << 32 | state) + 1;
+
+  /* Look it up. */
+  for (i = (size_t)(key * 0x9e3779b97f4a7c15ull >> 20) & (memo->size - 1);
+       memo->entries[i].key != 0; i = (i + 1) & (memo->size - 1))
+  {
+    if (memo->entries[i].key == key)
+    {
+      return memo->entries + i;
+    }
+  }
+
+  /* Work it out. */
+  result.key = key;
+  if (level == 0)
+  {
+    /* Run the tape once round, by table as that is fastest. */
+    bells = ue1->bells;
+    halts = ue1->halts;
+    UE1_UNPACK(ue1, state);
+    ue1->pos = 0;
+    do
+    {
+      if (ue1->pair_ok[ue1->pos])
+      {
+        ue1_pair_table(ue1);
+      }
+      else
+      {
+        ue1_step_table(ue1);
+      }
+    }
+    while (ue1->pos != 0);
+    result.state = UE1_PACK(ue1);
+    result.bells = ue1->bells - bells;
+    result.halts = ue1->halts - halts;
+  }
+  else
+  {
+    half = run_passes(memo, ue1, level - 1, state);
+    if (half == NULL)
+    {
+      return NULL;
+    }
+    result = *half;
+    half = run_passes(memo, ue1, level - 1, result.state);
+    if (half == NULL)
+    {
+      return NULL;
+    }
+    result.key = key;
+    result.state = half->state;
+    result.bells += half->bells;
+    result.halts += half->halts;
+  }
+
+  /* Keep the table at most half full, rehashing when it grows. */
+  if (2 * (memo->used + 1) > memo->size)
+  {
+    entries = calloc(memo->size * 2, sizeof(pass_entry));
+    if (entries == NULL)
+    {
+      return NULL;
+    }
+    for (i = 0; i < memo->size; ++i)
+    {
+      if (memo->entries[i].key == 0)
+      {
+        continue;
+      }
+      for (j = (size_t)(memo->entries[i].key * 0x9e3779b97f4a7c15ull >> 20) &
+               (memo->size * 2 - 1);
+           entries[j].key != 0; j = (j + 1) & (memo->size * 2 - 1))
+      { }
+      entries[j] = memo->entries[i];
+    }
+    free(memo->entries);
+    memo->entries = entries;
+    memo->size *= 2;
+  }
+
+  /* Add it. */
+  for (i = (size_t)(key * 0x9e3779b97f4a7c15ull >> 20) & (memo->size - 1);
+       memo->entries[i].key != 0; i = (i + 1) & (memo->size - 1))
+  { }
+  memo->entries[i] = result;
+  ++memo->used;
+  return memo->entries + i;
+}
+
+/* Jump ahead the given number of whole passes of the tape, which must be at
+   its start, taking the passes a power of two at a time. */
+static int fast_forward(ue1_state *ue1, unsigned long long loops)
+{
+  unsigned level;
+  unsigned state = UE1_PACK(ue1);
+  unsigned long long loops_done = ue1->loops;
+  unsigned long long instructions = ue1->instructions;
+  unsigned long long bells = ue1->bells;
+  unsigned long long halts = ue1->halts;
+  const pass_entry *entry = NULL;
+  pass_memo memo;
+
+  memo.size = 1024;
+  memo.used = 0;
+  memo.entries = calloc(memo.size, sizeof(pass_entry));
+  if (memo.entries == NULL)
+  {
+    fputs("Out of memory.\n", stderr);
+    return 1;
+  }
+  for (level = 0; (loops >> level) != 0; ++level)
+  {
+    if ((loops >> level) & 1)
+    {
+      entry = run_passes(&memo, ue1, level, state);
+      if (entry == NULL)
+      {
+        fputs("Out of memory.\n", stderr);
+        free(memo.entries);
+        return 1;
+      }
+      state = entry->state;
+      bells += entry->bells;
+      halts += entry->halts;
+    }
+  }
+  free(memo.entries);
+
+  /* Set the machine as it would be after running all the passes. Running the
+     single passes moved the counters, so set them from the start. */
+  UE1_UNPACK(ue1, state);
+  ue1->pos = 0;
+  ue1->loops = loops_done + loops;
+  ue1->instructions = instructions + loops * ue1->tape_len;
+  ue1->bells = bells;
+  ue1->halts = halts;
+  return 0;
+}
+
+/* Report a cycle of the given period (in passes), found by a run from the
+   start state. The start of the cycle is found by running two copies from
+   the start, one a period ahead of the other, until they meet; then one
+   period is run again to show the output. */
+static void report_cycle(const ue1_state *start, unsigned table,
+                         unsigned long long period)
+{
+  unsigned long long i;
+  unsigned long long transient = 0;
+  unsigned long long first;
+  unsigned events;
+  unsigned changes = 0;
+  ue1_state tortoise = *start;
+  ue1_state hare = *start;
+
+  /* Put the hare a period ahead. */
+  for (i = 0; i < period; ++i)
+  {
+    while (!(ue1_next(&hare, table) & ue_loop))
+    { }
+  }
+
+  /* Step both a pass at a time until they meet at the start of the cycle. */
+  while (ue1_packed(&tortoise, table) != ue1_packed(&hare, table))
+  {
+    while (!(ue1_next(&tortoise, table) & ue_loop))
+    { }
+    while (!(ue1_next(&hare, table) & ue_loop))
+    { }
+    ++transient;
+  }
+
+  printf("Cycle: %llu passes before it starts, then a period of %llu passes "
+         "(%llu instructions).\n", transient, period,
+         period * tortoise.tape_len);
+
+  /* One period of output, counted from the start of the cycle. */
+  printf("Output over one period:\n");
+  first = tortoise.instructions;
+  for (i = 0; i < period; )
+  {
+    events = ue1_next(&tortoise, table);
+    if (events & ue_write)
+    {
+      printf("  +%llu: OR ", tortoise.instructions - first);
+      print_bits(tortoise.out, stdout);
+      putchar('\n');
+      ++changes;
+    }
+    if (events & ue_bell)
+    {
+      printf("  +%llu: bell\n", tortoise.instructions - first);
+      ++changes;
+    }
+    i += (events & ue_loop) != 0;
+  }
+  if (changes == 0)
+  {
+    printf("  No change to the output register and no bells.\n");
+  }
+}
+
+static void print_bits(unsigned value, FILE *out)
+{
+  int i;
+
+  for (i = 7; i >= 0; --i)
+  {
+    fputc('0' + ((value >> i) & 1), out);
+  }
+}
@@ -109,7 +109,8 @@
    is ~17. Setting 17 for the delay gives an actual speed of 9.8 Hz then. This
    of course does not account for the actual time the emulator needs to run the
    instruction, but it is assumed that is negligible in comparison to the clock
-   rate.
+   rate. Simpler and exact: run the emulator with --hz, which clocks at the
+   given rate regardless of the delay or .fixedlen.
 */
 #include <ctype.h>
 #include <stdio.h>
@@ -0,0 +1,688 @@
+/* UE14500 batch runner.
+
+   License: Public Domain
+
+   Runs many emulator jobs in one process: each job is an input file (as
+   for ue14500-emu), run headless from power-on to the end of the file, with
+   its own power-on state and data if given. There is no screen and no
+   process per job, and the jobs are shared out to a thread per core.
+
+   Every file named in the manifest is read (and input files compiled) once,
+   before any job starts, and is only read from then on, so the workers
+   share one copy. Each worker has a range of jobs of its own, taken from the
+   front; a worker that runs out steals the back half of the largest range
+   left, so a few long jobs cannot hold up the rest. The results are written
+   in the order of the manifest as soon as every job before them is done.
+   Build and run instructions (there are many ways - use these as a guide):
+
+   Linux/Mac/Windows (MSYS2):
+     - gcc -O2 -o ue14500-batch ue14500-batch.c -lpthread
+     - ./ue14500-batch jobs.txt results.csv
+
+   Command line:
+     ue14500-batch [OPTIONS] MANIFEST [RESULTS]
+
+     - RESULTS is where the results go (default, or "-", stdout).
+     - The options are:
+         --threads N = run N workers (default one per core).
+
+   Manifest: a job per line, as
+
+     PROGRAM [INIT [DATA]]
+
+   separated by spaces, where PROGRAM is the input file, INIT the ten
+   power-on characters to use instead of its second line ("-" to keep
+   them) and DATA a file of data bits: bit N of it (least significant bit
+   of each byte first, as in an output file) is the data switch on clock
+   N + 1, in place of the input file's, for as many clocks as it has bits.
+   Blank lines and anything from a ';' are ignored.
+
+   Results: CSV with a header line, then a line for each job:
+
+     job        the job's number, from 1
+     program    the input file
+     clocks     rising clock edges run
+     bits       bits written
+     state      the registers at the end, as ten power-on characters
+     output     the output file the job would have written, in hex (the
+                last byte padded with zeros)
+
+   File names must not hold spaces or commas.
+*/
+#include <ctype.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "ue14500-core.h"
+
+/* Most workers, and the longest manifest line. */
+#define BATCH_THREADS 256
+#define BATCH_LINE 4096
+
+/* A file named in the manifest, read once. Input files are compiled. */
+typedef struct batch_file_
+{
+  char *name;
+  unsigned is_program;
+  program prog;
+  unsigned char *data;
+  size_t size;
+} batch_file;
+
+/* No data file. */
+#define BATCH_NO_DATA ((size_t)-1)
+
+/* A job (its files by index), and its result line once run (NULL until
+   then, and again once written). */
+typedef struct batch_job_
+{
+  size_t prog;
+  size_t data;
+  unsigned init;
+  char *result;
+} batch_job;
+
+/* A worker's range of jobs, first to last + 1. */
+typedef struct batch_range_
+{
+  pthread_mutex_t lock;
+  size_t first;
+  size_t end;
+} batch_range;
+
+typedef struct batch_state_
+{
+  batch_job *jobs;
+  size_t num_jobs;
+  batch_file *files;
+  size_t num_files;
+  size_t max_files;
+
+  batch_range ranges[BATCH_THREADS];
+  unsigned num_threads;
+
+  /* The results file and the next job to write, under the lock. */
+  pthread_mutex_t lock;
+  FILE *out_file;
+  size_t next;
+  const char *error;
+} batch_state;
+
+typedef struct batch_worker_
+{
+  batch_state *state;
+  unsigned index;
+} batch_worker;
+
+static int read_manifest(batch_state *state, FILE *file);
+static int add_file(batch_state *state, const char *name,
+                    unsigned is_program, size_t *index);
+static int take_job(batch_state *state, unsigned index, size_t *job);
+static char *run_job(const batch_state *state, const batch_job *job,
+                     size_t index);
+static void *worker_thread(void *arg);
+
+int main(int argc, char **argv)
+{
+  const char *out_name = "-";
+  int arg;
+  unsigned i;
+  size_t per;
+  size_t extra;
+  size_t j;
+  FILE *file;
+  batch_state state;
+  batch_worker workers[BATCH_THREADS];
+  pthread_t threads[BATCH_THREADS];
+  int status = 0;
+
+  memset(&state, 0, sizeof(state));
+  state.num_threads = 1;
+#ifdef _SC_NPROCESSORS_ONLN
+  state.num_threads = (unsigned)sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+
+  for (arg = 1; arg < argc && strncmp(argv[arg], "--", 2) == 0; ++arg)
+  {
+    if (strcmp(argv[arg], "--threads") == 0 && arg + 1 < argc)
+    {
+      state.num_threads = (unsigned)strtoul(argv[++arg], NULL, 10);
+    }
+    else
+    {
+      fprintf(stderr, "Unknown option: %s\n", argv[arg]);
+      return 1;
+    }
+  }
+  if (arg == argc || argc - arg > 2)
+  {
+    fputs("Usage: ue14500-batch [OPTIONS] MANIFEST [RESULTS]\n", stderr);
+    return 1;
+  }
+  if (state.num_threads < 1)
+  {
+    state.num_threads = 1;
+  }
+  if (state.num_threads > BATCH_THREADS)
+  {
+    state.num_threads = BATCH_THREADS;
+  }
+
+  /* Read the manifest and everything it names. */
+  file = fopen(argv[arg], "r");
+  if (file == NULL)
+  {
+    fputs("Error opening manifest.\n", stderr);
+    return 1;
+  }
+  if (read_manifest(&state, file))
+  {
+    fclose(file);
+    return 1;
+  }
+  fclose(file);
+
+  if (arg + 1 < argc && strcmp(argv[arg + 1], "-") != 0)
+  {
+    out_name = argv[arg + 1];
+  }
+  state.out_file = strcmp(out_name, "-") == 0 ? stdout :
+                   fopen(out_name, "w");
+  if (state.out_file == NULL)
+  {
+    fputs("Error opening results file.\n", stderr);
+    return 1;
+  }
+  fputs("job,program,clocks,bits,state,output\n", state.out_file);
+
+  /* Give each worker an even share to start with. */
+  if (state.num_threads > state.num_jobs && state.num_jobs > 0)
+  {
+    state.num_threads = (unsigned)state.num_jobs;
+  }
+  per = state.num_jobs / state.num_threads;
+  extra = state.num_jobs % state.num_threads;
+  pthread_mutex_init(&state.lock, NULL);
+  for (i = 0; i < state.num_threads; ++i)
+  {
+    pthread_mutex_init(&state.ranges[i].lock, NULL);
+    state.ranges[i].first = per * i + (i < extra ? i : extra);
+    state.ranges[i].end = state.ranges[i].first + per + (i < extra);
+  }
+
+  for (i = 0; i < state.num_threads; ++i)
+  {
+    workers[i].state = &state;
+    workers[i].index = i;
+    if (pthread_create(&threads[i], NULL, worker_thread, &workers[i]) != 0)
+    {
+      fputs("Error creating worker thread.\n", stderr);
+      return 1;
+    }
+  }
+  for (i = 0; i < state.num_threads; ++i)
+  {
+    pthread_join(threads[i], NULL);
+  }
+
+  if (state.error == NULL && state.next != state.num_jobs)
+  {
+    state.error = "Out of memory.";
+  }
+  if ((state.out_file != stdout ? fclose(state.out_file) :
+                                  fflush(stdout)) != 0 &&
+      state.error == NULL)
+  {
+    state.error = "Error writing results file.";
+  }
+  if (state.error != NULL)
+  {
+    fprintf(stderr, "%s\n", state.error);
+    status = 1;
+  }
+
+  for (j = 0; j < state.num_jobs; ++j)
+  {
+    free(state.jobs[j].result);
+  }
+  for (j = 0; j < state.num_files; ++j)
+  {
+    free(state.files[j].name);
+    program_free(&state.files[j].prog);
+    free(state.files[j].data);
+  }
+  free(state.files);
+  free(state.jobs);
+  return status;
+}
+
+/* Read the jobs, and the files they name. Returns nonzero on error. */
+static int read_manifest(batch_state *state, FILE *file)
+{
+  char line[BATCH_LINE];
+  char *field[3];
+  char *p;
+  unsigned line_num = 0;
+  unsigned n;
+  unsigned i;
+  size_t max_jobs = 0;
+  batch_job *job;
+
+  while (fgets(line, sizeof(line), file) != NULL)
+  {
+    ++line_num;
+    line[strcspn(line, ";\r\n")] = '\0';
+
+    /* Split the line into its fields. */
+    n = 0;
+    p = line;
+    while (*p != '\0')
+    {
+      while (isspace((unsigned char)*p))
+      {
+        *p++ = '\0';
+      }
+      if (*p == '\0')
+      {
+        break;
+      }
+      if (n == 3)
+      {
+        fprintf(stderr, "Too many fields on manifest line %u.\n", line_num);
+        return 1;
+      }
+      field[n++] = p;
+      while (*p != '\0' && !isspace((unsigned char)*p))
+      {
+        ++p;
+      }
+    }
+    if (n == 0)
+    {
+      continue;
+    }
+
+    if (state->num_jobs == max_jobs)
+    {
+      max_jobs = max_jobs ? max_jobs * 2 : 1024;
+      job = (batch_job *)realloc(state->jobs, max_jobs * sizeof(batch_job));
+      if (job == NULL)
+      {
+        fputs("Out of memory.\n", stderr);
+        return 1;
+      }
+      state->jobs = job;
+    }
+    job = state->jobs + state->num_jobs++;
+    job->data = BATCH_NO_DATA;
+    job->result = NULL;
+
+    if (add_file(state, field[0], 1, &job->prog))
+    {
+      fprintf(stderr, "(manifest line %u)\n", line_num);
+      return 1;
+    }
+    job->init = state->files[job->prog].prog.init;
+    if (n > 1 && strcmp(field[1], "-") != 0)
+    {
+      if (strlen(field[1]) != num_power_init)
+      {
+        fprintf(stderr, "Power-on state on manifest line %u is not %u "
+                        "characters.\n", line_num, num_power_init);
+        return 1;
+      }
+      job->init = 0;
+      for (i = 0; i < num_power_init; ++i)
+      {
+        job->init |= (unsigned)(field[1][i] & 1) << i;
+      }
+    }
+    if (n > 2)
+    {
+      if (add_file(state, field[2], 0, &job->data))
+      {
+        fprintf(stderr, "(manifest line %u)\n", line_num);
+        return 1;
+      }
+    }
+  }
+  if (ferror(file))
+  {
+    fputs("Error reading manifest.\n", stderr);
+    return 1;
+  }
+  return 0;
+}
+
+/* Find a file already read, or read it. Returns nonzero on error. */
+static int add_file(batch_state *state, const char *name,
+                    unsigned is_program, size_t *index)
+{
+  size_t i;
+  size_t len;
+  long size;
+  const char *error;
+  FILE *file;
+  batch_file *f;
+
+  for (i = 0; i < state->num_files; ++i)
+  {
+    if (state->files[i].is_program == is_program &&
+        strcmp(state->files[i].name, name) == 0)
+    {
+      *index = i;
+      return 0;
+    }
+  }
+
+  if (state->num_files == state->max_files)
+  {
+    state->max_files = state->max_files ? state->max_files * 2 : 64;
+    f = (batch_file *)realloc(state->files,
+                              state->max_files * sizeof(batch_file));
+    if (f == NULL)
+    {
+      fputs("Out of memory.\n", stderr);
+      return 1;
+    }
+    state->files = f;
+  }
+  f = state->files + state->num_files;
+  memset(f, 0, sizeof(*f));
+  len = strlen(name);
+  f->name = (char *)malloc(len + 1);
+  if (f->name == NULL)
+  {
+    fputs("Out of memory.\n", stderr);
+    return 1;
+  }
+  memcpy(f->name, name, len + 1);
+  f->is_program = is_program;
+
+  file = fopen(name, is_program ? "r" : "rb");
+  if (file == NULL)
+  {
+    fprintf(stderr, "Error opening %s.\n", name);
+    free(f->name);
+    return 1;
+  }
+  if (is_program)
+  {
+    error = program_load(&f->prog, file);
+  }
+  else
+  {
+    error = NULL;
+    if (fseek(file, 0, SEEK_END) != 0 || (size = ftell(file)) < 0 ||
+        fseek(file, 0, SEEK_SET) != 0)
+    {
+      error = "Error reading data file.";
+    }
+    else
+    {
+      f->size = (size_t)size;
+      f->data = (unsigned char *)malloc(f->size + 1);
+      if (f->data == NULL)
+      {
+        error = "Out of memory.";
+      }
+      else if (fread(f->data, 1, f->size, file) != f->size)
+      {
+        error = "Error reading data file.";
+      }
+    }
+  }
+  fclose(file);
+  if (error != NULL)
+  {
+    fprintf(stderr, "%s: %s\n", name, error);
+    program_free(&f->prog);
+    free(f->data);
+    free(f->name);
+    return 1;
+  }
+  *index = state->num_files++;
+  return 0;
+}
+
+/* Take the next job for a worker: the first of its own range, or else the
+   back half of the largest range left. Returns 0 when there are none. */
+static int take_job(batch_state *state, unsigned index, size_t *job)
+{
+  unsigned i;
+  unsigned victim;
+  size_t left;
+  size_t most;
+  size_t first;
+  size_t end;
+  batch_range *own = state->ranges + index;
+  batch_range *range;
+
+  for (;;)
+  {
+    pthread_mutex_lock(&own->lock);
+    if (own->first < own->end)
+    {
+      *job = own->first++;
+      pthread_mutex_unlock(&own->lock);
+      return 1;
+    }
+    pthread_mutex_unlock(&own->lock);
+
+    /* Find the largest range. It may have changed by the time it is locked,
+       which only means less is taken. */
+    most = 0;
+    victim = index;
+    for (i = 0; i < state->num_threads; ++i)
+    {
+      range = state->ranges + i;
+      pthread_mutex_lock(&range->lock);
+      left = range->end - range->first;
+      pthread_mutex_unlock(&range->lock);
+      if (i != index && left > most)
+      {
+        most = left;
+        victim = i;
+      }
+    }
+    if (victim == index)
+    {
+      return 0;
+    }
+
+    range = state->ranges + victim;
+    pthread_mutex_lock(&range->lock);
+    first = range->first;
+    end = range->end;
+    if (first < end)
+    {
+      range->end = end - (end - first + 1) / 2;
+      first = range->end;
+    }
+    pthread_mutex_unlock(&range->lock);
+
+    /* Only this worker adds to its own range, so it is still empty. */
+    if (first < end)
+    {
+      pthread_mutex_lock(&own->lock);
+      own->first = first;
+      own->end = end;
+      pthread_mutex_unlock(&own->lock);
+    }
+  }
+}
+
+/* Run a job and make its result line. Returns NULL if out of memory. */
+static char *run_job(const batch_state *state, const batch_job *job,
+                     size_t index)
+{
+  static const char hex[] = "0123456789abcdef";
+  const batch_file *prog_file = state->files + job->prog;
+  const program *prog = &prog_file->prog;
+  const unsigned char *data = NULL;
+  unsigned long long data_bits = 0;
+  unsigned long long clocks = 0;
+  unsigned long long bits = 0;
+  unsigned events;
+  unsigned curr_byte = 0;
+  unsigned bits_set = 0;
+  unsigned rises;
+  size_t max = 64;
+  size_t len = 0;
+  size_t hex_len;
+  size_t s;
+  unsigned i;
+  char *out;
+  char *p;
+  program_step step;
+  panel_state panel;
+
+  if (job->data != BATCH_NO_DATA)
+  {
+    data = state->files[job->data].data;
+    data_bits = (unsigned long long)state->files[job->data].size * 8;
+  }
+  out = (char *)malloc(max);
+  if (out == NULL)
+  {
+    return NULL;
+  }
+
+  panel_power_on(&panel, job->init);
+  for (s = 0; s < prog->num_steps; ++s)
+  {
+    /* The data file, while it lasts, sets the data switch for each rising
+       edge. */
+    step = prog->steps[s];
+    rises = step.type == st_cycle ||
+            (step.type == st_high && !panel.control_states[c_clk]);
+    if (rises && clocks < data_bits)
+    {
+      step.inst = (unsigned char)((step.inst & 0xfu) |
+                                  ((data[clocks / 8] >> (clocks % 8)) & 1) <<
+                                  4);
+    }
+
+    events = program_step_run(&panel, &step);
+    clocks += (events & pe_clock_high) != 0;
+    if (events & pe_write)
+    {
+      ++bits;
+      curr_byte |= panel.cpu.bus << bits_set;
+      if (++bits_set == 8)
+      {
+        /* Two hex digits, with room left for the rest of the line. */
+        if (len + 3 > max)
+        {
+          max *= 2;
+          p = (char *)realloc(out, max);
+          if (p == NULL)
+          {
+            free(out);
+            return NULL;
+          }
+          out = p;
+        }
+        out[len++] = hex[curr_byte >> 4];
+        out[len++] = hex[curr_byte & 0xf];
+        curr_byte = 0;
+        bits_set = 0;
+      }
+    }
+  }
+  hex_len = len;
+
+  /* The line: the fields before the output, then the output. */
+  p = (char *)malloc(hex_len + strlen(prog_file->name) + 128);
+  if (p == NULL)
+  {
+    free(out);
+    return NULL;
+  }
+  len = (size_t)sprintf(p, "%lu,%s,%llu,%llu,", (unsigned long)index + 1,
+                        prog_file->name, clocks, bits);
+  for (i = 0; i < num_power_init; ++i)
+  {
+    switch (i)
+    {
+      case pi_ien:
+        p[len++] = (char)('0' + panel.cpu.ien);
+        break;
+
+      case pi_logic:
+        p[len++] = (char)('0' + ((panel.cpu.outputs & co_logic) != 0));
+        break;
+
+      case pi_carry:
+        p[len++] = (char)('0' + panel.cpu.cr);
+        break;
+
+      case pi_rr:
+        p[len++] = (char)('0' + panel.cpu.rr);
+        break;
+
+      case pi_oen:
+        p[len++] = (char)('0' + panel.cpu.oen);
+        break;
+
+      case pi_skip:
+        p[len++] = (char)('0' + panel.cpu.skip);
+        break;
+
+      default:
+        p[len++] = (char)('0' + (((unsigned)panel.cpu.ir >> i) & 1));
+        break;
+    }
+  }
+  p[len++] = ',';
+  memcpy(p + len, out, hex_len);
+  len += hex_len;
+  if (bits_set != 0)
+  {
+    p[len++] = hex[curr_byte >> 4];
+    p[len++] = hex[curr_byte & 0xf];
+  }
+  p[len++] = '\n';
+  p[len] = '\0';
+  free(out);
+  return p;
+}
+
+static void *worker_thread(void *arg)
+{
+  batch_worker *worker = (batch_worker *)arg;
+  batch_state *state = worker->state;
+  batch_job *job;
+  size_t index;
+  char *result;
+
+  while (take_job(state, worker->index, &index))
+  {
+    result = run_job(state, state->jobs + index, index);
+
+    /* Write every result that is now next in order. The job must be
+       marked done under the lock, or its line could be missed. */
+    pthread_mutex_lock(&state->lock);
+    state->jobs[index].result = result;
+    if (result == NULL)
+    {
+      state->error = "Out of memory.";
+    }
+    while (state->next < state->num_jobs &&
+           state->jobs[state->next].result != NULL)
+    {
+      job = state->jobs + state->next++;
+      if (fputs(job->result, state->out_file) == EOF)
+      {
+        state->error = "Error writing results file.";
+      }
+      free(job->result);
+      job->result = NULL;
+    }
+    pthread_mutex_unlock(&state->lock);
+  }
+  return NULL;
+}
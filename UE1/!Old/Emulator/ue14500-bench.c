@@ -0,0 +1,600 @@
+/* UE14500 benchmarks.
+
+   License: Public Domain
+
+   Runs a fixed set of workloads on the built emulators and assembler and
+   reports how fast they went, so versions of them can be compared. Each
+   workload is run as its own process, a few times to warm up and then
+   a number of times measured, and the wall time of each run is taken along
+   with the peak memory (RSS) of the process. Needs POSIX (fork, exec and
+   wait4).
+   Build and run instructions (there are many ways - use these as a guide):
+
+   Linux/Mac:
+     - gcc -O2 -o ue14500-bench ue14500-bench.c -lm
+     - ./ue14500-bench --build
+
+   Command line:
+     ue14500-bench [OPTIONS]
+
+     - The options are:
+         --build = build ue14500-emu, ue14500-asm and ue1-emu from the
+                   sources first, with $CC (default cc) and -O2, once
+                   ue14500-gentab --check has found ue14500-table.h up to
+                   date with the core.
+         --dir DIR = where the sources, programs and hello.s are (default
+                     the current directory).
+         --tapes DIR = where the UE1 tapes are (default
+                       DIR/../../Software/Binaries).
+         --runs N = measured runs of each workload (default 5).
+         --warmup N = runs of each workload first that are not measured
+                      (default 1).
+         --csv = print CSV instead of a table.
+         --json = print JSON instead of a table.
+
+   The workloads are:
+     asm-hello   ue14500-asm on hello.s
+     asm-synth   ue14500-asm on a made-up program of a million instructions
+     emu-hello   ue14500-emu --headless on hello.s as assembled
+     emu-synth   ue14500-emu --headless on the made-up program as assembled
+     ue1-fibo    ue1-emu on UE1FIBO.BIN for 10000 passes
+     ue1-math    ue1-emu on UE1MATH.BIN for 10000 passes
+     ue1-diaper  ue1-emu on UE1_DIAPER1_V1.BIN for 10000 passes
+     ue1-synth   ue1-emu on a made-up tape of a million instructions
+
+   For each, the report gives the work done (assembler lines, emulator
+   clocks or UE1 instructions, as the programs themselves count them), the
+   number of runs, the median, lowest, mean and standard deviation of the
+   run times in seconds, the work per second and nanoseconds per unit of
+   work (both from the median), and the highest peak RSS in KiB. The times
+   include starting the process, which is why the made-up workloads are big.
+*/
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <sys/resource.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+/* Size of the made-up programs, and passes of the UE1 tapes. */
+#define SYNTH_INSTRUCTIONS 1000000
+#define TAPE_LOOPS "10000"
+
+/* Longest path or command line argument made. */
+#define PATH_LEN 1024
+
+/* Output formats. */
+typedef enum report_format_
+{
+  rf_table,
+  rf_csv,
+  rf_json
+} report_format;
+
+/* What a workload's work is counted in, and how the count is found. */
+typedef enum work_unit_
+{
+  wu_lines,        /* Lines of the input file. */
+  wu_clocks,       /* The emulator's --stats file. */
+  wu_instructions  /* The UE1 emulator's summary. */
+} work_unit;
+
+static const char *const unit_names[] = { "lines", "clocks", "instructions" };
+
+typedef struct workload_
+{
+  const char *name;
+  work_unit unit;
+
+  /* Program and arguments, and a file to send stdout to (NULL for none). */
+  char *argv[12];
+  const char *out;
+
+  /* Work done, run times and the highest peak RSS (KiB). */
+  unsigned long long work;
+  double *times;
+  long rss;
+} workload;
+
+static int run(char *const *argv, const char *out, double *seconds,
+               long *rss);
+static int make_synth_source(const char *path);
+static int make_synth_tape(const char *path);
+static unsigned long long count_lines(const char *path);
+static unsigned long long count_work(const workload *w, const char *stats);
+static int compare_times(const void *a, const void *b);
+static void report(const workload *w, unsigned runs, report_format format,
+                   unsigned first);
+
+int main(int argc, char **argv)
+{
+  const char *dir = ".";
+  const char *tapes = NULL;
+  const char *cc;
+  unsigned runs = 5;
+  unsigned warmup = 1;
+  unsigned build = 0;
+  report_format format = rf_table;
+  char tmp[] = "/tmp/ue14500-bench.XXXXXX";
+  char path[13][PATH_LEN];
+  char tape[3][PATH_LEN + 32];
+  workload w[8];
+  unsigned num = 0;
+  unsigned i;
+  unsigned r;
+  double seconds;
+  long rss;
+  int status = 0;
+  int arg;
+
+  for (arg = 1; arg < argc; ++arg)
+  {
+    if (strcmp(argv[arg], "--build") == 0)
+    {
+      build = 1;
+    }
+    else if (strcmp(argv[arg], "--dir") == 0 && arg + 1 < argc)
+    {
+      dir = argv[++arg];
+    }
+    else if (strcmp(argv[arg], "--tapes") == 0 && arg + 1 < argc)
+    {
+      tapes = argv[++arg];
+    }
+    else if (strcmp(argv[arg], "--runs") == 0 && arg + 1 < argc)
+    {
+      runs = (unsigned)strtoul(argv[++arg], NULL, 10);
+    }
+    else if (strcmp(argv[arg], "--warmup") == 0 && arg + 1 < argc)
+    {
+      warmup = (unsigned)strtoul(argv[++arg], NULL, 10);
+    }
+    else if (strcmp(argv[arg], "--csv") == 0)
+    {
+      format = rf_csv;
+    }
+    else if (strcmp(argv[arg], "--json") == 0)
+    {
+      format = rf_json;
+    }
+    else
+    {
+      fprintf(stderr, "Unknown option: %s\n", argv[arg]);
+      return 1;
+    }
+  }
+  if (runs == 0)
+  {
+    fputs("The --runs count must be greater than zero.\n", stderr);
+    return 1;
+  }
+
+  /* Programs, sources, tapes and the scratch files. */
+  snprintf(path[0], PATH_LEN, "%s/ue14500-emu", dir);
+  snprintf(path[1], PATH_LEN, "%s/ue14500-asm", dir);
+  snprintf(path[2], PATH_LEN, "%s/ue1-emu", dir);
+  snprintf(path[3], PATH_LEN, "%s/hello.s", dir);
+  if (tapes == NULL)
+  {
+    snprintf(path[4], PATH_LEN, "%s/../../Software/Binaries", dir);
+  }
+  else
+  {
+    snprintf(path[4], PATH_LEN, "%s", tapes);
+  }
+  if (mkdtemp(tmp) == NULL)
+  {
+    fputs("Error making a scratch directory.\n", stderr);
+    return 1;
+  }
+  snprintf(path[5], PATH_LEN, "%s/hello.emu", tmp);
+  snprintf(path[6], PATH_LEN, "%s/synth.s", tmp);
+  snprintf(path[7], PATH_LEN, "%s/synth.emu", tmp);
+  snprintf(path[8], PATH_LEN, "%s/synth.bin", tmp);
+  snprintf(path[9], PATH_LEN, "%s/stats.csv", tmp);
+  snprintf(path[10], PATH_LEN, "%s/out", tmp);
+  snprintf(path[11], PATH_LEN, "%s/out.bin", tmp);
+  snprintf(path[12], PATH_LEN, "%s/ue14500-gentab", tmp);
+
+  /* Build the programs from the sources if asked to. */
+  if (build)
+  {
+    static const char *const sources[] =
+    {
+      "ue14500-emu.c", "ue14500-asm.c", "ue1-emu.c"
+    };
+    char source[PATH_LEN];
+    char *cmd[9];
+
+    cc = getenv("CC");
+    cc = cc != NULL ? cc : "cc";
+
+    /* The lookup tables must match the core before anything is built. */
+    snprintf(source, PATH_LEN, "%s/ue14500-gentab.c", dir);
+    cmd[0] = (char *)cc;
+    cmd[1] = (char *)"-o";
+    cmd[2] = path[12];
+    cmd[3] = source;
+    cmd[4] = NULL;
+    if (run(cmd, NULL, &seconds, &rss) != 0)
+    {
+      fprintf(stderr, "Error building %s.\n", source);
+      status = 1;
+    }
+    cmd[0] = path[12];
+    cmd[1] = (char *)"--check";
+    cmd[2] = NULL;
+    if (status == 0 && run(cmd, NULL, &seconds, &rss) != 0)
+    {
+      fputs("ue14500-table.h does not match ue14500-core.h.\n", stderr);
+      status = 1;
+    }
+
+    for (i = 0; i < 3 && status == 0; ++i)
+    {
+      snprintf(source, PATH_LEN, "%s/%s", dir, sources[i]);
+      cmd[0] = (char *)cc;
+      cmd[1] = (char *)"-O2";
+      cmd[2] = (char *)"-o";
+      cmd[3] = path[i];
+      cmd[4] = source;
+      cmd[5] = i == 0 ? (char *)"-lncurses" : NULL;
+      cmd[6] = i == 0 ? (char *)"-lpthread" : NULL;
+      cmd[7] = NULL;
+      if (run(cmd, NULL, &seconds, &rss) != 0)
+      {
+        fprintf(stderr, "Error building %s.\n", source);
+        status = 1;
+      }
+    }
+  }
+
+  /* The made-up program and tape. */
+  if (status == 0 && (make_synth_source(path[6]) ||
+                      make_synth_tape(path[8])))
+  {
+    fputs("Error writing the made-up programs.\n", stderr);
+    status = 1;
+  }
+
+  /* The workloads, in the order they are run (the emulator ones use what
+     the assembler ones make). */
+  memset(w, 0, sizeof(w));
+  w[num].name = "asm-hello";
+  w[num].unit = wu_lines;
+  w[num].argv[0] = path[1];
+  w[num].argv[1] = path[3];
+  w[num].argv[2] = path[5];
+  w[num++].work = count_lines(path[3]);
+
+  w[num].name = "asm-synth";
+  w[num].unit = wu_lines;
+  w[num].argv[0] = path[1];
+  w[num].argv[1] = path[6];
+  w[num].argv[2] = path[7];
+  w[num++].work = count_lines(path[6]);
+
+  for (i = 0; i < 2; ++i)
+  {
+    w[num].name = i == 0 ? "emu-hello" : "emu-synth";
+    w[num].unit = wu_clocks;
+    w[num].argv[0] = path[0];
+    w[num].argv[1] = (char *)"--headless";
+    w[num].argv[2] = (char *)"--stats";
+    w[num].argv[3] = path[9];
+    w[num].argv[4] = i == 0 ? path[5] : path[7];
+    w[num++].argv[5] = path[11];
+  }
+
+  for (i = 0; i < 4; ++i)
+  {
+    static const char *const names[] =
+    {
+      "ue1-fibo", "ue1-math", "ue1-diaper", "ue1-synth"
+    };
+    static const char *const files[] =
+    {
+      "UE1FIBO.BIN", "UE1MATH.BIN", "UE1_DIAPER1_V1.BIN", NULL
+    };
+
+    w[num].name = names[i];
+    w[num].unit = wu_instructions;
+    w[num].out = path[10];
+    w[num].argv[0] = path[2];
+    w[num].argv[1] = (char *)"--quiet";
+    w[num].argv[2] = (char *)"--nohalt";
+    w[num].argv[3] = (char *)"--loops";
+    w[num].argv[4] = files[i] != NULL ? (char *)TAPE_LOOPS : (char *)"1";
+    if (files[i] != NULL)
+    {
+      snprintf(tape[i], sizeof(tape[i]), "%s/%s", path[4], files[i]);
+      w[num++].argv[5] = tape[i];
+    }
+    else
+    {
+      w[num++].argv[5] = path[8];
+    }
+  }
+
+  /* Run them all. */
+  for (i = 0; i < num && status == 0; ++i)
+  {
+    w[i].times = (double *)malloc(runs * sizeof(double));
+    if (w[i].times == NULL)
+    {
+      fputs("Out of memory.\n", stderr);
+      status = 1;
+      break;
+    }
+    for (r = 0; r < warmup + runs; ++r)
+    {
+      if (run(w[i].argv, w[i].out, &seconds, &rss) != 0)
+      {
+        fprintf(stderr, "Error running the %s workload.\n", w[i].name);
+        status = 1;
+        break;
+      }
+      if (r >= warmup)
+      {
+        w[i].times[r - warmup] = seconds;
+        w[i].rss = rss > w[i].rss ? rss : w[i].rss;
+      }
+    }
+    if (status == 0 && w[i].unit != wu_lines)
+    {
+      w[i].work = count_work(w + i, path[9]);
+    }
+    if (status == 0 && w[i].work == 0)
+    {
+      fprintf(stderr, "The %s workload did no work.\n", w[i].name);
+      status = 1;
+    }
+    if (status == 0)
+    {
+      qsort(w[i].times, runs, sizeof(double), compare_times);
+      report(w + i, runs, format, i == 0);
+    }
+  }
+  if (status == 0 && format == rf_json)
+  {
+    puts(num != 0 ? "\n]" : "[]");
+  }
+
+  for (i = 0; i < num; ++i)
+  {
+    free(w[i].times);
+  }
+  for (i = 5; i < 13; ++i)
+  {
+    remove(path[i]);
+  }
+  rmdir(tmp);
+  return status;
+}
+
+/* Run a program to the end, its output going to the given file or
+   nowhere. Returns nonzero unless it ran and exited with 0. */
+static int run(char *const *argv, const char *out, double *seconds,
+               long *rss)
+{
+  struct timespec start;
+  struct timespec end;
+  struct rusage usage;
+  pid_t pid;
+  int status;
+  int fd;
+
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  pid = fork();
+  if (pid < 0)
+  {
+    return 1;
+  }
+  if (pid == 0)
+  {
+    fd = open(out != NULL ? out : "/dev/null", O_WRONLY | O_CREAT | O_TRUNC,
+              0666);
+    if (fd >= 0)
+    {
+      dup2(fd, 1);
+      close(fd);
+    }
+    fd = open("/dev/null", O_WRONLY);
+    if (fd >= 0)
+    {
+      dup2(fd, 2);
+      close(fd);
+    }
+    execvp(argv[0], argv);
+    _exit(127);
+  }
+  if (wait4(pid, &status, 0, &usage) != pid)
+  {
+    return 1;
+  }
+  clock_gettime(CLOCK_MONOTONIC, &end);
+  *seconds = (double)(end.tv_sec - start.tv_sec) +
+             (double)(end.tv_nsec - start.tv_nsec) / 1e9;
+  *rss = usage.ru_maxrss;
+#ifdef __APPLE__
+  *rss /= 1024;
+#endif
+  return !WIFEXITED(status) || WEXITSTATUS(status) != 0;
+}
+
+/* A program of SYNTH_INSTRUCTIONS instructions using all of them, writing
+   as it goes. The pattern does not matter; it is the same every time. */
+static int make_synth_source(const char *path)
+{
+  static const char *const pattern[] =
+  {
+    "IEN", "OEN", "LD", "ADD", "SUB", "ONE", "NAND", "STO",
+    "OR", "XOR", "STOC", "SKZ", "NOP0", "JMP", "RTN", "NOPF"
+  };
+  FILE *file;
+  unsigned i;
+  int error;
+
+  file = fopen(path, "w");
+  if (file == NULL)
+  {
+    return 1;
+  }
+  fputs(".outfmt emu\n.delay 1\n.init 0000000000\n.quit on\n.data 1\n",
+        file);
+  for (i = 0; i < SYNTH_INSTRUCTIONS; ++i)
+  {
+    fprintf(file, "  %s\n", pattern[i % 16]);
+  }
+  error = ferror(file);
+  return fclose(file) != 0 || error;
+}
+
+/* A tape of SYNTH_INSTRUCTIONS bytes, every opcode but NOPF on every
+   address in a fixed pseudo-random order. */
+static int make_synth_tape(const char *path)
+{
+  FILE *file;
+  unsigned i;
+  unsigned seed = 1;
+  unsigned op;
+  int error;
+
+  file = fopen(path, "wb");
+  if (file == NULL)
+  {
+    return 1;
+  }
+  for (i = 0; i < SYNTH_INSTRUCTIONS; ++i)
+  {
+    seed = seed * 1103515245u + 12345u;
+    op = (seed >> 16) % 15;
+    putc((int)(op << 4 | ((seed >> 8) & 0xf)), file);
+  }
+  error = ferror(file);
+  return fclose(file) != 0 || error;
+}
+
+static unsigned long long count_lines(const char *path)
+{
+  FILE *file;
+  int ch;
+  unsigned long long lines = 0;
+
+  file = fopen(path, "r");
+  if (file == NULL)
+  {
+    return 0;
+  }
+  while ((ch = getc(file)) != EOF)
+  {
+    lines += ch == '\n';
+  }
+  fclose(file);
+  return lines;
+}
+
+/* The clocks from the emulator's --stats file, or the instructions from the
+   UE1 emulator's summary, of the last run. */
+static unsigned long long count_work(const workload *w, const char *stats)
+{
+  FILE *file;
+  char line[256];
+  const char *p;
+  unsigned long long work = 0;
+
+  file = fopen(w->unit == wu_clocks ? stats : w->out, "r");
+  if (file == NULL)
+  {
+    return 0;
+  }
+  while (fgets(line, sizeof(line), file) != NULL)
+  {
+    if (w->unit == wu_clocks && strncmp(line, "clocks,", 7) == 0)
+    {
+      work = strtoull(line + 7, NULL, 10);
+    }
+    else if (w->unit == wu_instructions &&
+             (p = strstr(line, "after ")) != NULL &&
+             strstr(p, " instructions") != NULL)
+    {
+      work = strtoull(p + 6, NULL, 10);
+    }
+  }
+  fclose(file);
+  return work;
+}
+
+static int compare_times(const void *a, const void *b)
+{
+  double x = *(const double *)a;
+  double y = *(const double *)b;
+
+  return x < y ? -1 : x > y;
+}
+
+/* Report a workload whose times are sorted. */
+static void report(const workload *w, unsigned runs, report_format format,
+                   unsigned first)
+{
+  unsigned i;
+  double median;
+  double mean = 0;
+  double dev = 0;
+  double rate;
+  double ns;
+
+  median = runs % 2 ? w->times[runs / 2] :
+           (w->times[runs / 2 - 1] + w->times[runs / 2]) / 2;
+  for (i = 0; i < runs; ++i)
+  {
+    mean += w->times[i];
+  }
+  mean /= runs;
+  for (i = 0; i < runs; ++i)
+  {
+    dev += (w->times[i] - mean) * (w->times[i] - mean);
+  }
+  dev = runs > 1 ? sqrt(dev / (runs - 1)) : 0;
+  rate = median > 0 ? (double)w->work / median : 0;
+  ns = median * 1e9 / (double)w->work;
+
+  switch (format)
+  {
+    case rf_table:
+      if (first)
+      {
+        printf("%-11s %10s %-12s %4s %9s %9s %9s %9s %13s %9s %8s\n",
+               "workload", "work", "unit", "runs", "median s", "min s",
+               "mean s", "stddev s", "work/s", "ns/unit", "rss KiB");
+      }
+      printf("%-11s %10llu %-12s %4u %9.4f %9.4f %9.4f %9.4f %13.0f %9.2f "
+             "%8ld\n", w->name, w->work, unit_names[w->unit], runs, median,
+             w->times[0], mean, dev, rate, ns, w->rss);
+      break;
+
+    case rf_csv:
+      if (first)
+      {
+        puts("workload,work,unit,runs,median_s,min_s,mean_s,stddev_s,"
+             "per_s,ns_per_unit,rss_kib");
+      }
+      printf("%s,%llu,%s,%u,%.6f,%.6f,%.6f,%.6f,%.0f,%.3f,%ld\n", w->name,
+             w->work, unit_names[w->unit], runs, median, w->times[0], mean,
+             dev, rate, ns, w->rss);
+      break;
+
+    case rf_json:
+      printf("%s  { \"workload\": \"%s\", \"work\": %llu, \"unit\": \"%s\", "
+             "\"runs\": %u, \"median_s\": %.6f, \"min_s\": %.6f, "
+             "\"mean_s\": %.6f, \"stddev_s\": %.6f, \"per_s\": %.0f, "
+             "\"ns_per_unit\": %.3f, \"rss_kib\": %ld }",
+             first ? "[\n" : ",\n", w->name, w->work, unit_names[w->unit],
+             runs, median, w->times[0], mean, dev, rate, ns, w->rss);
+      break;
+  }
+}
@@ -0,0 +1,505 @@
+/* UE14500 conditional breakpoints and watchpoints.
+
+   License: Public Domain
+
+   A condition is an expression over what the chip is doing, checked after
+   every clock edge:
+
+     rr, carry, ien, oen, skip   the registers
+     write, flg0, flgf, jmp, rtn the output lines
+     clk, inst, data             the clock and the switches (inst is 0-15)
+     clock                       rising edges so far (cycle is the same)
+     writes                      bits written so far
+     byte                        the byte completed by this edge, or 256
+
+   and numbers (decimal or 0x hex; a leading 0 is still decimal), combined
+   as in C with !, <, <=, > and >=, == and !=, && and || and brackets, where
+   anything tested on its own means it is not zero. changed(NAME) is true on
+   the edge where NAME changes, which is all a watchpoint is. For example:
+
+     skip && rr == 0     byte == 0x21     writes == 100     changed(carry)
+
+   A breakpoint goes off when its condition becomes true, not for as long as
+   it stays true, so carrying on from one is never stopped by the same
+   condition straight away.
+
+   Each condition is compiled to a short postfix program for a stack
+   machine, run with a value for each name. There are no short cuts: both
+   sides of && and || are run, so the program is a straight line.
+*/
+#ifndef UE14500_BREAK_H
+#define UE14500_BREAK_H
+
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ue14500-core.h"
+
+/* Limits on a condition and the number of breakpoints. */
+#define BREAK_TEXT 64
+#define BREAK_CODE 64
+#define BREAK_STACK 16
+#define BREAK_MAX 16
+
+/* The names a condition can use. */
+typedef enum break_var_
+{
+  bv_rr, bv_carry, bv_ien, bv_oen, bv_skip,
+  bv_write, bv_flg0, bv_flgf, bv_jmp, bv_rtn,
+  bv_clk, bv_inst, bv_data,
+  bv_clock, bv_writes, bv_byte,
+  num_break_vars
+} break_var;
+
+static const char *const break_names[num_break_vars] =
+{
+  "rr", "carry", "ien", "oen", "skip",
+  "write", "flg0", "flgf", "jmp", "rtn",
+  "clk", "inst", "data",
+  "clock", "writes", "byte"
+};
+
+/* Operations of the predicate program. */
+typedef enum break_op_
+{
+  bo_var,      /* Push a value. */
+  bo_number,   /* Push a number. */
+  bo_changed,  /* Push whether a value changed on this edge. */
+  bo_eq, bo_ne, bo_lt, bo_le, bo_gt, bo_ge,
+  bo_not, bo_and, bo_or
+} break_op;
+
+typedef struct break_code_
+{
+  unsigned char op;
+  unsigned char var;
+  unsigned long long number;
+} break_code;
+
+typedef struct breakpoint_
+{
+  char text[BREAK_TEXT];
+  break_code code[BREAK_CODE];
+  unsigned length;
+  unsigned was_true;
+} breakpoint;
+
+typedef struct break_set_
+{
+  breakpoint points[BREAK_MAX];
+  unsigned count;
+
+  /* Values after this edge and the last, whether there has been a last,
+     and the byte being put together. */
+  unsigned long long now[num_break_vars];
+  unsigned long long last[num_break_vars];
+  unsigned primed;
+  unsigned curr_byte;
+  unsigned bits_set;
+} break_set;
+
+/* Compiling. The parser keeps its place in the text and fails by setting
+   the error message. */
+typedef struct break_parser_
+{
+  const char *p;
+  breakpoint *point;
+  unsigned depth;
+  const char *error;
+} break_parser;
+
+static inline void break_emit(break_parser *bp, break_op op, unsigned var,
+                              unsigned long long number, int push)
+{
+  breakpoint *point = bp->point;
+
+  if (bp->error != NULL)
+  {
+    return;
+  }
+  if (point->length == BREAK_CODE)
+  {
+    bp->error = "Breakpoint condition is too long.";
+    return;
+  }
+  point->code[point->length].op = (unsigned char)op;
+  point->code[point->length].var = (unsigned char)var;
+  point->code[point->length].number = number;
+  ++point->length;
+  bp->depth = (unsigned)((int)bp->depth + push);
+  if (bp->depth > BREAK_STACK)
+  {
+    bp->error = "Breakpoint condition is too deeply nested.";
+  }
+}
+
+static inline void break_space(break_parser *bp)
+{
+  while (isspace((unsigned char)*bp->p))
+  {
+    ++bp->p;
+  }
+}
+
+/* Match the given text next, skipping spaces before it. */
+static inline unsigned break_match(break_parser *bp, const char *text)
+{
+  size_t len = strlen(text);
+
+  break_space(bp);
+  if (strncmp(bp->p, text, len) != 0)
+  {
+    return 0;
+  }
+  bp->p += len;
+  return 1;
+}
+
+static inline unsigned break_name(break_parser *bp)
+{
+  unsigned i;
+  size_t len = 0;
+
+  break_space(bp);
+  while (isalnum((unsigned char)bp->p[len]))
+  {
+    ++len;
+  }
+  if (len == 5 && strncmp(bp->p, "cycle", 5) == 0)
+  {
+    bp->p += len;
+    return bv_clock;
+  }
+  for (i = 0; i < num_break_vars; ++i)
+  {
+    if (strlen(break_names[i]) == len &&
+        strncmp(bp->p, break_names[i], len) == 0)
+    {
+      bp->p += len;
+      return i;
+    }
+  }
+  if (bp->error == NULL)
+  {
+    bp->error = "Breakpoint condition has an unknown name.";
+  }
+  return 0;
+}
+
+static inline void break_or(break_parser *bp);
+
+/* A name, a number, changed(NAME), !unary or (condition). */
+static inline void break_unary(break_parser *bp)
+{
+  unsigned var;
+  char *end;
+  unsigned long long number;
+
+  if (bp->error != NULL)
+  {
+    return;
+  }
+  if (break_match(bp, "!"))
+  {
+    break_unary(bp);
+    break_emit(bp, bo_not, 0, 0, 0);
+    return;
+  }
+  if (break_match(bp, "("))
+  {
+    break_or(bp);
+    if (!break_match(bp, ")") && bp->error == NULL)
+    {
+      bp->error = "Breakpoint condition is missing a ')'.";
+    }
+    return;
+  }
+  if (break_match(bp, "changed"))
+  {
+    if (!break_match(bp, "(") && bp->error == NULL)
+    {
+      bp->error = "Breakpoint condition is missing a '('.";
+    }
+    var = break_name(bp);
+    break_emit(bp, bo_changed, var, 0, 1);
+    if (!break_match(bp, ")") && bp->error == NULL)
+    {
+      bp->error = "Breakpoint condition is missing a ')'.";
+    }
+    return;
+  }
+  if (!isdigit((unsigned char)*bp->p))
+  {
+    if (!isalpha((unsigned char)*bp->p))
+    {
+      bp->error = "Breakpoint condition is missing a name or number.";
+      return;
+    }
+    var = break_name(bp);
+    break_emit(bp, bo_var, var, 0, 1);
+    return;
+  }
+
+  /* Not strtoull()'s base 0, which would take 010 as octal. */
+  if (bp->p[0] == '0' && (bp->p[1] == 'x' || bp->p[1] == 'X') &&
+      isxdigit((unsigned char)bp->p[2]))
+  {
+    number = strtoull(bp->p + 2, &end, 16);
+  }
+  else
+  {
+    number = strtoull(bp->p, &end, 10);
+  }
+  bp->p = end;
+  break_emit(bp, bo_number, 0, number, 1);
+}
+
+/* The comparison operators. Those from 2 on are done first, as in C, and
+   <= and >= are tried before < and >. */
+static const char *const break_compares[] =
+{
+  "==", "!=", "<=", ">=", "<", ">"
+};
+static const break_op break_compare_ops[] =
+{
+  bo_eq, bo_ne, bo_le, bo_ge, bo_lt, bo_gt
+};
+
+/* Match one of the comparisons from first to last. Returns its number or
+   last + 1 for none. */
+static inline unsigned break_compare_op(break_parser *bp, unsigned first,
+                                        unsigned last)
+{
+  while (first <= last && !break_match(bp, break_compares[first]))
+  {
+    ++first;
+  }
+  return first;
+}
+
+static inline void break_relation(break_parser *bp)
+{
+  unsigned i;
+
+  break_unary(bp);
+  while (bp->error == NULL && (i = break_compare_op(bp, 2, 5)) <= 5)
+  {
+    break_unary(bp);
+    break_emit(bp, break_compare_ops[i], 0, 0, -1);
+  }
+}
+
+static inline void break_equality(break_parser *bp)
+{
+  unsigned i;
+
+  break_relation(bp);
+  while (bp->error == NULL && (i = break_compare_op(bp, 0, 1)) <= 1)
+  {
+    break_relation(bp);
+    break_emit(bp, break_compare_ops[i], 0, 0, -1);
+  }
+}
+
+static inline void break_and(break_parser *bp)
+{
+  break_equality(bp);
+  while (bp->error == NULL && break_match(bp, "&&"))
+  {
+    break_equality(bp);
+    break_emit(bp, bo_and, 0, 0, -1);
+  }
+}
+
+static inline void break_or(break_parser *bp)
+{
+  break_and(bp);
+  while (bp->error == NULL && break_match(bp, "||"))
+  {
+    break_and(bp);
+    break_emit(bp, bo_or, 0, 0, -1);
+  }
+}
+
+/* Add a breakpoint on the given condition (only the start of a long one is
+   kept to show). Returns NULL on success or an error message. */
+static inline const char *break_add(break_set *set, const char *text)
+{
+  break_parser bp;
+
+  if (set->count == BREAK_MAX)
+  {
+    return "Too many breakpoints.";
+  }
+  bp.p = text;
+  bp.point = set->points + set->count;
+  bp.depth = 0;
+  bp.error = NULL;
+  strncpy(bp.point->text, text, BREAK_TEXT - 1);
+  bp.point->text[BREAK_TEXT - 1] = '\0';
+  bp.point->length = 0;
+  bp.point->was_true = 0;
+  break_or(&bp);
+  break_space(&bp);
+  if (bp.error == NULL && *bp.p != '\0')
+  {
+    bp.error = "Breakpoint condition has something extra at the end.";
+  }
+  if (bp.error == NULL)
+  {
+    ++set->count;
+  }
+  return bp.error;
+}
+
+/* Start counting from the given clocks and output (the bits written, and
+   those of them in the byte being filled). */
+static inline void break_sync(break_set *set, unsigned long long clocks,
+                              unsigned long long writes, unsigned curr_byte,
+                              unsigned bits_set)
+{
+  set->now[bv_clock] = clocks;
+  set->now[bv_writes] = writes;
+  set->curr_byte = curr_byte;
+  set->bits_set = bits_set;
+  set->primed = 0;
+}
+
+static inline unsigned break_run(const breakpoint *point,
+                                 const unsigned long long *now,
+                                 const unsigned long long *last)
+{
+  unsigned long long stack[BREAK_STACK + 1];
+  unsigned long long *top = stack;
+  const break_code *code = point->code;
+  const break_code *end = code + point->length;
+
+  for (; code < end; ++code)
+  {
+    switch ((break_op)code->op)
+    {
+      case bo_var:
+        *++top = now[code->var];
+        break;
+
+      case bo_number:
+        *++top = code->number;
+        break;
+
+      case bo_changed:
+        *++top = now[code->var] != last[code->var];
+        break;
+
+      case bo_eq:
+        --top;
+        *top = *top == top[1];
+        break;
+
+      case bo_ne:
+        --top;
+        *top = *top != top[1];
+        break;
+
+      case bo_lt:
+        --top;
+        *top = *top < top[1];
+        break;
+
+      case bo_le:
+        --top;
+        *top = *top <= top[1];
+        break;
+
+      case bo_gt:
+        --top;
+        *top = *top > top[1];
+        break;
+
+      case bo_ge:
+        --top;
+        *top = *top >= top[1];
+        break;
+
+      case bo_not:
+        *top = !*top;
+        break;
+
+      case bo_and:
+        --top;
+        *top = *top && top[1];
+        break;
+
+      case bo_or:
+        --top;
+        *top = *top || top[1];
+        break;
+    }
+  }
+  return *top != 0;
+}
+
+/* Check the breakpoints after a clock edge, with the given switches (as in
+   program_step). Returns the number of the first breakpoint to go off
+   (from 1), or 0 for none. */
+static inline unsigned break_check(break_set *set, unsigned inst,
+                                   const cpu_state *cpu, unsigned clk)
+{
+  unsigned i;
+  unsigned is_true;
+  unsigned hit = 0;
+  unsigned long long *now = set->now;
+
+  memcpy(set->last, now, sizeof(set->now));
+  now[bv_rr] = cpu->rr;
+  now[bv_carry] = cpu->cr;
+  now[bv_ien] = cpu->ien;
+  now[bv_oen] = cpu->oen;
+  now[bv_skip] = cpu->skip;
+  now[bv_write] = (cpu->outputs & co_write) != 0;
+  now[bv_flg0] = (cpu->outputs & co_flg0) != 0;
+  now[bv_flgf] = (cpu->outputs & co_flgf) != 0;
+  now[bv_jmp] = (cpu->outputs & co_jump) != 0;
+  now[bv_rtn] = (cpu->outputs & co_return) != 0;
+  now[bv_clk] = clk != 0;
+  now[bv_inst] = inst & 0xf;
+  now[bv_data] = (inst >> 4) & 1;
+  now[bv_byte] = 256;
+
+  /* A bit is written on the rising edge. */
+  if (clk)
+  {
+    ++now[bv_clock];
+    if (cpu->outputs & co_write)
+    {
+      ++now[bv_writes];
+      set->curr_byte |= cpu->bus << set->bits_set;
+      if (++set->bits_set == 8)
+      {
+        now[bv_byte] = set->curr_byte;
+        set->curr_byte = 0;
+        set->bits_set = 0;
+      }
+    }
+  }
+
+  /* Nothing has changed on the first edge seen. */
+  if (!set->primed)
+  {
+    memcpy(set->last, now, sizeof(set->now));
+    set->primed = 1;
+  }
+
+  for (i = 0; i < set->count; ++i)
+  {
+    is_true = break_run(set->points + i, now, set->last);
+    if (is_true && !set->points[i].was_true && hit == 0)
+    {
+      hit = i + 1;
+    }
+    set->points[i].was_true = is_true;
+  }
+  return hit;
+}
+
+#endif
@@ -0,0 +1,925 @@
+/* UE14500 execution core.
+
+   License: Public Domain
+
+   This is the behaviour of the UE14500 with no dependency on curses or any
+   other display: the CPU registers, what happens to them on each clock edge,
+   and the front panel controls (instruction/data switches and clock) as
+   driven by keystrokes. The emulator draws the result; the core never does.
+
+   Everything here is static (inline, so unused parts cost nothing) so a
+   program only has to include this header. There is nothing extra to compile
+   or link.
+
+   The CPU functions take the current state by value and return the new state.
+   They do not touch anything else, so they are safe to call from anywhere and
+   as often as needed.
+
+   Input files (see ue14500-emu.c for the format) are compiled once by
+   program_load() into an array of steps. Each step is a clock edge (or a
+   breakpoint) together with the switch settings at that point, so running a
+   program is just a walk through the array with no keystroke parsing. The
+   keystrokes are kept, so that if the switches are changed at a breakpoint
+   the rest of the file can be compiled again from them.
+*/
+#ifndef UE14500_CORE_H
+#define UE14500_CORE_H
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Controls. */
+typedef enum controls_
+{
+  c_i3,
+  c_i2,
+  c_i1,
+  c_i0,
+  c_d,
+  c_clk,
+
+  num_controls
+} controls;
+
+/* Instructions. */
+typedef enum instruction_
+{
+  i_nop0, /* 0000: NOP0 = No change in registers. RR -> RR. FLG0 high. */
+  i_ld,   /* 0001: LD   = Load result register. Data -> RR. */
+  i_add,  /* 0010: ADD  = Addition. D + RR -> RR. */
+  i_sub,  /* 0011: SUB  = Subtraction. QD + RR -> RR. */
+  i_one,  /* 0100: ONE  = Force one. 1 -> RR. 0 -> CAR. */
+  i_nand, /* 0101: NAND = Logical NAND. Q(RR * D) -> RR. */
+  i_or,   /* 0110: OR   = Logical OR. RR + D -> RR. */
+  i_xor,  /* 0111: XOR  = Exclusive OR. RR != D -> RR. */
+  i_sto,  /* 1000: STO  = Store. RR -> Data. Write high if OEN. */
+  i_stoc, /* 1001: STOC = Store complement. QRR -> Data. Write high if OEN. */
+  i_ien,  /* 1010: IEN  = Input enable. D -> IEN. */
+  i_oen,  /* 1011: OEN  = Output enable. D -> OEN. */
+  i_jmp,  /* 1100: JMP  = Jump. Jump high. */
+  i_rtn,  /* 1101: RTN  = Return. RTN high. 1 -> Skip. */
+  i_skz,  /* 1110: SKZ  = Skip if zero. 1 -> Skip if RR == 0. */
+  i_nopf  /* 1111: NOPF = No change in registers. RR -> RR. FLGF high. */
+} instruction;
+static const char *const instructions[] =
+{
+  "NOP0",
+  "LD",
+  "ADD",
+  "SUB",
+  "ONE",
+  "NAND",
+  "OR",
+  "XOR",
+  "STO",
+  "STOC",
+  "IEN",
+  "OEN",
+  "JMP",
+  "RTN",
+  "SKZ",
+  "NOPF"
+};
+
+/* Power-on initialization values, in the order they are prompted for. Bit N
+   of the value passed to cpu_power_on() is the Nth of these. */
+typedef enum power_init_
+{
+  pi_inst0,
+  pi_inst1,
+  pi_inst2,
+  pi_inst3,
+  pi_ien,
+  pi_logic,
+  pi_carry,
+  pi_rr,
+  pi_oen,
+  pi_skip,
+
+  num_power_init
+} power_init;
+
+/* Output lines and indicators driven by the CPU. */
+typedef enum cpu_output_
+{
+  co_write = 0x01,  /* Write line. High from clock high to clock low. */
+  co_flg0 = 0x02,   /* Flag 0 line. */
+  co_jump = 0x04,   /* Jump line. */
+  co_return = 0x08, /* Return line. */
+  co_flgf = 0x10,   /* Flag F line. */
+  co_logic = 0x20,  /* Logic unit VFD. */
+  co_store = 0x40   /* The data bus was driven by STO/STOC (see bus). */
+} cpu_output;
+
+/* State of the CPU. */
+typedef struct cpu_state_
+{
+  /* Instruction register. */
+  instruction ir;
+
+  /* Input/output enable registers. */
+  unsigned ien;
+  unsigned oen;
+
+  /* Result/carry registers. */
+  unsigned rr;
+  unsigned cr;
+
+  /* Skip register. */
+  unsigned skip;
+
+  /* Output lines (cpu_output bits) and the last value stored to the bus. */
+  unsigned outputs;
+  unsigned bus;
+} cpu_state;
+
+/* State of the front panel: the controls plus the CPU they drive. */
+typedef struct panel_state_
+{
+  /* The currently-selected control and the state of that control. */
+  controls control;
+  unsigned control_states[num_controls];
+
+  /* Last value seen on the data line, from either the data switch or a
+     store. This is what the remote data VFD shows. */
+  unsigned data_line;
+
+  /* The CPU. */
+  cpu_state cpu;
+} panel_state;
+
+/* Events reported by panel_key(). */
+typedef enum panel_event_
+{
+  pe_select = 0x01,     /* The selected control changed. */
+  pe_control = 0x02,    /* The selected control was toggled. */
+  pe_clock_high = 0x04, /* The clock went high. */
+  pe_clock_low = 0x08,  /* The clock went low. */
+  pe_write = 0x10,      /* A bit was written (the value is cpu.bus). */
+  pe_break = 0x20,      /* Breakpoint command. */
+  pe_quit = 0x40        /* Quit command. */
+} panel_event;
+
+/* Return the instruction for the given panel. */
+#define GET_INSTR(panel)                              \
+  (((panel)->control_states[c_i0] ? i_ld : i_nop0) |  \
+   ((panel)->control_states[c_i1] ? i_add : i_nop0) | \
+   ((panel)->control_states[c_i2] ? i_one : i_nop0) | \
+   ((panel)->control_states[c_i3] ? i_sto : i_nop0))
+
+static inline cpu_state cpu_power_on(unsigned init)
+{
+  cpu_state cpu = { i_nop0 };
+
+  /* Instruction register. */
+  cpu.ir = (instruction)(init & 0xf);
+
+  /* Registers. */
+  cpu.ien = (init >> pi_ien) & 1;
+  cpu.cr = (init >> pi_carry) & 1;
+  cpu.rr = (init >> pi_rr) & 1;
+  cpu.oen = (init >> pi_oen) & 1;
+  cpu.skip = (init >> pi_skip) & 1;
+
+  /* The logic unit VFD is the only output with a random power-on state. */
+  if ((init >> pi_logic) & 1)
+  {
+    cpu.outputs = co_logic;
+  }
+
+  return cpu;
+}
+
+/* A rising edge: cpu_clock_high() or another with the same results, such as
+   table_clock_high() in ue14500-table.h. */
+typedef cpu_state (*clock_high_fn)(cpu_state cpu, unsigned inst,
+                                   unsigned data);
+
+static inline cpu_state cpu_clock_high(cpu_state cpu, unsigned inst,
+                                       unsigned data)
+{
+  unsigned skip = cpu.skip;
+
+  /* Turn skip off it was on. */
+  cpu.skip = 0;
+
+  /* Load the instruction in the instruction register. If the skip flag is set,
+     the instruction lines are all pulled high. */
+  cpu.ir = skip ? i_nopf : (instruction)inst;
+
+  /* Turn off FLG0, JUMP, RETURN, FLGF and the logic VFD in case they were
+     on. */
+  cpu.outputs &= co_write;
+
+  /* Determine the data. If IEN is off, the data is zero; otherwise it is the
+     data bus line. However, if the instruction is IEN, the data bus is read
+     regardless. */
+  data = cpu.ien || cpu.ir == i_ien ? data : 0;
+
+  /* Perform the instruction to update the result and carry registers. */
+  switch (cpu.ir)
+  {
+    case i_nop0:
+      /* FLG0 high. */
+      cpu.outputs |= co_flg0;
+      break;
+
+    case i_ld:
+      /* Result register set to data. */
+      cpu.rr = data;
+      break;
+
+    case i_add:
+      /* Result register set to data plus result register plus carry. Carry
+         register set appropriately. */
+      cpu.rr += data + cpu.cr;
+      cpu.cr = cpu.rr >> 1;
+      cpu.rr &= 1;
+      break;
+
+    case i_sub:
+      /* Result register set to complement of data plus result register plus
+         carry. Carry register set appropriately. */
+      cpu.rr += (data ^ 1) + cpu.cr;
+      cpu.cr = cpu.rr >> 1;
+      cpu.rr &= 1;
+      break;
+
+    case i_one:
+      /* Result register set to one. Carry register cleared. */
+      cpu.rr = 1;
+      cpu.cr = 0;
+      break;
+
+    case i_nand:
+      /* Result register set to complement of result register and data. */
+      cpu.rr = (cpu.rr & data) ^ 1;
+      cpu.outputs |= cpu.rr ? co_logic : 0;
+      break;
+
+    case i_or:
+      /* Result register set to result register or data. */
+      cpu.rr |= data;
+      cpu.outputs |= cpu.rr ? co_logic : 0;
+      break;
+
+    case i_xor:
+      /* Result register set to result register xor data. */
+      cpu.rr ^= data;
+      cpu.outputs |= cpu.rr ? co_logic : 0;
+      break;
+
+    case i_sto:
+      /* Data bus set to result register. Write high if OEN. */
+      cpu.bus = cpu.rr;
+      cpu.outputs |= co_store | (cpu.oen ? co_write : 0);
+      break;
+
+    case i_stoc:
+      /* Data bus set to complement of result register. Write high if OEN. */
+      cpu.bus = cpu.rr ^ 1;
+      cpu.outputs |= co_store | (cpu.oen ? co_write : 0);
+      break;
+
+    case i_ien:
+      /* Input enable register set to data. */
+      cpu.ien = data;
+      break;
+
+    case i_oen:
+      /* Output enable register set to data. */
+      cpu.oen = data;
+      break;
+
+    case i_jmp:
+      /* JUMP high. */
+      cpu.outputs |= co_jump;
+      break;
+
+    case i_rtn:
+      /* RETURN high. Skip next instruction. */
+      cpu.outputs |= co_return;
+      cpu.skip = 1;
+      break;
+
+    case i_skz:
+      /* Skip register set to one if result register is zero. */
+      cpu.skip = cpu.rr == 0;
+      break;
+
+    case i_nopf:
+      /* FLGF high unless this was NOPF due to skip. */
+      cpu.outputs |= skip ? 0 : co_flgf;
+      break;
+  }
+
+  return cpu;
+}
+
+static inline cpu_state cpu_clock_low(cpu_state cpu)
+{
+  /* Return the write line low. Nothing else changes on the falling edge. */
+  cpu.outputs &= ~(unsigned)co_write;
+  return cpu;
+}
+
+static inline void panel_power_on(panel_state *panel, unsigned init)
+{
+  /* Controls all zero with the cursor at I3, CPU as initialized. */
+  panel->control = c_i3;
+  panel->control_states[c_i3] = 0;
+  panel->control_states[c_i2] = 0;
+  panel->control_states[c_i1] = 0;
+  panel->control_states[c_i0] = 0;
+  panel->control_states[c_d] = 0;
+  panel->control_states[c_clk] = 0;
+  panel->data_line = 0;
+  panel->cpu = cpu_power_on(init);
+}
+
+/* Toggle the clock, with the given rising edge. */
+static inline unsigned panel_toggle_clock_with(panel_state *panel,
+                                               clock_high_fn clock_high)
+{
+  /* Perform clock-triggered functions depending on the transition. */
+  if (panel->control_states[c_clk])
+  {
+    /* Clock is currently high, so transition low. */
+    panel->control_states[c_clk] = 0;
+    panel->cpu = cpu_clock_low(panel->cpu);
+    return pe_clock_low;
+  }
+
+  /* Clock is currently low, so transition high. */
+  panel->control_states[c_clk] = 1;
+  panel->cpu = clock_high(panel->cpu, GET_INSTR(panel),
+                          panel->control_states[c_d]);
+  if (panel->cpu.outputs & co_store)
+  {
+    panel->data_line = panel->cpu.bus;
+  }
+  return pe_clock_high | (panel->cpu.outputs & co_write ? pe_write : 0);
+}
+
+static inline unsigned panel_toggle_clock(panel_state *panel)
+{
+  return panel_toggle_clock_with(panel, cpu_clock_high);
+}
+
+static inline unsigned panel_toggle(panel_state *panel)
+{
+  /* Toggle the current control, clocking the CPU if it is the clock. */
+  if (panel->control == c_clk)
+  {
+    return panel_toggle_clock(panel);
+  }
+
+  panel->control_states[panel->control] ^= 1;
+
+  /* The data line also controls the data VFD on the remote. */
+  if (panel->control == c_d)
+  {
+    panel->data_line = panel->control_states[c_d];
+  }
+
+  return pe_control;
+}
+
+static inline unsigned panel_set(panel_state *panel, controls ctrl,
+                                 unsigned value)
+{
+  /* Select the control and toggle it if it does not have the value. */
+  unsigned events = panel->control != ctrl ? pe_select : 0;
+  panel->control = ctrl;
+  if (panel->control_states[ctrl] != value)
+  {
+    events |= panel_toggle(panel);
+  }
+  return events;
+}
+
+/* Handle a keystroke. Only plain characters are understood here; the caller
+   maps any special keys (arrows and so on) to their character equivalents.
+   Returns the panel_event bits for what happened. */
+static inline unsigned panel_key(panel_state *panel, int ch)
+{
+  unsigned events;
+
+  switch (ch)
+  {
+    case 'h':
+    case 'H':
+      /* Select the control to the left, wrapping around. */
+      panel->control = panel->control == c_i3 ?
+                       c_clk : (controls)(panel->control - 1);
+      return pe_select;
+
+    case '\t':
+    case 'l':
+    case 'L':
+      /* Select the control to the right, wrapping around. */
+      panel->control = panel->control == c_clk ?
+                       c_i3 : (controls)(panel->control + 1);
+      return pe_select;
+
+    case 'c':
+    case 'C':
+      /* Select the clock control. */
+      events = panel->control != c_clk ? pe_select : 0;
+      panel->control = c_clk;
+      return events;
+
+    case '\r':
+    case '\n':
+    case ' ':
+    case 't':
+    case 'T':
+      /* Toggle the current control. */
+      return panel_toggle(panel);
+
+    case '0':
+    case '1':
+    case '2':
+    case '3':
+      /* Set I0-I3 off. */
+      return panel_set(panel, (controls)(c_i0 - (ch - '0')), 0);
+
+    case '4':
+    case '5':
+    case '6':
+    case '7':
+      /* Set I0-I3 on. */
+      return panel_set(panel, (controls)(c_i0 - (ch - '4')), 1);
+
+    case 'd':
+      /* Set data off. */
+      return panel_set(panel, c_d, 0);
+
+    case 'D':
+      /* Set data on. */
+      return panel_set(panel, c_d, 1);
+
+    case 'k':
+    case 'K':
+      /* Select the clock control and toggle twice. */
+      events = panel->control != c_clk ? pe_select : 0;
+      panel->control = c_clk;
+      events |= panel_toggle_clock(panel);
+      events |= panel_toggle_clock(panel);
+      return events;
+
+    case 'b':
+    case 'B':
+      /* Toggle breakpoint mode. */
+      return pe_break;
+
+    case 'q':
+    case 'Q':
+      /* Quit. */
+      return pe_quit;
+
+    default:
+      /* Ignore others. */
+      return 0;
+  }
+}
+
+/* Step types of a compiled program. */
+typedef enum step_type_
+{
+  st_high,  /* Clock high. */
+  st_low,   /* Clock low. */
+  st_cycle, /* Clock high then low (the 'k' command). */
+  st_break, /* Breakpoint. */
+  st_set    /* Switches only, at the end of the program. */
+} step_type;
+
+/* One step of a compiled program. The switches are those in effect for the
+   step: the instruction in the low 4 bits of inst and data in bit 4. */
+typedef struct program_step_
+{
+  unsigned char type;
+  unsigned char inst;
+  unsigned char control;
+  unsigned char keys; /* Keystrokes the step took in the file (max 255). */
+} program_step;
+
+/* Where a step came from in the keystrokes, so the rest of the file can be
+   compiled again from any step (see program_resume()). */
+typedef struct program_source_
+{
+  /* Keystrokes used up once the step has run. */
+  unsigned end;
+
+  /* The switches (as in program_step), cursor and clock the step's
+     keystrokes started from. */
+  unsigned char inst;
+  unsigned char control;
+  unsigned char clock;
+} program_source;
+
+/* A compiled input file. */
+typedef struct program_
+{
+  /* Delay between keystrokes (ms) and power-on values from the header. */
+  unsigned delay;
+  unsigned init;
+
+  /* Set if the file ends by quitting rather than going interactive. */
+  unsigned quit;
+
+  /* The keystrokes after the header, up to any quit. */
+  char *text;
+  size_t text_len;
+
+  /* The steps and where each came from. The last step of a compile is
+     always st_set with the final switches; program_resume() adds more
+     compiles after it. */
+  size_t num_steps;
+  size_t max_steps;
+  program_step *steps;
+  program_source *sources;
+} program;
+
+/* Read the next keystroke from an input file, skipping comments and carriage
+   returns. Returns EOF at the end of the file or on error. */
+static inline int program_getc(FILE *in_file)
+{
+  int ch;
+  int in_comment = 0;
+  int end_comment = 0;
+
+  /* Get a non-comment character. */
+  do
+  {
+    /* If the end of comment was seen, we're out of the comment. */
+    in_comment = in_comment ^ end_comment;
+
+    /* Get the next character. */
+    ch = fgetc(in_file);
+    if (ch == EOF)
+    {
+      return EOF;
+    }
+    else if (in_comment)
+    {
+      /* Check if the end of the comment was found. */
+      end_comment = ch == '\n';
+    }
+    else if (ch == ';')
+    {
+      /* Keep reading until a newline. */
+      in_comment = 1;
+      end_comment = 0;
+    }
+    else if (ch == '\r')
+    {
+      /* Treat carriage return like a single-character comment. */
+      in_comment = 1;
+      end_comment = 1;
+    }
+  }
+  while (in_comment);
+
+  /* Return the character read. */
+  return ch;
+}
+
+static inline unsigned char program_inst(const panel_state *panel)
+{
+  return (unsigned char)(GET_INSTR(panel) |
+                         (panel->control_states[c_d] << 4));
+}
+
+/* Add a step with the switches of panel, whose keystrokes started from the
+   panel from and end at end. Returns nonzero if out of memory. */
+static inline int program_add(program *prog, const panel_state *panel,
+                              step_type type, unsigned *keys,
+                              const panel_state *from, size_t end)
+{
+  void *grown;
+  program_step *step;
+  program_source *source;
+
+  /* Grow the arrays as needed. */
+  if (prog->num_steps == prog->max_steps)
+  {
+    prog->max_steps = prog->max_steps ? prog->max_steps * 2 : 1024;
+    grown = realloc(prog->steps, prog->max_steps * sizeof(program_step));
+    if (grown == NULL)
+    {
+      return 1;
+    }
+    prog->steps = (program_step *)grown;
+    grown = realloc(prog->sources, prog->max_steps * sizeof(program_source));
+    if (grown == NULL)
+    {
+      return 1;
+    }
+    prog->sources = (program_source *)grown;
+  }
+
+  /* Add the step with the switches as they are now. */
+  step = prog->steps + prog->num_steps;
+  step->type = (unsigned char)type;
+  step->inst = program_inst(panel);
+  step->control = (unsigned char)panel->control;
+  step->keys = (unsigned char)(*keys > 255 ? 255 : *keys);
+  *keys = 0;
+
+  source = prog->sources + prog->num_steps++;
+  source->end = (unsigned)end;
+  source->inst = program_inst(from);
+  source->control = (unsigned char)from->control;
+  source->clock = (unsigned char)from->control_states[c_clk];
+  return 0;
+}
+
+static inline void program_free(program *prog)
+{
+  free(prog->text);
+  free(prog->steps);
+  free(prog->sources);
+  prog->text = NULL;
+  prog->steps = NULL;
+  prog->sources = NULL;
+  prog->text_len = 0;
+  prog->num_steps = 0;
+  prog->max_steps = 0;
+}
+
+/* Compile the keystrokes from pos on, starting from the switches, cursor
+   and clock of the given panel, and add the steps to the program. The
+   keystrokes are run through panel_key() exactly as typed, so the steps
+   have the same effect as the file would have had read one key at a time.
+   Returns NULL on success or an error message. */
+static inline const char *program_compile(program *prog, size_t pos,
+                                          const panel_state *start)
+{
+  unsigned keys = 0;
+  unsigned clock;
+  unsigned events;
+  panel_state panel = *start;
+  panel_state from = *start;
+  panel_state half;
+
+  while (pos < prog->text_len)
+  {
+    ++keys;
+    clock = panel.control_states[c_clk];
+    events = panel_key(&panel, prog->text[pos++]);
+
+    if ((events & (pe_clock_high | pe_clock_low)) ==
+        (pe_clock_high | pe_clock_low))
+    {
+      /* A 'k' command: the clock goes through a whole cycle from where it
+         was. From high, it is a falling edge and then a rising one, and the
+         'k' is only used up by the second. */
+      if (clock)
+      {
+        half = panel;
+        half.control_states[c_clk] = 0;
+        if (program_add(prog, &panel, st_low, &keys, &from, pos - 1) ||
+            program_add(prog, &panel, st_high, &keys, &half, pos))
+        {
+          return "Out of memory.";
+        }
+      }
+      else if (program_add(prog, &panel, st_cycle, &keys, &from, pos))
+      {
+        return "Out of memory.";
+      }
+    }
+    else if (events & (pe_clock_high | pe_clock_low))
+    {
+      if (program_add(prog, &panel, events & pe_clock_high ? st_high : st_low,
+                      &keys, &from, pos))
+      {
+        return "Out of memory.";
+      }
+    }
+    else if (events & pe_break)
+    {
+      if (program_add(prog, &panel, st_break, &keys, &from, pos))
+      {
+        return "Out of memory.";
+      }
+    }
+    else
+    {
+      continue;
+    }
+    from = panel;
+  }
+
+  /* Finish with the switches as the file leaves them. */
+  if (program_add(prog, &panel, st_set, &keys, &from, pos))
+  {
+    return "Out of memory.";
+  }
+  return NULL;
+}
+
+/* Compile an input file, which must be open for reading from the start.
+   Returns NULL on success or an error message. */
+static inline const char *program_load(program *prog, FILE *in_file)
+{
+  int ch;
+  char buff[80];
+  unsigned i;
+  size_t max_len = 0;
+  char *grown;
+  panel_state panel;
+
+  prog->delay = 1;
+  prog->init = 0;
+  prog->quit = 0;
+  prog->text = NULL;
+  prog->text_len = 0;
+  prog->num_steps = 0;
+  prog->max_steps = 0;
+  prog->steps = NULL;
+  prog->sources = NULL;
+
+  /* Read the first line to get the delay time. */
+  if (fgets(buff, sizeof(buff), in_file) == NULL)
+  {
+    return "Error reading delay time.";
+  }
+  prog->delay = (unsigned)strtol(buff, NULL, 10);
+
+  /* The second line has the power-on values, then the rest of the line is
+     ignored. */
+  for (i = 0; i < num_power_init; ++i)
+  {
+    ch = program_getc(in_file);
+    prog->init |= (unsigned)(ch != EOF && (ch & 1)) << i;
+  }
+  do
+  {
+    ch = program_getc(in_file);
+  }
+  while (ch != '\n' && ch != EOF);
+
+  /* Keep the keystrokes, up to and including any quit. */
+  while (!prog->quit && (ch = program_getc(in_file)) != EOF)
+  {
+    if (prog->text_len == max_len)
+    {
+      /* Step sources count keystrokes in 32 bits. */
+      if (max_len > 0x7fffffffu)
+      {
+        return "Input file is too long.";
+      }
+      max_len = max_len ? max_len * 2 : 4096;
+      grown = (char *)realloc(prog->text, max_len);
+      if (grown == NULL)
+      {
+        return "Out of memory.";
+      }
+      prog->text = grown;
+    }
+    prog->text[prog->text_len++] = (char)ch;
+    prog->quit = ch == 'q' || ch == 'Q';
+  }
+  if (ferror(in_file))
+  {
+    return "Error reading input file.";
+  }
+
+  /* The keystrokes do not depend on the CPU, so any power-on state will do
+     for working out the switches. */
+  panel_power_on(&panel, 0);
+  return program_compile(prog, 0, &panel);
+}
+
+/* Carry on from step s of the program (pos keystrokes in, and half way
+   through a 'k' if in_cycle) with the given panel. The steps were compiled
+   for the switches, cursor and clock the file itself left; if the panel is
+   no longer like that (they were changed at a breakpoint), the rest of the
+   file is compiled again from the panel as it is, so that it acts on it as
+   its keystrokes would have. The new steps are added after the old ones,
+   which are left as they were, and *first is set to the first of them (or
+   to s if nothing had changed). Returns NULL on success or an error
+   message. */
+static inline const char *program_resume(program *prog, size_t s, size_t pos,
+                                         unsigned in_cycle,
+                                         const panel_state *panel,
+                                         size_t *first)
+{
+  unsigned keys = 0;
+  program_step step = prog->steps[s];
+  program_source source = prog->sources[s];
+  panel_state from = *panel;
+
+  /* Half way through a 'k', the rising edge has been run. */
+  if (in_cycle)
+  {
+    source.inst = step.inst;
+    source.control = step.control;
+    source.clock = 1;
+  }
+  *first = s;
+  if (source.inst == program_inst(panel) &&
+      source.control == panel->control &&
+      source.clock == panel->control_states[c_clk])
+  {
+    return NULL;
+  }
+  *first = prog->num_steps;
+
+  /* What is left of a 'k' already begun (the falling edge, or from high the
+     rising edge) is just the clock edge, on the switches as they are. */
+  if (in_cycle || (step.keys == 0 && step.type != st_set))
+  {
+    step.type = in_cycle ? st_low : step.type;
+    if (program_add(prog, panel, (step_type)step.type, &keys, panel,
+                    source.end))
+    {
+      return "Out of memory.";
+    }
+    from.control_states[c_clk] = step.type == st_high;
+    pos = source.end;
+  }
+  return program_compile(prog, pos, &from);
+}
+
+/* Set the clock to the given level, clocking the CPU if it changes. */
+static inline unsigned panel_clock_with(panel_state *panel, unsigned level,
+                                        clock_high_fn clock_high)
+{
+  return panel->control_states[c_clk] != level ?
+         panel_toggle_clock_with(panel, clock_high) : 0;
+}
+
+static inline unsigned panel_clock(panel_state *panel, unsigned level)
+{
+  return panel_clock_with(panel, level, cpu_clock_high);
+}
+
+/* Run one step of a compiled program, with the given rising edge. Returns
+   the panel_event bits for what happened, as panel_key() would have for the
+   keystrokes. */
+static inline unsigned program_step_run_with(panel_state *panel,
+                                             const program_step *step,
+                                             clock_high_fn clock_high)
+{
+  unsigned i;
+  unsigned events = 0;
+
+  /* Set the switches. */
+  for (i = c_i3; i <= c_i0; ++i)
+  {
+    if (panel->control_states[i] != ((step->inst >> (c_i0 - i)) & 1u))
+    {
+      panel->control_states[i] ^= 1;
+      events |= pe_control;
+    }
+  }
+  if (panel->control_states[c_d] != (step->inst >> 4))
+  {
+    panel->control_states[c_d] ^= 1;
+    panel->data_line = panel->control_states[c_d];
+    events |= pe_control;
+  }
+  if (panel->control != step->control)
+  {
+    panel->control = (controls)step->control;
+    events |= pe_select;
+  }
+
+  /* Then the clock. */
+  switch (step->type)
+  {
+    case st_high:
+      events |= panel_clock_with(panel, 1, clock_high);
+      break;
+
+    case st_low:
+      events |= panel_clock_with(panel, 0, clock_high);
+      break;
+
+    case st_cycle:
+      events |= panel_clock_with(panel, 0, clock_high);
+      events |= panel_clock_with(panel, 1, clock_high);
+      events |= panel_clock_with(panel, 0, clock_high);
+      break;
+
+    case st_break:
+      events |= pe_break;
+      break;
+
+    default:
+      break;
+  }
+
+  return events;
+}
+
+static inline unsigned program_step_run(panel_state *panel,
+                                        const program_step *step)
+{
+  return program_step_run_with(panel, step, cpu_clock_high);
+}
+
+#endif
@@ -5,24 +5,25 @@
    The code is very basic. The only requirement is a curses library (and the
    standard C library. On Linux and Mac, ncurses is used; on Windows pdcurses
    is used. To build, you really just need to compile this file and link to the
-   cursees library. Build and run instructions (there are many ways - use these
-   as a guide):
+   cursees library. The CPU itself lives in ue14500-core.h, which must be in
+   the same directory but is simply included. Build and run instructions (there
+   are many ways - use these as a guide):
 
    Linux:
      - Ensure GCC is installed.
      - Ensure the ncurses development package (ncurses-dev) is installed.
-     - gcc -o ue14500-emu ue14500-emu.c -lncurses
+     - gcc -O2 -o ue14500-emu ue14500-emu.c -lncurses -lpthread
      - ./ue14500-emu
 
    Mac:
      - Ensure Xcode is installed.
-     - clang -o ue14500-emu ue14500-emu.c -lncurses
+     - clang -O2 -o ue14500-emu ue14500-emu.c -lncurses -lpthread
      - ./ue14500-emu
 
    Windows:
      - Install MSYS2 (https://www.msys2.org) including the base dev package.
      - Install pdcurses (pacman -S mingw-w64-x86_64-pdcurses).
-     - gcc -o ue14500-emu ue14500-emu.c -lpdcurses
+     - gcc -O2 -o ue14500-emu ue14500-emu.c -lpdcurses -lpthread
      - ./ue14500-emu.exe
 
    After starting, the STATUS window will guide you through the initialization
@@ -41,8 +42,21 @@
      c/C = select clock input.
      k/K = equivalent to "c  " in a single cycle.
      b/B = trigger/resume a breakpoint.
+     p = go back one step (a clock edge or a step of the input file).
+     P = go back to the given clock (type the number and press enter).
+
+   Going back puts the machine, the input file position and the output file
+   exactly as they were at that point. With the output on stdout, which
+   cannot be taken back, p and P do nothing. If that point is in the input
+   file, it is paused as at a breakpoint; B carries on from there. Only the
+   last --history steps can be gone back to. The --trace and --vcd files are
+   not taken back: they keep every edge in the order it was run, so their
+   clocks (and --vcd-window) count the rising edges recorded, which from
+   then on are ahead of the machine's clock.
 
    Command line:
+     ue14500-emu [OPTIONS] [INFILE] [OUTFILE]
+
      - If no arguments are given, interactive mode is entered. See above.
      - If one argument is given, it is the input file. If the first argument
        is "-", that is equivalent to no input file - this is used when you want
@@ -50,6 +64,109 @@
      - If two arguments are given, the first is the input file and the second
        is the output file. If the second argument is "-", the output is sent
        to stdout. See below.
+     - Options come before the files. The options are:
+         --headless = run the input file to completion as fast as possible
+                      without curses, so no terminal is needed. The delay on
+                      the first line is ignored, breakpoints are ignored, and
+                      the run ends when the input file does (an input file is
+                      required).
+         --sweep = run the input file under every one of the 1024 power-on
+                   states at once (the initialization line is ignored) using
+                   all CPU cores, and report each state whose output bitstream
+                   differs from that of the majority of states, with the first
+                   clock at which its write line or written bit differs. No
+                   output file is used. Add -mavx2 or -march=native to the
+                   build to sweep 256 or 512 states per host instruction.
+         --hz N = run the input file's clock at N Hz (N may be a fraction),
+                  however many keystrokes each clock takes, instead of pacing
+                  the keystrokes by the delay on the first line. Rising edges
+                  are 1/N seconds apart with the falling edges half way
+                  between. Falling behind (a slow terminal, say) is caught up
+                  by running the late edges back to back. The timing jitter
+                  is reported on stderr at the end. Also works with
+                  --headless.
+         --table = run the clock edges of the input file (and of going
+                   back) by lookup in the generated tables of
+                   ue14500-table.h instead of the core's switch. Same
+                   results, fewer branches. Keys typed are still run by
+                   the switch; they come far too slowly to matter.
+         --fps N = redraw the screen at most N times a second (default 30,
+                   0 for no limit). Only what changed since the last frame is
+                   drawn, so fast clocks still get a live display.
+         --baud N = for a real serial terminal (an ADDS on the Centurion,
+                    say) at N baud: a compact layout with just the CPU's
+                    VFDs in a row above the remote and no attributes on
+                    the VFDs, and the screen is only drawn as fast as the
+                    line can carry it. Changes that come faster are shown
+                    together in the next frame; the clock never waits.
+         --snapshot FILE = save the whole machine state to FILE when the
+                           run ends (see ue14500-snap.h for the format).
+         --snapshot-every N = also save it every N clocks, so a long run
+                              can be carried on after an interruption. The
+                              file is replaced atomically, so it is always
+                              a complete snapshot. Uses the --restore file
+                              if there is no --snapshot.
+         --history N = keep the last N steps (at least) for going back
+                       (default 1048576, two bytes each; 0 for none).
+         --checkpoint-every N = save the whole state every N steps of the
+                                history (default 4096). Going back runs up
+                                to N steps again from the last checkpoint.
+         --trace FILE = record every clock edge in FILE: the switches,
+                        the registers and the output lines, two bytes an
+                        edge before compression (see ue14500-trace.h for
+                        the format, and ue14500-trace.c to read it).
+         --vcd FILE = write the chip's signals to FILE as a VCD waveform
+                      (for GTKWave, say), edges half a period apart at the
+                      --hz rate or else 1000 Hz (see ue14500-vcd.h).
+         --vcd-signals LIST = only write the given signals, a comma-
+                              separated list of clk, i0, i1, i2, i3, data,
+                              rr, carry, ien, oen, skip, write, flg0, flgf,
+                              jmp and rtn (default all).
+         --vcd-window FROM:TO = only write clocks FROM to TO (either may
+                                be left out for the start or the end).
+         --break COND = stop when COND becomes true, for example
+                        "skip && rr == 0", "byte == 0x21" or
+                        "clock >= 5000" (see ue14500-break.h for what a
+                        condition can use). May be given more than once.
+         --watch LIST = stop when any of the comma-separated list of
+                        registers or lines (rr, carry, ien, oen, skip,
+                        write, ...) changes.
+         --stats FILE = write the run's counters to FILE at the end: the
+                        clocks, the instructions run and skipped, the
+                        write pulses and bytes, and the clock rate (see
+                        ue14500-stats.h). JSON if FILE ends in .json, else
+                        CSV; "-" is stderr. The clocks and rate are also
+                        shown under the STATUS window as it runs.
+         --shm NAME = keep the live machine state (VFDs, switches,
+                      registers, clocks) in /dev/shm/NAME (/tmp/NAME on
+                      macOS, or NAME if it has a '/') for other programs
+                      to watch, ue14500-shm say, without slowing the run
+                      (see ue14500-shm.h).
+                      The last state is left there at the end.
+         --record FILE = record every key the machine takes (power-on
+                         and panel keys, going back) with its clock and
+                         when it was typed, and the final state, in FILE
+                         (see ue14500-session.h).
+         --replay FILE = run the keys recorded in FILE again, as typed
+                         (any key skips the wait for the next one) or at
+                         once with --headless, which then needs no input
+                         file. The input file and any --restore must be
+                         the ones it was recorded with. The run stops if
+                         it goes a different way from the recording, and
+                         the final state is checked against the recorded
+                         one; either way, a mismatch exits with status 1.
+         --restore FILE = start from the snapshot in FILE instead of the
+                          power-on prompts, carrying on the input file from
+                          where the snapshot was taken. The input file must
+                          be the same one. The output file is cut back to
+                          what had been written at the snapshot and added
+                          to from there.
+
+   The machine runs on a thread of its own. The screen is drawn by another
+   thread from the latest state the machine has published, and keys are read
+   by a third and queued for the machine (see ue14500-threads.h), so a slow
+   terminal (over SSH or a serial line, say) only makes the screen lag; it
+   never slows the machine down.
 
    Input File: If an input file is given, inputs are read from that file until
    the file is exhausted or an error occurs. After input file exhaustion,
@@ -62,7 +179,8 @@
    file in pure little-endian format. This means each bit is formed into bytes
    from least-to-most significant and written out when each bit has been set.
    If an incomplete byte is left at the end, it is written with zeros for the
-   upper bits.
+   upper bits. The file is written by a thread of its own (see
+   ue14500-writer.h), so it is only complete once the emulator exits.
 
    Input File Format: The first line of the file must be a decimal integer that
    specifies the time to wait between key strokes in milliseconds (must be
@@ -83,6 +201,13 @@
    debugging. When a breakpoint is hit, the emulator stops reading from the
    input file and enters interactive mode until the breakpoint command is
    received again, at which point the emulator resumes reading the input file.
+   Whatever was done to the switches at the breakpoint is kept: the rest of
+   the input file carries on from them, as its keystrokes would have.
+
+   --break and --watch stop the input file in the same way when their
+   condition is met (headless, the run ends there, with a snapshot if one is
+   asked for). They are checked after every clock edge, but only when there
+   are any: without them the input file runs with no checks at all.
 */
 
 #ifdef WIN32
@@ -90,112 +215,180 @@
 #else
 #  include <curses.h>
 #endif
+#include <pthread.h>
 #include <stdlib.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+/* Only table_clock_high() is used from ue14500-table.h. */
+#define TABLE_NO_PAIR
+
+#include "ue14500-core.h"
+#include "ue14500-break.h"
+#include "ue14500-history.h"
+#include "ue14500-sched.h"
+#include "ue14500-session.h"
+#include "ue14500-shm.h"
+#include "ue14500-slice.h"
+#include "ue14500-snap.h"
+#include "ue14500-stats.h"
+#include "ue14500-table.h"
+#include "ue14500-threads.h"
+#include "ue14500-trace.h"
+#include "ue14500-vcd.h"
+#include "ue14500-writer.h"
 
 /* Screen size. */
 #define SCREEN_Y 24
 #define SCREEN_X 80
 
-/* Controls. */
-typedef enum controls_
-{
-  c_i3,
-  c_i2,
-  c_i1,
-  c_i0,
-  c_d,
-  c_clk,
-
-  num_controls
-} controls;
-
-/* Instructions. */
-typedef enum instruction_
-{
-  i_nop0, /* 0000: NOP0 = No change in registers. RR -> RR. FLG0 high. */
-  i_ld,   /* 0001: LD   = Load result register. Data -> RR. */
-  i_add,  /* 0010: ADD  = Addition. D + RR -> RR. */
-  i_sub,  /* 0011: SUB  = Subtraction. QD + RR -> RR. */
-  i_one,  /* 0100: ONE  = Force one. 1 -> RR. 0 -> CAR. */
-  i_nand, /* 0101: NAND = Logical NAND. Q(RR * D) -> RR. */
-  i_or,   /* 0110: OR   = Logical OR. RR + D -> RR. */
-  i_xor,  /* 0111: XOR  = Exclusive OR. RR != D -> RR. */
-  i_sto,  /* 1000: STO  = Store. RR -> Data. Write high if OEN. */
-  i_stoc, /* 1001: STOC = Store complement. QRR -> Data. Write high if OEN. */
-  i_ien,  /* 1010: IEN  = Input enable. D -> IEN. */
-  i_oen,  /* 1011: OEN  = Output enable. D -> OEN. */
-  i_jmp,  /* 1100: JMP  = Jump. Jump high. */
-  i_rtn,  /* 1101: RTN  = Return. RTN high. 1 -> Skip. */
-  i_skz,  /* 1110: SKZ  = Skip if zero. 1 -> Skip if RR == 0. */
-  i_nopf  /* 1111: NOPF = No change in registers. RR -> RR. FLGF high. */
-} instruction;
-static const char *instructions[] =
-{
-  "NOP0",
-  "LD",
-  "ADD",
-  "SUB",
-  "ONE",
-  "NAND",
-  "OR",
-  "XOR",
-  "STO",
-  "STOC",
-  "IEN",
-  "OEN",
-  "JMP",
-  "RTN",
-  "SKZ",
-  "NOPF"
-};
+/* How often the clock rate under the STATUS window is worked out (ns). */
+#define HUD_INTERVAL 250000000ull
+
+/* How often the input thread looks for a key when there is none, and how
+   often the render thread looks for a new frame with no frame rate cap
+   (ns). */
+#define INPUT_POLL 10000000ull
+#define RENDER_POLL 1000000ull
+
+/* Rough bytes a terminal needs to move to an item drawn on its own and set
+   its attributes, for the --baud byte budget, and the most line time (ns)
+   the budget saves up while nothing changes. */
+#define MOVE_BYTES 6
+#define BAUD_BURST 100000000ull
+
+/* Default history size and checkpoint interval (steps). */
+#define HISTORY_STEPS 1048576
+#define HISTORY_INTERVAL 4096
 
 /* Structure to hold the state of the machine. */
 typedef struct machine_state_
 {
-  /* The screen. */
+  /* The screen, the window keys are read through (never drawn on), and the
+     lock held for every curses call once the input thread is running. */
   WINDOW *screen;
-
-  /* The currently-selected control and the state of that control. */
-  controls control;
-  unsigned control_states[num_controls];
-
-  /* Instruction register. */
-  instruction ir;
-
-  /* Input/output enable registers. */
-  unsigned ien;
-  unsigned oen;
-
-  /* Result/carry registers. */
-  unsigned rr;
-  unsigned cr;
-
-  /* Skip register. */
-  unsigned skip;
-
-  /* Input file or NULL for interactive. */
-  FILE *in_file;
-  unsigned delay;
-
-  /* Output file or NULL for none. */
+  WINDOW *input;
+  pthread_mutex_t curses_lock;
+
+  /* Keys from the input thread, frames for the render thread, the threads
+     and when they should stop. */
+  key_queue keys;
+  frame_pub frame;
+  pthread_t input_thread;
+  pthread_t render_thread;
+  atomic_int stop_input;
+  atomic_int stop_render;
+
+  /* Front panel controls and the CPU. */
+  panel_state panel;
+
+  /* Compiled input file, the next step to run, the keystrokes of the file
+     used so far, and whether the program is still running (otherwise input
+     is interactive). */
+  program prog;
+  size_t step;
+  size_t pos;
+  unsigned scripted;
+
+  /* Clock scheduler for --hz, and whether the rising edge of a 'k' step has
+     been run but not the falling edge. */
+  unsigned paced;
+  sched_state sched;
+  unsigned in_cycle;
+
+  /* Output file or NULL for none, its writer, and the byte being filled. */
   FILE *out_file;
+  out_writer writer;
   unsigned curr_byte;
   unsigned bits_set;
 
   /* Breakpoint mode. */
   unsigned in_break;
 
+  /* Clocks so far and whole bytes written, for snapshots. */
+  unsigned long long clocks;
+  unsigned long long out_bytes;
+
+  /* Snapshot file to save (NULL for none), every how many clocks (0 for
+     just at the end), whether one is due, and whether the state was
+     restored from one. */
+  const char *snap_name;
+  unsigned long long snap_every;
+  unsigned snap_due;
+  unsigned restored;
+
+  /* Trace file (NULL for none) and its writer, the same for a VCD file. */
+  FILE *trace_file;
+  trace_writer trace;
+  FILE *vcd_file;
+  vcd_writer vcd;
+
+  /* Conditional breakpoints, and the first to go off in this step (0 for
+     none). */
+  break_set breaks;
+  unsigned break_hit;
+
+  /* Whether a file is recorded or there are breakpoints, so each clock
+     edge must be seen. */
+  unsigned per_edge;
+
+  /* Whether steps are run by table lookup (--table). */
+  unsigned table;
+
+  /* Counters, the file to report them to (NULL for none), and when the run
+     started (ns). Also the clocks shown under the STATUS window, and the
+     clocks, time and rate when the rate was last worked out. */
+  run_stats stats;
+  const char *stats_name;
+  unsigned long long run_start;
+  unsigned long long shown_clocks;
+  unsigned long long hud_clocks;
+  unsigned long long hud_time;
+  double hud_hz;
+
+  /* Shared front panel for other programs to watch (NULL for none). */
+  shm_panel *shm;
+
+  /* Keys recorded with --record and replayed from --replay (each only if
+     the flag is set), when the session started (ns), and why a replay
+     went a different way from its recording. */
+  session_writer rec;
+  unsigned recording;
+  session_reader play;
+  unsigned replaying;
+  unsigned long long session_start;
+  char diverged[96];
+
+  /* History for going back, whether the next step must start a new block
+     of it, and a status message (a clock number, say). */
+  history hist;
+  unsigned new_block;
+  char message[26];
+
+  /* Status to show, what is currently drawn (display_item bits, cursor and
+     status, only used by the render thread once it runs) and the frame rate
+     cap (0 for none). */
+  const char *status;
+  unsigned shown_items;
+  controls shown_control;
+  char shown_status[26];
+  unsigned fps;
+
+  /* Serial terminal speed for --baud (0 for none, which also means the full
+     layout), and the bytes the render thread may still send (negative when
+     it is over budget). */
+  unsigned baud;
+  double baud_bytes;
+
+  /* Headless mode (no curses) and power-on sweep mode. */
+  unsigned headless;
+  unsigned sweep;
+
   /* Error message or NULL for none. */
   const char *error;
 } machine_state;
 
-/* Return the instruction for the given state. */
-#define GET_INSTR(state)                              \
-  (((state)->control_states[c_i0] ? i_ld : i_nop0) |  \
-   ((state)->control_states[c_i1] ? i_add : i_nop0) | \
-   ((state)->control_states[c_i2] ? i_one : i_nop0) | \
-   ((state)->control_states[c_i3] ? i_sto : i_nop0))
-
 /* Helper functions. */
 static int init_args(machine_state *state, int argc, char **argv);
 static int uninit(machine_state *state);
@@ -203,15 +396,47 @@ static void draw_cpu(machine_state *state);
 static void draw_remote(machine_state *state);
 static void draw_status(machine_state *state);
 static void draw_help(machine_state *state);
+static void draw_compact(machine_state *state);
+static void draw_vfd(machine_state *state, int y, int x, unsigned on);
 static void power_on(machine_state *state);
 static void main_loop(machine_state *state);
-static void clock_high(machine_state *state);
-static void clock_low(machine_state *state);
-static void select_control(machine_state *state, controls ctrl);
-static void toggle_control(machine_state *state);
-static void toggle_clock(machine_state *state);
-static int get_input(machine_state *state);
+static void headless_loop(machine_state *state);
+static int sweep(machine_state *state);
+static unsigned display_items(const panel_state *panel);
+static unsigned render(machine_state *state, const panel_frame *frame);
+static void take_frame(const machine_state *state, panel_frame *frame);
+static void publish(machine_state *state);
+static void *render_thread(void *arg);
+static void *input_thread(void *arg);
+static unsigned run_step(const machine_state *state, panel_state *panel,
+                         const program_step *step);
+static unsigned script_step(machine_state *state);
+static void resume_file(machine_state *state);
+static void script_delay(machine_state *state, unsigned keys);
 static void write_data(machine_state *state, unsigned bit);
+static int restore(machine_state *state, const char *snap_name);
+static FILE *open_output(machine_state *state, const char *out_name);
+static void step_done(machine_state *state, unsigned events);
+static void take_snapshot(const machine_state *state, snapshot *snap);
+static void save_snapshot(machine_state *state);
+static void history_log(machine_state *state, const panel_state *before,
+                        unsigned in_cycle, const unsigned short *entries,
+                        unsigned num_entries);
+static void go_back(machine_state *state, size_t block, size_t used);
+static void step_back(machine_state *state);
+static void clock_back(machine_state *state);
+static void trim_output(machine_state *state);
+static void record_edge(machine_state *state, unsigned inst,
+                        const cpu_state *cpu, unsigned clk);
+static void record_edges(machine_state *state, const panel_state *before,
+                         unsigned events);
+static void sync_breaks(machine_state *state);
+static void draw_hud(machine_state *state, unsigned long long clocks);
+static void report_stats(machine_state *state);
+static void share_panel(machine_state *state, unsigned flags);
+static int next_key(machine_state *state);
+static void end_session(machine_state *state);
+static unsigned break_stop(machine_state *state);
 
 int main(int argc, char **argv)
 {
@@ -220,6 +445,9 @@ int main(int argc, char **argv)
   int delay;
   machine_state state = { 0 };
 
+  /* Default frame rate cap. */
+  state.fps = 30;
+
   /* Initialize arguments. */
   delay = init_args(&state, argc, argv);
   if (delay == 0)
@@ -227,6 +455,38 @@ int main(int argc, char **argv)
     return 1;
   }
 
+  /* Sweep and headless modes never touch curses. */
+  if (state.sweep)
+  {
+    delay = sweep(&state);
+    uninit(&state);
+    return delay;
+  }
+  if (state.headless)
+  {
+    headless_loop(&state);
+    end_session(&state);
+    if (state.snap_name != NULL && state.error == NULL)
+    {
+      save_snapshot(&state);
+    }
+    if (state.paced)
+    {
+      sched_report(&state.sched, stderr);
+    }
+    if (state.stats_name != NULL)
+    {
+      report_stats(&state);
+    }
+    if (state.error != NULL)
+    {
+      fprintf(stderr, "%s\n", state.error);
+      uninit(&state);
+      return 1;
+    }
+    return uninit(&state);
+  }
+
   /* Initialize curses. Make sure the screen is big enough. This emulator is
      written to fit a standard physical TTY only. */
   state.screen = initscr();
@@ -241,43 +501,101 @@ int main(int argc, char **argv)
   /* Turn off echo. */
   noecho();
 
-  /* Enable keypad to get function key support. */
-  keypad(stdscr, TRUE);
-
   /* Disable newline translation. */
   nonl();
 
   /* Make the cursor invisible. */
   curs_set(0);
 
-  /* Enable unbuffered character input if no input file. */
-  if (state.in_file == NULL)
+  /* Enable unbuffered character input. Keys are read by the input thread
+     through a window of their own with function key support, which is
+     never drawn on, so reading never refreshes the screen. Drawing must not
+     look at the input either (typeahead). */
+  cbreak();
+  typeahead(-1);
+  state.input = newwin(1, 1, 0, 0);
+  keypad(state.input, TRUE);
+  nodelay(state.input, TRUE);
+
+  /* Draw the CPU (just its VFDs for a serial terminal), remote, and
+     status. */
+  if (state.baud)
   {
-    cbreak();
+    draw_compact(&state);
   }
   else
   {
-    /* Set the timeout with the delay time. */
-    wtimeout(state.screen, delay);
+    draw_cpu(&state);
   }
-
-  /* Draw the CPU, remote, and status. */
-  draw_cpu(&state);
   draw_remote(&state);
   draw_status(&state);
+  wrefresh(state.screen);
+
+  /* Curses is not thread-safe, so from here on every call to it is made
+     holding curses_lock. The input window starts out touched, and reading
+     would draw it (blank) over the top left corner. */
+  untouchwin(state.input);
+  pthread_mutex_init(&state.curses_lock, NULL);
+  if (key_queue_init(&state.keys) ||
+      pthread_create(&state.input_thread, NULL, input_thread, &state) != 0)
+  {
+    endwin();
+    puts("Error starting the input thread.");
+    return 1;
+  }
 
   /* Power on, then display help. */
+  state.session_start = sched_now();
   power_on(&state);
+  pthread_mutex_lock(&state.curses_lock);
   draw_help(&state);
-
-  /* Refresh. */
   wrefresh(state.screen);
+  pthread_mutex_unlock(&state.curses_lock);
+
+  /* From here on only the render thread draws, and this thread runs the
+     machine. */
+  publish(&state);
+  if (pthread_create(&state.render_thread, NULL, render_thread,
+                     &state) != 0)
+  {
+    state.error = "Error starting the render thread.";
+  }
+  else
+  {
+    main_loop(&state);
 
-  /* Loop to handle input. */
-  main_loop(&state);
+    /* Show the final state before stopping. */
+    publish(&state);
+    atomic_store(&state.stop_render, 1);
+    pthread_join(state.render_thread, NULL);
+  }
+  atomic_store(&state.stop_input, 1);
+  pthread_join(state.input_thread, NULL);
+  key_queue_free(&state.keys);
 
   /* End curses mode, restoring the terminal. */
+  pthread_mutex_destroy(&state.curses_lock);
+  delwin(state.input);
   endwin();
+  end_session(&state);
+  if (state.snap_name != NULL && state.error == NULL)
+  {
+    save_snapshot(&state);
+  }
+  if (state.paced)
+  {
+    sched_report(&state.sched, stderr);
+  }
+  if (state.stats_name != NULL)
+  {
+    report_stats(&state);
+  }
+  if (state.error != NULL)
+  {
+    fprintf(stderr, "%s\n", state.error);
+    uninit(&state);
+    return 1;
+  }
 
   /* Uninitialize. */
   return uninit(&state);
@@ -285,78 +603,412 @@ int main(int argc, char **argv)
 
 static int init_args(machine_state *state, int argc, char **argv)
 {
-  char buff[80];
+  FILE *in_file;
+  const char *error;
+  const char *snap_name = NULL;
+  const char *vcd_name = NULL;
+  const char *record_name = NULL;
+  const char *replay_name = NULL;
+  const char *window;
+  const char *list;
+  char watch[BREAK_TEXT];
+  size_t len;
+  char *end;
+  unsigned vcd_signals = VCD_ALL;
+  unsigned long long vcd_from = 0;
+  unsigned long long vcd_to = 0;
+  unsigned long long half_period = 500000;
+  size_t history_steps = HISTORY_STEPS;
+  size_t history_interval = HISTORY_INTERVAL;
   int delay = 1;
+  int i;
+
+  /* Options come first. */
+  for (i = 1; i < argc && strncmp(argv[i], "--", 2) == 0; ++i)
+  {
+    if (strcmp(argv[i], "--headless") == 0)
+    {
+      state->headless = 1;
+    }
+    else if (strcmp(argv[i], "--sweep") == 0)
+    {
+      state->sweep = 1;
+    }
+    else if (strcmp(argv[i], "--table") == 0)
+    {
+      state->table = 1;
+    }
+    else if (strcmp(argv[i], "--fps") == 0 && i + 1 < argc)
+    {
+      state->fps = (unsigned)strtol(argv[++i], NULL, 10);
+    }
+    else if (strcmp(argv[i], "--baud") == 0 && i + 1 < argc)
+    {
+      state->baud = (unsigned)strtol(argv[++i], NULL, 10);
+      if (state->baud == 0)
+      {
+        fputs("The --baud rate must be greater than zero.\n", stderr);
+        return 0;
+      }
+    }
+    else if (strcmp(argv[i], "--hz") == 0 && i + 1 < argc)
+    {
+      state->paced = 1;
+      state->sched.hz = strtod(argv[++i], NULL);
+      if (!(state->sched.hz > 0))
+      {
+        fputs("The --hz frequency must be greater than zero.\n", stderr);
+        return 0;
+      }
+    }
+    else if (strcmp(argv[i], "--snapshot") == 0 && i + 1 < argc)
+    {
+      state->snap_name = argv[++i];
+    }
+    else if (strcmp(argv[i], "--snapshot-every") == 0 && i + 1 < argc)
+    {
+      state->snap_every = strtoull(argv[++i], NULL, 10);
+      if (state->snap_every == 0)
+      {
+        fputs("The --snapshot-every count must be greater than zero.\n",
+              stderr);
+        return 0;
+      }
+    }
+    else if (strcmp(argv[i], "--restore") == 0 && i + 1 < argc)
+    {
+      snap_name = argv[++i];
+    }
+    else if (strcmp(argv[i], "--trace") == 0 && i + 1 < argc)
+    {
+      state->trace_file = fopen(argv[++i], "wb");
+      if (state->trace_file == NULL ||
+          trace_open(&state->trace, state->trace_file))
+      {
+        fputs("Error opening trace file.\n", stderr);
+        return 0;
+      }
+    }
+    else if (strcmp(argv[i], "--vcd") == 0 && i + 1 < argc)
+    {
+      vcd_name = argv[++i];
+    }
+    else if (strcmp(argv[i], "--vcd-signals") == 0 && i + 1 < argc)
+    {
+      vcd_signals = vcd_parse_signals(argv[++i]);
+      if (vcd_signals == 0)
+      {
+        fputs("The --vcd-signals list has an unknown signal.\n", stderr);
+        return 0;
+      }
+    }
+    else if (strcmp(argv[i], "--vcd-window") == 0 && i + 1 < argc)
+    {
+      window = argv[++i];
+      vcd_from = strtoull(window, &end, 10);
+      if (*end != ':' || (end[1] != '\0' &&
+                          (vcd_to = strtoull(end + 1, NULL, 10)) < vcd_from))
+      {
+        fputs("The --vcd-window must be FROM:TO with FROM no more than "
+              "TO.\n", stderr);
+        return 0;
+      }
+    }
+    else if (strcmp(argv[i], "--break") == 0 && i + 1 < argc)
+    {
+      error = break_add(&state->breaks, argv[++i]);
+      if (error != NULL)
+      {
+        fprintf(stderr, "%s\n", error);
+        return 0;
+      }
+    }
+    else if (strcmp(argv[i], "--watch") == 0 && i + 1 < argc)
+    {
+      /* Each one is a breakpoint on it changing. */
+      for (list = argv[++i]; *list != '\0'; list += *list == ',')
+      {
+        len = strcspn(list, ",");
+        if (len > 16)
+        {
+          len = 16;
+        }
+        sprintf(watch, "changed(%.*s)", (int)len, list);
+        list += strcspn(list, ",");
+        error = break_add(&state->breaks, watch);
+        if (error != NULL)
+        {
+          fprintf(stderr, "%s\n", error);
+          return 0;
+        }
+      }
+    }
+    else if (strcmp(argv[i], "--stats") == 0 && i + 1 < argc)
+    {
+      state->stats_name = argv[++i];
+    }
+    else if (strcmp(argv[i], "--record") == 0 && i + 1 < argc)
+    {
+      record_name = argv[++i];
+    }
+    else if (strcmp(argv[i], "--replay") == 0 && i + 1 < argc)
+    {
+      replay_name = argv[++i];
+    }
+    else if (strcmp(argv[i], "--shm") == 0 && i + 1 < argc)
+    {
+      state->shm = shm_create(argv[++i]);
+      if (state->shm == NULL)
+      {
+        fputs("Error creating the shared panel file.\n", stderr);
+        return 0;
+      }
+    }
+    else if (strcmp(argv[i], "--history") == 0 && i + 1 < argc)
+    {
+      history_steps = (size_t)strtoull(argv[++i], NULL, 10);
+    }
+    else if (strcmp(argv[i], "--checkpoint-every") == 0 && i + 1 < argc)
+    {
+      history_interval = (size_t)strtoull(argv[++i], NULL, 10);
+      if (history_interval == 0)
+      {
+        fputs("The --checkpoint-every count must be greater than zero.\n",
+              stderr);
+        return 0;
+      }
+    }
+    else
+    {
+      fprintf(stderr, "Unknown option: %s\n", argv[i]);
+      return 0;
+    }
+  }
 
-  /* If there is an argument, it is the input file. */
-  if (argc > 1)
+  /* If there is an argument, it is the input file. "-" means none. */
+  if (i < argc && strcmp(argv[i], "-") != 0)
   {
     /* Open the file for read. */
-    state->in_file = fopen(argv[1], "rb");
-    if (state->in_file == NULL)
+    in_file = fopen(argv[i], "rb");
+    if (in_file == NULL)
     {
       fputs("Error opening input file.\n", stderr);
       return 0;
     }
 
-    /* Read the first line to get the delay time. */
-    if (fgets(buff, sizeof(buff), state->in_file) == NULL)
+    /* Compile the whole file up front; it is not needed after that. */
+    error = program_load(&state->prog, in_file);
+    fclose(in_file);
+    if (error != NULL)
     {
-      fputs("Error reading delay time.\n", stderr);
+      fprintf(stderr, "%s\n", error);
       return 0;
     }
-    delay = (int)strtol(buff, NULL, 10);
+    state->scripted = 1;
+    delay = (int)state->prog.delay;
+  }
+  ++i;
+
+  /* Carry on from a snapshot if asked to. */
+  if (state->snap_every != 0 && state->snap_name == NULL)
+  {
+    state->snap_name = snap_name;
+  }
+  if (state->snap_every != 0 && state->snap_name == NULL)
+  {
+    fputs("The --snapshot-every option needs --snapshot or --restore.\n",
+          stderr);
+    return 0;
+  }
+  if (snap_name != NULL && !restore(state, snap_name))
+  {
+    return 0;
   }
 
-  /* If there is another argument, it is the output file. */
-  if (argc > 2)
+  /* If there is another argument, it is the output file. "-" is stdout. */
+  if (i < argc)
   {
-    /* Open the file for write. */
-    state->out_file = fopen(argv[2], "wb");
+    state->out_file = open_output(state, argv[i]);
     if (state->out_file == NULL)
     {
-      fputs("Error opening output file.\n", stderr);
       return 0;
     }
   }
 
+  /* Headless mode has nobody to type, so it needs an input file (or a
+     recording of the keys). */
+  if ((state->headless || state->sweep) && !state->scripted &&
+      (replay_name == NULL || state->sweep))
+  {
+    fputs("Headless and sweep modes require an input file.\n", stderr);
+    return 0;
+  }
+  if (state->sweep && (record_name != NULL || replay_name != NULL))
+  {
+    fputs("Sweep mode does not record or replay keys.\n", stderr);
+    return 0;
+  }
+
+  /* A recording is only replayed from where it started, with the input
+     file it was made with. */
+  if (replay_name != NULL)
+  {
+    error = session_open(&state->play, replay_name);
+    if (error != NULL)
+    {
+      fprintf(stderr, "%s\n", error);
+      return 0;
+    }
+    state->replaying = 1;
+    if (state->play.prog_hash != snap_program_hash(&state->prog) ||
+        state->play.step != state->step ||
+        state->play.start_clocks != state->clocks)
+    {
+      fputs("The recording was made with a different input file or "
+            "snapshot.\n", stderr);
+      return 0;
+    }
+  }
+  if (record_name != NULL)
+  {
+    error = session_create(&state->rec, record_name,
+                           snap_program_hash(&state->prog), state->step,
+                           state->clocks);
+    if (error != NULL)
+    {
+      fprintf(stderr, "%s\n", error);
+      return 0;
+    }
+    state->recording = 1;
+  }
+  if (state->paced && (state->sweep || !state->scripted))
+  {
+    fputs("The --hz option needs an input file and cannot be used with "
+          "--sweep.\n", stderr);
+    return 0;
+  }
+  if (state->sweep && state->out_file != NULL)
+  {
+    fputs("Sweep mode does not take an output file.\n", stderr);
+    return 0;
+  }
+  if (state->sweep && (state->restored || state->snap_name != NULL ||
+                       state->trace_file != NULL || vcd_name != NULL ||
+                       state->breaks.count != 0 || state->stats_name != NULL))
+  {
+    fputs("Sweep mode does not use snapshots, traces, VCD files, "
+          "breakpoints or --stats.\n", stderr);
+    return 0;
+  }
+
+  /* The VCD file starts from wherever the run does, timed by --hz. */
+  if (vcd_name != NULL)
+  {
+    if (state->paced)
+    {
+      half_period = (unsigned long long)(5e8 / state->sched.hz + 0.5);
+      half_period = half_period < 2 ? 2 : half_period;
+    }
+    state->vcd_file = fopen(vcd_name, "wb");
+    if (state->vcd_file == NULL ||
+        vcd_open(&state->vcd, state->vcd_file, vcd_signals, half_period,
+                 vcd_from, vcd_to, state->clocks,
+                 state->panel.control_states[c_clk]))
+    {
+      fputs("Error opening VCD file.\n", stderr);
+      return 0;
+    }
+  }
+  state->per_edge = state->trace_file != NULL || state->vcd_file != NULL ||
+                    state->breaks.count != 0;
+  sync_breaks(state);
+
+  /* Only the screen (or keys replayed from it) can be used to go back, so
+     only it keeps history. */
+  if ((!state->headless || state->replaying) && !state->sweep &&
+      history_steps != 0 &&
+      history_init(&state->hist, history_steps, history_interval))
+  {
+    fputs("Out of memory for the history.\n", stderr);
+    return 0;
+  }
+
+  /* Output goes through the writer thread from now on. */
+  if (state->out_file != NULL && writer_open(&state->writer,
+                                             fileno(state->out_file)))
+  {
+    fputs("Error starting the output writer.\n", stderr);
+    return 0;
+  }
+
+  /* A snapshot taken at the end of the input file carries on
+     interactively (or, headless, has nothing left to do). */
+  if (state->restored && state->scripted &&
+      state->pos == state->prog.text_len && !state->headless)
+  {
+    state->scripted = 0;
+  }
+
   /* Success. */
   return delay;
 }
 
 static int uninit(machine_state *state)
 {
-  /* Close the input file. */
-  if (state->in_file != NULL)
+  int status = 0;
+
+  /* Leave the last state in the shared panel for anyone still watching. */
+  if (state->shm != NULL)
+  {
+    share_panel(state, SHM_ENDED);
+    shm_close(state->shm);
+  }
+
+  /* Free the compiled input file and history. */
+  program_free(&state->prog);
+  history_free(&state->hist);
+
+  /* Finish the trace with its index, and the VCD file. A failure is noted
+     and the rest still finished, so the output is never lost over it. */
+  if (state->trace_file != NULL)
   {
-    if (fclose(state->in_file) != 0)
+    if (trace_close(&state->trace) | fclose(state->trace_file))
     {
-      fputs("Error closing input file.\n", stderr);
-      return 1;
+      fputs("Error writing trace file.\n", stderr);
+      status = 1;
+    }
+  }
+  if (state->vcd_file != NULL)
+  {
+    if (vcd_close(&state->vcd) | fclose(state->vcd_file))
+    {
+      fputs("Error writing VCD file.\n", stderr);
+      status = 1;
     }
   }
 
-  /* Flush any pending byte and close the output file. */
+  /* Write any pending byte, wait for the writer to finish and close the
+     output file. */
   if (state->out_file != NULL)
   {
     if (state->bits_set != 0)
     {
-      if (fputc(state->curr_byte, state->out_file) != state->curr_byte)
-      {
-        fputs("Error writing output file.\n", stderr);
-        return 1;
-      }
+      writer_put(&state->writer, (unsigned char)state->curr_byte);
+    }
+    if (writer_close(&state->writer))
+    {
+      fputs("Error writing output file.\n", stderr);
+      status = 1;
     }
-
     if (fclose(state->out_file) != 0)
     {
       fputs("Error closing output file.\n", stderr);
-      return 1;
+      status = 1;
     }
   }
 
-  /* Success. */
-  return 0;
+  /* Nonzero if anything failed. */
+  return status;
 }
 
 /* Add a horizontal line at the current position or at a given position. */
@@ -410,6 +1062,10 @@ static int uninit(machine_state *state)
 #define VFD_ON_YX(win, y, x) mvwaddch((win), (y), (x), 'V' | A_BOLD)
 #define VFD_OFF(win, c) mvwaddch((win), c, 'v' | A_DIM)
 #define VFD_OFF_YX(win, y, x) mvwaddch((win), (y), (x), 'v' | A_DIM)
+#define VFD_SET(win, c, on) \
+  mvwaddch((win), c, (on) ? 'V' | A_BOLD : 'v' | A_DIM)
+#define VFD_SET_YX(win, y, x, on) \
+  mvwaddch((win), (y), (x), (on) ? 'V' | A_BOLD : 'v' | A_DIM)
 
 /* Input control 0/1. */
 #define CONTROL_ON(win, c) mvwchgat((win), c, 1, A_STANDOUT, 0, NULL)
@@ -1300,6 +1956,18 @@ static void draw_cpu(machine_state *state)
 #define REMOTE_CLK_K 22, 41
 #define REMOTE_CLK_P REMOTE_POINTER, 41
 
+/* CPU VFD locations in the --baud layout, a row above the remote. */
+#define COMPACT_INST0_VFD 13, 31
+#define COMPACT_INST1_VFD 13, 30
+#define COMPACT_INST2_VFD 13, 29
+#define COMPACT_INST3_VFD 13, 28
+#define COMPACT_IV_VFD 13, 33
+#define COMPACT_LV_VFD 13, 35
+#define COMPACT_CR_VFD 13, 37
+#define COMPACT_RR_VFD 13, 39
+#define COMPACT_OEN_VFD 13, 41
+#define COMPACT_SKIP_VFD 13, 43
+
 /* Location indexes. */
 typedef enum bc_indexes_
 {
@@ -1411,9 +2079,11 @@ static void draw_remote(machine_state *state)
 /* Set the status. */
 #define STATUS_Y 9
 #define STATUS_X 54
-#define SET_STATUS(win, status)                                      \
+#define DRAW_STATUS(win, status)                                     \
   mvwaddstr((win), STATUS_Y, STATUS_X, "                         "); \
-  mvwaddstr((win), STATUS_Y, STATUS_X, (status));                    \
+  mvwaddstr((win), STATUS_Y, STATUS_X, (status))
+#define SET_STATUS(win, status) \
+  DRAW_STATUS((win), (status));  \
   wrefresh(win)
 
 static void draw_status(machine_state *state)
@@ -1478,30 +2148,34 @@ static void draw_status(machine_state *state)
 
 static void draw_help(machine_state *state)
 {
-  mvwaddstr(state->screen, 1, 28,
-            ".: tube, v: VFD off, V: VFD on");
-  mvwaddstr(state->screen, 2, 28,
-            "INST: instruction register VFDs");
-  mvwaddstr(state->screen, 3, 28,
-            "IV: IEN VFD");
-  mvwaddstr(state->screen, 4, 28,
-            "CRB: carry register buffer VFD");
-  mvwaddstr(state->screen, 5, 28,
-            "RR: results register VFD");
-  mvwaddstr(state->screen, 6, 28,
-            "LV: logic unit VFD");
-  mvwaddstr(state->screen, 7, 28,
-            "OSBS: OEN/SKIP VFDs");
-  mvwaddstr(state->screen, 8, 28,
-            "W: write VFD");
-  mvwaddstr(state->screen, 9, 28,
-            "0: flag 0 VFD");
-  mvwaddstr(state->screen, 10, 28,
-            "J: jump flag VFD");
-  mvwaddstr(state->screen, 11, 28,
-            "R: return flag VFD");
-  mvwaddstr(state->screen, 12, 28,
-            "F: flag f VFD");
+  /* The legend for the CPU, which the --baud layout labels itself. */
+  if (!state->baud)
+  {
+    mvwaddstr(state->screen, 1, 28,
+              ".: tube, v: VFD off, V: VFD on");
+    mvwaddstr(state->screen, 2, 28,
+              "INST: instruction register VFDs");
+    mvwaddstr(state->screen, 3, 28,
+              "IV: IEN VFD");
+    mvwaddstr(state->screen, 4, 28,
+              "CRB: carry register buffer VFD");
+    mvwaddstr(state->screen, 5, 28,
+              "RR: results register VFD");
+    mvwaddstr(state->screen, 6, 28,
+              "LV: logic unit VFD");
+    mvwaddstr(state->screen, 7, 28,
+              "OSBS: OEN/SKIP VFDs");
+    mvwaddstr(state->screen, 8, 28,
+              "W: write VFD");
+    mvwaddstr(state->screen, 9, 28,
+              "0: flag 0 VFD");
+    mvwaddstr(state->screen, 10, 28,
+              "J: jump flag VFD");
+    mvwaddstr(state->screen, 11, 28,
+              "R: return flag VFD");
+    mvwaddstr(state->screen, 12, 28,
+              "F: flag f VFD");
+  }
   mvwaddstr(state->screen, 14, 44,
             "D: data, R: result register");
   mvwaddstr(state->screen, 15, 44,
@@ -1522,902 +2196,1059 @@ static void draw_help(machine_state *state)
             "Arrows/h/l/tab/F1-F6 move cursor.");
 }
 
-static void power_on(machine_state *state)
+/* The --baud layout of the CPU: just its VFDs in a row, with the
+   instruction register bits in the same order as on the remote. */
+static void draw_compact(machine_state *state)
 {
-  int ch;
+  MV_ADD_TITLE(state->screen, 11, 28, "INST I L C R O S");
+  MV_ADD_TITLE(state->screen, 12, 28, "3210 E V R R E K");
+  mvwaddstr(state->screen, 13, 28, "vvvv v v v v v v");
+}
 
-  /* Instruction registers. */
-  state->ir = i_nop0;
-  SET_STATUS(state->screen, "Press a key to init INST0");
-  ch = get_input(state);
-  if (ch & 1)
-  {
-    state->ir |= i_ld;
-    VFD_ON(state->screen, INST_VFD0);
-  }
-  else
-  {
-    VFD_OFF(state->screen, INST_VFD0);
-  }
-  SET_STATUS(state->screen, "Press a key to init INST1");
-  ch = get_input(state);
-  if (ch & 1)
-  {
-    state->ir |= i_add;
-    VFD_ON(state->screen, INST_VFD1);
-  }
-  else
-  {
-    VFD_OFF(state->screen, INST_VFD1);
-  }
-  SET_STATUS(state->screen, "Press a key to init INST2");
-  ch = get_input(state);
-  if (ch & 1)
-  {
-    state->ir |= i_one;
-    VFD_ON(state->screen, INST_VFD2);
-  }
-  else
-  {
-    VFD_OFF(state->screen, INST_VFD2);
-  }
-  SET_STATUS(state->screen, "Press a key to init INST3");
-  ch = get_input(state);
-  if (ch & 1)
+/* Set a VFD. Serial terminals get no attributes, as the letter says it
+   all and each attribute change costs bytes on the line. */
+static void draw_vfd(machine_state *state, int y, int x, unsigned on)
+{
+  if (state->baud)
   {
-    state->ir |= i_sto;
-    VFD_ON(state->screen, INST_VFD3);
+    mvwaddch(state->screen, y, x, on ? 'V' : 'v');
   }
   else
   {
-    VFD_OFF(state->screen, INST_VFD3);
+    VFD_SET_YX(state->screen, y, x, on);
   }
+}
 
-  /* Input enable. */
-  SET_STATUS(state->screen, "Press a key to init IEN");
-  state->ien = get_input(state) & 1;
-  if (state->ien)
-  {
-    VFD_ON(state->screen, IV_VFD);
-  }
-  else
-  {
-    VFD_OFF(state->screen, IV_VFD);
-  }
+/* Power-on prompts and the VFD showing each value in the full and --baud
+   layouts, in power_init order. */
+static const struct
+{
+  const char *prompt;
+  coord vfd;
+  coord compact;
+} power_prompts[num_power_init] =
+{
+  { "Press a key to init INST0", {INST_VFD0}, {COMPACT_INST0_VFD} },
+  { "Press a key to init INST1", {INST_VFD1}, {COMPACT_INST1_VFD} },
+  { "Press a key to init INST2", {INST_VFD2}, {COMPACT_INST2_VFD} },
+  { "Press a key to init INST3", {INST_VFD3}, {COMPACT_INST3_VFD} },
+  { "Press a key to init IEN", {IV_VFD}, {COMPACT_IV_VFD} },
+  { "Press a key to init LOGIC", {LV_VFD}, {COMPACT_LV_VFD} },
+  { "Press a key to init CARRY", {CR_VFD}, {COMPACT_CR_VFD} },
+  { "Press a key to init RR", {RR_VFD}, {COMPACT_RR_VFD} },
+  { "Press a key to init OEN", {OEN_VFD}, {COMPACT_OEN_VFD} },
+  { "Press a key to init SKIP", {SKIP_VFD}, {COMPACT_SKIP_VFD} }
+};
 
-  /* Logic unit. */
-  SET_STATUS(state->screen, "Press a key to init LOGIC");
-  ch = get_input(state);
-  if (ch & 1)
-  {
-    VFD_ON(state->screen, LV_VFD);
-  }
-  else
+static void power_on(machine_state *state)
+{
+  unsigned i;
+  unsigned init = 0;
+  const coord *c;
+  panel_frame frame;
+
+  /* Prompt for each register, showing its VFD as it is set. A restored
+     snapshot has already set them all. */
+  for (i = 0; i < num_power_init && !state->restored; ++i)
   {
-    VFD_OFF(state->screen, LV_VFD);
+    pthread_mutex_lock(&state->curses_lock);
+    SET_STATUS(state->screen, power_prompts[i].prompt);
+    pthread_mutex_unlock(&state->curses_lock);
+    if (state->scripted)
+    {
+      script_delay(state, 1);
+      init |= state->prog.init & (1u << i);
+    }
+    else if (next_key(state) & 1)
+    {
+      init |= 1u << i;
+    }
+    c = state->baud ? &power_prompts[i].compact : &power_prompts[i].vfd;
+    pthread_mutex_lock(&state->curses_lock);
+    draw_vfd(state, c->y, c->x, (init >> i) & 1);
+    pthread_mutex_unlock(&state->curses_lock);
   }
 
-  /* Carry register. */
-  SET_STATUS(state->screen, "Press a key to init CARRY");
-  state->cr = get_input(state) & 1;
-  if (state->cr)
+  /* Power on. Outputs and inputs power up off, input controls all zero,
+     cursor at I3. Nothing is known to be on the screen yet, so it is all
+     drawn. */
+  if (!state->restored)
   {
-    VFD_ON(state->screen, CR_VFD);
+    panel_power_on(&state->panel, init);
   }
-  else
+  state->status = instructions[GET_INSTR(&state->panel)];
+  if (state->shm != NULL)
   {
-    VFD_OFF(state->screen, CR_VFD);
+    share_panel(state, 0);
   }
+  take_frame(state, &frame);
+  state->shown_items = ~frame.items;
+  state->shown_control = num_controls;
+  state->shown_status[0] = '\0';
+  pthread_mutex_lock(&state->curses_lock);
+  render(state, &frame);
+  wrefresh(state->screen);
+  pthread_mutex_unlock(&state->curses_lock);
+}
 
-  /* Results register. */
-  SET_STATUS(state->screen, "Press a key to init RR");
-  state->rr = get_input(state) & 1;
-  if (state->rr)
-  {
-    VFD_ON(state->screen, RR_VFD);
-  }
-  else
+static void main_loop(machine_state *state)
+{
+  int ch;
+  unsigned events;
+  unsigned short entries[2];
+  panel_state before;
+  program_step step;
+  panel_state *panel = &state->panel;
+
+  /* The clock schedule and the counters start now. */
+  state->run_start = sched_now();
+  state->hud_time = state->run_start;
+  if (state->paced)
   {
-    VFD_OFF(state->screen, RR_VFD);
+    sched_init(&state->sched, state->sched.hz);
   }
 
-  /* Output enable. */
-  SET_STATUS(state->screen, "Press a key to init OEN");
-  state->oen = get_input(state) & 1;
-  if (state->oen)
+  while (state->error == NULL)
   {
-    VFD_ON(state->screen, OEN_VFD);
-  }
-  else
-  {
-    VFD_OFF(state->screen, OEN_VFD);
-  }
-
-  /* Skip register. */
-  SET_STATUS(state->screen, "Press a key to init SKIP");
-  state->skip = get_input(state) & 1;
-  if (state->skip)
-  {
-    VFD_ON(state->screen, SKIP_VFD);
-  }
-  else
-  {
-    VFD_OFF(state->screen, SKIP_VFD);
-  }
-
-  /* Outputs power up off. Except RR, which matches RR above. */
-  VFD_OFF(state->screen, REMOTE_DATA_VFD);
-  if (state->rr)
-  {
-    VFD_ON(state->screen, REMOTE_RR_VFD);
-  }
-  else
-  {
-    VFD_OFF(state->screen, REMOTE_RR_VFD);
-  }
-  VFD_OFF(state->screen, WRITE_VFD);
-  VFD_OFF(state->screen, REMOTE_WRITE_VFD);
-  VFD_OFF(state->screen, FLG0_VFD);
-  VFD_OFF(state->screen, REMOTE_FLG0_VFD);
-  VFD_OFF(state->screen, JUMP_VFD);
-  VFD_OFF(state->screen, REMOTE_JUMP_VFD);
-  VFD_OFF(state->screen, RETURN_VFD);
-  VFD_OFF(state->screen, REMOTE_RETURN_VFD);
-  VFD_OFF(state->screen, FLGF_VFD);
-  VFD_OFF(state->screen, REMOTE_FLGF_VFD);
-
-  /* Inputs power up off. */
-  VFD_OFF(state->screen, REMOTE_I3_VFD);
-  VFD_OFF(state->screen, REMOTE_I2_VFD);
-  VFD_OFF(state->screen, REMOTE_I1_VFD);
-  VFD_OFF(state->screen, REMOTE_I0_VFD);
-  VFD_OFF(state->screen, REMOTE_D_VFD);
-  VFD_OFF(state->screen, REMOTE_C_VFD);
-
-  /* Input controls all zero. */
-  state->control_states[c_i3] = bci_0;
-  CONTROL_ON_YX(state->screen,
-             binary_controls[c_i3][bci_0].y, binary_controls[c_i3][bci_0].x);
-  state->control_states[c_i2] = bci_0;
-  CONTROL_ON_YX(state->screen,
-             binary_controls[c_i2][bci_0].y, binary_controls[c_i2][bci_0].x);
-  state->control_states[c_i1] = bci_0;
-  CONTROL_ON_YX(state->screen,
-             binary_controls[c_i1][bci_0].y, binary_controls[c_i1][bci_0].x);
-  state->control_states[c_i0] = bci_0;
-  CONTROL_ON_YX(state->screen,
-             binary_controls[c_i0][bci_0].y, binary_controls[c_i0][bci_0].x);
-  state->control_states[c_d] = bci_0;
-  CONTROL_ON_YX(state->screen,
-             binary_controls[c_d][bci_0].y, binary_controls[c_d][bci_0].x);
-  state->control_states[c_clk] = bci_0;
-  SET_STATUS(state->screen, instructions[GET_INSTR(state)]);
-
-  /* Cursor starts at I3. */
-  state->control = c_i3;
-  POINTER_ON(state->screen,
-             binary_controls[c_i3][bci_pointer].y,
-             binary_controls[c_i3][bci_pointer].x);
-
-  /* Read the rest of the current line if reading from a file. */
-  if (state->in_file != NULL)
-  {
-    while (get_input(state) != '\n')
-    { }
-  }
-}
-
-static void main_loop(machine_state *state)
-{
-  int ch;
-  int done = 0;
-
-  while (!done)
-  {
-    /* Get the next input character. */
-    ch = get_input(state);
-
-    /* Handle the input. */
-    switch (ch)
+    /* Run the next step of the input file unless at a breakpoint. */
+    if (state->scripted && !state->in_break)
     {
-      case 'h':
-      case 'H':
-      case KEY_LEFT:
-        /* Select the control to the left, wrapping around. */
-        if (state->control == c_i3)
-        {
-          select_control(state, c_clk);
-        }
-        else
-        {
-          select_control(state, state->control - 1);
-        }
-        break;
-
-      case '\t':
-      case 'l':
-      case 'L':
-      case KEY_RIGHT:
-        /* Select the control to the right, wrapping around. */
-        if (state->control == c_clk)
+      events = script_step(state);
+
+      /* At the end, quit or switch back to interactive. */
+      if (!state->in_cycle &&
+          state->prog.steps[state->step - 1].type == st_set)
+      {
+        state->scripted = 0;
+        if (state->prog.quit)
         {
-          select_control(state, c_i3);
+          events |= pe_quit;
         }
-        else
+      }
+    }
+    else
+    {
+      /* Get the next key and map the special keys to the characters the
+         panel understands. */
+      ch = next_key(state);
+      switch (ch)
+      {
+        case KEY_LEFT:
+          ch = 'h';
+          break;
+
+        case KEY_RIGHT:
+          ch = 'l';
+          break;
+
+        case KEY_ENTER:
+        case KEY_UP:
+        case KEY_DOWN:
+          ch = 't';
+          break;
+
+        case KEY_F(6):
+          ch = 'c';
+          break;
+
+        default:
+          break;
+      }
+
+      /* Going back is not a panel control. */
+      if (ch == 'p' || ch == 'P')
+      {
+        if (state->out_file == stdout)
         {
-          select_control(state, state->control + 1);
+          state->status = "Cannot go back: stdout.";
         }
-        break;
-
-      case KEY_F(1):
-        /* Select the instruction 3 control. */
-        select_control(state, c_i3);
-        break;
-
-      case KEY_F(2):
-        /* Select the instruction 2 control. */
-        select_control(state, c_i2);
-        break;
-
-      case KEY_F(3):
-        /* Select the instruction 1 control. */
-        select_control(state, c_i1);
-        break;
-
-      case KEY_F(4):
-        /* Select the instruction 0 control. */
-        select_control(state, c_i0);
-        break;
-
-      case KEY_F(5):
-        /* Select the data control. */
-        select_control(state, c_d);
-        break;
-
-      case 'c':
-      case 'C':
-      case KEY_F(6):
-        /* Select the clock control. */
-        select_control(state, c_clk);
-        break;
-
-      case '\r':
-      case '\n':
-      case ' ':
-      case 't':
-      case 'T':
-      case KEY_ENTER:
-      case KEY_UP:
-      case KEY_DOWN:
-        /* Toggle the current control. */
-        if (state->control == c_clk)
+        else if (ch == 'p')
         {
-          toggle_clock(state);
+          step_back(state);
         }
         else
         {
-          toggle_control(state);
-        }
-        break;
-
-      case '0':
-        /* Set I0 off. */
-        select_control(state, c_i0);
-        if (state->control_states[c_i0] != 0)
-        {
-          toggle_control(state);
+          clock_back(state);
         }
-        break;
-
-      case '1':
-        /* Set I1 off. */
-        select_control(state, c_i1);
-        if (state->control_states[c_i1] != 0)
+        if (state->shm != NULL)
         {
-          toggle_control(state);
+          share_panel(state, 0);
         }
-        break;
+        publish(state);
+        continue;
+      }
 
-      case '2':
-        /* Set I2 off. */
-        select_control(state, c_i2);
-        if (state->control_states[c_i2] != 0)
-        {
-          toggle_control(state);
-        }
-        break;
+      /* Handle the input. F1-F5 select the control directly. */
+      before = *panel;
+      if (ch >= KEY_F(1) && ch <= KEY_F(5))
+      {
+        panel->control = (controls)(ch - KEY_F(1));
+        events = pe_select;
+      }
+      else
+      {
+        events = panel_key(panel, ch);
+      }
 
-      case '3':
-        /* Set I3 off. */
-        select_control(state, c_i3);
-        if (state->control_states[c_i3] != 0)
+      /* Log any clock edges as steps, as a file would have given them. */
+      if (events & (pe_clock_high | pe_clock_low))
+      {
+        record_edges(state, &before, events);
+        step.inst = (unsigned char)(GET_INSTR(panel) |
+                                    (panel->control_states[c_d] << 4));
+        step.control = (unsigned char)panel->control;
+        if ((events & (pe_clock_high | pe_clock_low)) !=
+            (pe_clock_high | pe_clock_low))
         {
-          toggle_control(state);
+          step.type = events & pe_clock_high ? st_high : st_low;
+          entries[0] = history_entry(&step, 0);
+          history_log(state, &before, state->in_cycle, entries, 1);
         }
-        break;
-
-      case '4':
-        /* Set I0 on. */
-        select_control(state, c_i0);
-        if (state->control_states[c_i0] == 0)
+        else if (before.control_states[c_clk])
         {
-          toggle_control(state);
+          step.type = st_low;
+          entries[0] = history_entry(&step, 0);
+          step.type = st_high;
+          entries[1] = history_entry(&step, 0);
+          history_log(state, &before, state->in_cycle, entries, 2);
         }
-        break;
-
-      case '5':
-        /* Set I1 on. */
-        select_control(state, c_i1);
-        if (state->control_states[c_i1] == 0)
+        else
         {
-          toggle_control(state);
+          step.type = st_cycle;
+          entries[0] = history_entry(&step, 0);
+          history_log(state, &before, state->in_cycle, entries, 1);
         }
-        break;
+      }
+    }
 
-      case '6':
-        /* Set I2 on. */
-        select_control(state, c_i2);
-        if (state->control_states[c_i2] == 0)
-        {
-          toggle_control(state);
-        }
-        break;
+    /* A control change shows the new instruction. */
+    if (events & pe_control)
+    {
+      state->status = instructions[GET_INSTR(panel)];
+    }
 
-      case '7':
-        /* Set I3 on. */
-        select_control(state, c_i3);
-        if (state->control_states[c_i3] == 0)
-        {
-          toggle_control(state);
-        }
-        break;
+    /* Record the output. */
+    if (events & pe_write)
+    {
+      write_data(state, panel->cpu.bus);
+    }
+    step_done(state, events);
 
-      case 'd':
-        /* Set data off. */
-        select_control(state, c_d);
-        if (state->control_states[c_d] != 0)
-        {
-          toggle_control(state);
-        }
-        break;
+    /* Stop at a --break or --watch as at a breakpoint in the file. */
+    if (break_stop(state) && state->scripted)
+    {
+      state->in_break = 1;
+    }
 
-      case 'D':
-        /* Set data on. */
-        select_control(state, c_d);
-        if (state->control_states[c_d] == 0)
-        {
-          toggle_control(state);
-        }
-        break;
-
-      case 'k':
-      case 'K':
-        /* Select the clock control. */
-        select_control(state, c_clk);
-
-        /* Toggle twice. */
-        toggle_clock(state);
-        toggle_clock(state);
-        break;
-
-      case 'b':
-      case 'B':
-        /* Toggle breakpoint mode. */
-        if (state->in_break)
-        {
-          state->in_break = 0;
-        }
-        else
+    /* Toggle breakpoint mode. */
+    if (events & pe_break)
+    {
+      if (state->in_break)
+      {
+        /* Do not try to catch up the time spent at the breakpoint. */
+        state->in_break = 0;
+        resume_file(state);
+        if (state->paced)
         {
-          state->in_break = 1;
-          SET_STATUS(state->screen, "Breakpoint. B to resume.");
+          sched_restart(&state->sched);
         }
-        break;
-
-      case 'q':
-      case 'Q':
-        /* Quit. */
-        done = 1;
-        break;
+      }
+      else
+      {
+        state->in_break = 1;
+        state->status = "Breakpoint. B to resume.";
+      }
+    }
 
-      default:
-        /* Ignore others. */
-        break;
+    /* Quit. */
+    if (events & pe_quit)
+    {
+      break;
     }
 
-    /* If an error has been set, quit. */
-    if (state->error != NULL)
+    /* Hand what changed to the render thread. */
+    if (events != 0)
     {
-      done = 1;
+      publish(state);
     }
   }
 }
 
-static void clock_high(machine_state *state)
+static void headless_loop(machine_state *state)
 {
-  unsigned data;
-  unsigned skip = state->skip;
-
-  /* Turn skip off it was on. */
-  if (skip)
+  unsigned i;
+  unsigned events;
+  unsigned init = state->prog.init;
+
+  /* Power on from the second line of the input file (unless restored),
+     then run every step. Breakpoints have nobody to hand control to, so
+     'b' is ignored and a --break or --watch ends the run. */
+  state->session_start = sched_now();
+  if (!state->restored)
   {
-    state->skip = 0;
-    VFD_OFF(state->screen, SKIP_VFD);
-  }
-
-  /* Load the instruction in the instruction register. If the skip flag is set,
-     the instruction lines are all pulled high. */
-  state->ir = skip ? i_nopf : GET_INSTR(state);
-  if (state->control_states[c_i3] | skip)
-  {
-    VFD_ON(state->screen, INST_VFD3);
-  }
-  else
-  {
-    VFD_OFF(state->screen, INST_VFD3);
+    for (i = 0; i < num_power_init && state->replaying && !state->scripted;
+         ++i)
+    {
+      init = (init & ~(1u << i)) | (next_key(state) & 1u) << i;
+    }
+    panel_power_on(&state->panel, init);
   }
-  if (state->control_states[c_i2] | skip)
+  if (state->shm != NULL)
   {
-    VFD_ON(state->screen, INST_VFD2);
+    share_panel(state, 0);
   }
-  else
+
+  /* A replayed session runs just as it did on the screen, keys and all. */
+  if (state->replaying)
   {
-    VFD_OFF(state->screen, INST_VFD2);
+    main_loop(state);
+    return;
   }
-  if (state->control_states[c_i1] | skip)
+  state->run_start = sched_now();
+  if (state->paced)
   {
-    VFD_ON(state->screen, INST_VFD1);
+    sched_init(&state->sched, state->sched.hz);
   }
-  else
+  while (state->scripted && state->error == NULL)
   {
-    VFD_OFF(state->screen, INST_VFD1);
+    events = script_step(state);
+    if (!state->in_cycle &&
+        state->prog.steps[state->step - 1].type == st_set)
+    {
+      state->scripted = 0;
+    }
+    if (events & pe_write)
+    {
+      write_data(state, state->panel.cpu.bus);
+    }
+    step_done(state, events);
+    if (break_stop(state))
+    {
+      break;
+    }
   }
-  if (state->control_states[c_i0] | skip)
+}
+
+/* Number of power-on states, how many slice words they fill, and the CRC-64
+   (ECMA-182) used to fingerprint each state's output bitstream. */
+#define SWEEP_STATES (1u << num_power_init)
+#define SWEEP_WORDS (SWEEP_STATES / SLICE_LANES)
+#define SWEEP_CRC_POLY 0x42f0e1eba9ea3693ull
+
+/* Work for one sweep thread. Clocks hold the instruction in the low 4 bits
+   and the data in bit 4. If ref is NULL the thread fingerprints the output
+   of each state in crc; otherwise ref holds the write line (bit 0) and bit
+   written (bit 1) of the majority for each clock, and the thread records in
+   diverge the first clock where each state differs from it. */
+typedef struct sweep_job_
+{
+  const unsigned char *clocks;
+  size_t num_clocks;
+  const unsigned char *ref;
+  unsigned first_word;
+  unsigned word_step;
+  unsigned long long *crc;
+  size_t *diverge;
+} sweep_job;
+
+static void sweep_word(const sweep_job *job, unsigned word)
+{
+  size_t c;
+  unsigned i;
+  unsigned lane;
+  cpu_state cpu;
+  slice_state s;
+  slice_word fb;
+  slice_word bit;
+  slice_word diff;
+  slice_word seen = slice_fill(0);
+  slice_word crc[64];
+  unsigned long long u;
+
+  /* Power on each lane in its own state. */
+  memset(&s, 0, sizeof(s));
+  for (lane = 0; lane < SLICE_LANES; ++lane)
   {
-    VFD_ON(state->screen, INST_VFD0);
+    cpu = cpu_power_on(word * SLICE_LANES + lane);
+    slice_set_lane(&s, lane, &cpu);
   }
-  else
+  for (i = 0; i < 64; ++i)
   {
-    VFD_OFF(state->screen, INST_VFD0);
+    crc[i] = slice_fill(1);
   }
 
-  /* Turn off FLG0, JUMP, RETURN, FLGF in case they were on. */
-  VFD_OFF(state->screen, FLG0_VFD);
-  VFD_OFF(state->screen, REMOTE_FLG0_VFD);
-  VFD_OFF(state->screen, JUMP_VFD);
-  VFD_OFF(state->screen, REMOTE_JUMP_VFD);
-  VFD_OFF(state->screen, RETURN_VFD);
-  VFD_OFF(state->screen, REMOTE_RETURN_VFD);
-  VFD_OFF(state->screen, FLGF_VFD);
-  VFD_OFF(state->screen, REMOTE_FLGF_VFD);
-
-  /* Turn off the logic VFD in case this is not a logic instruction. */
-  VFD_OFF(state->screen, LV_VFD);
-
-  /* Determine the data. If IEN is off, the data is zero; otherwise it is the
-     data bus line. However, if the instruction is IEN, the data bus is read
-     regardless. */
-  data = state->ien || state->ir == i_ien ? state->control_states[c_d] : 0;
-
-  /* Perform the instruction to update the result and carry registers. */
-  switch (state->ir)
+  for (c = 0; c < job->num_clocks; ++c)
   {
-    case i_nop0:
-      /* FLG0 high. */
-      VFD_ON(state->screen, FLG0_VFD);
-      VFD_ON(state->screen, REMOTE_FLG0_VFD);
-      break;
-
-    case i_ld:
-      /* Result register set to data. */
-      state->rr = data;
-      if (data)
-      {
-        VFD_ON(state->screen, RR_VFD);
-        VFD_ON(state->screen, REMOTE_RR_VFD);
-      }
-      else
-      {
-        VFD_OFF(state->screen, RR_VFD);
-        VFD_OFF(state->screen, REMOTE_RR_VFD);
-      }
-      break;
-
-    case i_add:
-      /* Result register set to data plus result register plus carry. Carry
-         register set appropriately. */
-      state->rr += data + state->cr;
-      state->cr = state->rr >> 1;
-      state->rr &= 1;
-      if (state->rr)
-      {
-        VFD_ON(state->screen, RR_VFD);
-        VFD_ON(state->screen, REMOTE_RR_VFD);
-      }
-      else
-      {
-        VFD_OFF(state->screen, RR_VFD);
-        VFD_OFF(state->screen, REMOTE_RR_VFD);
-      }
-      if (state->cr)
-      {
-        VFD_ON(state->screen, CR_VFD);
-      }
-      else
-      {
-        VFD_OFF(state->screen, CR_VFD);
-      }
-      break;
-
-    case i_sub:
-      /* Result register set to complement of data plus result register plus
-         carry. Carry register set appropriately. */
-      state->rr += (data ^ 1) + state->cr;
-      state->cr = state->rr >> 1;
-      state->rr &= 1;
-      if (state->rr)
-      {
-        VFD_ON(state->screen, RR_VFD);
-        VFD_ON(state->screen, REMOTE_RR_VFD);
-      }
-      else
-      {
-        VFD_OFF(state->screen, RR_VFD);
-        VFD_OFF(state->screen, REMOTE_RR_VFD);
-      }
-      if (state->cr)
-      {
-        VFD_ON(state->screen, CR_VFD);
-      }
-      else
-      {
-        VFD_OFF(state->screen, CR_VFD);
-      }
-      break;
-
-    case i_one:
-      /* Result register set to one. Carry register cleared. */
-      state->rr = 1;
-      state->cr = 0;
-      VFD_ON(state->screen, RR_VFD);
-      VFD_ON(state->screen, REMOTE_RR_VFD);
-      VFD_OFF(state->screen, CR_VFD);
-      break;
-
-    case i_nand:
-      /* Result register set to complement of result register and data. */
-      state->rr = (state->rr & data) ^ 1;
-      if (state->rr)
-      {
-        VFD_ON(state->screen, LV_VFD);
-        VFD_ON(state->screen, RR_VFD);
-        VFD_ON(state->screen, REMOTE_RR_VFD);
-      }
-      else
-      {
-        VFD_OFF(state->screen, RR_VFD);
-        VFD_OFF(state->screen, REMOTE_RR_VFD);
-      }
-      break;
-
-    case i_or:
-      /* Result register set to result register or data. */
-      state->rr |= data;
-      if (state->rr)
-      {
-        VFD_ON(state->screen, LV_VFD);
-        VFD_ON(state->screen, RR_VFD);
-        VFD_ON(state->screen, REMOTE_RR_VFD);
-      }
-      else
-      {
-        VFD_OFF(state->screen, RR_VFD);
-        VFD_OFF(state->screen, REMOTE_RR_VFD);
-      }
-      break;
-
-    case i_xor:
-      /* Result register set to result register or data. */
-      state->rr ^= data;
-      if (state->rr)
-      {
-        VFD_ON(state->screen, LV_VFD);
-        VFD_ON(state->screen, RR_VFD);
-        VFD_ON(state->screen, REMOTE_RR_VFD);
-      }
-      else
-      {
-        VFD_OFF(state->screen, RR_VFD);
-        VFD_OFF(state->screen, REMOTE_RR_VFD);
-      }
-      break;
-
-    case i_sto:
-      /* Data bus set to result register. Write high if OEN. */
-      if (state->rr)
-      {
-        VFD_ON(state->screen, REMOTE_DATA_VFD);
-      }
-      else
-      {
-        VFD_OFF(state->screen, REMOTE_DATA_VFD);
-      }
-      if (state->oen)
-      {
-        VFD_ON(state->screen, WRITE_VFD);
-        VFD_ON(state->screen, REMOTE_WRITE_VFD);
-        write_data(state, state->rr);
-      }
-      break;
-
-    case i_stoc:
-      /* Data bus set to complement of result register. Write high if OEN. */
-      if (!state->rr)
-      {
-        VFD_ON(state->screen, REMOTE_DATA_VFD);
-      }
-      else
-      {
-        VFD_OFF(state->screen, REMOTE_DATA_VFD);
-      }
-      if (state->oen)
-      {
-        VFD_ON(state->screen, WRITE_VFD);
-        VFD_ON(state->screen, REMOTE_WRITE_VFD);
-        write_data(state, state->rr ^ 1);
-      }
-      break;
-
-    case i_ien:
-      /* Input enable register set to data. */
-      state->ien = data;
-      if (data)
-      {
-        VFD_ON(state->screen, IV_VFD);
-      }
-      else
-      {
-        VFD_OFF(state->screen, IV_VFD);
-      }
-      break;
-
-    case i_oen:
-      /* Output enable register set to data. */
-      state->oen = data;
-      if (data)
-      {
-        VFD_ON(state->screen, OEN_VFD);
-      }
-      else
+    slice_clock_high(&s, (instruction)(job->clocks[c] & 0xf),
+                     slice_fill(job->clocks[c] >> 4));
+    if (job->ref == NULL)
+    {
+      /* Shift the written bit in to the CRC of each lane that wrote. */
+      if (slice_any(s.write))
       {
-        VFD_OFF(state->screen, OEN_VFD);
+        fb = crc[63] ^ s.bus;
+        for (i = 63; i > 0; --i)
+        {
+          bit = (SWEEP_CRC_POLY >> i) & 1 ? crc[i - 1] ^ fb : crc[i - 1];
+          crc[i] = SLICE_SELECT(s.write, bit, crc[i]);
+        }
+        crc[0] = SLICE_SELECT(s.write, fb, crc[0]);
       }
-      break;
-
-    case i_jmp:
-      /* JUMP high. */
-      VFD_ON(state->screen, JUMP_VFD);
-      VFD_ON(state->screen, REMOTE_JUMP_VFD);
-      break;
-
-    case i_rtn:
-      /* RETURN high. Skip next instruction. */
-      VFD_ON(state->screen, RETURN_VFD);
-      VFD_ON(state->screen, REMOTE_RETURN_VFD);
-      state->skip = 1;
-      VFD_ON(state->screen, SKIP_VFD);
-      break;
-
-    case i_skz:
-      /* Skip register set to one if result register is zero. */
-      if (state->rr == 0)
+    }
+    else
+    {
+      /* Note the lanes that differ from the majority for the first time. */
+      diff = s.write ^ slice_fill(job->ref[c] & 1);
+      diff |= s.write & (s.bus ^ slice_fill((job->ref[c] >> 1) & 1));
+      diff &= ~seen;
+      if (slice_any(diff))
       {
-        state->skip = 1;
-        VFD_ON(state->screen, SKIP_VFD);
+        seen |= diff;
+        for (lane = 0; lane < SLICE_LANES; ++lane)
+        {
+          if (slice_get(diff, lane))
+          {
+            job->diverge[word * SLICE_LANES + lane] = c;
+          }
+        }
       }
-      break;
+    }
+  }
 
-    case i_nopf:
-      /* FLGF high unless this was NOPF due to skip. */
-      if (!skip)
+  /* Collect the fingerprints. */
+  if (job->ref == NULL)
+  {
+    for (lane = 0; lane < SLICE_LANES; ++lane)
+    {
+      u = 0;
+      for (i = 0; i < 64; ++i)
       {
-        VFD_ON(state->screen, FLGF_VFD);
-        VFD_ON(state->screen, REMOTE_FLGF_VFD);
+        u |= (unsigned long long)slice_get(crc[i], lane) << i;
       }
-      break;
+      job->crc[word * SLICE_LANES + lane] = u;
+    }
   }
-
-  /* Refresh. */
-  wrefresh(state->screen);
 }
 
-static void clock_low(machine_state *state)
+static void *sweep_thread(void *arg)
 {
-  /* Perform the instruction to update the result and carry registers. */
-  switch (state->ir)
-  {
-    case i_nop0:
-    case i_ld:
-    case i_add:
-    case i_sub:
-    case i_one:
-    case i_nand:
-    case i_or:
-    case i_xor:
-      /* No change. */
-      break;
-
-    case i_sto:
-    case i_stoc:
-      /* Return the write line low. */
-      VFD_OFF(state->screen, WRITE_VFD);
-      VFD_OFF(state->screen, REMOTE_WRITE_VFD);
-      break;
+  unsigned word;
+  const sweep_job *job = arg;
 
-    case i_ien:
-    case i_oen:
-    case i_jmp:
-    case i_rtn:
-    case i_skz:
-    case i_nopf:
-      /* No change. */
-      break;
+  for (word = job->first_word; word < SWEEP_WORDS; word += job->word_step)
+  {
+    sweep_word(job, word);
   }
-
-  /* Refresh. */
-  wrefresh(state->screen);
-}
-
-static void select_control(machine_state *state, controls ctrl)
-{
-  const coord *c;
-
-  /* Select the control. */
-  c = binary_controls[state->control] + bci_pointer;
-  POINTER_OFF(state->screen, c->y, c->x);
-  state->control = ctrl;
-  c = binary_controls[ctrl] + bci_pointer;
-  POINTER_ON(state->screen, c->y, c->x);
+  return NULL;
 }
 
-static void toggle_control(machine_state *state)
+static int sweep_run(sweep_job *job)
 {
-  const coord *c;
-
-  /* Turn off the current setting. */
-  c = binary_controls[state->control] + state->control_states[state->control];
-  CONTROL_OFF_YX(state->screen, c->y, c->x);
-
-  /* Toggle the current value. */
-  state->control_states[state->control] ^= 1;
-
-  /* Turn on the new setting. */
-  c = binary_controls[state->control] + state->control_states[state->control];
-  CONTROL_ON_YX(state->screen, c->y, c->x);
-
-  /* Set the corresponding VFD to match. */
-  c = binary_controls[state->control] + bci_vfd;
-  if (state->control_states[state->control])
+  unsigned i;
+  unsigned num_threads = 1;
+  pthread_t threads[SWEEP_WORDS];
+  sweep_job jobs[SWEEP_WORDS];
+
+  /* One thread per core, but no more than there are words. */
+#ifdef _SC_NPROCESSORS_ONLN
+  num_threads = (unsigned)sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+  if (num_threads < 1)
   {
-    VFD_ON_YX(state->screen, c->y, c->x);
+    num_threads = 1;
   }
-  else
+  if (num_threads > SWEEP_WORDS)
   {
-    VFD_OFF_YX(state->screen, c->y, c->x);
+    num_threads = SWEEP_WORDS;
   }
 
-  /* The data line also controls the data VFD on the remote. */
-  if (state->control == c_d)
+  for (i = 0; i < num_threads; ++i)
   {
-    if (state->control_states[c_d])
-    {
-      VFD_ON(state->screen, REMOTE_DATA_VFD);
-    }
-    else
+    jobs[i] = *job;
+    jobs[i].first_word = i;
+    jobs[i].word_step = num_threads;
+    if (pthread_create(&threads[i], NULL, sweep_thread, &jobs[i]) != 0)
     {
-      VFD_OFF(state->screen, REMOTE_DATA_VFD);
+      fputs("Error creating sweep thread.\n", stderr);
+      return 1;
     }
   }
+  for (i = 0; i < num_threads; ++i)
+  {
+    pthread_join(threads[i], NULL);
+  }
+  return 0;
+}
 
-  /* Update status. */
-  SET_STATUS(state->screen, instructions[GET_INSTR(state)]);
+static int compare_crc(const void *a, const void *b)
+{
+  unsigned long long x = *(const unsigned long long *)a;
+  unsigned long long y = *(const unsigned long long *)b;
+  return x < y ? -1 : x > y;
 }
 
-static void toggle_clock(machine_state *state)
+static int sweep(machine_state *state)
 {
-  /* Perform clock-triggered functions depending on the transition. */
-  if (state->control_states[c_clk])
+  size_t c;
+  size_t bits = 0;
+  size_t count;
+  size_t best = 0;
+  unsigned i;
+  unsigned j;
+  unsigned majority = 0;
+  unsigned differ = 0;
+  unsigned char *clocks = NULL;
+  unsigned char *ref = NULL;
+  unsigned long long majority_crc = 0;
+  static unsigned long long crc[SWEEP_STATES];
+  static unsigned long long sorted[SWEEP_STATES];
+  static size_t diverge[SWEEP_STATES];
+  sweep_job job;
+  cpu_state cpu;
+  const program_step *step;
+
+  /* The initialization line is not used; every state is run. Only rising
+     edges do anything, so take the instruction and data of each. */
+  memset(&job, 0, sizeof(job));
+  clocks = malloc(state->prog.num_steps + 1);
+  if (clocks == NULL)
   {
-    /* Clock is currently high, so transition low. */
-    state->control_states[c_clk] = bci_0;
-    VFD_OFF(state->screen, REMOTE_C_VFD);
-    CONTROL_OFF(state->screen, REMOTE_CLK_C);
-    CONTROL_OFF(state->screen, REMOTE_CLK_L);
-    CONTROL_OFF(state->screen, REMOTE_CLK_K);
-    clock_low(state);
+    fputs("Out of memory.\n", stderr);
+    return 1;
   }
-  else
+  for (c = 0; c < state->prog.num_steps; ++c)
   {
-    /* Clock is currently low, so transition high. */
-    state->control_states[c_clk] = bci_1;
-    VFD_ON(state->screen, REMOTE_C_VFD);
-    CONTROL_ON(state->screen, REMOTE_CLK_C);
-    CONTROL_ON(state->screen, REMOTE_CLK_L);
-    CONTROL_ON(state->screen, REMOTE_CLK_K);
-    clock_high(state);
+    step = state->prog.steps + c;
+    if (step->type == st_high || step->type == st_cycle)
+    {
+      clocks[job.num_clocks++] = step->inst;
+    }
   }
-}
 
-static int get_input(machine_state *state)
-{
-  int ch;
-  int in_comment = 0;
-  int end_comment = 0;
+  /* Fingerprint the output of every state. */
+  job.clocks = clocks;
+  job.crc = crc;
+  if (sweep_run(&job) != 0)
+  {
+    free(clocks);
+    return 1;
+  }
 
-  /* If there is an input file, read from it as long as we're not in breakpoint
-     mode. */
-  if (state->in_file != NULL && !state->in_break)
+  /* Find the most common output. */
+  memcpy(sorted, crc, sizeof(sorted));
+  qsort(sorted, SWEEP_STATES, sizeof(sorted[0]), compare_crc);
+  for (i = 0; i < SWEEP_STATES; i = j)
+  {
+    for (j = i; j < SWEEP_STATES && sorted[j] == sorted[i]; ++j)
+    { }
+    count = j - i;
+    if (count > best)
+    {
+      best = count;
+      majority_crc = sorted[i];
+    }
+  }
+  for (i = 0; crc[i] != majority_crc; ++i)
+  { }
+  majority = i;
+
+  /* Record what the majority does on every clock, then find where each of the
+     others first differs from it. */
+  ref = malloc(job.num_clocks + 1);
+  if (ref == NULL)
+  {
+    fputs("Out of memory.\n", stderr);
+    free(clocks);
+    return 1;
+  }
+  cpu = cpu_power_on(majority);
+  for (c = 0; c < job.num_clocks; ++c)
+  {
+    cpu = cpu_clock_high(cpu, clocks[c] & 0xf, clocks[c] >> 4);
+    ref[c] = (unsigned char)((cpu.outputs & co_write ? 1 : 0) |
+                             (cpu.bus << 1));
+    bits += ref[c] & 1;
+    cpu = cpu_clock_low(cpu);
+  }
+  for (i = 0; i < SWEEP_STATES; ++i)
   {
-    /* Delay. */
-    getch();
+    diverge[i] = job.num_clocks;
+  }
+  job.ref = ref;
+  job.diverge = diverge;
+  if (sweep_run(&job) != 0)
+  {
+    free(ref);
+    free(clocks);
+    return 1;
+  }
 
-    /* Get a non-comment character. */
-    do
+  /* Report. */
+  for (i = 0; i < SWEEP_STATES; ++i)
+  {
+    differ += crc[i] != majority_crc;
+  }
+  printf("%u power-on states, %lu clocks, majority of %lu states writes %lu "
+         "bits.\n", SWEEP_STATES, (unsigned long)job.num_clocks,
+         (unsigned long)best, (unsigned long)bits);
+  printf("%u states differ from the majority.\n", differ);
+  for (i = 0; i < SWEEP_STATES; ++i)
+  {
+    if (crc[i] != majority_crc)
     {
-      /* If the end of comment was seen, we're out of the comment. */
-      in_comment = in_comment ^ end_comment;
+      for (j = 0; j < num_power_init; ++j)
+      {
+        putchar('0' + ((i >> j) & 1));
+      }
+      printf(" first differs at clock %lu\n", (unsigned long)diverge[i] + 1);
+    }
+  }
+
+  free(ref);
+  free(clocks);
+  return 0;
+}
 
-      /* Get the next character. */
-      ch = fgetc(state->in_file);
-      if (ch == EOF)
+/* Items on the screen that each show one bit of state. The instruction
+   register VFDs come first so bit N is INST VFD N, and the controls are in the
+   same order as the controls enum. */
+typedef enum display_item_
+{
+  di_inst0,
+  di_inst1,
+  di_inst2,
+  di_inst3,
+  di_ien,
+  di_logic,
+  di_cr,
+  di_rr,
+  di_oen,
+  di_skip,
+  di_data,
+  di_write,
+  di_flg0,
+  di_jump,
+  di_return,
+  di_flgf,
+  di_i3,
+  di_i2,
+  di_i1,
+  di_i0,
+  di_d,
+  di_clk,
+
+  num_display_items
+} display_item;
+
+/* The CPU and remote VFDs for each VFD item (y < 0 for none). */
+static const coord display_vfds[di_i3][2] =
+{
+  { {INST_VFD0}, {-1, -1} },
+  { {INST_VFD1}, {-1, -1} },
+  { {INST_VFD2}, {-1, -1} },
+  { {INST_VFD3}, {-1, -1} },
+  { {IV_VFD}, {-1, -1} },
+  { {LV_VFD}, {-1, -1} },
+  { {CR_VFD}, {-1, -1} },
+  { {RR_VFD}, {REMOTE_RR_VFD} },
+  { {OEN_VFD}, {-1, -1} },
+  { {SKIP_VFD}, {-1, -1} },
+  { {-1, -1}, {REMOTE_DATA_VFD} },
+  { {WRITE_VFD}, {REMOTE_WRITE_VFD} },
+  { {FLG0_VFD}, {REMOTE_FLG0_VFD} },
+  { {JUMP_VFD}, {REMOTE_JUMP_VFD} },
+  { {RETURN_VFD}, {REMOTE_RETURN_VFD} },
+  { {FLGF_VFD}, {REMOTE_FLGF_VFD} }
+};
+
+/* The same for the --baud layout, where the outputs are only on the
+   remote. */
+static const coord compact_vfds[di_i3][2] =
+{
+  { {COMPACT_INST0_VFD}, {-1, -1} },
+  { {COMPACT_INST1_VFD}, {-1, -1} },
+  { {COMPACT_INST2_VFD}, {-1, -1} },
+  { {COMPACT_INST3_VFD}, {-1, -1} },
+  { {COMPACT_IV_VFD}, {-1, -1} },
+  { {COMPACT_LV_VFD}, {-1, -1} },
+  { {COMPACT_CR_VFD}, {-1, -1} },
+  { {COMPACT_RR_VFD}, {REMOTE_RR_VFD} },
+  { {COMPACT_OEN_VFD}, {-1, -1} },
+  { {COMPACT_SKIP_VFD}, {-1, -1} },
+  { {-1, -1}, {REMOTE_DATA_VFD} },
+  { {-1, -1}, {REMOTE_WRITE_VFD} },
+  { {-1, -1}, {REMOTE_FLG0_VFD} },
+  { {-1, -1}, {REMOTE_JUMP_VFD} },
+  { {-1, -1}, {REMOTE_RETURN_VFD} },
+  { {-1, -1}, {REMOTE_FLGF_VFD} }
+};
+
+/* Return the display_item bits for the given panel. */
+static unsigned display_items(const panel_state *panel)
+{
+  unsigned i;
+  const cpu_state *cpu = &panel->cpu;
+  unsigned items = (unsigned)cpu->ir & 0xf;
+
+  /* Registers. */
+  items |= cpu->ien << di_ien;
+  items |= (cpu->outputs & co_logic ? 1u : 0) << di_logic;
+  items |= cpu->cr << di_cr;
+  items |= cpu->rr << di_rr;
+  items |= cpu->oen << di_oen;
+  items |= cpu->skip << di_skip;
+
+  /* Outputs. */
+  items |= panel->data_line << di_data;
+  items |= (cpu->outputs & co_write ? 1u : 0) << di_write;
+  items |= (cpu->outputs & co_flg0 ? 1u : 0) << di_flg0;
+  items |= (cpu->outputs & co_jump ? 1u : 0) << di_jump;
+  items |= (cpu->outputs & co_return ? 1u : 0) << di_return;
+  items |= (cpu->outputs & co_flgf ? 1u : 0) << di_flgf;
+
+  /* Controls. */
+  for (i = c_i3; i < num_controls; ++i)
+  {
+    items |= panel->control_states[i] << (di_i3 + i);
+  }
+
+  return items;
+}
+
+/* Draw whatever in the frame differs from what is on the screen. Returns
+   roughly how many bytes that sends to the terminal (0 if nothing was
+   drawn). The screen is not refreshed. */
+static unsigned render(machine_state *state, const panel_frame *frame)
+{
+  unsigned i;
+  unsigned j;
+  unsigned on;
+  const coord *c;
+  unsigned items = frame->items;
+  unsigned changed = items ^ state->shown_items;
+  unsigned drawn = 0;
+  const coord (*vfds)[2] = state->baud ? compact_vfds : display_vfds;
+
+  /* VFDs. */
+  for (i = di_inst0; i < di_i3; ++i)
+  {
+    if (changed & (1u << i))
+    {
+      on = (items >> i) & 1;
+      for (j = 0; j < 2; ++j)
       {
-        /* If it was an error, quit. */
-        if (ferror(state->in_file))
+        c = vfds[i] + j;
+        if (c->y >= 0)
         {
-          state->error = "Error reading input file.";
-          return 'q';
+          draw_vfd(state, c->y, c->x, on);
+          drawn += MOVE_BYTES + 1;
         }
+      }
+    }
+  }
 
-        /* Close the file if not an error. */
-        if (fclose(state->in_file) != 0)
-        {
-          state->error = "Error closing input file.";
-          return 'q';
-        }
+  /* Binary controls: highlight the selected value and set the VFD. */
+  for (i = c_i3; i < c_clk; ++i)
+  {
+    if (changed & (1u << (di_i3 + i)))
+    {
+      on = (items >> (di_i3 + i)) & 1;
+      c = binary_controls[i] + (on ? bci_0 : bci_1);
+      CONTROL_OFF_YX(state->screen, c->y, c->x);
+      c = binary_controls[i] + (on ? bci_1 : bci_0);
+      CONTROL_ON_YX(state->screen, c->y, c->x);
+      c = binary_controls[i] + bci_vfd;
+      draw_vfd(state, c->y, c->x, on);
+      drawn += 3 * (MOVE_BYTES + 1);
+    }
+  }
 
-        /* The input file is exhausted so switch back to interactive. */
-        state->in_file = NULL;
-        nocbreak();
-        cbreak();
-      }
-      else if (in_comment)
-      {
-        /* Check if the end of the comment was found. */
-        end_comment = ch == '\n';
-      }
-      else if (ch == ';')
-      {
-        /* Keep reading until a newline. */
-        in_comment = 1;
-        end_comment = 0;
-      }
-      else if (ch == '\r')
+  /* The clock lights the whole clock button while high. */
+  if (changed & (1u << di_clk))
+  {
+    on = (items >> di_clk) & 1;
+    draw_vfd(state, REMOTE_C_VFD, on);
+    if (on)
+    {
+      CONTROL_ON(state->screen, REMOTE_CLK_C);
+      CONTROL_ON(state->screen, REMOTE_CLK_L);
+      CONTROL_ON(state->screen, REMOTE_CLK_K);
+    }
+    else
+    {
+      CONTROL_OFF(state->screen, REMOTE_CLK_C);
+      CONTROL_OFF(state->screen, REMOTE_CLK_L);
+      CONTROL_OFF(state->screen, REMOTE_CLK_K);
+    }
+    drawn += 4 * (MOVE_BYTES + 1);
+  }
+  state->shown_items = items;
+
+  /* Status, and the counters under it. */
+  if (strcmp(frame->status, state->shown_status) != 0)
+  {
+    DRAW_STATUS(state->screen, frame->status);
+    strcpy(state->shown_status, frame->status);
+    drawn += MOVE_BYTES + 25;
+  }
+  if (frame->clocks != state->shown_clocks)
+  {
+    draw_hud(state, frame->clocks);
+    drawn += MOVE_BYTES + 25;
+  }
+
+  /* Cursor last as it also leaves the curses cursor there. */
+  if (frame->control != state->shown_control)
+  {
+    if (state->shown_control < num_controls)
+    {
+      c = binary_controls[state->shown_control] + bci_pointer;
+      POINTER_OFF(state->screen, c->y, c->x);
+    }
+    c = binary_controls[frame->control] + bci_pointer;
+    POINTER_ON(state->screen, c->y, c->x);
+    state->shown_control = (controls)frame->control;
+    drawn += 2 * (MOVE_BYTES + 1);
+  }
+
+  return drawn;
+}
+
+/* Make a frame of what the screen shows from the state. */
+static void take_frame(const machine_state *state, panel_frame *frame)
+{
+  frame->items = display_items(&state->panel);
+  frame->control = state->panel.control;
+  frame->clocks = stats_clocks(&state->stats, 0);
+  snprintf(frame->status, sizeof(frame->status), "%s", state->status);
+}
+
+/* Hand the screen's state to the render thread. This never waits for it. */
+static void publish(machine_state *state)
+{
+  panel_frame frame;
+
+  take_frame(state, &frame);
+  frame_publish(&state->frame, &frame);
+}
+
+/* Draw the latest frame at most --fps times a second, however fast they
+   come, until told to stop, and then draw the last one.
+
+   With --baud, the line can only take so many bytes a second (a start and
+   stop bit to each), so drawing is paid for out of a budget that fills at
+   that rate. When a frame overdraws it, the frames after it are skipped
+   until it has filled again, and whatever changed meanwhile is drawn
+   together, once. A frame is also skipped while the terminal still has
+   output queued (where that can be told), so the line never holds more
+   than one frame. The machine never waits for any of this. */
+static void *render_thread(void *arg)
+{
+  machine_state *state = (machine_state *)arg;
+  panel_frame frame;
+  unsigned seq;
+  unsigned shown_seq = 1;
+  unsigned stop;
+  unsigned due;
+  unsigned long long now;
+  unsigned long long next = sched_now();
+  unsigned long long earned = next;
+  double rate = state->baud / 10.0;
+#ifdef TIOCOUTQ
+  int queued;
+#endif
+
+  do
+  {
+    stop = (unsigned)atomic_load(&state->stop_render);
+    seq = frame_read(&state->frame, &frame);
+    due = seq != shown_seq;
+    if (due && state->baud)
+    {
+      now = sched_now();
+      state->baud_bytes += (double)(now - earned) * rate / 1e9;
+      if (state->baud_bytes > rate * BAUD_BURST / 1e9)
       {
-        /* Treat carriage return like a single-character comment. */
-        in_comment = 1;
-        end_comment = 1;
+        state->baud_bytes = rate * BAUD_BURST / 1e9;
       }
-      else
+      earned = now;
+      due = state->baud_bytes >= 0;
+#ifdef TIOCOUTQ
+      if (ioctl(STDOUT_FILENO, TIOCOUTQ, &queued) == 0 && queued > 0)
       {
-        /* If not EOF or error, return the charcter read. */
-        return ch;
+        due = 0;
       }
+#endif
+
+      /* The last frame is drawn whatever it costs. */
+      due |= stop;
+    }
+    if (due)
+    {
+      pthread_mutex_lock(&state->curses_lock);
+      state->baud_bytes -= render(state, &frame);
+      wrefresh(state->screen);
+      pthread_mutex_unlock(&state->curses_lock);
+      shown_seq = seq;
+    }
+
+    /* Frames missed while the terminal was slow are skipped rather than
+       drawn back to back. */
+    next += state->fps ? 1000000000ull / state->fps : RENDER_POLL;
+    if (next < sched_now())
+    {
+      next = sched_now();
+    }
+    if (!stop)
+    {
+      sched_sleep_until(next);
+    }
+  } while (!stop);
+  return NULL;
+}
+
+/* Read keys and queue them for the machine until told to stop. Reading
+   does not wait, so the curses lock is only held while a key is taken;
+   with none, this thread waits without it. */
+static void *input_thread(void *arg)
+{
+  int ch;
+  machine_state *state = (machine_state *)arg;
+
+  while (!atomic_load(&state->stop_input))
+  {
+    pthread_mutex_lock(&state->curses_lock);
+    ch = wgetch(state->input);
+    pthread_mutex_unlock(&state->curses_lock);
+    if (ch == ERR)
+    {
+      sched_sleep_until(sched_now() + INPUT_POLL);
+      continue;
     }
-    while (in_comment);
+
+    /* Keys are not dropped; a full queue waits for the machine. */
+    while (key_push(&state->keys, ch) &&
+           !atomic_load(&state->stop_input))
+    {
+      sched_sleep_until(sched_now() + RENDER_POLL);
+    }
+  }
+  return NULL;
+}
+
+/* Run a step of the input file or the history, by table lookup with
+   --table. */
+static unsigned run_step(const machine_state *state, panel_state *panel,
+                         const program_step *step)
+{
+  return state->table ? program_step_run_with(panel, step, table_clock_high) :
+                        program_step_run(panel, step);
+}
+
+static unsigned script_step(machine_state *state)
+{
+  unsigned short entry;
+  unsigned events;
+  unsigned clk;
+  unsigned in_cycle = state->in_cycle;
+  program_step step = state->prog.steps[state->step];
+  cpu_state before;
+
+  if (state->paced)
+  {
+    /* Each edge of a 'k' gets its own slot in the schedule, so run it as a
+       rising edge and then, next time, as a falling edge. */
+    if (step.type == st_cycle)
+    {
+      step.type = state->in_cycle ? st_low : st_high;
+      state->in_cycle ^= 1;
+    }
+    if (step.type == st_high || step.type == st_low)
+    {
+      sched_wait(&state->sched);
+    }
+  }
+  else if (!state->headless)
+  {
+    /* Take as long as the keystrokes would have. */
+    script_delay(state, step.keys);
+  }
+
+  /* Move on unless half way through a 'k'. */
+  entry = history_entry(&step, state->in_cycle ? HISTORY_SPLIT :
+                                                 HISTORY_ADVANCE);
+  history_log(state, &state->panel, in_cycle, &entry, 1);
+  if (!state->in_cycle)
+  {
+    state->pos = state->prog.sources[state->step++].end;
+  }
+  if (!state->per_edge)
+  {
+    return run_step(state, &state->panel, &step);
+  }
+
+  /* Recording and breakpoints need the state after each edge, but a 'k' is
+     still run as one step: a falling edge only takes the write line low, so
+     the CPU after each of its earlier edges follows from the one before or
+     after the step. */
+  before = state->panel.cpu;
+  clk = state->panel.control_states[c_clk];
+  events = run_step(state, &state->panel, &step);
+  if (step.type == st_cycle)
+  {
+    if (clk)
+    {
+      before.outputs &= ~(unsigned)co_write;
+      record_edge(state, step.inst, &before, 0);
+    }
+    before = state->panel.cpu;
+    before.outputs |= events & pe_write ? co_write : 0;
+    record_edge(state, step.inst, &before, 1);
+  }
+  if (events & (pe_clock_high | pe_clock_low))
+  {
+    record_edge(state, step.inst, &state->panel.cpu,
+                state->panel.control_states[c_clk]);
+  }
+  return events;
+}
+
+/* Carry on with the input file from a breakpoint, on the switches as they
+   were left there (see program_resume()). A new compile of the rest of the
+   file starts a new block of history, as going back counts its way through
+   the steps of one compile. */
+static void resume_file(machine_state *state)
+{
+  size_t first;
+  const char *error;
+
+  if (!state->scripted)
+  {
+    return;
   }
+  error = program_resume(&state->prog, state->step, state->pos,
+                         state->in_cycle, &state->panel, &first);
+  if (error != NULL)
+  {
+    state->error = error;
+  }
+  else if (first != state->step)
+  {
+    state->step = first;
+    state->in_cycle = 0;
+    state->new_block = 1;
+  }
+}
 
-  /* Otherwise get the next character from curses. */
-  return getch();
+static void script_delay(machine_state *state, unsigned keys)
+{
+  /* Wait the delay time once per keystroke. A key press cuts the wait for
+     that keystroke short (the key is otherwise ignored). */
+  while (keys-- > 0)
+  {
+    key_wait(&state->keys,
+             sched_now() + (unsigned long long)state->prog.delay * 1000000ull);
+  }
 }
 
 static void write_data(machine_state *state, unsigned bit)
@@ -2435,10 +3266,11 @@ static void write_data(machine_state *state, unsigned bit)
   /* If all bits are set in the byte, write it out. */
   if (state->bits_set == 8)
   {
-    if (fputc(state->curr_byte, state->out_file) != state->curr_byte)
+    if (writer_put(&state->writer, (unsigned char)state->curr_byte))
     {
       state->error = "Error writing output file.";
     }
+    ++state->out_bytes;
 
     /* And reset to start the next. */
     state->curr_byte = 0;
@@ -2446,3 +3278,745 @@ static void write_data(machine_state *state, unsigned bit)
   }
 }
 
+/* Load the snapshot and carry on from it. Returns 0 on error. */
+static int restore(machine_state *state, const char *snap_name)
+{
+  snapshot snap;
+  const char *error = snap_load(snap_name, &snap);
+
+  if (error != NULL)
+  {
+    fprintf(stderr, "%s\n", error);
+    return 0;
+  }
+  if (snap.prog_hash != snap_program_hash(&state->prog) ||
+      snap.pos > state->prog.text_len)
+  {
+    fputs("The snapshot was taken with a different input file.\n", stderr);
+    return 0;
+  }
+
+  /* Carry on from the keystroke the snapshot got to, compiling the rest of
+     the file from the switches as they were then. */
+  if (state->scripted)
+  {
+    state->step = state->prog.num_steps;
+    error = program_compile(&state->prog, (size_t)snap.pos, &snap.panel);
+    if (error != NULL)
+    {
+      fprintf(stderr, "%s\n", error);
+      return 0;
+    }
+  }
+  state->panel = snap.panel;
+  state->pos = (size_t)snap.pos;
+  state->clocks = snap.clocks;
+  state->out_bytes = snap.out_bytes;
+  state->curr_byte = snap.curr_byte;
+  state->bits_set = snap.bits_set;
+  state->restored = 1;
+  return 1;
+}
+
+/* Open the output file ("-" for stdout). After a restore, the file is kept
+   up to the bytes written when the snapshot was taken and the rest is cut
+   off, as it was written after the snapshot. Returns NULL on error. */
+static FILE *open_output(machine_state *state, const char *out_name)
+{
+  FILE *out_file;
+  long size;
+
+  if (strcmp(out_name, "-") == 0)
+  {
+    return stdout;
+  }
+  if (!state->restored)
+  {
+    out_file = fopen(out_name, "wb");
+    if (out_file == NULL)
+    {
+      fputs("Error opening output file.\n", stderr);
+    }
+    return out_file;
+  }
+
+  out_file = fopen(out_name, "r+b");
+  if (out_file == NULL && state->out_bytes == 0)
+  {
+    out_file = fopen(out_name, "wb");
+  }
+  if (out_file == NULL)
+  {
+    fputs("Error opening output file.\n", stderr);
+    return NULL;
+  }
+  if (fseek(out_file, 0, SEEK_END) != 0 || (size = ftell(out_file)) < 0 ||
+      (unsigned long long)size < state->out_bytes)
+  {
+    fputs("The output file is shorter than when the snapshot was taken.\n",
+          stderr);
+    fclose(out_file);
+    return NULL;
+  }
+  /* The writer thread writes straight to the descriptor, so that is what
+     must be positioned: the stream need not move it back from the end. */
+  if (ftruncate(fileno(out_file), (off_t)state->out_bytes) != 0 ||
+      lseek(fileno(out_file), (off_t)state->out_bytes, SEEK_SET) < 0)
+  {
+    fputs("Error opening output file.\n", stderr);
+    fclose(out_file);
+    return NULL;
+  }
+  return out_file;
+}
+
+/* Count the clocks and what they ran, and save a snapshot when one is due.
+   A 'k' run as two edges under --hz is not split by a snapshot, so a due
+   snapshot waits for the falling edge. */
+static void step_done(machine_state *state, unsigned events)
+{
+  stats_step(&state->stats, &state->panel, events);
+  if (state->shm != NULL)
+  {
+    share_panel(state, 0);
+  }
+  if (events & pe_clock_high)
+  {
+    ++state->clocks;
+    if (state->snap_every != 0 && state->clocks % state->snap_every == 0)
+    {
+      state->snap_due = 1;
+    }
+  }
+  if (state->snap_due && !state->in_cycle && state->error == NULL)
+  {
+    state->snap_due = 0;
+    save_snapshot(state);
+  }
+}
+
+static void take_snapshot(const machine_state *state, snapshot *snap)
+{
+  snap->panel = state->panel;
+  snap->prog_hash = 0;
+  snap->step = state->step;
+  snap->pos = state->pos;
+  snap->clocks = state->clocks;
+  snap->out_bytes = state->out_bytes;
+  snap->curr_byte = state->curr_byte;
+  snap->bits_set = state->bits_set;
+}
+
+static void save_snapshot(machine_state *state)
+{
+  snapshot snap;
+
+  /* The output file must hold every byte the snapshot says it does. */
+  if (state->out_file != NULL && writer_flush(&state->writer))
+  {
+    state->error = "Error writing output file.";
+    return;
+  }
+
+  take_snapshot(state, &snap);
+  snap.prog_hash = snap_program_hash(&state->prog);
+  state->error = snap_save(state->snap_name, &snap);
+}
+
+/* Log the entries for a step about to change the panel from before (with
+   the given in_cycle). The rest of the state must not have changed yet. */
+static void history_log(machine_state *state, const panel_state *before,
+                        unsigned in_cycle, const unsigned short *entries,
+                        unsigned num_entries)
+{
+  unsigned i;
+  snapshot snap;
+
+  if (state->hist.num_blocks == 0)
+  {
+    return;
+  }
+  if (state->new_block || !history_room(&state->hist, num_entries))
+  {
+    state->new_block = 0;
+    take_snapshot(state, &snap);
+    snap.panel = *before;
+    history_checkpoint(&state->hist, &snap, &state->stats, in_cycle);
+  }
+  for (i = 0; i < num_entries; ++i)
+  {
+    history_add(&state->hist, entries[i]);
+  }
+}
+
+/* Go back to the given number of entries into the given block of the
+   history, and forget what came after. */
+static void go_back(machine_state *state, size_t block, size_t used)
+{
+  size_t i;
+  unsigned events;
+  unsigned short entry;
+  program_step step;
+  history_block *b = history_block_at(&state->hist, block);
+  const unsigned short *entries = history_entries(&state->hist, b);
+
+  /* Start from the checkpoint. */
+  state->panel = b->start.panel;
+  state->step = (size_t)b->start.step;
+  state->pos = (size_t)b->start.pos;
+  state->clocks = b->start.clocks;
+  state->out_bytes = b->start.out_bytes;
+  state->curr_byte = b->start.curr_byte;
+  state->bits_set = b->start.bits_set;
+  state->stats = b->stats;
+  state->in_cycle = b->in_cycle;
+
+  /* Run the entries again, counting them afresh. The output they give is
+     already in the file. */
+  for (i = 0; i < used; ++i)
+  {
+    entry = entries[i];
+    step = history_step(entry);
+    events = run_step(state, &state->panel, &step);
+    stats_step(&state->stats, &state->panel, events);
+    if ((events & pe_write) && state->out_file != NULL)
+    {
+      state->curr_byte |= state->panel.cpu.bus << state->bits_set;
+      if (++state->bits_set == 8)
+      {
+        ++state->out_bytes;
+        state->curr_byte = 0;
+        state->bits_set = 0;
+      }
+    }
+    if (events & pe_clock_high)
+    {
+      ++state->clocks;
+    }
+    if (entry & HISTORY_ADVANCE)
+    {
+      state->pos = state->prog.sources[state->step++].end;
+    }
+    state->in_cycle = (entry & HISTORY_SPLIT) != 0;
+  }
+  history_cut(&state->hist, block, used);
+  trim_output(state);
+  sync_breaks(state);
+  if (state->vcd_file != NULL)
+  {
+    vcd_comment_back(&state->vcd, state->clocks);
+  }
+
+  /* Back in the input file, it waits as at a breakpoint. */
+  if (state->pos < state->prog.text_len)
+  {
+    state->scripted = 1;
+    state->in_break = 1;
+    snprintf(state->message, sizeof(state->message),
+             "Clock %llu. B to resume.", state->clocks);
+  }
+  else
+  {
+    snprintf(state->message, sizeof(state->message), "Back to clock %llu.",
+             state->clocks);
+  }
+  state->status = state->message;
+}
+
+static void step_back(machine_state *state)
+{
+  if (state->hist.count == 0)
+  {
+    state->status = "No history to go back to.";
+    return;
+  }
+  go_back(state, state->hist.count - 1,
+          history_block_at(&state->hist, state->hist.count - 1)->used - 1);
+}
+
+/* Ask for a clock number and go back to just after that clock. */
+static void clock_back(machine_state *state)
+{
+  int ch;
+  size_t i;
+  size_t len = 0;
+  unsigned long long clock = 0;
+  char digits[11];
+  history_block *b;
+  const unsigned short *entries;
+  program_step step;
+  panel_state panel;
+  unsigned long long clocks;
+
+  /* Read the number. Anything but digits, backspace or enter cancels. */
+  for (;;)
+  {
+    digits[len] = '\0';
+    snprintf(state->message, sizeof(state->message), "Back to clock: %s",
+             digits);
+    state->status = state->message;
+    publish(state);
+    ch = next_key(state);
+    if (ch >= '0' && ch <= '9' && len + 1 < sizeof(digits))
+    {
+      digits[len++] = (char)ch;
+    }
+    else if ((ch == KEY_BACKSPACE || ch == '\b' || ch == 127) && len > 0)
+    {
+      --len;
+    }
+    else if ((ch == '\r' || ch == '\n' || ch == KEY_ENTER) && len > 0)
+    {
+      break;
+    }
+    else
+    {
+      state->status = instructions[GET_INSTR(&state->panel)];
+      return;
+    }
+  }
+  clock = strtoull(digits, NULL, 10);
+
+  if (clock > state->clocks)
+  {
+    state->status = "Clock not reached yet.";
+    return;
+  }
+
+  /* Find the newest block starting before the clock, then the first entry
+     of it that reaches the clock. */
+  for (i = state->hist.count; i-- > 0; )
+  {
+    b = history_block_at(&state->hist, i);
+    if (b->start.clocks < clock)
+    {
+      entries = history_entries(&state->hist, b);
+      panel = b->start.panel;
+      clocks = b->start.clocks;
+      for (len = 0; len < b->used && clocks < clock; ++len)
+      {
+        step = history_step(entries[len]);
+        clocks += (run_step(state, &panel, &step) & pe_clock_high) != 0;
+      }
+      go_back(state, i, len);
+      return;
+    }
+  }
+  if (state->hist.count != 0 &&
+      history_block_at(&state->hist, 0)->start.clocks == clock)
+  {
+    go_back(state, 0, 0);
+    return;
+  }
+  state->status = "Clock is too long ago.";
+}
+
+/* Cut the output file back to the bytes written so far, after going back.
+   Stdout cannot be. */
+static void trim_output(machine_state *state)
+{
+  if (state->out_file == NULL || state->out_file == stdout)
+  {
+    return;
+  }
+  if (writer_flush(&state->writer) ||
+      ftruncate(state->writer.fd, (off_t)state->out_bytes) != 0 ||
+      lseek(state->writer.fd, (off_t)state->out_bytes, SEEK_SET) < 0)
+  {
+    state->error = "Error writing output file.";
+  }
+}
+
+/* Record a clock edge, with the switches (as in program_step), the CPU
+   after it and the clock level it left, in the trace and VCD files and
+   check the breakpoints. */
+static void record_edge(machine_state *state, unsigned inst,
+                        const cpu_state *cpu, unsigned clk)
+{
+  unsigned hit;
+
+  if (state->trace_file != NULL)
+  {
+    trace_put(&state->trace, trace_record(inst, cpu, clk));
+    if (state->trace.error)
+    {
+      state->error = "Error writing trace file.";
+    }
+  }
+  if (state->vcd_file != NULL)
+  {
+    vcd_edge(&state->vcd, inst, cpu, clk);
+    if (state->vcd.error)
+    {
+      state->error = "Error writing VCD file.";
+    }
+  }
+  if (state->breaks.count != 0)
+  {
+    hit = break_check(&state->breaks, inst, cpu, clk);
+    if (state->break_hit == 0)
+    {
+      state->break_hit = hit;
+    }
+  }
+}
+
+/* Record the clock edges a key took the panel through from before.
+   Only the state after the last edge is known, so any edges before that are
+   run again on a copy to see the state after each. */
+static void record_edges(machine_state *state, const panel_state *before,
+                         unsigned events)
+{
+  unsigned edges;
+  unsigned inst;
+  panel_state mid;
+  const panel_state *panel = &state->panel;
+
+  if (!state->per_edge || !(events & (pe_clock_high | pe_clock_low)))
+  {
+    return;
+  }
+
+  /* A rising and a falling edge that leave the clock where it was are two
+     edges; otherwise three (a 'k' step from high). */
+  edges = (events & (pe_clock_high | pe_clock_low)) !=
+          (pe_clock_high | pe_clock_low) ? 1 :
+          panel->control_states[c_clk] == before->control_states[c_clk] ?
+          2 : 3;
+  inst = GET_INSTR(panel) | panel->control_states[c_d] << 4;
+  if (edges > 1)
+  {
+    mid = *panel;
+    mid.cpu = before->cpu;
+    mid.control_states[c_clk] = before->control_states[c_clk];
+    while (--edges > 0)
+    {
+      panel_toggle_clock(&mid);
+      record_edge(state, inst, &mid.cpu, mid.control_states[c_clk]);
+    }
+  }
+  record_edge(state, inst, &panel->cpu, panel->control_states[c_clk]);
+}
+
+/* Start the breakpoints counting from where the run is. The bits written
+   are only known with an output file; without one they carry on. */
+static void sync_breaks(machine_state *state)
+{
+  break_set *breaks = &state->breaks;
+
+  if (breaks->count == 0)
+  {
+    return;
+  }
+  if (state->out_file != NULL)
+  {
+    break_sync(breaks, state->clocks,
+               state->out_bytes * 8 + state->bits_set, state->curr_byte,
+               state->bits_set);
+  }
+  else
+  {
+    break_sync(breaks, state->clocks, breaks->now[bv_writes],
+               breaks->curr_byte, breaks->bits_set);
+  }
+}
+
+/* If a breakpoint went off in the last step, say which and return 1. */
+static unsigned break_stop(machine_state *state)
+{
+  unsigned hit = state->break_hit;
+
+  if (hit == 0)
+  {
+    return 0;
+  }
+  state->break_hit = 0;
+  if (state->headless)
+  {
+    fprintf(stderr, "Breakpoint %u (%s) at clock %llu.\n", hit,
+            state->breaks.points[hit - 1].text, state->clocks);
+  }
+  else
+  {
+    snprintf(state->message, sizeof(state->message), "Break %u at clock %llu.",
+             hit % 100, state->clocks);
+    state->status = state->message;
+  }
+  return 1;
+}
+
+/* Show the clocks so far and the clock rate (against --hz) along the bottom
+   of the STATUS window. The rate is over the last HUD_INTERVAL or more. */
+static void draw_hud(machine_state *state, unsigned long long clocks)
+{
+  char rate[32];
+  char text[64];
+  const char *unit = "Hz";
+  double scale = 1;
+  double target = state->paced ? state->sched.hz : 0;
+  unsigned long long now = sched_now();
+
+  if (now - state->hud_time >= HUD_INTERVAL)
+  {
+    state->hud_hz = (double)(clocks - state->hud_clocks) * 1e9 /
+                    (double)(now - state->hud_time);
+    state->hud_clocks = clocks;
+    state->hud_time = now;
+  }
+
+  /* Both rates in the unit of the larger. */
+  if (state->hud_hz >= 1e6 || target >= 1e6)
+  {
+    unit = "MHz";
+    scale = 1e6;
+  }
+  else if (state->hud_hz >= 1e3 || target >= 1e3)
+  {
+    unit = "kHz";
+    scale = 1e3;
+  }
+  if (state->paced)
+  {
+    snprintf(rate, sizeof(rate), "%.3g/%.3g %s", state->hud_hz / scale,
+             target / scale, unit);
+  }
+  else
+  {
+    snprintf(rate, sizeof(rate), "%.3g %s", state->hud_hz / scale, unit);
+  }
+  snprintf(text, sizeof(text), " %llu clk %s ", clocks, rate);
+  text[23] = '\0';
+
+  mvwhline(state->screen, STATUS_Y + 1, STATUS_X, ACS_HLINE, 25);
+  mvwaddstr(state->screen, STATUS_Y + 1, STATUS_X + 1, text);
+  state->shown_clocks = clocks;
+}
+
+/* Write the counters to the --stats file. */
+static void report_stats(machine_state *state)
+{
+  FILE *file;
+  size_t len = strlen(state->stats_name);
+  unsigned json = len >= 5 &&
+                  strcmp(state->stats_name + len - 5, ".json") == 0;
+  double seconds = (double)(sched_now() - state->run_start) / 1e9;
+  int error;
+
+  if (strcmp(state->stats_name, "-") == 0)
+  {
+    stats_report(&state->stats, stderr, 0, state->out_bytes, seconds,
+                 state->paced ? state->sched.hz : 0);
+    return;
+  }
+  file = fopen(state->stats_name, "w");
+  if (file == NULL)
+  {
+    fputs("Error opening stats file.\n", stderr);
+    return;
+  }
+  error = stats_report(&state->stats, file, json, state->out_bytes, seconds,
+                       state->paced ? state->sched.hz : 0);
+  if (fclose(file) != 0 || error)
+  {
+    fputs("Error writing stats file.\n", stderr);
+  }
+}
+
+/* Publish the state to the --shm panel, with the given extra SHM_ flags. */
+static void share_panel(machine_state *state, unsigned flags)
+{
+  shm_state shared;
+  const panel_state *panel = &state->panel;
+
+  shared.clocks = state->clocks;
+  shared.writes = state->stats.writes;
+  shared.vfds = display_items(panel) & ((1u << di_i3) - 1);
+  shared.switches = GET_INSTR(panel) | panel->control_states[c_d] << 4 |
+                    panel->control_states[c_clk] << 5;
+  shared.control = panel->control;
+  shared.flags = flags | (state->scripted && !state->in_break ?
+                          SHM_SCRIPTED : 0) |
+                 (state->in_break ? SHM_BREAK : 0);
+  shared.ir = (uint8_t)panel->cpu.ir;
+  shared.ien = (uint8_t)panel->cpu.ien;
+  shared.oen = (uint8_t)panel->cpu.oen;
+  shared.rr = (uint8_t)panel->cpu.rr;
+  shared.cr = (uint8_t)panel->cpu.cr;
+  shared.skip = (uint8_t)panel->cpu.skip;
+  shared.outputs = (uint8_t)panel->cpu.outputs;
+  shared.bus = (uint8_t)panel->cpu.bus;
+  shm_publish(state->shm, &shared);
+}
+
+/* Take the next key for the machine: the next one in the --replay
+   recording, at the pace it was typed (a key press skips the wait, and
+   headless there is no wait), or else the next one typed. Each is recorded
+   for --record. At the end of a recording, or if the replay has gone a
+   different way from it, the session quits. */
+static int next_key(machine_state *state)
+{
+  int ch;
+
+  if (!state->replaying)
+  {
+    ch = key_wait(&state->keys, ~0ull);
+  }
+  else if (session_next(&state->play, &ch) != 1)
+  {
+    ch = 'q';
+  }
+  else if (state->play.clocks != state->clocks)
+  {
+    snprintf(state->diverged, sizeof(state->diverged),
+             "Replay went a different way: key %llu was at clock %llu, not "
+             "%llu.", state->play.keys, state->play.clocks, state->clocks);
+    state->error = state->diverged;
+    ch = 'q';
+  }
+  else if (!state->headless)
+  {
+    key_wait(&state->keys,
+             state->session_start + state->play.ms * 1000000ull);
+  }
+
+  if (state->recording)
+  {
+    session_key(&state->rec, ch,
+                (sched_now() - state->session_start) / 1000000ull,
+                state->clocks);
+  }
+  return ch;
+}
+
+/* Returns the name of the first part of two snapshots that differs, or NULL
+   if they match apart from the program hash. */
+static const char *snapshot_difference(const snapshot *a, const snapshot *b)
+{
+  unsigned i;
+  const cpu_state *x = &a->panel.cpu;
+  const cpu_state *y = &b->panel.cpu;
+
+  if (a->step != b->step)
+  {
+    return "input file step";
+  }
+  if (a->clocks != b->clocks)
+  {
+    return "clock count";
+  }
+  if (a->out_bytes != b->out_bytes)
+  {
+    return "output byte count";
+  }
+  if (a->panel.control != b->panel.control)
+  {
+    return "switches";
+  }
+  for (i = 0; i < num_controls; ++i)
+  {
+    if (a->panel.control_states[i] != b->panel.control_states[i])
+    {
+      return "switches";
+    }
+  }
+  if (a->panel.data_line != b->panel.data_line)
+  {
+    return "data line";
+  }
+  if (x->ir != y->ir)
+  {
+    return "IR";
+  }
+  if (x->ien != y->ien)
+  {
+    return "IEN";
+  }
+  if (x->oen != y->oen)
+  {
+    return "OEN";
+  }
+  if (x->rr != y->rr)
+  {
+    return "RR";
+  }
+  if (x->cr != y->cr)
+  {
+    return "carry";
+  }
+  if (x->skip != y->skip)
+  {
+    return "skip";
+  }
+  if (x->outputs != y->outputs)
+  {
+    return "outputs";
+  }
+  if (x->bus != y->bus)
+  {
+    return "data bus";
+  }
+  if (a->curr_byte != b->curr_byte || a->bits_set != b->bits_set)
+  {
+    return "byte being written";
+  }
+  if (a->pos != b->pos)
+  {
+    return "input file position";
+  }
+  return NULL;
+}
+
+/* Finish the --record file with the final state, and check the state at
+   the end of a --replay against the recording's. */
+static void end_session(machine_state *state)
+{
+  int key;
+  int got;
+  const char *what;
+  snapshot snap;
+
+  take_snapshot(state, &snap);
+  snap.prog_hash = snap_program_hash(&state->prog);
+  if (state->recording && session_end(&state->rec, &snap))
+  {
+    fputs("Error writing the recording file.\n", stderr);
+  }
+  if (!state->replaying)
+  {
+    return;
+  }
+
+  got = session_next(&state->play, &key);
+  if (state->error != NULL)
+  {
+    /* Already failed. */
+  }
+  else if (got < 0)
+  {
+    state->error = "The recording was cut short, so there is no final "
+                   "state to check.";
+  }
+  else if (got > 0)
+  {
+    snprintf(state->diverged, sizeof(state->diverged),
+             "Replay ended at key %llu of the recording.",
+             state->play.keys - 1);
+    state->error = state->diverged;
+  }
+  else
+  {
+    what = snapshot_difference(&snap, &state->play.final);
+    if (what != NULL)
+    {
+      snprintf(state->diverged, sizeof(state->diverged),
+               "Replay ended with a different %s from the recording.", what);
+      state->error = state->diverged;
+    }
+    if (state->error == NULL)
+    {
+      fprintf(stderr, "Replay matches the recording: %llu keys, clock "
+              "%llu.\n", state->play.keys, state->clocks);
+    }
+  }
+  session_close(&state->play);
+}
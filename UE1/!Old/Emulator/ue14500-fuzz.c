@@ -0,0 +1,655 @@
+/* UE14500 differential fuzzer.
+
+   License: Public Domain
+
+   Checks the faster execution engines against the reference one,
+   cpu_clock_high() and cpu_clock_low() in ue14500-core.h. The engines are:
+
+     table  table_clock_high() (ue14500-table.h), one clock per lookup
+     pair   the table_pair lookup used by ue1-emu --table, two clocks at once
+     slice  slice_clock_high() (ue14500-slice.h), a machine per bit lane
+
+   Random programs (a power-on state and a run of instructions, each with
+   its data bit) are run through all of them in lockstep, comparing the
+   registers, bus and output lines after every edge. A batch is one run of
+   instructions under a word of machines, each with its own power-on state
+   and data, so the slice engine runs whole words as it does in a sweep.
+
+   At the first difference, the program of the machine that differed is
+   cut down by delta debugging to as few instructions as still show it, and
+   printed along with the engines that differ. It is also saved (see --save)
+   in the input format used with --replay and libFuzzer: two bytes of
+   power-on state (bit N is the Nth character of the emulator's power-on
+   line), then a byte an instruction, the instruction in bits 0-3 and its
+   data in bit 4.
+   Build and run instructions (there are many ways - use these as a guide):
+
+   Linux/Mac/Windows (MSYS2):
+     - gcc -O2 -o ue14500-fuzz ue14500-fuzz.c
+     - ./ue14500-fuzz --clocks 1000000000
+
+   libFuzzer (clang), for coverage-guided runs:
+     - clang -O1 -g -fsanitize=fuzzer,address -DFUZZ_LIBFUZZER
+         -o ue14500-fuzz ue14500-fuzz.c
+     - ./ue14500-fuzz corpus/
+
+   Command line:
+     ue14500-fuzz [OPTIONS]
+
+     - The options are:
+         --seed N = seed for the random programs (default from the time).
+         --clocks N = stop after N clocks in all (default 100000000).
+         --length N = instructions in a program (default 256).
+         --save FILE = where to save a failing program (default
+                       fuzz-failure.bin).
+         --replay FILE = run the program in FILE instead of fuzzing.
+     - The exit status is 1 if an engine differed.
+*/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "ue14500-core.h"
+#include "ue14500-slice.h"
+#include "ue14500-table.h"
+
+/* Engines, as bits of a mask of those that differ. */
+#define FUZZ_TABLE 1u
+#define FUZZ_PAIR 2u
+#define FUZZ_SLICE 4u
+
+/* Output lines the slice engine does not model. */
+#define FUZZ_NO_SLICE ((unsigned)co_logic)
+
+/* One machine's program. */
+typedef struct fuzz_case_
+{
+  unsigned init;
+  size_t length;
+  unsigned char *clocks;
+} fuzz_case;
+
+/* A batch: a run of instructions, and for each machine (lane) its
+   power-on state and a data bit per instruction. */
+typedef struct fuzz_batch_
+{
+  size_t length;
+  unsigned char *insts;
+  unsigned long long (*data)[SLICE_WORDS];
+  unsigned init[SLICE_LANES];
+} fuzz_batch;
+
+static const char *const engine_names[] = { "table", "pair", "slice" };
+
+static unsigned check_case(const fuzz_case *fc, size_t *where);
+static void report(const fuzz_case *fc, unsigned engines, size_t where);
+#ifndef FUZZ_LIBFUZZER
+static unsigned check_batch(const fuzz_batch *fb, unsigned *lane,
+                            size_t *where);
+static void minimize(fuzz_case *fc, unsigned engines);
+static int save_case(const fuzz_case *fc, const char *path);
+static unsigned long long fuzz_random(unsigned long long *seed);
+#endif
+
+/* Whether two machines match, leaving out the given output lines. */
+static inline unsigned same_cpu(const cpu_state *a, const cpu_state *b,
+                                unsigned ignore)
+{
+  return a->ir == b->ir && a->rr == b->rr && a->cr == b->cr &&
+         a->ien == b->ien && a->oen == b->oen && a->skip == b->skip &&
+         a->bus == b->bus && ((a->outputs ^ b->outputs) & ~ignore) == 0;
+}
+
+/* Whether the pair table agrees with the reference over two clocks: the
+   state after both and the outputs (and bus, if stored) of each. */
+static inline unsigned same_pair(const cpu_state *start,
+                                 const cpu_state *first,
+                                 const cpu_state *second, unsigned inst1,
+                                 unsigned data1, unsigned inst2,
+                                 unsigned data2)
+{
+  uint32_t entry = table_pair[TABLE_PAIR_INDEX(table_state(start),
+                                               inst1, data1, inst2, data2)];
+
+  return (entry & TABLE_STATE) == table_state(second) &&
+         TABLE_OUTPUTS(entry) == (first->outputs & 0x7fu) &&
+         TABLE_OUTPUTS2(entry) == (second->outputs & 0x7fu) &&
+         (!(first->outputs & co_store) || TABLE_BUS(entry) == first->bus) &&
+         (!(second->outputs & co_store) ||
+          TABLE_BUS2(entry) == second->bus);
+}
+
+#ifdef FUZZ_LIBFUZZER
+
+int LLVMFuzzerTestOneInput(const unsigned char *data, size_t size)
+{
+  fuzz_case fc;
+  size_t where;
+  unsigned engines;
+
+  if (size < 2)
+  {
+    return 0;
+  }
+  fc.init = (data[0] | (unsigned)data[1] << 8) & ((1u << num_power_init) - 1);
+  fc.length = size - 2;
+  fc.clocks = (unsigned char *)data + 2;
+  engines = check_case(&fc, &where);
+  if (engines != 0)
+  {
+    report(&fc, engines, where);
+    fflush(stdout);
+    abort();
+  }
+  return 0;
+}
+
+#else
+
+int main(int argc, char **argv)
+{
+  const char *save = "fuzz-failure.bin";
+  const char *replay = NULL;
+  unsigned long long seed = (unsigned long long)time(NULL);
+  unsigned long long limit = 100000000ull;
+  unsigned long long clocks = 0;
+  unsigned long long batches = 0;
+  unsigned long long r;
+  unsigned engines = 0;
+  unsigned lane = 0;
+  unsigned i;
+  size_t length = 256;
+  size_t where = 0;
+  size_t c;
+  fuzz_batch fb;
+  fuzz_case fc;
+  FILE *file;
+  clock_t start;
+  double seconds;
+  int arg;
+  long size;
+
+  for (arg = 1; arg < argc; ++arg)
+  {
+    if (strcmp(argv[arg], "--seed") == 0 && arg + 1 < argc)
+    {
+      seed = strtoull(argv[++arg], NULL, 10);
+    }
+    else if (strcmp(argv[arg], "--clocks") == 0 && arg + 1 < argc)
+    {
+      limit = strtoull(argv[++arg], NULL, 10);
+    }
+    else if (strcmp(argv[arg], "--length") == 0 && arg + 1 < argc)
+    {
+      length = (size_t)strtoull(argv[++arg], NULL, 10);
+    }
+    else if (strcmp(argv[arg], "--save") == 0 && arg + 1 < argc)
+    {
+      save = argv[++arg];
+    }
+    else if (strcmp(argv[arg], "--replay") == 0 && arg + 1 < argc)
+    {
+      replay = argv[++arg];
+    }
+    else
+    {
+      fprintf(stderr, "Unknown option: %s\n", argv[arg]);
+      return 1;
+    }
+  }
+  if (length == 0)
+  {
+    fputs("The --length must be greater than zero.\n", stderr);
+    return 1;
+  }
+
+  /* Run a saved program. */
+  if (replay != NULL)
+  {
+    file = fopen(replay, "rb");
+    if (file == NULL || fseek(file, 0, SEEK_END) != 0 ||
+        (size = ftell(file)) < 2 || fseek(file, 0, SEEK_SET) != 0)
+    {
+      fputs("Error reading the program file.\n", stderr);
+      return 1;
+    }
+    fc.length = (size_t)size - 2;
+    fc.clocks = (unsigned char *)malloc((size_t)size);
+    if (fc.clocks == NULL || fread(fc.clocks, 1, (size_t)size, file) !=
+                             (size_t)size)
+    {
+      fputs("Error reading the program file.\n", stderr);
+      return 1;
+    }
+    fclose(file);
+    fc.init = (fc.clocks[0] | (unsigned)fc.clocks[1] << 8) &
+              ((1u << num_power_init) - 1);
+    memmove(fc.clocks, fc.clocks + 2, fc.length);
+    engines = check_case(&fc, &where);
+    if (engines != 0)
+    {
+      report(&fc, engines, where);
+    }
+    else
+    {
+      printf("%lu clocks, no differences.\n", (unsigned long)fc.length);
+    }
+    free(fc.clocks);
+    return engines != 0;
+  }
+
+  fb.length = length;
+  fb.insts = (unsigned char *)malloc(length);
+  fb.data = (unsigned long long (*)[SLICE_WORDS])
+            malloc(length * sizeof(*fb.data));
+  fc.clocks = (unsigned char *)malloc(length);
+  if (fb.insts == NULL || fb.data == NULL || fc.clocks == NULL)
+  {
+    fputs("Out of memory.\n", stderr);
+    return 1;
+  }
+
+  printf("Seed %llu, %u machines a batch of %lu instructions.\n", seed,
+         SLICE_LANES, (unsigned long)length);
+  start = clock();
+  while (clocks < limit)
+  {
+    /* A random batch. */
+    for (c = 0; c < length; ++c)
+    {
+      r = fuzz_random(&seed);
+      fb.insts[c] = (unsigned char)(r & 0xf);
+      for (i = 0; i < SLICE_WORDS; ++i)
+      {
+        fb.data[c][i] = fuzz_random(&seed);
+      }
+    }
+    for (i = 0; i < SLICE_LANES; ++i)
+    {
+      fb.init[i] = (unsigned)fuzz_random(&seed) &
+                   ((1u << num_power_init) - 1);
+    }
+
+    ++batches;
+    clocks += (unsigned long long)length * SLICE_LANES;
+    engines = check_batch(&fb, &lane, &where);
+    if (engines != 0)
+    {
+      break;
+    }
+  }
+  seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+  printf("%llu clocks in %llu batches, %.1f million clocks a second.\n",
+         clocks, batches, seconds > 0 ? (double)clocks / seconds / 1e6 : 0);
+
+  if (engines != 0)
+  {
+    /* Take out the machine that differed and cut its program down. */
+    fc.init = fb.init[lane];
+    fc.length = where + 1;
+    for (c = 0; c < fc.length; ++c)
+    {
+      fc.clocks[c] = (unsigned char)(fb.insts[c] |
+                                     ((fb.data[c][lane / 64] >>
+                                       (lane % 64)) & 1) << 4);
+    }
+    printf("Machine %u differs at instruction %lu.\n", lane,
+           (unsigned long)where + 1);
+    if (check_case(&fc, &where) == 0)
+    {
+      puts("It does not differ when run on its own, so the lanes affect "
+           "each other.");
+      engines = FUZZ_SLICE;
+    }
+    else
+    {
+      minimize(&fc, engines);
+      engines = check_case(&fc, &where);
+    }
+    report(&fc, engines, where);
+    if (save_case(&fc, save))
+    {
+      fputs("Error saving the program.\n", stderr);
+    }
+    else
+    {
+      printf("Saved to %s.\n", save);
+    }
+  }
+  else
+  {
+    puts("No differences.");
+  }
+
+  free(fb.insts);
+  free(fb.data);
+  free(fc.clocks);
+  return engines != 0;
+}
+
+#endif
+
+/* Run one machine's program through every engine. Returns the engines that
+   differ from the reference, with the instruction where they first did. */
+static unsigned check_case(const fuzz_case *fc, size_t *where)
+{
+  cpu_state ref = cpu_power_on(fc->init);
+  cpu_state table = ref;
+  cpu_state before = ref;
+  cpu_state first = ref;
+  cpu_state lane;
+  slice_state slice;
+  unsigned engines = 0;
+  unsigned inst;
+  unsigned data;
+  size_t c;
+
+  memset(&slice, 0, sizeof(slice));
+  slice_set_lane(&slice, 0, &ref);
+
+  for (c = 0; c < fc->length && engines == 0; ++c)
+  {
+    inst = fc->clocks[c] & 0xf;
+    data = (fc->clocks[c] >> 4) & 1;
+
+    /* Rising edge. */
+    ref = cpu_clock_high(ref, inst, data);
+    table = table_clock_high(table, inst, data);
+    slice_clock_high(&slice, (instruction)inst, slice_fill(data));
+    lane = slice_get_lane(&slice, 0, (instruction)inst);
+    engines |= same_cpu(&ref, &table, 0) ? 0 : FUZZ_TABLE;
+    engines |= same_cpu(&ref, &lane, FUZZ_NO_SLICE) ? 0 : FUZZ_SLICE;
+
+    /* The pair table takes instructions two at a time. */
+    if (c % 2 == 0)
+    {
+      first = ref;
+    }
+    else if (!same_pair(&before, &first, &ref, fc->clocks[c - 1] & 0xf,
+                        (fc->clocks[c - 1] >> 4) & 1, inst, data))
+    {
+      engines |= FUZZ_PAIR;
+    }
+
+    /* Falling edge. */
+    ref = cpu_clock_low(ref);
+    table = cpu_clock_low(table);
+    slice_clock_low(&slice);
+    lane = slice_get_lane(&slice, 0, (instruction)inst);
+    engines |= same_cpu(&ref, &table, 0) ? 0 : FUZZ_TABLE;
+    engines |= same_cpu(&ref, &lane, FUZZ_NO_SLICE) ? 0 : FUZZ_SLICE;
+    if (c % 2 == 1)
+    {
+      before = ref;
+    }
+  }
+  *where = c - 1;
+  return engines;
+}
+
+static void report(const fuzz_case *fc, unsigned engines, size_t where)
+{
+  unsigned i;
+  size_t c;
+
+  printf("Differs from the reference:");
+  for (i = 0; i < 3; ++i)
+  {
+    if (engines & 1u << i)
+    {
+      printf(" %s", engine_names[i]);
+    }
+  }
+  printf(" (at instruction %lu).\nPower-on: ", (unsigned long)where + 1);
+  for (i = 0; i < num_power_init; ++i)
+  {
+    putchar('0' + ((fc->init >> i) & 1));
+  }
+  putchar('\n');
+  for (c = 0; c < fc->length; ++c)
+  {
+    printf("%6lu: %-4s %u\n", (unsigned long)c + 1,
+           instructions[fc->clocks[c] & 0xf], (fc->clocks[c] >> 4) & 1);
+  }
+}
+
+#ifndef FUZZ_LIBFUZZER
+
+/* Gather a word of one register of every lane, for comparing with the slice
+   engine a word at a time. */
+#define FUZZ_GATHER(words, lane, bit) \
+  ((words)[(lane) / 64] |= (unsigned long long)((bit) != 0) << ((lane) % 64))
+
+/* Run a batch through every engine. Returns the engines that differ from
+   the reference, with the first lane and instruction where one did. */
+static unsigned check_batch(const fuzz_batch *fb, unsigned *lane,
+                            size_t *where)
+{
+  static cpu_state ref[SLICE_LANES];
+  static cpu_state table[SLICE_LANES];
+  static cpu_state before[SLICE_LANES];
+  static cpu_state first[SLICE_LANES];
+  unsigned long long want[12][SLICE_WORDS];
+  unsigned long long got[12][SLICE_WORDS];
+  unsigned long long diff;
+  slice_word data;
+  slice_state slice;
+  unsigned engines;
+  unsigned inst;
+  unsigned bit;
+  unsigned edge;
+  unsigned l;
+  unsigned i;
+  unsigned w;
+  size_t c;
+
+  memset(&slice, 0, sizeof(slice));
+  for (l = 0; l < SLICE_LANES; ++l)
+  {
+    ref[l] = cpu_power_on(fb->init[l]);
+    table[l] = ref[l];
+    before[l] = ref[l];
+    slice_set_lane(&slice, l, ref + l);
+  }
+
+  for (c = 0; c < fb->length; ++c)
+  {
+    inst = fb->insts[c];
+    memcpy(&data, fb->data[c], sizeof(data));
+    for (edge = 0; edge < 2; ++edge)
+    {
+      engines = 0;
+      memset(want, 0, sizeof(want));
+      if (edge == 0)
+      {
+        slice_clock_high(&slice, (instruction)inst, data);
+      }
+      else
+      {
+        slice_clock_low(&slice);
+      }
+
+      for (l = 0; l < SLICE_LANES; ++l)
+      {
+        if (edge == 0)
+        {
+          bit = (unsigned)(fb->data[c][l / 64] >> (l % 64)) & 1;
+          ref[l] = cpu_clock_high(ref[l], inst, bit);
+          table[l] = table_clock_high(table[l], inst, bit);
+          if (c % 2 == 0)
+          {
+            first[l] = ref[l];
+          }
+          else if (!same_pair(before + l, first + l, ref + l,
+                              fb->insts[c - 1],
+                              (unsigned)(fb->data[c - 1][l / 64] >>
+                                         (l % 64)) & 1, inst, bit))
+          {
+            engines |= FUZZ_PAIR;
+          }
+        }
+        else
+        {
+          ref[l] = cpu_clock_low(ref[l]);
+          table[l] = cpu_clock_low(table[l]);
+          if (c % 2 == 1)
+          {
+            before[l] = ref[l];
+          }
+        }
+        if (!same_cpu(ref + l, table + l, 0))
+        {
+          engines |= FUZZ_TABLE;
+        }
+        if (engines != 0)
+        {
+          *lane = l;
+          *where = c;
+          return engines;
+        }
+
+        FUZZ_GATHER(want[0], l, ref[l].ien);
+        FUZZ_GATHER(want[1], l, ref[l].oen);
+        FUZZ_GATHER(want[2], l, ref[l].rr);
+        FUZZ_GATHER(want[3], l, ref[l].cr);
+        FUZZ_GATHER(want[4], l, ref[l].skip);
+        FUZZ_GATHER(want[5], l, ref[l].outputs & co_write);
+        FUZZ_GATHER(want[6], l, ref[l].outputs & co_flg0);
+        FUZZ_GATHER(want[7], l, ref[l].outputs & co_jump);
+        FUZZ_GATHER(want[8], l, ref[l].outputs & co_return);
+        FUZZ_GATHER(want[9], l, ref[l].outputs & co_flgf);
+        FUZZ_GATHER(want[10], l, ref[l].outputs & co_store);
+        FUZZ_GATHER(want[11], l, ref[l].bus);
+      }
+
+      /* The slice engine, a word at a time. */
+      memcpy(got[0], &slice.ien, sizeof(got[0]));
+      memcpy(got[1], &slice.oen, sizeof(got[0]));
+      memcpy(got[2], &slice.rr, sizeof(got[0]));
+      memcpy(got[3], &slice.cr, sizeof(got[0]));
+      memcpy(got[4], &slice.skip, sizeof(got[0]));
+      memcpy(got[5], &slice.write, sizeof(got[0]));
+      memcpy(got[6], &slice.flg0, sizeof(got[0]));
+      memcpy(got[7], &slice.jump, sizeof(got[0]));
+      memcpy(got[8], &slice.ret, sizeof(got[0]));
+      memcpy(got[9], &slice.flgf, sizeof(got[0]));
+      memcpy(got[10], &slice.store, sizeof(got[0]));
+      memcpy(got[11], &slice.bus, sizeof(got[0]));
+      for (w = 0; w < SLICE_WORDS; ++w)
+      {
+        diff = 0;
+        for (i = 0; i < 12; ++i)
+        {
+          diff |= want[i][w] ^ got[i][w];
+        }
+        if (diff != 0)
+        {
+          for (l = 0; !((diff >> l) & 1); ++l)
+          {
+          }
+          *lane = w * 64 + l;
+          *where = c;
+          return FUZZ_SLICE;
+        }
+      }
+    }
+  }
+  return 0;
+}
+
+/* Cut a failing program down by delta debugging: take out ever smaller
+   parts of it for as long as the same engines still differ. The program is
+   also cut short after the first difference each time. The pair table
+   takes instructions two at a time, so for it the parts are kept to an
+   even length. */
+static void minimize(fuzz_case *fc, unsigned engines)
+{
+  unsigned char *trial;
+  size_t smallest = engines & FUZZ_PAIR ? 2 : 1;
+  size_t parts = 2;
+  size_t part;
+  size_t from;
+  size_t to;
+  size_t where;
+  unsigned removed;
+  fuzz_case t;
+
+  trial = (unsigned char *)malloc(fc->length);
+  if (trial == NULL)
+  {
+    return;
+  }
+  t.init = fc->init;
+  t.clocks = trial;
+  while (fc->length > smallest)
+  {
+    /* Try the program without each of the parts in turn. */
+    part = (fc->length + parts - 1) / parts;
+    part += part % smallest;
+    removed = 0;
+    for (from = 0; from < fc->length && !removed; from += part)
+    {
+      to = from + part < fc->length ? from + part : fc->length;
+      memcpy(trial, fc->clocks, from);
+      memcpy(trial + from, fc->clocks + to, fc->length - to);
+      t.length = fc->length - (to - from);
+      if (t.length != 0 && (check_case(&t, &where) & engines) == engines)
+      {
+        t.length = where + 1;
+        memcpy(fc->clocks, trial, t.length);
+        fc->length = t.length;
+        removed = 1;
+      }
+    }
+
+    /* If one came out, carry on with fewer parts; if none did, with more,
+       until they are as small as they can be. */
+    if (removed)
+    {
+      parts = parts > 2 ? parts - 1 : 2;
+    }
+    else if (part <= smallest)
+    {
+      break;
+    }
+    else
+    {
+      parts *= 2;
+    }
+  }
+  free(trial);
+}
+
+static int save_case(const fuzz_case *fc, const char *path)
+{
+  FILE *file;
+  unsigned char init[2];
+  int error;
+
+  file = fopen(path, "wb");
+  if (file == NULL)
+  {
+    return 1;
+  }
+  init[0] = (unsigned char)fc->init;
+  init[1] = (unsigned char)(fc->init >> 8);
+  error = fwrite(init, 1, 2, file) != 2 ||
+          fwrite(fc->clocks, 1, fc->length, file) != fc->length;
+  return fclose(file) != 0 || error;
+}
+
+/* xorshift64*. */
+static unsigned long long fuzz_random(unsigned long long *seed)
+{
+  unsigned long long x = *seed != 0 ? *seed : 0x9e3779b97f4a7c15ull;
+
+  x ^= x >> 12;
+  x ^= x << 25;
+  x ^= x >> 27;
+  *seed = x;
+  return x * 0x2545f4914f6cdd1dull;
+}
+
+#endif
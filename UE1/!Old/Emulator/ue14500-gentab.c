@@ -0,0 +1,270 @@
+/* UE14500 step table generator.
+
+   License: Public Domain
+
+   Writes ue14500-table.h, the lookup tables for table-driven execution, by
+   running cpu_clock_high() from ue14500-core.h for every possible state, so
+   the tables are the reference behaviour by construction. Run it again
+   whenever the core changes. With --check, it instead compares the tables in
+   the current ue14500-table.h against the reference and reports any entry
+   that differs, so a build can check the tables are up to date. Build and run
+   instructions (there are many ways - use these as a guide):
+
+   Linux/Mac/Windows (MSYS2):
+     - gcc -o ue14500-gentab ue14500-gentab.c
+     - ./ue14500-gentab > ue14500-table.h
+     - ./ue14500-gentab --check
+
+   If ue14500-table.h is missing or broken, build with -DGENTAB_BOOTSTRAP to
+   leave out the check and generate it anew.
+
+   The state that matters for execution is 5 bits: RR, carry, IEN, OEN and
+   skip. With the 4-bit instruction and the data bit, that gives 1024 entries
+   for one instruction. The pair table takes the state and two instructions
+   with their data (32768 entries) and gives the state after both, with the
+   outputs of each. See the generated file for the layout.
+*/
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "ue14500-core.h"
+#ifndef GENTAB_BOOTSTRAP
+#  include "ue14500-table.h"
+#endif
+
+/* Table layout. These must match the macros written out below. */
+#define STATE_BITS 5
+#define OUT_BITS 8
+#define NUM_STEP (1u << (STATE_BITS + 5))
+#define NUM_PAIR (1u << (STATE_BITS + 10))
+
+/* Helper functions. */
+static cpu_state unpack_state(unsigned state);
+static unsigned pack_state(const cpu_state *cpu);
+static unsigned pack_outputs(const cpu_state *cpu);
+static unsigned gen_step(unsigned index);
+static uint32_t gen_pair(unsigned index);
+static int write_tables(void);
+static int check_tables(void);
+
+int main(int argc, char **argv)
+{
+  if (argc == 1)
+  {
+    return write_tables();
+  }
+  if (argc == 2 && strcmp(argv[1], "--check") == 0)
+  {
+    return check_tables();
+  }
+  fputs("Usage: ue14500-gentab [--check]\n", stderr);
+  return 1;
+}
+
+static cpu_state unpack_state(unsigned state)
+{
+  cpu_state cpu = { i_nop0 };
+
+  cpu.rr = state & 1;
+  cpu.cr = (state >> 1) & 1;
+  cpu.ien = (state >> 2) & 1;
+  cpu.oen = (state >> 3) & 1;
+  cpu.skip = (state >> 4) & 1;
+  return cpu;
+}
+
+static unsigned pack_state(const cpu_state *cpu)
+{
+  return cpu->rr | cpu->cr << 1 | cpu->ien << 2 | cpu->oen << 3 |
+         cpu->skip << 4;
+}
+
+static unsigned pack_outputs(const cpu_state *cpu)
+{
+  /* The outputs of this clock, and the bus only if it was driven. */
+  return (cpu->outputs & 0x7f) |
+         (cpu->outputs & co_store ? cpu->bus << 7 : 0);
+}
+
+static unsigned gen_step(unsigned index)
+{
+  cpu_state cpu = unpack_state(index & 0x1f);
+
+  cpu = cpu_clock_high(cpu, (index >> 5) & 0xf, (index >> 9) & 1);
+  return pack_state(&cpu) | pack_outputs(&cpu) << STATE_BITS;
+}
+
+static uint32_t gen_pair(unsigned index)
+{
+  uint32_t entry;
+  cpu_state cpu = unpack_state(index & 0x1f);
+
+  cpu = cpu_clock_high(cpu, (index >> 5) & 0xf, (index >> 9) & 1);
+  entry = (uint32_t)pack_outputs(&cpu) << STATE_BITS;
+  cpu = cpu_clock_low(cpu);
+  cpu.outputs = 0;
+  cpu = cpu_clock_high(cpu, (index >> 10) & 0xf, (index >> 14) & 1);
+  entry |= (uint32_t)pack_outputs(&cpu) << (STATE_BITS + OUT_BITS);
+  return entry | pack_state(&cpu);
+}
+
+static int write_tables(void)
+{
+  unsigned i;
+
+  puts("/* UE14500 step tables.\n"
+       "\n"
+       "   License: Public Domain\n"
+       "\n"
+       "   GENERATED by ue14500-gentab.c from ue14500-core.h. Do not edit;\n"
+       "   regenerate with ./ue14500-gentab > ue14500-table.h and check with\n"
+       "   ./ue14500-gentab --check.\n"
+       "\n"
+       "   Index: bits 0-4 are the state (RR, carry, IEN, OEN, skip), bits\n"
+       "   5-8 the instruction and bit 9 its data. The pair table adds the\n"
+       "   second instruction in bits 10-13 and its data in bit 14.\n"
+       "\n"
+       "   Entry: bits 0-4 are the new state. Bits 5-11 are the cpu_output\n"
+       "   bits of the (first) instruction and bit 12 the bit it put on the\n"
+       "   bus, if co_store is set. In the pair table, bits 13-20 are the\n"
+       "   same for the second instruction.\n"
+       "*/\n"
+       "#ifndef UE14500_TABLE_H\n"
+       "#define UE14500_TABLE_H\n"
+       "\n"
+       "#include <stdint.h>\n"
+       "\n"
+       "#include \"ue14500-core.h\"\n"
+       "\n"
+       "/* Index and entry fields. */\n"
+       "#define TABLE_STATE 0x1fu\n"
+       "#define TABLE_INDEX(state, inst, data) \\\n"
+       "  ((state) | (unsigned)(inst) << 5 | (unsigned)(data) << 9)\n"
+       "#define TABLE_PAIR_INDEX(state, inst1, data1, inst2, data2) \\\n"
+       "  (TABLE_INDEX((state), (inst1), (data1)) |                 \\\n"
+       "   (unsigned)(inst2) << 10 | (unsigned)(data2) << 14)\n"
+       "#define TABLE_OUTPUTS(entry) (((entry) >> 5) & 0x7fu)\n"
+       "#define TABLE_BUS(entry) (((entry) >> 12) & 1u)\n"
+       "#define TABLE_OUTPUTS2(entry) (((entry) >> 13) & 0x7fu)\n"
+       "#define TABLE_BUS2(entry) (((entry) >> 20) & 1u)\n");
+
+  printf("static const unsigned short table_step[%u] =\n{", NUM_STEP);
+  for (i = 0; i < NUM_STEP; ++i)
+  {
+    printf("%s0x%04x%s", i % 8 ? " " : "\n  ", gen_step(i),
+           i + 1 < NUM_STEP ? "," : "\n");
+  }
+  puts("};\n");
+
+  puts("/* Left out with TABLE_NO_PAIR for programs that only need\n"
+       "   table_clock_high(). */\n"
+       "#ifndef TABLE_NO_PAIR");
+  printf("static const uint32_t table_pair[%u] =\n{", NUM_PAIR);
+  for (i = 0; i < NUM_PAIR; ++i)
+  {
+    printf("%s0x%06lx%s", i % 6 ? " " : "\n  ", (unsigned long)gen_pair(i),
+           i + 1 < NUM_PAIR ? "," : "\n");
+  }
+  puts("};\n"
+       "#endif\n");
+
+  puts("/* Pack the state of a CPU for indexing. */\n"
+       "static inline unsigned table_state(const cpu_state *cpu)\n"
+       "{\n"
+       "  return cpu->rr | cpu->cr << 1 | cpu->ien << 2 | cpu->oen << 3 |\n"
+       "         cpu->skip << 4;\n"
+       "}\n"
+       "\n"
+       "/* Same as cpu_clock_high() but by table lookup. */\n"
+       "static inline cpu_state table_clock_high(cpu_state cpu, "
+       "unsigned inst,\n"
+       "                                         unsigned data)\n"
+       "{\n"
+       "  unsigned entry = table_step[TABLE_INDEX(table_state(&cpu), inst,\n"
+       "                                          data)];\n"
+       "\n"
+       "  cpu.ir = cpu.skip ? i_nopf : (instruction)inst;\n"
+       "  cpu.rr = entry & 1;\n"
+       "  cpu.cr = (entry >> 1) & 1;\n"
+       "  cpu.ien = (entry >> 2) & 1;\n"
+       "  cpu.oen = (entry >> 3) & 1;\n"
+       "  cpu.skip = (entry >> 4) & 1;\n"
+       "  cpu.outputs = (cpu.outputs & co_write) | TABLE_OUTPUTS(entry);\n"
+       "  cpu.bus = cpu.outputs & co_store ? TABLE_BUS(entry) : cpu.bus;\n"
+       "  return cpu;\n"
+       "}\n"
+       "\n"
+       "#endif");
+
+  return ferror(stdout) ? 1 : 0;
+}
+
+static int check_tables(void)
+{
+#ifdef GENTAB_BOOTSTRAP
+  fputs("Built with GENTAB_BOOTSTRAP, so there is nothing to check.\n",
+        stderr);
+  return 1;
+#else
+  unsigned i;
+  unsigned state;
+  unsigned inst;
+  unsigned data;
+  unsigned bad = 0;
+  cpu_state ref;
+  cpu_state cpu;
+
+  /* Raw entries. */
+  for (i = 0; i < NUM_STEP; ++i)
+  {
+    if (table_step[i] != gen_step(i))
+    {
+      fprintf(stderr, "table_step[%u] is 0x%04x, should be 0x%04x.\n", i,
+              table_step[i], gen_step(i));
+      ++bad;
+    }
+  }
+  for (i = 0; i < NUM_PAIR; ++i)
+  {
+    if (table_pair[i] != gen_pair(i))
+    {
+      fprintf(stderr, "table_pair[%u] is 0x%06lx, should be 0x%06lx.\n", i,
+              (unsigned long)table_pair[i], (unsigned long)gen_pair(i));
+      ++bad;
+    }
+  }
+
+  /* The lookup function against the reference, from every state with the
+     write line and bus in both states. */
+  for (i = 0; i < 4 << STATE_BITS; ++i)
+  {
+    state = i & 0x1f;
+    for (inst = 0; inst < 16; ++inst)
+    {
+      for (data = 0; data < 2; ++data)
+      {
+        ref = unpack_state(state);
+        ref.outputs = i & 0x20 ? co_write : 0;
+        ref.bus = (i >> 6) & 1;
+        cpu = table_clock_high(ref, inst, data);
+        ref = cpu_clock_high(ref, inst, data);
+        if (memcmp(&cpu, &ref, sizeof(cpu)) != 0)
+        {
+          fprintf(stderr, "table_clock_high() differs for state 0x%02x, "
+                  "%s, data %u.\n", i, instructions[inst], data);
+          ++bad;
+        }
+      }
+    }
+  }
+
+  if (bad != 0)
+  {
+    fprintf(stderr, "%u differences; regenerate ue14500-table.h.\n", bad);
+    return 1;
+  }
+  puts("ue14500-table.h matches ue14500-core.h.");
+  return 0;
+#endif
+}
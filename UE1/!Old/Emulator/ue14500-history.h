@@ -0,0 +1,160 @@
+/* UE14500 execution history.
+
+   License: Public Domain
+
+   Keeps enough of the past of a run to go back to any point in it. Every
+   step run is logged as a 16-bit entry (the switches, the clock edges and
+   whether it moved on through the input file), and every so many entries
+   there is a checkpoint: a snapshot (see ue14500-snap.h) of the state before
+   the next entry, and the run's counters (see ue14500-stats.h) then. A
+   checkpoint and the entries after it make a block. Going back to any point
+   is restoring the checkpoint of its block and running the block's entries
+   up to that point again, so it never costs more than one block of steps
+   whatever the distance.
+
+   The blocks are a ring of fixed size allocated up front, so the memory used
+   is bounded: when it is full the oldest block is dropped and the history
+   starts later.
+*/
+#ifndef UE14500_HISTORY_H
+#define UE14500_HISTORY_H
+
+#include <stdlib.h>
+
+#include "ue14500-core.h"
+#include "ue14500-snap.h"
+#include "ue14500-stats.h"
+
+/* Entry fields. The step is the program_step run, with no keystrokes. */
+#define HISTORY_INST 0x1fu      /* Instruction and data, as program_step. */
+#define HISTORY_CONTROL 5       /* Shift of the selected control. */
+#define HISTORY_TYPE 8          /* Shift of the step_type. */
+#define HISTORY_ADVANCE 0x800u  /* The step moved on through the program. */
+#define HISTORY_SPLIT 0x1000u   /* First edge of a 'k' run as two steps. */
+
+/* A checkpoint and the entries logged after it. */
+typedef struct history_block_
+{
+  snapshot start;
+  run_stats stats;
+  unsigned in_cycle;
+  size_t used;
+} history_block;
+
+typedef struct history_
+{
+  /* Entries per block and blocks in the ring. */
+  size_t block_size;
+  size_t num_blocks;
+
+  /* Oldest block in the ring and how many are in use. */
+  size_t first;
+  size_t count;
+
+  history_block *blocks;
+  unsigned short *entries;
+} history;
+
+/* Allocate a history keeping at least the given number of entries, with a
+   checkpoint every interval entries. Returns 0 on success or 1 if out of
+   memory. */
+static inline int history_init(history *hist, size_t entries,
+                               size_t interval)
+{
+  hist->block_size = interval;
+  hist->num_blocks = entries / interval + 1;
+  hist->first = 0;
+  hist->count = 0;
+  hist->blocks = (history_block *)malloc(hist->num_blocks *
+                                         sizeof(history_block));
+  hist->entries = (unsigned short *)malloc(hist->num_blocks * interval *
+                                           sizeof(unsigned short));
+  return hist->blocks == NULL || hist->entries == NULL;
+}
+
+static inline void history_free(history *hist)
+{
+  free(hist->blocks);
+  free(hist->entries);
+  hist->blocks = NULL;
+  hist->entries = NULL;
+  hist->num_blocks = 0;
+  hist->count = 0;
+}
+
+static inline unsigned short history_entry(const program_step *step,
+                                           unsigned flags)
+{
+  return (unsigned short)((step->inst & HISTORY_INST) |
+                          (unsigned)step->control << HISTORY_CONTROL |
+                          (unsigned)step->type << HISTORY_TYPE | flags);
+}
+
+static inline program_step history_step(unsigned short entry)
+{
+  program_step step;
+
+  step.type = (unsigned char)((entry >> HISTORY_TYPE) & 7);
+  step.inst = (unsigned char)(entry & HISTORY_INST);
+  step.control = (unsigned char)((entry >> HISTORY_CONTROL) & 7);
+  step.keys = 0;
+  return step;
+}
+
+/* The ith block, oldest first, and its entries. */
+static inline history_block *history_block_at(const history *hist, size_t i)
+{
+  return hist->blocks + (hist->first + i) % hist->num_blocks;
+}
+
+static inline unsigned short *history_entries(const history *hist,
+                                              const history_block *block)
+{
+  return hist->entries + (size_t)(block - hist->blocks) * hist->block_size;
+}
+
+/* Whether the given number of entries fit in the newest block. If not, the
+   caller must start a new one with history_checkpoint(). */
+static inline unsigned history_room(const history *hist, size_t entries)
+{
+  return hist->count != 0 &&
+         history_block_at(hist, hist->count - 1)->used + entries <=
+         hist->block_size;
+}
+
+/* Start a new block from the given state, dropping the oldest if full. */
+static inline void history_checkpoint(history *hist, const snapshot *start,
+                                      const run_stats *stats,
+                                      unsigned in_cycle)
+{
+  history_block *block;
+
+  if (hist->count == hist->num_blocks)
+  {
+    hist->first = (hist->first + 1) % hist->num_blocks;
+    --hist->count;
+  }
+  block = history_block_at(hist, hist->count++);
+  block->start = *start;
+  block->stats = *stats;
+  block->in_cycle = in_cycle;
+  block->used = 0;
+}
+
+/* Log an entry in the newest block, which must have room. */
+static inline void history_add(history *hist, unsigned short entry)
+{
+  history_block *block = history_block_at(hist, hist->count - 1);
+
+  history_entries(hist, block)[block->used++] = entry;
+}
+
+/* Forget everything after the given number of entries of the ith block
+   (including the block itself if that is none). */
+static inline void history_cut(history *hist, size_t i, size_t used)
+{
+  history_block_at(hist, i)->used = used;
+  hist->count = used != 0 ? i + 1 : i;
+}
+
+#endif
@@ -0,0 +1,207 @@
+/* libue14500: the UE14500 as a library.
+
+   License: Public Domain
+
+   See ue14500-lib.h for the API and how to build it. This is only the
+   wrapping: the CPU and the compiling of input files are those of
+   ue14500-core.h, so the library runs programs exactly as the emulator
+   does headless.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "ue14500-core.h"
+#include "ue14500-lib.h"
+
+struct ue_machine_
+{
+  panel_state panel;
+
+  /* The program being run and the next step of it. */
+  const ue_program *prog;
+  size_t step;
+
+  unsigned long long clocks;
+  unsigned long long writes;
+
+  ue_output_fn output;
+  void *output_ctx;
+};
+
+struct ue_program_
+{
+  program prog;
+};
+
+/* Run one step of a program. Returns nonzero on a rising edge. */
+static inline unsigned run_step(ue_machine *m, const program_step *step)
+{
+  unsigned events = program_step_run(&m->panel, step);
+
+  if (events & pe_write)
+  {
+    ++m->writes;
+    if (m->output != NULL)
+    {
+      m->output(m->output_ctx, m->panel.cpu.bus);
+    }
+  }
+  m->clocks += (events & pe_clock_high) != 0;
+  return (events & pe_clock_high) != 0;
+}
+
+ue_machine *ue_new(void)
+{
+  ue_machine *m = (ue_machine *)calloc(1, sizeof(ue_machine));
+
+  if (m != NULL)
+  {
+    ue_power_on(m, 0);
+  }
+  return m;
+}
+
+void ue_free(ue_machine *m)
+{
+  free(m);
+}
+
+void ue_power_on(ue_machine *m, unsigned init)
+{
+  panel_power_on(&m->panel, init & ((1u << num_power_init) - 1));
+  m->prog = NULL;
+  m->step = 0;
+  m->clocks = 0;
+  m->writes = 0;
+}
+
+void ue_on_output(ue_machine *m, ue_output_fn fn, void *ctx)
+{
+  m->output = fn;
+  m->output_ctx = ctx;
+}
+
+unsigned ue_step(ue_machine *m, unsigned inst, unsigned data)
+{
+  program_step step;
+  unsigned outputs;
+
+  /* A whole cycle from low (taking the clock low first if a program left
+     it high), through the panel so the switches show it. */
+  step.inst = (unsigned char)((inst & 0xfu) | (data & 1u) << 4);
+  step.control = (unsigned char)m->panel.control;
+  step.keys = 0;
+  step.type = st_low;
+  run_step(m, &step);
+  step.type = st_high;
+  run_step(m, &step);
+  outputs = m->panel.cpu.outputs & (UE_WRITE | UE_FLG0 | UE_JMP | UE_RTN |
+                                    UE_FLGF);
+  step.type = st_low;
+  run_step(m, &step);
+  return outputs;
+}
+
+void ue_get_state(const ue_machine *m, ue_state *state)
+{
+  const cpu_state *cpu = &m->panel.cpu;
+
+  state->ir = (unsigned)cpu->ir;
+  state->ien = cpu->ien;
+  state->oen = cpu->oen;
+  state->rr = cpu->rr;
+  state->cr = cpu->cr;
+  state->skip = cpu->skip;
+  state->outputs = cpu->outputs & (UE_WRITE | UE_FLG0 | UE_JMP | UE_RTN |
+                                   UE_FLGF);
+  state->bus = cpu->bus;
+  state->clk = m->panel.control_states[c_clk];
+  state->clocks = m->clocks;
+  state->writes = m->writes;
+}
+
+ue_program *ue_load(const char *path, const char **error)
+{
+  FILE *file = fopen(path, "r");
+  ue_program *p;
+
+  if (file == NULL)
+  {
+    *error = "Error opening input file.";
+    return NULL;
+  }
+  p = ue_load_file(file, error);
+  fclose(file);
+  return p;
+}
+
+ue_program *ue_load_file(FILE *file, const char **error)
+{
+  ue_program *p = (ue_program *)malloc(sizeof(ue_program));
+
+  if (p == NULL)
+  {
+    *error = "Out of memory.";
+    return NULL;
+  }
+  *error = program_load(&p->prog, file);
+  if (*error != NULL)
+  {
+    program_free(&p->prog);
+    free(p);
+    return NULL;
+  }
+  return p;
+}
+
+void ue_program_free(ue_program *p)
+{
+  if (p != NULL)
+  {
+    program_free(&p->prog);
+    free(p);
+  }
+}
+
+unsigned ue_program_init(const ue_program *p)
+{
+  return p->prog.init;
+}
+
+unsigned long long ue_run(ue_machine *m, const ue_program *p,
+                          unsigned long long n)
+{
+  return ue_run_until(m, p, n, NULL, NULL);
+}
+
+unsigned long long ue_run_until(ue_machine *m, const ue_program *p,
+                                unsigned long long n, ue_predicate_fn fn,
+                                void *ctx)
+{
+  unsigned long long clocks = 0;
+  const program_step *steps = p->prog.steps;
+  size_t num_steps = p->prog.num_steps;
+
+  if (m->prog != p)
+  {
+    m->prog = p;
+    m->step = 0;
+  }
+  while (m->step < num_steps && (n == 0 || clocks < n))
+  {
+    if (run_step(m, steps + m->step++))
+    {
+      ++clocks;
+      if (fn != NULL && fn(ctx, m))
+      {
+        break;
+      }
+    }
+  }
+  return clocks;
+}
+
+int ue_program_done(const ue_machine *m, const ue_program *p)
+{
+  return m->prog == p && m->step == p->prog.num_steps;
+}
@@ -0,0 +1,134 @@
+/* libue14500: the UE14500 as a library.
+
+   License: Public Domain
+
+   The same core as the emulator (ue14500-core.h), behind a small API for
+   programs that want to run a UE14500 themselves: clock it an instruction
+   at a time, or run input files (as for ue14500-emu) on it, with a call
+   for each bit written. A machine is a handle whose insides are private to
+   the library; any number can be used at once, one thread each. Nothing is
+   allocated once a machine and its programs exist, so running never does.
+
+   ue14500-lib.c is the library. Build it as a static and a shared library
+   (there are many ways - use these as a guide):
+
+     gcc -O2 -fPIC -c ue14500-lib.c
+     ar rcs libue14500.a ue14500-lib.o
+     gcc -shared -o libue14500.so ue14500-lib.o
+
+   and link with -L. -lue14500. For example, to run hello.emu and count
+   the bits it writes:
+
+     static void count(void *ctx, unsigned bit)
+     {
+       ++*(unsigned long *)ctx;
+     }
+
+     unsigned long bits = 0;
+     const char *error;
+     ue_machine *m = ue_new();
+     ue_program *p = ue_load("hello.emu", &error);
+
+     ue_power_on(m, ue_program_init(p));
+     ue_on_output(m, count, &bits);
+     ue_run(m, p, 0);
+
+   Registers and lines are reported as in ue_state below. The power-on
+   value is the ten characters of an input file's second line, bit N for
+   the Nth: I0-I3, IEN, logic VFD, carry, RR, OEN and skip.
+*/
+#ifndef UE14500_LIB_H
+#define UE14500_LIB_H
+
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Output lines, as in ue_state.outputs. */
+#define UE_WRITE 0x01
+#define UE_FLG0 0x02
+#define UE_JMP 0x04
+#define UE_RTN 0x08
+#define UE_FLGF 0x10
+
+typedef struct ue_machine_ ue_machine;
+typedef struct ue_program_ ue_program;
+
+/* What a machine is showing. */
+typedef struct ue_state_
+{
+  /* Instruction register (0-15) and the registers (0 or 1). */
+  unsigned ir;
+  unsigned ien;
+  unsigned oen;
+  unsigned rr;
+  unsigned cr;
+  unsigned skip;
+
+  /* Output lines (UE_ bits), the last bit stored and the clock level. */
+  unsigned outputs;
+  unsigned bus;
+  unsigned clk;
+
+  /* Rising clock edges since power-on, and bits written. */
+  unsigned long long clocks;
+  unsigned long long writes;
+} ue_state;
+
+/* Called with each bit written. */
+typedef void (*ue_output_fn)(void *ctx, unsigned bit);
+
+/* Called after each rising clock edge of ue_run_until(); nonzero stops. */
+typedef int (*ue_predicate_fn)(void *ctx, const ue_machine *m);
+
+/* A new machine, powered on with everything 0, or NULL if out of memory. */
+ue_machine *ue_new(void);
+void ue_free(ue_machine *m);
+
+/* Power on with the given value, as from an input file's second line. The
+   switches go to 0 and any program is run again from its start. */
+void ue_power_on(ue_machine *m, unsigned init);
+
+/* Call fn with each bit written (NULL for none). */
+void ue_on_output(ue_machine *m, ue_output_fn fn, void *ctx);
+
+/* One clock (a rising then falling edge) with the given instruction (0-15)
+   and data. Returns the output lines as they were while the clock was
+   high. */
+unsigned ue_step(ue_machine *m, unsigned inst, unsigned data);
+
+/* The machine as it is now. */
+void ue_get_state(const ue_machine *m, ue_state *state);
+
+/* Compile an input file, from a path or an open file (read from where it
+   is to the end). Returns NULL on error, with a message in *error. */
+ue_program *ue_load(const char *path, const char **error);
+ue_program *ue_load_file(FILE *file, const char **error);
+void ue_program_free(ue_program *p);
+
+/* The power-on value on the program's second line. */
+unsigned ue_program_init(const ue_program *p);
+
+/* Run up to n clocks (0 for no limit) of a program, carrying on from where
+   the last run of it on this machine stopped (from the start if the last
+   run was of another program, or there has been a ue_power_on since).
+   Breakpoint commands in the file are ignored. Returns the clocks run, so
+   fewer than n means the program has ended. */
+unsigned long long ue_run(ue_machine *m, const ue_program *p,
+                          unsigned long long n);
+
+/* Run as ue_run() does, but stop as soon as the predicate is true. */
+unsigned long long ue_run_until(ue_machine *m, const ue_program *p,
+                                unsigned long long n, ue_predicate_fn fn,
+                                void *ctx);
+
+/* Whether the machine has run a program to its end. */
+int ue_program_done(const ue_machine *m, const ue_program *p);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,134 @@
+/* UE14500 clock scheduler.
+
+   License: Public Domain
+
+   Paces clock edges at a fixed frequency. Every edge has an absolute
+   deadline, start + n half periods, and the caller sleeps until it with
+   clock_nanosleep(TIMER_ABSTIME), so time spent drawing or writing output
+   between edges does not add up as drift. If an edge is late the following
+   ones are run without sleeping until the schedule is caught up, so a short
+   stall costs nothing over the whole run. A stall longer than SCHED_MAX_BEHIND
+   (the terminal was suspended, say) is not caught up; the schedule restarts
+   from now instead of running a burst of edges.
+
+   The lateness of each edge is recorded so the jitter can be reported at the
+   end of the run.
+
+   Needs POSIX clock_nanosleep(). On Windows, MSYS2 provides it through
+   winpthreads (link with -lpthread).
+*/
+#ifndef UE14500_SCHED_H
+#define UE14500_SCHED_H
+
+#include <stdio.h>
+#include <time.h>
+
+/* Furthest behind the schedule (ns) that is caught up rather than skipped. */
+#define SCHED_MAX_BEHIND 250000000ull
+
+/* Scheduler state. Times are in ns. */
+typedef struct sched_state_
+{
+  /* Clock frequency and time between edges (half a clock period). */
+  double hz;
+  double half_period;
+
+  /* Time of edge 0 and the number of edges since. */
+  unsigned long long start;
+  unsigned long long edges;
+
+  /* Lateness statistics. */
+  unsigned long long total_edges;
+  unsigned long long late_sum;
+  unsigned long long late_max;
+  unsigned long long late_edges;
+  unsigned long long stalls;
+} sched_state;
+
+static inline unsigned long long sched_now(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (unsigned long long)ts.tv_sec * 1000000000ull +
+         (unsigned long long)ts.tv_nsec;
+}
+
+/* Restart the schedule so the next edge is due now. Used at the start and
+   after any pause (a breakpoint, for instance) that should not be caught
+   up. */
+static inline void sched_restart(sched_state *sched)
+{
+  sched->start = sched_now();
+  sched->edges = 0;
+}
+
+static inline void sched_init(sched_state *sched, double hz)
+{
+  sched->hz = hz;
+  sched->half_period = 500000000.0 / hz;
+  sched->total_edges = 0;
+  sched->late_sum = 0;
+  sched->late_max = 0;
+  sched->late_edges = 0;
+  sched->stalls = 0;
+  sched_restart(sched);
+}
+
+/* Sleep until the given time (ns on the sched_now() clock). */
+static inline void sched_sleep_until(unsigned long long when)
+{
+  struct timespec ts;
+
+  /* EINTR just means sleep again. */
+  ts.tv_sec = (time_t)(when / 1000000000ull);
+  ts.tv_nsec = (long)(when % 1000000000ull);
+  while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) != 0)
+  { }
+}
+
+/* Return the time (ns) the next edge is due. */
+static inline unsigned long long sched_next(const sched_state *sched)
+{
+  return sched->start +
+         (unsigned long long)((double)sched->edges * sched->half_period);
+}
+
+/* Wait until the next edge is due. */
+static inline void sched_wait(sched_state *sched)
+{
+  unsigned long long now;
+  unsigned long long late;
+  unsigned long long deadline = sched_next(sched);
+
+  sched_sleep_until(deadline);
+
+  /* Note how late we are. */
+  now = sched_now();
+  late = now > deadline ? now - deadline : 0;
+  ++sched->edges;
+  ++sched->total_edges;
+  sched->late_sum += late;
+  sched->late_max = late > sched->late_max ? late : sched->late_max;
+  sched->late_edges += late >= sched->half_period;
+
+  /* Too far behind to catch up, so start again from here. */
+  if (late > SCHED_MAX_BEHIND)
+  {
+    ++sched->stalls;
+    sched->start = now;
+    sched->edges = 1;
+  }
+}
+
+/* Report the jitter. */
+static inline void sched_report(const sched_state *sched, FILE *out)
+{
+  fprintf(out, "Clock %g Hz: %llu edges, lateness mean %llu us, max %llu us, "
+          "%llu edges a half period or more late, %llu stalls.\n", sched->hz,
+          sched->total_edges,
+          sched->total_edges ?
+            sched->late_sum / sched->total_edges / 1000 : 0,
+          sched->late_max / 1000, sched->late_edges, sched->stalls);
+}
+
+#endif
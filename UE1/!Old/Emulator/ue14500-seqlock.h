@@ -0,0 +1,56 @@
+/* UE14500 seqlock.
+
+   License: Public Domain
+
+   One writer publishes a small block of plain data that any number of
+   readers copy out, without the writer ever waiting. The sequence number
+   is odd while the data is being changed and goes up by 2 each time it has
+   been; a reader copies the data and keeps it if the number was even and
+   the same before and after, and copies it again if not.
+
+   Used for the emulator's screen frames (ue14500-threads.h) and for the
+   shared front panel file (ue14500-shm.h). Needs C11 atomics.
+*/
+#ifndef UE14500_SEQLOCK_H
+#define UE14500_SEQLOCK_H
+
+#include <stdatomic.h>
+#include <stddef.h>
+#include <string.h>
+
+/* Copy size bytes from src to data. Only one thread may publish. */
+static inline void seqlock_publish(atomic_uint *seq, void *data,
+                                   const void *src, size_t size)
+{
+  unsigned now = atomic_load_explicit(seq, memory_order_relaxed);
+
+  atomic_store_explicit(seq, now + 1, memory_order_relaxed);
+  atomic_thread_fence(memory_order_release);
+  memcpy(data, src, size);
+  atomic_store_explicit(seq, now + 2, memory_order_release);
+}
+
+/* Copy size bytes of a whole publish from data to dest. Returns the
+   sequence number, which only changes when the data has. */
+static inline unsigned seqlock_read(atomic_uint *seq, void *dest,
+                                    const void *data, size_t size)
+{
+  unsigned now;
+
+  for (;;)
+  {
+    now = atomic_load_explicit(seq, memory_order_acquire);
+    if (now & 1)
+    {
+      continue;
+    }
+    memcpy(dest, data, size);
+    atomic_thread_fence(memory_order_acquire);
+    if (atomic_load_explicit(seq, memory_order_relaxed) == now)
+    {
+      return now;
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,218 @@
+/* UE14500 session recordings.
+
+   License: Public Domain
+
+   A recording is every key the machine acted on in an interactive session
+   (power-on keys, panel keys, going back), with when it was pressed. The
+   machine only changes on the input file and those keys, so running the
+   same input file with the same keys, in the same order, gives the same
+   run however fast it goes; the times are only there to replay it at the
+   pace it was typed. The clock count at each key is kept as well, to catch
+   a replay the moment it goes a different way. The file is:
+
+     "UE14KEYS", version (4 bytes), then the program hash (8), step (8) and
+     clocks (8) at the start, all little-endian
+     a record per key: key + 1, milliseconds since the previous key (since
+       the start for the first) and clocks since the previous key, each as
+       an unsigned LEB128 number (mostly a byte each)
+     at the end, 0 and the final state as a snapshot (see ue14500-snap.h)
+
+   Each key is flushed as it is recorded, so a session that never finished
+   can still be replayed up to its last key, but has no final state to
+   check against.
+*/
+#ifndef UE14500_SESSION_H
+#define UE14500_SESSION_H
+
+#include <stdio.h>
+#include <string.h>
+
+#include "ue14500-snap.h"
+
+/* File layout. */
+#define SESSION_MAGIC "UE14KEYS"
+#define SESSION_VERSION 1u
+#define SESSION_HEADER 36
+
+/* Recording being written. */
+typedef struct session_writer_
+{
+  FILE *file;
+  unsigned long long ms;
+  unsigned long long clocks;
+  int error;
+} session_writer;
+
+/* Recording being read. The time (ms from the start) and clocks are those
+   of the last key read, and keys counts them. */
+typedef struct session_reader_
+{
+  FILE *file;
+  unsigned long long prog_hash;
+  unsigned long long step;
+  unsigned long long start_clocks;
+  unsigned long long ms;
+  unsigned long long clocks;
+  unsigned long long keys;
+  int ended;
+  snapshot final;
+} session_reader;
+
+static inline void session_put_num(session_writer *w, unsigned long long n)
+{
+  while (n >= 0x80)
+  {
+    w->error |= putc((int)(n & 0x7f) | 0x80, w->file) == EOF;
+    n >>= 7;
+  }
+  w->error |= putc((int)n, w->file) == EOF;
+}
+
+/* Returns nonzero if the file ends first. */
+static inline int session_get_num(session_reader *r, unsigned long long *n)
+{
+  int c;
+  unsigned shift = 0;
+
+  *n = 0;
+  do
+  {
+    c = getc(r->file);
+    if (c == EOF || shift > 63)
+    {
+      return 1;
+    }
+    *n |= (unsigned long long)(c & 0x7f) << shift;
+    shift += 7;
+  } while (c & 0x80);
+  return 0;
+}
+
+/* Start a recording of a run from the given step and clocks of the given
+   program. Returns NULL on success or an error message. */
+static inline const char *session_create(session_writer *w, const char *path,
+                                         unsigned long long prog_hash,
+                                         unsigned long long step,
+                                         unsigned long long clocks)
+{
+  unsigned char buff[SESSION_HEADER];
+
+  w->file = fopen(path, "wb");
+  if (w->file == NULL)
+  {
+    return "Error creating the recording file.";
+  }
+  memcpy(buff, SESSION_MAGIC, 8);
+  snap_put(buff + 8, SESSION_VERSION, 4);
+  snap_put(buff + 12, prog_hash, 8);
+  snap_put(buff + 20, step, 8);
+  snap_put(buff + 28, clocks, 8);
+  w->ms = 0;
+  w->clocks = clocks;
+  w->error = fwrite(buff, sizeof(buff), 1, w->file) != 1;
+  return NULL;
+}
+
+/* Record a key taken at the given time (ms from the start) and clocks. */
+static inline void session_key(session_writer *w, int key,
+                               unsigned long long ms,
+                               unsigned long long clocks)
+{
+  session_put_num(w, (unsigned long long)key + 1);
+  session_put_num(w, ms - w->ms);
+  session_put_num(w, clocks - w->clocks);
+  w->error |= fflush(w->file) != 0;
+  w->ms = ms;
+  w->clocks = clocks;
+}
+
+/* End the recording with the final state. Returns nonzero if there was ever
+   an error. */
+static inline int session_end(session_writer *w, const snapshot *final)
+{
+  unsigned char buff[SNAP_SIZE];
+
+  snap_encode(final, buff);
+  session_put_num(w, 0);
+  w->error |= fwrite(buff, sizeof(buff), 1, w->file) != 1;
+  return fclose(w->file) != 0 || w->error;
+}
+
+/* Open a recording. Returns NULL on success or an error message. */
+static inline const char *session_open(session_reader *r, const char *path)
+{
+  unsigned char buff[SESSION_HEADER];
+
+  r->file = fopen(path, "rb");
+  if (r->file == NULL)
+  {
+    return "Error opening the recording file.";
+  }
+  if (fread(buff, sizeof(buff), 1, r->file) != 1 ||
+      memcmp(buff, SESSION_MAGIC, 8) != 0)
+  {
+    fclose(r->file);
+    return "Not a recording file.";
+  }
+  if (snap_get(buff + 8, 4) != SESSION_VERSION)
+  {
+    fclose(r->file);
+    return "Recording file is from a different version.";
+  }
+  r->prog_hash = snap_get(buff + 12, 8);
+  r->step = snap_get(buff + 20, 8);
+  r->start_clocks = snap_get(buff + 28, 8);
+  r->ms = 0;
+  r->clocks = r->start_clocks;
+  r->keys = 0;
+  r->ended = 0;
+  return NULL;
+}
+
+/* Read the next key. Returns 1 for a key, 0 at the end (with the final
+   state in r->final) and -1 if the recording is cut short or corrupt. Once
+   it has ended, it stays ended. */
+static inline int session_next(session_reader *r, int *key)
+{
+  unsigned long long n;
+  unsigned long long ms;
+  unsigned long long clocks;
+  unsigned char buff[SNAP_SIZE];
+
+  if (r->ended)
+  {
+    return r->ended > 0 ? 0 : -1;
+  }
+  r->ended = -1;
+  if (session_get_num(r, &n))
+  {
+    return -1;
+  }
+  if (n == 0)
+  {
+    if (fread(buff, sizeof(buff), 1, r->file) != 1 ||
+        snap_decode(&r->final, buff, sizeof(buff)) != NULL)
+    {
+      return -1;
+    }
+    r->ended = 1;
+    return 0;
+  }
+  if (session_get_num(r, &ms) || session_get_num(r, &clocks))
+  {
+    return -1;
+  }
+  *key = (int)(n - 1);
+  r->ms += ms;
+  r->clocks += clocks;
+  ++r->keys;
+  r->ended = 0;
+  return 1;
+}
+
+static inline void session_close(session_reader *r)
+{
+  fclose(r->file);
+}
+
+#endif
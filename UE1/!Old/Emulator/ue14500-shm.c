@@ -0,0 +1,115 @@
+/* UE14500 shared front panel viewer.
+
+   License: Public Domain
+
+   Watches an emulator started with --shm NAME (the format is in
+   ue14500-shm.h, which with the other ue14500-*.h headers it includes must
+   be in the same directory) and prints its state whenever it has changed,
+   without touching the emulator at all. This is also the example to start
+   from for a display of your own. Build and run instructions (there are
+   many ways - use these as a guide):
+
+   Linux/Mac/Windows (MSYS2):
+     - gcc -O2 -o ue14500-shm ue14500-shm.c
+     - ./ue14500-shm ue14500
+
+   Command line:
+     ue14500-shm [--once] [--every MS] NAME
+
+     - Looks at the panel every MS milliseconds (default 100) and prints a
+       line if it has changed, until the emulator exits.
+     - --once prints the state once and exits.
+
+   Each line is the clock number, the instruction and data on the switches
+   (and C if the clock is high), the instruction register, the registers,
+   the output lines that are high (W: write, 0: flag 0, J: jump, R: return,
+   F: flag F), the write pulses so far and RUN, BREAK, or END if the input
+   file is running, stopped at a breakpoint, or the emulator has exited.
+*/
+#include <errno.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ue14500-core.h"
+#include "ue14500-sched.h"
+#include "ue14500-shm.h"
+
+static void print_state(const shm_state *s);
+
+int main(int argc, char **argv)
+{
+  shm_panel *panel;
+  shm_state state;
+  const char *error;
+  unsigned seq;
+  unsigned shown_seq = 1;
+  unsigned once = 0;
+  unsigned long long every = 100;
+  int arg = 1;
+
+  for (; arg < argc && strncmp(argv[arg], "--", 2) == 0; ++arg)
+  {
+    if (strcmp(argv[arg], "--once") == 0)
+    {
+      once = 1;
+    }
+    else if (strcmp(argv[arg], "--every") == 0 && arg + 1 < argc)
+    {
+      every = strtoull(argv[++arg], NULL, 10);
+    }
+    else
+    {
+      break;
+    }
+  }
+  if (arg + 1 != argc)
+  {
+    fputs("Usage: ue14500-shm [--once] [--every MS] NAME\n", stderr);
+    return 1;
+  }
+
+  panel = shm_attach(argv[arg], &error);
+  if (panel == NULL)
+  {
+    fprintf(stderr, "%s\n", error);
+    return 1;
+  }
+
+  for (;;)
+  {
+    seq = shm_read(panel, &state);
+    if (seq != shown_seq)
+    {
+      print_state(&state);
+      fflush(stdout);
+      shown_seq = seq;
+    }
+
+    /* An emulator that was killed never says it has ended. */
+    if (once || (state.flags & SHM_ENDED) ||
+        (kill((pid_t)panel->pid, 0) != 0 && errno == ESRCH))
+    {
+      break;
+    }
+    sched_sleep_until(sched_now() + every * 1000000ull);
+  }
+
+  shm_close(panel);
+  return 0;
+}
+
+static void print_state(const shm_state *s)
+{
+  printf("%10llu %-4s D%u%s  %-4s RR %u CR %u IEN %u OEN %u SKIP %u  "
+         "%c%c%c%c%c  %llu writes  %s\n", (unsigned long long)s->clocks,
+         instructions[s->switches & 0xf], (s->switches >> 4) & 1,
+         s->switches & 0x20 ? " C" : "  ", instructions[s->ir & 0xf], s->rr,
+         s->cr, s->ien, s->oen, s->skip,
+         s->outputs & co_write ? 'W' : '-', s->outputs & co_flg0 ? '0' : '-',
+         s->outputs & co_jump ? 'J' : '-', s->outputs & co_return ? 'R' : '-',
+         s->outputs & co_flgf ? 'F' : '-', (unsigned long long)s->writes,
+         s->flags & SHM_ENDED ? "END" : s->flags & SHM_BREAK ? "BREAK" :
+         s->flags & SHM_SCRIPTED ? "RUN" : "");
+}
@@ -0,0 +1,197 @@
+/* UE14500 shared front panel.
+
+   License: Public Domain
+
+   ue14500-emu --shm NAME keeps the live state of the machine in a small
+   file mapped into memory, /dev/shm/NAME (/tmp/NAME on macOS, which has no
+   /dev/shm, or NAME itself if it has a '/' in it). Any number of other
+   programs can map the same file and watch the machine - a second display
+   next to the real computer, a logger - without going near the emulator's
+   terminal or slowing it down: the emulator only stores into memory, and
+   never waits for a reader.
+
+   The file is one shm_panel, in the byte order of the machine it is on:
+
+     "UE14SHM" and a zero byte, version (4 bytes), size of the file (4),
+     process ID of the emulator (4), sequence number (4), then shm_state
+
+   The sequence number is odd while the emulator is changing the state and
+   goes up by 2 each time it has changed it (after every step). A reader
+   copies the state and checks that the number was even and the same
+   before and after, as shm_read() does (see ue14500-seqlock.h), and
+   copies again if not. The file is left behind when the emulator exits,
+   with SHM_ENDED set, so the last state can still be read.
+
+   VFD bits in shm_state.vfds:
+
+     bits 0-3  INST VFDs 0-3
+     bits 4-9  IEN, logic, carry, RR, OEN and skip VFDs
+     bits 10-15 data, write, flag 0, jump, return and flag F VFDs
+
+   and in shm_state.switches, bits 0-3 are the instruction, bit 4 the data
+   and bit 5 the clock. Needs POSIX mmap() and C11 atomics (which must be
+   lock-free for 32 bits, as they are everywhere the emulator runs).
+*/
+#ifndef UE14500_SHM_H
+#define UE14500_SHM_H
+
+#include <fcntl.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "ue14500-seqlock.h"
+
+/* File layout. */
+#define SHM_MAGIC "UE14SHM"
+#define SHM_VERSION 1u
+#ifdef __APPLE__
+#define SHM_DIR "/tmp/"
+#else
+#define SHM_DIR "/dev/shm/"
+#endif
+
+/* shm_state.flags. */
+#define SHM_SCRIPTED 0x1u /* The input file is running. */
+#define SHM_BREAK 0x2u    /* Stopped at a breakpoint. */
+#define SHM_ENDED 0x4u    /* The emulator has exited. */
+
+typedef struct shm_state_
+{
+  /* Clocks so far and write pulses. */
+  uint64_t clocks;
+  uint64_t writes;
+
+  /* VFDs and switches (see above), the selected control (as in the
+     controls enum) and SHM_ flags. */
+  uint32_t vfds;
+  uint32_t switches;
+  uint32_t control;
+  uint32_t flags;
+
+  /* Registers, output lines (cpu_output bits) and the data bus. */
+  uint8_t ir;
+  uint8_t ien;
+  uint8_t oen;
+  uint8_t rr;
+  uint8_t cr;
+  uint8_t skip;
+  uint8_t outputs;
+  uint8_t bus;
+} shm_state;
+
+typedef struct shm_panel_
+{
+  char magic[8];
+  uint32_t version;
+  uint32_t size;
+  uint32_t pid;
+  atomic_uint seq;
+  shm_state state;
+} shm_panel;
+
+/* Make the file's path from NAME. */
+static inline void shm_path(const char *name, char *path, size_t size)
+{
+  snprintf(path, size, "%s%s", strchr(name, '/') != NULL ? "" : SHM_DIR,
+           name);
+}
+
+/* Create (or replace) the panel file and map it. Returns NULL on error. */
+static inline shm_panel *shm_create(const char *name)
+{
+  char path[4096];
+  shm_panel *panel;
+  int fd;
+
+  shm_path(name, path, sizeof(path));
+  fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0)
+  {
+    return NULL;
+  }
+  if (ftruncate(fd, (off_t)sizeof(shm_panel)) != 0)
+  {
+    close(fd);
+    return NULL;
+  }
+  panel = (shm_panel *)mmap(NULL, sizeof(shm_panel), PROT_READ | PROT_WRITE,
+                            MAP_SHARED, fd, 0);
+  close(fd);
+  if (panel == (shm_panel *)MAP_FAILED)
+  {
+    return NULL;
+  }
+
+  /* The file starts out zeroed, so the state is all zero at sequence 0
+     until the first shm_publish(). */
+  memcpy(panel->magic, SHM_MAGIC, sizeof(panel->magic));
+  panel->version = SHM_VERSION;
+  panel->size = (uint32_t)sizeof(shm_panel);
+  panel->pid = (uint32_t)getpid();
+  return panel;
+}
+
+/* Change the state. Only one thread may do so. */
+static inline void shm_publish(shm_panel *panel, const shm_state *state)
+{
+  seqlock_publish(&panel->seq, &panel->state, state, sizeof(*state));
+}
+
+static inline void shm_close(shm_panel *panel)
+{
+  munmap(panel, sizeof(shm_panel));
+}
+
+/* Map an existing panel file to read. Returns NULL and sets error if it
+   cannot be. */
+static inline shm_panel *shm_attach(const char *name, const char **error)
+{
+  char path[4096];
+  struct stat st;
+  shm_panel *panel;
+  int fd;
+
+  shm_path(name, path, sizeof(path));
+  fd = open(path, O_RDONLY);
+  if (fd < 0)
+  {
+    *error = "Error opening the panel file.";
+    return NULL;
+  }
+  if (fstat(fd, &st) != 0 || st.st_size != (off_t)sizeof(shm_panel))
+  {
+    close(fd);
+    *error = "Not a panel file of this version.";
+    return NULL;
+  }
+  panel = (shm_panel *)mmap(NULL, sizeof(shm_panel), PROT_READ, MAP_SHARED,
+                            fd, 0);
+  close(fd);
+  if (panel == (shm_panel *)MAP_FAILED)
+  {
+    *error = "Error mapping the panel file.";
+    return NULL;
+  }
+  if (memcmp(panel->magic, SHM_MAGIC, sizeof(panel->magic)) != 0 ||
+      panel->version != SHM_VERSION || panel->size != sizeof(shm_panel))
+  {
+    shm_close(panel);
+    *error = "Not a panel file of this version.";
+    return NULL;
+  }
+  return panel;
+}
+
+/* Copy out the state. Returns its sequence number, which only changes when
+   the state has. */
+static inline unsigned shm_read(shm_panel *panel, shm_state *state)
+{
+  return seqlock_read(&panel->seq, state, &panel->state, sizeof(*state));
+}
+
+#endif
@@ -0,0 +1,269 @@
+/* UE14500 bit-sliced execution engine.
+
+   License: Public Domain
+
+   Every UE14500 register is a single bit, so many independent machines can be
+   run at once by giving each one a bit lane of a wider word: bit N of rr is
+   the result register of machine N, and so on. All machines execute the same
+   instruction on each clock but each has its own data input, so one pass
+   through slice_clock_high() advances a whole word of machines.
+
+   The word is 64 lanes (a plain 64-bit integer) unless the compiler is
+   targeting AVX2 (256 lanes) or AVX-512 (512 lanes), in which case GCC/clang
+   vector types are used and the compiler emits the wide instructions. Build
+   with -mavx2 or -mavx512f (or -march=native) to get the wider words, or
+   define SLICE_LANES as 64, 256 or 512 to choose explicitly.
+
+   The behaviour matches cpu_clock_high()/cpu_clock_low() in ue14500-core.h
+   lane for lane, except the logic unit VFD, which is display only and is not
+   modelled here. Use slice_set_lane()/slice_get_lane() to move single machines
+   in and out.
+*/
+#ifndef UE14500_SLICE_H
+#define UE14500_SLICE_H
+
+#include <string.h>
+
+#include "ue14500-core.h"
+
+/* Lanes per word. */
+#ifndef SLICE_LANES
+#  if defined(__AVX512F__)
+#    define SLICE_LANES 512
+#  elif defined(__AVX2__)
+#    define SLICE_LANES 256
+#  else
+#    define SLICE_LANES 64
+#  endif
+#endif
+#define SLICE_WORDS (SLICE_LANES / 64)
+
+/* One bit per lane. */
+#if SLICE_LANES == 64
+typedef unsigned long long slice_word;
+#elif SLICE_LANES == 256 || SLICE_LANES == 512
+typedef unsigned long long slice_word
+  __attribute__((vector_size(SLICE_LANES / 8)));
+#else
+#  error SLICE_LANES must be 64, 256 or 512.
+#endif
+
+/* State of a word of CPUs. The outputs are those of the last clock high, with
+   write returning low on clock low as on a single CPU. */
+typedef struct slice_state_
+{
+  /* Registers. */
+  slice_word ien;
+  slice_word oen;
+  slice_word rr;
+  slice_word cr;
+  slice_word skip;
+
+  /* Lanes that skipped the last instruction clocked in. */
+  slice_word skipped;
+
+  /* Output lines and the last value stored to the bus. */
+  slice_word write;
+  slice_word flg0;
+  slice_word jump;
+  slice_word ret;
+  slice_word flgf;
+  slice_word store;
+  slice_word bus;
+} slice_state;
+
+/* Select bits from a where mask is set and from b elsewhere. */
+#define SLICE_SELECT(mask, a, b) (((mask) & (a)) | (~(mask) & (b)))
+
+static inline slice_word slice_fill(unsigned bit)
+{
+  slice_word zero = { 0 };
+  return bit ? ~zero : zero;
+}
+
+static inline unsigned slice_get(slice_word w, unsigned lane)
+{
+  unsigned long long u[SLICE_WORDS];
+  memcpy(u, &w, sizeof(u));
+  return (unsigned)(u[lane / 64] >> (lane % 64)) & 1;
+}
+
+static inline slice_word slice_put(slice_word w, unsigned lane, unsigned bit)
+{
+  unsigned long long u[SLICE_WORDS];
+  memcpy(u, &w, sizeof(u));
+  u[lane / 64] &= ~(1ull << (lane % 64));
+  u[lane / 64] |= (unsigned long long)(bit & 1) << (lane % 64);
+  memcpy(&w, u, sizeof(u));
+  return w;
+}
+
+static inline unsigned slice_any(slice_word w)
+{
+  unsigned i;
+  unsigned long long any = 0;
+  unsigned long long u[SLICE_WORDS];
+  memcpy(u, &w, sizeof(u));
+  for (i = 0; i < SLICE_WORDS; ++i)
+  {
+    any |= u[i];
+  }
+  return any != 0;
+}
+
+/* Load one machine into a lane. */
+static inline void slice_set_lane(slice_state *s, unsigned lane,
+                                  const cpu_state *cpu)
+{
+  s->ien = slice_put(s->ien, lane, cpu->ien);
+  s->oen = slice_put(s->oen, lane, cpu->oen);
+  s->rr = slice_put(s->rr, lane, cpu->rr);
+  s->cr = slice_put(s->cr, lane, cpu->cr);
+  s->skip = slice_put(s->skip, lane, cpu->skip);
+  s->skipped = slice_put(s->skipped, lane,
+                         cpu->ir == i_nopf && !(cpu->outputs & co_flgf));
+  s->write = slice_put(s->write, lane, (cpu->outputs & co_write) != 0);
+  s->flg0 = slice_put(s->flg0, lane, (cpu->outputs & co_flg0) != 0);
+  s->jump = slice_put(s->jump, lane, (cpu->outputs & co_jump) != 0);
+  s->ret = slice_put(s->ret, lane, (cpu->outputs & co_return) != 0);
+  s->flgf = slice_put(s->flgf, lane, (cpu->outputs & co_flgf) != 0);
+  s->store = slice_put(s->store, lane, (cpu->outputs & co_store) != 0);
+  s->bus = slice_put(s->bus, lane, cpu->bus);
+}
+
+/* Read one machine out of a lane. The instruction register is not kept per
+   lane, so the caller supplies the last instruction clocked in; lanes that
+   skipped it report NOPF as a single CPU would. */
+static inline cpu_state slice_get_lane(const slice_state *s, unsigned lane,
+                                       instruction last)
+{
+  cpu_state cpu = { i_nop0 };
+
+  cpu.ien = slice_get(s->ien, lane);
+  cpu.oen = slice_get(s->oen, lane);
+  cpu.rr = slice_get(s->rr, lane);
+  cpu.cr = slice_get(s->cr, lane);
+  cpu.skip = slice_get(s->skip, lane);
+  cpu.bus = slice_get(s->bus, lane);
+  cpu.outputs = (slice_get(s->write, lane) ? co_write : 0) |
+                (slice_get(s->flg0, lane) ? co_flg0 : 0) |
+                (slice_get(s->jump, lane) ? co_jump : 0) |
+                (slice_get(s->ret, lane) ? co_return : 0) |
+                (slice_get(s->flgf, lane) ? co_flgf : 0) |
+                (slice_get(s->store, lane) ? co_store : 0);
+  cpu.ir = slice_get(s->skipped, lane) ? i_nopf : last;
+  return cpu;
+}
+
+static inline void slice_clock_high(slice_state *s, instruction inst,
+                                    slice_word data)
+{
+  slice_word zero = { 0 };
+  slice_word sum;
+  slice_word carry;
+
+  /* Lanes with skip set execute NOPF (with no FLGF), which changes nothing,
+     so the instruction only takes effect in the other lanes. */
+  slice_word run = ~s->skip;
+  s->skipped = s->skip;
+  s->skip = zero;
+
+  /* All outputs other than the bus return low. */
+  s->write = zero;
+  s->flg0 = zero;
+  s->jump = zero;
+  s->ret = zero;
+  s->flgf = zero;
+  s->store = zero;
+
+  /* Data is only seen where IEN is set, except by IEN itself. */
+  if (inst != i_ien)
+  {
+    data &= s->ien;
+  }
+
+  switch (inst)
+  {
+    case i_nop0:
+      s->flg0 = run;
+      break;
+
+    case i_ld:
+      s->rr = SLICE_SELECT(run, data, s->rr);
+      break;
+
+    case i_sub:
+      /* Subtraction is addition of the complement. */
+      data = ~data;
+      /* Fall through. */
+
+    case i_add:
+      sum = s->rr ^ data ^ s->cr;
+      carry = (s->rr & data) | (s->cr & (s->rr ^ data));
+      s->rr = SLICE_SELECT(run, sum, s->rr);
+      s->cr = SLICE_SELECT(run, carry, s->cr);
+      break;
+
+    case i_one:
+      s->rr |= run;
+      s->cr &= ~run;
+      break;
+
+    case i_nand:
+      s->rr = SLICE_SELECT(run, ~(s->rr & data), s->rr);
+      break;
+
+    case i_or:
+      s->rr |= run & data;
+      break;
+
+    case i_xor:
+      s->rr ^= run & data;
+      break;
+
+    case i_sto:
+      s->bus = SLICE_SELECT(run, s->rr, s->bus);
+      s->store = run;
+      s->write = run & s->oen;
+      break;
+
+    case i_stoc:
+      s->bus = SLICE_SELECT(run, ~s->rr, s->bus);
+      s->store = run;
+      s->write = run & s->oen;
+      break;
+
+    case i_ien:
+      s->ien = SLICE_SELECT(run, data, s->ien);
+      break;
+
+    case i_oen:
+      s->oen = SLICE_SELECT(run, data, s->oen);
+      break;
+
+    case i_jmp:
+      s->jump = run;
+      break;
+
+    case i_rtn:
+      s->ret = run;
+      s->skip = run;
+      break;
+
+    case i_skz:
+      s->skip = run & ~s->rr;
+      break;
+
+    case i_nopf:
+      s->flgf = run;
+      break;
+  }
+}
+
+static inline void slice_clock_low(slice_state *s)
+{
+  slice_word zero = { 0 };
+  s->write = zero;
+}
+
+#endif
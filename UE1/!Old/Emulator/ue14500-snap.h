@@ -0,0 +1,303 @@
+/* UE14500 machine-state snapshots.
+
+   License: Public Domain
+
+   A snapshot is everything needed to carry on a run from where it was: the
+   front panel and CPU, how far through the compiled input file it got, the
+   number of clocks, and how much output there was, including the byte still
+   being filled. Restoring one skips the power-on prompts entirely.
+
+   The file is a fixed 80 bytes, all fields little-endian so it can move
+   between machines:
+
+     0  "UE14SNAP"     8  version (4)    12 size (4)
+     16 program hash  24 step          32 clocks        40 output bytes
+     48 control, the six control states, data line, then the CPU: IR, IEN,
+        OEN, RR, carry, skip, outputs and bus (one byte each)
+     64 byte being filled, bits set in it, then keystrokes of the input file
+        used (6)
+     72 FNV-1a hash of bytes 0-71
+
+   The program hash is of the input file's power-on line and keystrokes, so
+   a snapshot is only restored with the input file it was taken with. The
+   step is the place in the steps compiled for that run; restoring carries
+   on from the keystroke position instead, compiling the rest of the file
+   from the restored switches.
+
+   snap_save() writes to a temporary file, syncs it and renames it over the
+   snapshot, so an interruption at any point leaves either the old snapshot
+   or the new one, never a mix. snap_load() maps the file rather than reading
+   it. Both need POSIX; on Windows the file is read instead and the rename is
+   not atomic.
+*/
+#ifndef UE14500_SNAP_H
+#define UE14500_SNAP_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifndef WIN32
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+
+#include "ue14500-core.h"
+
+/* File layout. */
+#define SNAP_MAGIC "UE14SNAP"
+#define SNAP_VERSION 2u
+#define SNAP_SIZE 80u
+#define SNAP_HASHED 72u
+
+/* FNV-1a 64-bit, used for both the program and file hashes. */
+#define SNAP_FNV_BASIS 0xcbf29ce484222325ull
+#define SNAP_FNV_PRIME 0x100000001b3ull
+
+/* A snapshot in memory. */
+typedef struct snapshot_
+{
+  /* Front panel and CPU. */
+  panel_state panel;
+
+  /* Hash of the program, the next step of it to run, the keystrokes of it
+     used, and clocks so far. */
+  unsigned long long prog_hash;
+  unsigned long long step;
+  unsigned long long pos;
+  unsigned long long clocks;
+
+  /* Whole bytes written to the output file, and the byte being filled. */
+  unsigned long long out_bytes;
+  unsigned curr_byte;
+  unsigned bits_set;
+} snapshot;
+
+static inline unsigned long long snap_fnv(unsigned long long hash,
+                                          const unsigned char *data,
+                                          size_t len)
+{
+  while (len-- > 0)
+  {
+    hash = (hash ^ *data++) * SNAP_FNV_PRIME;
+  }
+  return hash;
+}
+
+/* Hash of a program's power-on values and keystrokes (an empty one for
+   interactive use). */
+static inline unsigned long long snap_program_hash(const program *prog)
+{
+  unsigned char init[2];
+
+  init[0] = (unsigned char)prog->init;
+  init[1] = (unsigned char)(prog->init >> 8);
+  return snap_fnv(snap_fnv(SNAP_FNV_BASIS, init, sizeof(init)),
+                  (const unsigned char *)prog->text, prog->text_len);
+}
+
+static inline void snap_put(unsigned char *p, unsigned long long value,
+                            unsigned bytes)
+{
+  while (bytes-- > 0)
+  {
+    *p++ = (unsigned char)value;
+    value >>= 8;
+  }
+}
+
+static inline unsigned long long snap_get(const unsigned char *p,
+                                          unsigned bytes)
+{
+  unsigned long long value = 0;
+
+  while (bytes-- > 0)
+  {
+    value = value << 8 | p[bytes];
+  }
+  return value;
+}
+
+static inline void snap_encode(const snapshot *snap,
+                               unsigned char buff[SNAP_SIZE])
+{
+  unsigned i;
+  const cpu_state *cpu = &snap->panel.cpu;
+
+  memset(buff, 0, SNAP_SIZE);
+  memcpy(buff, SNAP_MAGIC, 8);
+  snap_put(buff + 8, SNAP_VERSION, 4);
+  snap_put(buff + 12, SNAP_SIZE, 4);
+  snap_put(buff + 16, snap->prog_hash, 8);
+  snap_put(buff + 24, snap->step, 8);
+  snap_put(buff + 32, snap->clocks, 8);
+  snap_put(buff + 40, snap->out_bytes, 8);
+  buff[48] = (unsigned char)snap->panel.control;
+  for (i = 0; i < num_controls; ++i)
+  {
+    buff[49 + i] = (unsigned char)snap->panel.control_states[i];
+  }
+  buff[55] = (unsigned char)snap->panel.data_line;
+  buff[56] = (unsigned char)cpu->ir;
+  buff[57] = (unsigned char)cpu->ien;
+  buff[58] = (unsigned char)cpu->oen;
+  buff[59] = (unsigned char)cpu->rr;
+  buff[60] = (unsigned char)cpu->cr;
+  buff[61] = (unsigned char)cpu->skip;
+  buff[62] = (unsigned char)cpu->outputs;
+  buff[63] = (unsigned char)cpu->bus;
+  buff[64] = (unsigned char)snap->curr_byte;
+  buff[65] = (unsigned char)snap->bits_set;
+  snap_put(buff + 66, snap->pos, 6);
+  snap_put(buff + SNAP_HASHED, snap_fnv(SNAP_FNV_BASIS, buff, SNAP_HASHED),
+           8);
+}
+
+/* Returns NULL on success or an error message. */
+static inline const char *snap_decode(snapshot *snap,
+                                      const unsigned char *buff, size_t len)
+{
+  unsigned i;
+  cpu_state *cpu = &snap->panel.cpu;
+
+  if (len < 16 || memcmp(buff, SNAP_MAGIC, 8) != 0)
+  {
+    return "Not a snapshot file.";
+  }
+  if (snap_get(buff + 8, 4) != SNAP_VERSION ||
+      snap_get(buff + 12, 4) != SNAP_SIZE || len != SNAP_SIZE)
+  {
+    return "Snapshot file is from a different version.";
+  }
+  if (snap_get(buff + SNAP_HASHED, 8) !=
+      snap_fnv(SNAP_FNV_BASIS, buff, SNAP_HASHED))
+  {
+    return "Snapshot file is corrupt.";
+  }
+
+  snap->prog_hash = snap_get(buff + 16, 8);
+  snap->step = snap_get(buff + 24, 8);
+  snap->clocks = snap_get(buff + 32, 8);
+  snap->out_bytes = snap_get(buff + 40, 8);
+  snap->panel.control = (controls)buff[48];
+  for (i = 0; i < num_controls; ++i)
+  {
+    snap->panel.control_states[i] = buff[49 + i];
+  }
+  snap->panel.data_line = buff[55];
+  cpu->ir = (instruction)buff[56];
+  cpu->ien = buff[57];
+  cpu->oen = buff[58];
+  cpu->rr = buff[59];
+  cpu->cr = buff[60];
+  cpu->skip = buff[61];
+  cpu->outputs = buff[62];
+  cpu->bus = buff[63];
+  snap->curr_byte = buff[64];
+  snap->bits_set = buff[65];
+  snap->pos = snap_get(buff + 66, 6);
+
+  /* The hash matched, so anything out of range was written that way. */
+  for (i = 49; i < 64; ++i)
+  {
+    if (i != 56 && i != 62 && buff[i] > 1)
+    {
+      return "Snapshot file is invalid.";
+    }
+  }
+  if (snap->panel.control >= num_controls || cpu->ir > i_nopf ||
+      snap->bits_set >= 8 || snap->curr_byte >> snap->bits_set != 0)
+  {
+    return "Snapshot file is invalid.";
+  }
+  return NULL;
+}
+
+/* Write a snapshot atomically. Returns NULL on success or an error
+   message. */
+static inline const char *snap_save(const char *path, const snapshot *snap)
+{
+  FILE *file;
+  char *tmp;
+  int ok;
+  unsigned char buff[SNAP_SIZE];
+
+  tmp = (char *)malloc(strlen(path) + 5);
+  if (tmp == NULL)
+  {
+    return "Out of memory.";
+  }
+  strcpy(tmp, path);
+  strcat(tmp, ".tmp");
+
+  /* Write and sync the temporary file, then move it into place. */
+  snap_encode(snap, buff);
+  file = fopen(tmp, "wb");
+  if (file == NULL)
+  {
+    free(tmp);
+    return "Error creating snapshot file.";
+  }
+  ok = fwrite(buff, SNAP_SIZE, 1, file) == 1 && fflush(file) == 0;
+#ifndef WIN32
+  ok = ok && fsync(fileno(file)) == 0;
+#endif
+  ok = fclose(file) == 0 && ok;
+#ifdef WIN32
+  remove(path);
+#endif
+  ok = ok && rename(tmp, path) == 0;
+  if (!ok)
+  {
+    remove(tmp);
+  }
+  free(tmp);
+  return ok ? NULL : "Error writing snapshot file.";
+}
+
+/* Load a snapshot. Returns NULL on success or an error message. */
+static inline const char *snap_load(const char *path, snapshot *snap)
+{
+  const char *error;
+#ifdef WIN32
+  FILE *file;
+  size_t len;
+  unsigned char buff[SNAP_SIZE + 1];
+
+  file = fopen(path, "rb");
+  if (file == NULL)
+  {
+    return "Error opening snapshot file.";
+  }
+  len = fread(buff, 1, sizeof(buff), file);
+  fclose(file);
+  error = snap_decode(snap, buff, len);
+#else
+  int fd;
+  struct stat st;
+  void *map;
+
+  fd = open(path, O_RDONLY);
+  if (fd < 0)
+  {
+    return "Error opening snapshot file.";
+  }
+  if (fstat(fd, &st) != 0 || st.st_size < 16)
+  {
+    close(fd);
+    return "Not a snapshot file.";
+  }
+  map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (map == MAP_FAILED)
+  {
+    return "Error reading snapshot file.";
+  }
+  error = snap_decode(snap, (const unsigned char *)map, (size_t)st.st_size);
+  munmap(map, (size_t)st.st_size);
+#endif
+  return error;
+}
+
+#endif
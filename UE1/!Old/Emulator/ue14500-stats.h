@@ -0,0 +1,118 @@
+/* UE14500 run counters.
+
+   License: Public Domain
+
+   Counts what a run does: the clocks, the instructions run (and skipped)
+   and the write pulses. Counting a clock is one increment of a counter for
+   its instruction, 16 of them plus 16 more for skipped instructions; the
+   totals are only added up when they are shown or reported, so counting can
+   be left on all the time.
+
+   stats_report() writes the counters as CSV (a name,value line each) or as
+   a JSON object:
+
+     clocks, skipped, writes           counts
+     bytes                             whole bytes in the output file
+     seconds, hz, target_hz            time taken, clocks a second and the
+                                       --hz rate (0 for none)
+     NAME / skipped NAME               clocks that ran / skipped each
+                                       instruction (an object each in JSON)
+*/
+#ifndef UE14500_STATS_H
+#define UE14500_STATS_H
+
+#include <stdio.h>
+
+#include "ue14500-core.h"
+
+typedef struct run_stats_
+{
+  /* Clocks by the instruction on the switches, plus 16 if it was skipped. */
+  unsigned long long ops[32];
+
+  /* Write pulses. */
+  unsigned long long writes;
+} run_stats;
+
+/* Count a step that left the panel as given. A skipped instruction leaves
+   NOPF in the instruction register without raising FLGF. */
+static inline void stats_step(run_stats *s, const panel_state *panel,
+                              unsigned events)
+{
+  const cpu_state *cpu = &panel->cpu;
+
+  if (events & pe_clock_high)
+  {
+    if (cpu->ir == i_nopf && !(cpu->outputs & co_flgf))
+    {
+      ++s->ops[16 + GET_INSTR(panel)];
+    }
+    else
+    {
+      ++s->ops[cpu->ir];
+    }
+    s->writes += (events & pe_write) != 0;
+  }
+}
+
+/* Total clocks, or just the skipped ones. */
+static inline unsigned long long stats_clocks(const run_stats *s,
+                                              unsigned skipped_only)
+{
+  unsigned i;
+  unsigned long long clocks = 0;
+
+  for (i = skipped_only ? 16 : 0; i < 32; ++i)
+  {
+    clocks += s->ops[i];
+  }
+  return clocks;
+}
+
+/* Write the counters to a file, as JSON or else CSV. Returns nonzero on
+   error. */
+static inline int stats_report(const run_stats *s, FILE *file, unsigned json,
+                               unsigned long long bytes, double seconds,
+                               double target_hz)
+{
+  unsigned i;
+  unsigned long long clocks = stats_clocks(s, 0);
+  double hz = seconds > 0 ? (double)clocks / seconds : 0.0;
+
+  if (json)
+  {
+    fprintf(file, "{\n  \"clocks\": %llu,\n  \"skipped\": %llu,\n"
+                  "  \"writes\": %llu,\n  \"bytes\": %llu,\n"
+                  "  \"seconds\": %.6f,\n  \"hz\": %.6g,\n"
+                  "  \"target_hz\": %.6g,\n  \"instructions\": {",
+            clocks, stats_clocks(s, 1), s->writes, bytes, seconds, hz,
+            target_hz);
+    for (i = 0; i < 16; ++i)
+    {
+      fprintf(file, "%s\"%s\": %llu", i ? ", " : " ", instructions[i],
+              s->ops[i]);
+    }
+    fputs(" },\n  \"skipped_instructions\": {", file);
+    for (i = 0; i < 16; ++i)
+    {
+      fprintf(file, "%s\"%s\": %llu", i ? ", " : " ", instructions[i],
+              s->ops[16 + i]);
+    }
+    fputs(" }\n}\n", file);
+  }
+  else
+  {
+    fprintf(file, "name,value\nclocks,%llu\nskipped,%llu\nwrites,%llu\n"
+                  "bytes,%llu\nseconds,%.6f\nhz,%.6g\ntarget_hz,%.6g\n",
+            clocks, stats_clocks(s, 1), s->writes, bytes, seconds, hz,
+            target_hz);
+    for (i = 0; i < 32; ++i)
+    {
+      fprintf(file, "%s%s,%llu\n", i < 16 ? "" : "skipped ",
+              instructions[i % 16], s->ops[i]);
+    }
+  }
+  return ferror(file) != 0;
+}
+
+#endif
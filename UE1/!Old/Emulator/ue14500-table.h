@@ -0,0 +1,5664 @@
+/* UE14500 step tables.
+
+   License: Public Domain
+
+   GENERATED by ue14500-gentab.c from ue14500-core.h. Do not edit;
+   regenerate with ./ue14500-gentab > ue14500-table.h and check with
+   ./ue14500-gentab --check.
+
+   Index: bits 0-4 are the state (RR, carry, IEN, OEN, skip), bits
+   5-8 the instruction and bit 9 its data. The pair table adds the
+   second instruction in bits 10-13 and its data in bit 14.
+
+   Entry: bits 0-4 are the new state. Bits 5-11 are the cpu_output
+   bits of the (first) instruction and bit 12 the bit it put on the
+   bus, if co_store is set. In the pair table, bits 13-20 are the
+   same for the second instruction.
+*/
+#ifndef UE14500_TABLE_H
+#define UE14500_TABLE_H
+
+#include <stdint.h>
+
+#include "ue14500-core.h"
+
+/* Index and entry fields. */
+#define TABLE_STATE 0x1fu
+#define TABLE_INDEX(state, inst, data) \
+  ((state) | (unsigned)(inst) << 5 | (unsigned)(data) << 9)
+#define TABLE_PAIR_INDEX(state, inst1, data1, inst2, data2) \
+  (TABLE_INDEX((state), (inst1), (data1)) |                 \
+   (unsigned)(inst2) << 10 | (unsigned)(data2) << 14)
+#define TABLE_OUTPUTS(entry) (((entry) >> 5) & 0x7fu)
+#define TABLE_BUS(entry) (((entry) >> 12) & 1u)
+#define TABLE_OUTPUTS2(entry) (((entry) >> 13) & 0x7fu)
+#define TABLE_BUS2(entry) (((entry) >> 20) & 1u)
+
+static const unsigned short table_step[1024] =
+{
+  0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+  0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f,
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+  0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f,
+  0x0000, 0x0000, 0x0002, 0x0002, 0x0004, 0x0004, 0x0006, 0x0006,
+  0x0008, 0x0008, 0x000a, 0x000a, 0x000c, 0x000c, 0x000e, 0x000e,
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+  0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f,
+  0x0000, 0x0001, 0x0001, 0x0002, 0x0004, 0x0005, 0x0005, 0x0006,
+  0x0008, 0x0009, 0x0009, 0x000a, 0x000c, 0x000d, 0x000d, 0x000e,
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+  0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f,
+  0x0001, 0x0002, 0x0002, 0x0003, 0x0005, 0x0006, 0x0006, 0x0007,
+  0x0009, 0x000a, 0x000a, 0x000b, 0x000d, 0x000e, 0x000e, 0x000f,
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+  0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0009, 0x0009, 0x0009, 0x0009, 0x000d, 0x000d, 0x000d, 0x000d,
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+  0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f,
+  0x0401, 0x0401, 0x0403, 0x0403, 0x0405, 0x0405, 0x0407, 0x0407,
+  0x0409, 0x0409, 0x040b, 0x040b, 0x040d, 0x040d, 0x040f, 0x040f,
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+  0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f,
+  0x0000, 0x0401, 0x0002, 0x0403, 0x0004, 0x0405, 0x0006, 0x0407,
+  0x0008, 0x0409, 0x000a, 0x040b, 0x000c, 0x040d, 0x000e, 0x040f,
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+  0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f,
+  0x0000, 0x0401, 0x0002, 0x0403, 0x0004, 0x0405, 0x0006, 0x0407,
+  0x0008, 0x0409, 0x000a, 0x040b, 0x000c, 0x040d, 0x000e, 0x040f,
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+  0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f,
+  0x0800, 0x1801, 0x0802, 0x1803, 0x0804, 0x1805, 0x0806, 0x1807,
+  0x0828, 0x1829, 0x082a, 0x182b, 0x082c, 0x182d, 0x082e, 0x182f,
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+  0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f,
+  0x1800, 0x0801, 0x1802, 0x0803, 0x1804, 0x0805, 0x1806, 0x0807,
+  0x1828, 0x0829, 0x182a, 0x082b, 0x182c, 0x082d, 0x182e, 0x082f,
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+  0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f,
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0000, 0x0001, 0x0002, 0x0003,
+  0x0008, 0x0009, 0x000a, 0x000b, 0x0008, 0x0009, 0x000a, 0x000b,
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+  0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f,
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+  0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f,
+  0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+  0x0088, 0x0089, 0x008a, 0x008b, 0x008c, 0x008d, 0x008e, 0x008f,
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+  0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f,
+  0x0110, 0x0111, 0x0112, 0x0113, 0x0114, 0x0115, 0x0116, 0x0117,
+  0x0118, 0x0119, 0x011a, 0x011b, 0x011c, 0x011d, 0x011e, 0x011f,
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+  0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f,
+  0x0010, 0x0001, 0x0012, 0x0003, 0x0014, 0x0005, 0x0016, 0x0007,
+  0x0018, 0x0009, 0x001a, 0x000b, 0x001c, 0x000d, 0x001e, 0x000f,
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+  0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f,
+  0x0200, 0x0201, 0x0202, 0x0203, 0x0204, 0x0205, 0x0206, 0x0207,
+  0x0208, 0x0209, 0x020a, 0x020b, 0x020c, 0x020d, 0x020e, 0x020f,
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+  0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f,
+  0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+  0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f,
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+  0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f,
+  0x0000, 0x0000, 0x0002, 0x0002, 0x0005, 0x0005, 0x0007, 0x0007,
+  0x0008, 0x0008, 0x000a, 0x000a, 0x000d, 0x000d, 0x000f, 0x000f,
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+  0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f,
+  0x0000, 0x0001, 0x0001, 0x0002, 0x0005, 0x0006, 0x0006, 0x0007,
+  0x0008, 0x0009, 0x0009, 0x000a, 0x000d, 0x000e, 0x000e, 0x000f,
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+  0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f,
+  0x0001, 0x0002, 0x0002, 0x0003, 0x0004, 0x0005, 0x0005, 0x0006,
+  0x0009, 0x000a, 0x000a, 0x000b, 0x000c, 0x000d, 0x000d, 0x000e,
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+  0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f,
+  0x0001, 0x0001, 0x0001, 0x0001, 0x0005, 0x0005, 0x0005, 0x0005,
+  0x0009, 0x0009, 0x0009, 0x0009, 0x000d, 0x000d, 0x000d, 0x000d,
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+  0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f,
+  0x0401, 0x0401, 0x0403, 0x0403, 0x0405, 0x0004, 0x0407, 0x0006,
+  0x0409, 0x0409, 0x040b, 0x040b, 0x040d, 0x000c, 0x040f, 0x000e,
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+  0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f,
+  0x0000, 0x0401, 0x0002, 0x0403, 0x0405, 0x0405, 0x0407, 0x0407,
+  0x0008, 0x0409, 0x000a, 0x040b, 0x040d, 0x040d, 0x040f, 0x040f,
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+  0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f,
+  0x0000, 0x0401, 0x0002, 0x0403, 0x0405, 0x0004, 0x0407, 0x0006,
+  0x0008, 0x0409, 0x000a, 0x040b, 0x040d, 0x000c, 0x040f, 0x000e,
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+  0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f,
+  0x0800, 0x1801, 0x0802, 0x1803, 0x0804, 0x1805, 0x0806, 0x1807,
+  0x0828, 0x1829, 0x082a, 0x182b, 0x082c, 0x182d, 0x082e, 0x182f,
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+  0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f,
+  0x1800, 0x0801, 0x1802, 0x0803, 0x1804, 0x0805, 0x1806, 0x0807,
+  0x1828, 0x0829, 0x182a, 0x082b, 0x182c, 0x082d, 0x182e, 0x082f,
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+  0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f,
+  0x0004, 0x0005, 0x0006, 0x0007, 0x0004, 0x0005, 0x0006, 0x0007,
+  0x000c, 0x000d, 0x000e, 0x000f, 0x000c, 0x000d, 0x000e, 0x000f,
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+  0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f,
+  0x0000, 0x0001, 0x0002, 0x0003, 0x000c, 0x000d, 0x000e, 0x000f,
+  0x0000, 0x0001, 0x0002, 0x0003, 0x000c, 0x000d, 0x000e, 0x000f,
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+  0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f,
+  0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+  0x0088, 0x0089, 0x008a, 0x008b, 0x008c, 0x008d, 0x008e, 0x008f,
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+  0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f,
+  0x0110, 0x0111, 0x0112, 0x0113, 0x0114, 0x0115, 0x0116, 0x0117,
+  0x0118, 0x0119, 0x011a, 0x011b, 0x011c, 0x011d, 0x011e, 0x011f,
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+  0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f,
+  0x0010, 0x0001, 0x0012, 0x0003, 0x0014, 0x0005, 0x0016, 0x0007,
+  0x0018, 0x0009, 0x001a, 0x000b, 0x001c, 0x000d, 0x001e, 0x000f,
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+  0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f,
+  0x0200, 0x0201, 0x0202, 0x0203, 0x0204, 0x0205, 0x0206, 0x0207,
+  0x0208, 0x0209, 0x020a, 0x020b, 0x020c, 0x020d, 0x020e, 0x020f,
+  0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+  0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d, 0x000e, 0x000f
+};
+
+/* Left out with TABLE_NO_PAIR for programs that only need
+   table_clock_high(). */
+#ifndef TABLE_NO_PAIR
+static const uint32_t table_pair[32768] =
+{
+  0x004040, 0x004041, 0x004042, 0x004043, 0x004044, 0x004045,
+  0x004046, 0x004047, 0x004048, 0x004049, 0x00404a, 0x00404b,
+  0x00404c, 0x00404d, 0x00404e, 0x00404f, 0x004000, 0x004001,
+  0x004002, 0x004003, 0x004004, 0x004005, 0x004006, 0x004007,
+  0x004008, 0x004009, 0x00400a, 0x00400b, 0x00400c, 0x00400d,
+  0x00400e, 0x00400f, 0x004000, 0x004000, 0x004002, 0x004002,
+  0x004004, 0x004004, 0x004006, 0x004006, 0x004008, 0x004008,
+  0x00400a, 0x00400a, 0x00400c, 0x00400c, 0x00400e, 0x00400e,
+  0x004000, 0x004001, 0x004002, 0x004003, 0x004004, 0x004005,
+  0x004006, 0x004007, 0x004008, 0x004009, 0x00400a, 0x00400b,
+  0x00400c, 0x00400d, 0x00400e, 0x00400f, 0x004000, 0x004001,
+  0x004001, 0x004002, 0x004004, 0x004005, 0x004005, 0x004006,
+  0x004008, 0x004009, 0x004009, 0x00400a, 0x00400c, 0x00400d,
+  0x00400d, 0x00400e, 0x004000, 0x004001, 0x004002, 0x004003,
+  0x004004, 0x004005, 0x004006, 0x004007, 0x004008, 0x004009,
+  0x00400a, 0x00400b, 0x00400c, 0x00400d, 0x00400e, 0x00400f,
+  0x004001, 0x004002, 0x004002, 0x004003, 0x004005, 0x004006,
+  0x004006, 0x004007, 0x004009, 0x00400a, 0x00400a, 0x00400b,
+  0x00400d, 0x00400e, 0x00400e, 0x00400f, 0x004000, 0x004001,
+  0x004002, 0x004003, 0x004004, 0x004005, 0x004006, 0x004007,
+  0x004008, 0x004009, 0x00400a, 0x00400b, 0x00400c, 0x00400d,
+  0x00400e, 0x00400f, 0x004001, 0x004001, 0x004001, 0x004001,
+  0x004005, 0x004005, 0x004005, 0x004005, 0x004009, 0x004009,
+  0x004009, 0x004009, 0x00400d, 0x00400d, 0x00400d, 0x00400d,
+  0x004000, 0x004001, 0x004002, 0x004003, 0x004004, 0x004005,
+  0x004006, 0x004007, 0x004008, 0x004009, 0x00400a, 0x00400b,
+  0x00400c, 0x00400d, 0x00400e, 0x00400f, 0x004401, 0x004401,
+  0x004403, 0x004403, 0x004405, 0x004405, 0x004407, 0x004407,
+  0x004409, 0x004409, 0x00440b, 0x00440b, 0x00440d, 0x00440d,
+  0x00440f, 0x00440f, 0x004000, 0x004001, 0x004002, 0x004003,
+  0x004004, 0x004005, 0x004006, 0x004007, 0x004008, 0x004009,
+  0x00400a, 0x00400b, 0x00400c, 0x00400d, 0x00400e, 0x00400f,
+  0x004000, 0x004401, 0x004002, 0x004403, 0x004004, 0x004405,
+  0x004006, 0x004407, 0x004008, 0x004409, 0x00400a, 0x00440b,
+  0x00400c, 0x00440d, 0x00400e, 0x00440f, 0x004000, 0x004001,
+  0x004002, 0x004003, 0x004004, 0x004005, 0x004006, 0x004007,
+  0x004008, 0x004009, 0x00400a, 0x00400b, 0x00400c, 0x00400d,
+  0x00400e, 0x00400f, 0x004000, 0x004401, 0x004002, 0x004403,
+  0x004004, 0x004405, 0x004006, 0x004407, 0x004008, 0x004409,
+  0x00400a, 0x00440b, 0x00400c, 0x00440d, 0x00400e, 0x00440f,
+  0x004000, 0x004001, 0x004002, 0x004003, 0x004004, 0x004005,
+  0x004006, 0x004007, 0x004008, 0x004009, 0x00400a, 0x00400b,
+  0x00400c, 0x00400d, 0x00400e, 0x00400f, 0x004800, 0x005801,
+  0x004802, 0x005803, 0x004804, 0x005805, 0x004806, 0x005807,
+  0x004828, 0x005829, 0x00482a, 0x00582b, 0x00482c, 0x00582d,
+  0x00482e, 0x00582f, 0x004000, 0x004001, 0x004002, 0x004003,
+  0x004004, 0x004005, 0x004006, 0x004007, 0x004008, 0x004009,
+  0x00400a, 0x00400b, 0x00400c, 0x00400d, 0x00400e, 0x00400f,
+  0x005800, 0x004801, 0x005802, 0x004803, 0x005804, 0x004805,
+  0x005806, 0x004807, 0x005828, 0x004829, 0x00582a, 0x00482b,
+  0x00582c, 0x00482d, 0x00582e, 0x00482f, 0x004000, 0x004001,
+  0x004002, 0x004003, 0x004004, 0x004005, 0x004006, 0x004007,
+  0x004008, 0x004009, 0x00400a, 0x00400b, 0x00400c, 0x00400d,
+  0x00400e, 0x00400f, 0x004000, 0x004001, 0x004002, 0x004003,
+  0x004000, 0x004001, 0x004002, 0x004003, 0x004008, 0x004009,
+  0x00400a, 0x00400b, 0x004008, 0x004009, 0x00400a, 0x00400b,
+  0x004000, 0x004001, 0x004002, 0x004003, 0x004004, 0x004005,
+  0x004006, 0x004007, 0x004008, 0x004009, 0x00400a, 0x00400b,
+  0x00400c, 0x00400d, 0x00400e, 0x00400f, 0x004000, 0x004001,
+  0x004002, 0x004003, 0x004004, 0x004005, 0x004006, 0x004007,
+  0x004000, 0x004001, 0x004002, 0x004003, 0x004004, 0x004005,
+  0x004006, 0x004007, 0x004000, 0x004001, 0x004002, 0x004003,
+  0x004004, 0x004005, 0x004006, 0x004007, 0x004008, 0x004009,
+  0x00400a, 0x00400b, 0x00400c, 0x00400d, 0x00400e, 0x00400f,
+  0x004080, 0x004081, 0x004082, 0x004083, 0x004084, 0x004085,
+  0x004086, 0x004087, 0x004088, 0x004089, 0x00408a, 0x00408b,
+  0x00408c, 0x00408d, 0x00408e, 0x00408f, 0x004000, 0x004001,
+  0x004002, 0x004003, 0x004004, 0x004005, 0x004006, 0x004007,
+  0x004008, 0x004009, 0x00400a, 0x00400b, 0x00400c, 0x00400d,
+  0x00400e, 0x00400f, 0x000100, 0x000101, 0x000102, 0x000103,
+  0x000104, 0x000105, 0x000106, 0x000107, 0x000108, 0x000109,
+  0x00010a, 0x00010b, 0x00010c, 0x00010d, 0x00010e, 0x00010f,
+  0x004000, 0x004001, 0x004002, 0x004003, 0x004004, 0x004005,
+  0x004006, 0x004007, 0x004008, 0x004009, 0x00400a, 0x00400b,
+  0x00400c, 0x00400d, 0x00400e, 0x00400f, 0x000000, 0x004001,
+  0x000002, 0x004003, 0x000004, 0x004005, 0x000006, 0x004007,
+  0x000008, 0x004009, 0x00000a, 0x00400b, 0x00000c, 0x00400d,
+  0x00000e, 0x00400f, 0x004000, 0x004001, 0x004002, 0x004003,
+  0x004004, 0x004005, 0x004006, 0x004007, 0x004008, 0x004009,
+  0x00400a, 0x00400b, 0x00400c, 0x00400d, 0x00400e, 0x00400f,
+  0x004200, 0x004201, 0x004202, 0x004203, 0x004204, 0x004205,
+  0x004206, 0x004207, 0x004208, 0x004209, 0x00420a, 0x00420b,
+  0x00420c, 0x00420d, 0x00420e, 0x00420f, 0x004000, 0x004001,
+  0x004002, 0x004003, 0x004004, 0x004005, 0x004006, 0x004007,
+  0x004008, 0x004009, 0x00400a, 0x00400b, 0x00400c, 0x00400d,
+  0x00400e, 0x00400f, 0x004040, 0x004041, 0x004042, 0x004043,
+  0x004044, 0x004045, 0x004046, 0x004047, 0x004048, 0x004049,
+  0x00404a, 0x00404b, 0x00404c, 0x00404d, 0x00404e, 0x00404f,
+  0x004000, 0x004001, 0x004002, 0x004003, 0x004004, 0x004005,
+  0x004006, 0x004007, 0x004008, 0x004009, 0x00400a, 0x00400b,
+  0x00400c, 0x00400d, 0x00400e, 0x00400f, 0x004000, 0x004000,
+  0x004002, 0x004002, 0x004005, 0x004005, 0x004007, 0x004007,
+  0x004008, 0x004008, 0x00400a, 0x00400a, 0x00400d, 0x00400d,
+  0x00400f, 0x00400f, 0x004000, 0x004001, 0x004002, 0x004003,
+  0x004004, 0x004005, 0x004006, 0x004007, 0x004008, 0x004009,
+  0x00400a, 0x00400b, 0x00400c, 0x00400d, 0x00400e, 0x00400f,
+  0x004000, 0x004001, 0x004001, 0x004002, 0x004005, 0x004006,
+  0x004006, 0x004007, 0x004008, 0x004009, 0x004009, 0x00400a,
+  0x00400d, 0x00400e, 0x00400e, 0x00400f, 0x004000, 0x004001,
+  0x004002, 0x004003, 0x004004, 0x004005, 0x004006, 0x004007,
+  0x004008, 0x004009, 0x00400a, 0x00400b, 0x00400c, 0x00400d,
+  0x00400e, 0x00400f, 0x004001, 0x004002, 0x004002, 0x004003,
+  0x004004, 0x004005, 0x004005, 0x004006, 0x004009, 0x00400a,
+  0x00400a, 0x00400b, 0x00400c, 0x00400d, 0x00400d, 0x00400e,
+  0x004000, 0x004001, 0x004002, 0x004003, 0x004004, 0x004005,
+  0x004006, 0x004007, 0x004008, 0x004009, 0x00400a, 0x00400b,
+  0x00400c, 0x00400d, 0x00400e, 0x00400f, 0x004001, 0x004001,
+  0x004001, 0x004001, 0x004005, 0x004005, 0x004005, 0x004005,
+  0x004009, 0x004009, 0x004009, 0x004009, 0x00400d, 0x00400d,
+  0x00400d, 0x00400d, 0x004000, 0x004001, 0x004002, 0x004003,
+  0x004004, 0x004005, 0x004006, 0x004007, 0x004008, 0x004009,
+  0x00400a, 0x00400b, 0x00400c, 0x00400d, 0x00400e, 0x00400f,
+  0x004401, 0x004401, 0x004403, 0x004403, 0x004405, 0x004004,
+  0x004407, 0x004006, 0x004409, 0x004409, 0x00440b, 0x00440b,
+  0x00440d, 0x00400c, 0x00440f, 0x00400e, 0x004000, 0x004001,
+  0x004002, 0x004003, 0x004004, 0x004005, 0x004006, 0x004007,
+  0x004008, 0x004009, 0x00400a, 0x00400b, 0x00400c, 0x00400d,
+  0x00400e, 0x00400f, 0x004000, 0x004401, 0x004002, 0x004403,
+  0x004405, 0x004405, 0x004407, 0x004407, 0x004008, 0x004409,
+  0x00400a, 0x00440b, 0x00440d, 0x00440d, 0x00440f, 0x00440f,
+  0x004000, 0x004001, 0x004002, 0x004003, 0x004004, 0x004005,
+  0x004006, 0x004007, 0x004008, 0x004009, 0x00400a, 0x00400b,
+  0x00400c, 0x00400d, 0x00400e, 0x00400f, 0x004000, 0x004401,
+  0x004002, 0x004403, 0x004405, 0x004004, 0x004407, 0x004006,
+  0x004008, 0x004409, 0x00400a, 0x00440b, 0x00440d, 0x00400c,
+  0x00440f, 0x00400e, 0x004000, 0x004001, 0x004002, 0x004003,
+  0x004004, 0x004005, 0x004006, 0x004007, 0x004008, 0x004009,
+  0x00400a, 0x00400b, 0x00400c, 0x00400d, 0x00400e, 0x00400f,
+  0x004800, 0x005801, 0x004802, 0x005803, 0x004804, 0x005805,
+  0x004806, 0x005807, 0x004828, 0x005829, 0x00482a, 0x00582b,
+  0x00482c, 0x00582d, 0x00482e, 0x00582f, 0x004000, 0x004001,
+  0x004002, 0x004003, 0x004004, 0x004005, 0x004006, 0x004007,
+  0x004008, 0x004009, 0x00400a, 0x00400b, 0x00400c, 0x00400d,
+  0x00400e, 0x00400f, 0x005800, 0x004801, 0x005802, 0x004803,
+  0x005804, 0x004805, 0x005806, 0x004807, 0x005828, 0x004829,
+  0x00582a, 0x00482b, 0x00582c, 0x00482d, 0x00582e, 0x00482f,
+  0x004000, 0x004001, 0x004002, 0x004003, 0x004004, 0x004005,
+  0x004006, 0x004007, 0x004008, 0x004009, 0x00400a, 0x00400b,
+  0x00400c, 0x00400d, 0x00400e, 0x00400f, 0x004004, 0x004005,
+  0x004006, 0x004007, 0x004004, 0x004005, 0x004006, 0x004007,
+  0x00400c, 0x00400d, 0x00400e, 0x00400f, 0x00400c, 0x00400d,
+  0x00400e, 0x00400f, 0x004000, 0x004001, 0x004002, 0x004003,
+  0x004004, 0x004005, 0x004006, 0x004007, 0x004008, 0x004009,
+  0x00400a, 0x00400b, 0x00400c, 0x00400d, 0x00400e, 0x00400f,
+  0x004000, 0x004001, 0x004002, 0x004003, 0x00400c, 0x00400d,
+  0x00400e, 0x00400f, 0x004000, 0x004001, 0x004002, 0x004003,
+  0x00400c, 0x00400d, 0x00400e, 0x00400f, 0x004000, 0x004001,
+  0x004002, 0x004003, 0x004004, 0x004005, 0x004006, 0x004007,
+  0x004008, 0x004009, 0x00400a, 0x00400b, 0x00400c, 0x00400d,
+  0x00400e, 0x00400f, 0x004080, 0x004081, 0x004082, 0x004083,
+  0x004084, 0x004085, 0x004086, 0x004087, 0x004088, 0x004089,
+  0x00408a, 0x00408b, 0x00408c, 0x00408d, 0x00408e, 0x00408f,
+  0x004000, 0x004001, 0x004002, 0x004003, 0x004004, 0x004005,
+  0x004006, 0x004007, 0x004008, 0x004009, 0x00400a, 0x00400b,
+  0x00400c, 0x00400d, 0x00400e, 0x00400f, 0x000100, 0x000101,
+  0x000102, 0x000103, 0x000104, 0x000105, 0x000106, 0x000107,
+  0x000108, 0x000109, 0x00010a, 0x00010b, 0x00010c, 0x00010d,
+  0x00010e, 0x00010f, 0x004000, 0x004001, 0x004002, 0x004003,
+  0x004004, 0x004005, 0x004006, 0x004007, 0x004008, 0x004009,
+  0x00400a, 0x00400b, 0x00400c, 0x00400d, 0x00400e, 0x00400f,
+  0x000000, 0x004001, 0x000002, 0x004003, 0x000004, 0x004005,
+  0x000006, 0x004007, 0x000008, 0x004009, 0x00000a, 0x00400b,
+  0x00000c, 0x00400d, 0x00000e, 0x00400f, 0x004000, 0x004001,
+  0x004002, 0x004003, 0x004004, 0x004005, 0x004006, 0x004007,
+  0x004008, 0x004009, 0x00400a, 0x00400b, 0x00400c, 0x00400d,
+  0x00400e, 0x00400f, 0x004200, 0x004201, 0x004202, 0x004203,
+  0x004204, 0x004205, 0x004206, 0x004207, 0x004208, 0x004209,
+  0x00420a, 0x00420b, 0x00420c, 0x00420d, 0x00420e, 0x00420f,
+  0x004000, 0x004001, 0x004002, 0x004003, 0x004004, 0x004005,
+  0x004006, 0x004007, 0x004008, 0x004009, 0x00400a, 0x00400b,
+  0x00400c, 0x00400d, 0x00400e, 0x00400f, 0x000040, 0x000040,
+  0x000042, 0x000042, 0x000044, 0x000044, 0x000046, 0x000046,
+  0x000048, 0x000048, 0x00004a, 0x00004a, 0x00004c, 0x00004c,
+  0x00004e, 0x00004e, 0x000000, 0x000000, 0x000002, 0x000002,
+  0x000004, 0x000004, 0x000006, 0x000006, 0x000008, 0x000008,
+  0x00000a, 0x00000a, 0x00000c, 0x00000c, 0x00000e, 0x00000e,
+  0x000000, 0x000000, 0x000002, 0x000002, 0x000004, 0x000004,
+  0x000006, 0x000006, 0x000008, 0x000008, 0x00000a, 0x00000a,
+  0x00000c, 0x00000c, 0x00000e, 0x00000e, 0x000000, 0x000000,
+  0x000002, 0x000002, 0x000004, 0x000004, 0x000006, 0x000006,
+  0x000008, 0x000008, 0x00000a, 0x00000a, 0x00000c, 0x00000c,
+  0x00000e, 0x00000e, 0x000000, 0x000000, 0x000000, 0x000002,
+  0x000004, 0x000004, 0x000004, 0x000006, 0x000008, 0x000008,
+  0x000008, 0x00000a, 0x00000c, 0x00000c, 0x00000c, 0x00000e,
+  0x000000, 0x000000, 0x000002, 0x000002, 0x000004, 0x000004,
+  0x000006, 0x000006, 0x000008, 0x000008, 0x00000a, 0x00000a,
+  0x00000c, 0x00000c, 0x00000e, 0x00000e, 0x000000, 0x000002,
+  0x000002, 0x000002, 0x000004, 0x000006, 0x000006, 0x000006,
+  0x000008, 0x00000a, 0x00000a, 0x00000a, 0x00000c, 0x00000e,
+  0x00000e, 0x00000e, 0x000000, 0x000000, 0x000002, 0x000002,
+  0x000004, 0x000004, 0x000006, 0x000006, 0x000008, 0x000008,
+  0x00000a, 0x00000a, 0x00000c, 0x00000c, 0x00000e, 0x00000e,
+  0x000000, 0x000000, 0x000000, 0x000000, 0x000004, 0x000004,
+  0x000004, 0x000004, 0x000008, 0x000008, 0x000008, 0x000008,
+  0x00000c, 0x00000c, 0x00000c, 0x00000c, 0x000000, 0x000000,
+  0x000002, 0x000002, 0x000004, 0x000004, 0x000006, 0x000006,
+  0x000008, 0x000008, 0x00000a, 0x00000a, 0x00000c, 0x00000c,
+  0x00000e, 0x00000e, 0x000400, 0x000400, 0x000402, 0x000402,
+  0x000404, 0x000404, 0x000406, 0x000406, 0x000408, 0x000408,
+  0x00040a, 0x00040a, 0x00040c, 0x00040c, 0x00040e, 0x00040e,
+  0x000000, 0x000000, 0x000002, 0x000002, 0x000004, 0x000004,
+  0x000006, 0x000006, 0x000008, 0x000008, 0x00000a, 0x00000a,
+  0x00000c, 0x00000c, 0x00000e, 0x00000e, 0x000000, 0x000400,
+  0x000002, 0x000402, 0x000004, 0x000404, 0x000006, 0x000406,
+  0x000008, 0x000408, 0x00000a, 0x00040a, 0x00000c, 0x00040c,
+  0x00000e, 0x00040e, 0x000000, 0x000000, 0x000002, 0x000002,
+  0x000004, 0x000004, 0x000006, 0x000006, 0x000008, 0x000008,
+  0x00000a, 0x00000a, 0x00000c, 0x00000c, 0x00000e, 0x00000e,
+  0x000000, 0x000400, 0x000002, 0x000402, 0x000004, 0x000404,
+  0x000006, 0x000406, 0x000008, 0x000408, 0x00000a, 0x00040a,
+  0x00000c, 0x00040c, 0x00000e, 0x00040e, 0x000000, 0x000000,
+  0x000002, 0x000002, 0x000004, 0x000004, 0x000006, 0x000006,
+  0x000008, 0x000008, 0x00000a, 0x00000a, 0x00000c, 0x00000c,
+  0x00000e, 0x00000e, 0x000800, 0x001800, 0x000802, 0x001802,
+  0x000804, 0x001804, 0x000806, 0x001806, 0x000828, 0x001828,
+  0x00082a, 0x00182a, 0x00082c, 0x00182c, 0x00082e, 0x00182e,
+  0x000000, 0x000000, 0x000002, 0x000002, 0x000004, 0x000004,
+  0x000006, 0x000006, 0x000008, 0x000008, 0x00000a, 0x00000a,
+  0x00000c, 0x00000c, 0x00000e, 0x00000e, 0x001800, 0x000800,
+  0x001802, 0x000802, 0x001804, 0x000804, 0x001806, 0x000806,
+  0x001828, 0x000828, 0x00182a, 0x00082a, 0x00182c, 0x00082c,
+  0x00182e, 0x00082e, 0x000000, 0x000000, 0x000002, 0x000002,
+  0x000004, 0x000004, 0x000006, 0x000006, 0x000008, 0x000008,
+  0x00000a, 0x00000a, 0x00000c, 0x00000c, 0x00000e, 0x00000e,
+  0x000000, 0x000000, 0x000002, 0x000002, 0x000000, 0x000000,
+  0x000002, 0x000002, 0x000008, 0x000008, 0x00000a, 0x00000a,
+  0x000008, 0x000008, 0x00000a, 0x00000a, 0x000000, 0x000000,
+  0x000002, 0x000002, 0x000004, 0x000004, 0x000006, 0x000006,
+  0x000008, 0x000008, 0x00000a, 0x00000a, 0x00000c, 0x00000c,
+  0x00000e, 0x00000e, 0x000000, 0x000000, 0x000002, 0x000002,
+  0x000004, 0x000004, 0x000006, 0x000006, 0x000000, 0x000000,
+  0x000002, 0x000002, 0x000004, 0x000004, 0x000006, 0x000006,
+  0x000000, 0x000000, 0x000002, 0x000002, 0x000004, 0x000004,
+  0x000006, 0x000006, 0x000008, 0x000008, 0x00000a, 0x00000a,
+  0x00000c, 0x00000c, 0x00000e, 0x00000e, 0x000080, 0x000080,
+  0x000082, 0x000082, 0x000084, 0x000084, 0x000086, 0x000086,
+  0x000088, 0x000088, 0x00008a, 0x00008a, 0x00008c, 0x00008c,
+  0x00008e, 0x00008e, 0x000000, 0x000000, 0x000002, 0x000002,
+  0x000004, 0x000004, 0x000006, 0x000006, 0x000008, 0x000008,
+  0x00000a, 0x00000a, 0x00000c, 0x00000c, 0x00000e, 0x00000e,
+  0x000100, 0x000101, 0x000102, 0x000103, 0x000104, 0x000105,
+  0x000106, 0x000107, 0x000108, 0x000109, 0x00010a, 0x00010b,
+  0x00010c, 0x00010d, 0x00010e, 0x00010f, 0x000000, 0x000000,
+  0x000002, 0x000002, 0x000004, 0x000004, 0x000006, 0x000006,
+  0x000008, 0x000008, 0x00000a, 0x00000a, 0x00000c, 0x00000c,
+  0x00000e, 0x00000e, 0x000000, 0x000000, 0x000002, 0x000002,
+  0x000004, 0x000004, 0x000006, 0x000006, 0x000008, 0x000008,
+  0x00000a, 0x00000a, 0x00000c, 0x00000c, 0x00000e, 0x00000e,
+  0x000000, 0x000000, 0x000002, 0x000002, 0x000004, 0x000004,
+  0x000006, 0x000006, 0x000008, 0x000008, 0x00000a, 0x00000a,
+  0x00000c, 0x00000c, 0x00000e, 0x00000e, 0x000200, 0x000200,
+  0x000202, 0x000202, 0x000204, 0x000204, 0x000206, 0x000206,
+  0x000208, 0x000208, 0x00020a, 0x00020a, 0x00020c, 0x00020c,
+  0x00020e, 0x00020e, 0x000000, 0x000000, 0x000002, 0x000002,
+  0x000004, 0x000004, 0x000006, 0x000006, 0x000008, 0x000008,
+  0x00000a, 0x00000a, 0x00000c, 0x00000c, 0x00000e, 0x00000e,
+  0x000040, 0x000040, 0x000042, 0x000042, 0x000044, 0x000044,
+  0x000046, 0x000046, 0x000048, 0x000048, 0x00004a, 0x00004a,
+  0x00004c, 0x00004c, 0x00004e, 0x00004e, 0x000000, 0x000000,
+  0x000002, 0x000002, 0x000004, 0x000004, 0x000006, 0x000006,
+  0x000008, 0x000008, 0x00000a, 0x00000a, 0x00000c, 0x00000c,
+  0x00000e, 0x00000e, 0x000000, 0x000000, 0x000002, 0x000002,
+  0x000004, 0x000004, 0x000006, 0x000006, 0x000008, 0x000008,
+  0x00000a, 0x00000a, 0x00000c, 0x00000c, 0x00000e, 0x00000e,
+  0x000000, 0x000000, 0x000002, 0x000002, 0x000004, 0x000004,
+  0x000006, 0x000006, 0x000008, 0x000008, 0x00000a, 0x00000a,
+  0x00000c, 0x00000c, 0x00000e, 0x00000e, 0x000000, 0x000000,
+  0x000000, 0x000002, 0x000004, 0x000006, 0x000006, 0x000006,
+  0x000008, 0x000008, 0x000008, 0x00000a, 0x00000c, 0x00000e,
+  0x00000e, 0x00000e, 0x000000, 0x000000, 0x000002, 0x000002,
+  0x000004, 0x000004, 0x000006, 0x000006, 0x000008, 0x000008,
+  0x00000a, 0x00000a, 0x00000c, 0x00000c, 0x00000e, 0x00000e,
+  0x000000, 0x000002, 0x000002, 0x000002, 0x000004, 0x000004,
+  0x000004, 0x000006, 0x000008, 0x00000a, 0x00000a, 0x00000a,
+  0x00000c, 0x00000c, 0x00000c, 0x00000e, 0x000000, 0x000000,
+  0x000002, 0x000002, 0x000004, 0x000004, 0x000006, 0x000006,
+  0x000008, 0x000008, 0x00000a, 0x00000a, 0x00000c, 0x00000c,
+  0x00000e, 0x00000e, 0x000000, 0x000000, 0x000000, 0x000000,
+  0x000004, 0x000004, 0x000004, 0x000004, 0x000008, 0x000008,
+  0x000008, 0x000008, 0x00000c, 0x00000c, 0x00000c, 0x00000c,
+  0x000000, 0x000000, 0x000002, 0x000002, 0x000004, 0x000004,
+  0x000006, 0x000006, 0x000008, 0x000008, 0x00000a, 0x00000a,
+  0x00000c, 0x00000c, 0x00000e, 0x00000e, 0x000400, 0x000400,
+  0x000402, 0x000402, 0x000404, 0x000004, 0x000406, 0x000006,
+  0x000408, 0x000408, 0x00040a, 0x00040a, 0x00040c, 0x00000c,
+  0x00040e, 0x00000e, 0x000000, 0x000000, 0x000002, 0x000002,
+  0x000004, 0x000004, 0x000006, 0x000006, 0x000008, 0x000008,
+  0x00000a, 0x00000a, 0x00000c, 0x00000c, 0x00000e, 0x00000e,
+  0x000000, 0x000400, 0x000002, 0x000402, 0x000404, 0x000404,
+  0x000406, 0x000406, 0x000008, 0x000408, 0x00000a, 0x00040a,
+  0x00040c, 0x00040c, 0x00040e, 0x00040e, 0x000000, 0x000000,
+  0x000002, 0x000002, 0x000004, 0x000004, 0x000006, 0x000006,
+  0x000008, 0x000008, 0x00000a, 0x00000a, 0x00000c, 0x00000c,
+  0x00000e, 0x00000e, 0x000000, 0x000400, 0x000002, 0x000402,
+  0x000404, 0x000004, 0x000406, 0x000006, 0x000008, 0x000408,
+  0x00000a, 0x00040a, 0x00040c, 0x00000c, 0x00040e, 0x00000e,
+  0x000000, 0x000000, 0x000002, 0x000002, 0x000004, 0x000004,
+  0x000006, 0x000006, 0x000008, 0x000008, 0x00000a, 0x00000a,
+  0x00000c, 0x00000c, 0x00000e, 0x00000e, 0x000800, 0x001800,
+  0x000802, 0x001802, 0x000804, 0x001804, 0x000806, 0x001806,
+  0x000828, 0x001828, 0x00082a, 0x00182a, 0x00082c, 0x00182c,
+  0x00082e, 0x00182e, 0x000000, 0x000000, 0x000002, 0x000002,
+  0x000004, 0x000004, 0x000006, 0x000006, 0x000008, 0x000008,
+  0x00000a, 0x00000a, 0x00000c, 0x00000c, 0x00000e, 0x00000e,
+  0x001800, 0x000800, 0x001802, 0x000802, 0x001804, 0x000804,
+  0x001806, 0x000806, 0x001828, 0x000828, 0x00182a, 0x00082a,
+  0x00182c, 0x00082c, 0x00182e, 0x00082e, 0x000000, 0x000000,
+  0x000002, 0x000002, 0x000004, 0x000004, 0x000006, 0x000006,
+  0x000008, 0x000008, 0x00000a, 0x00000a, 0x00000c, 0x00000c,
+  0x00000e, 0x00000e, 0x000004, 0x000004, 0x000006, 0x000006,
+  0x000004, 0x000004, 0x000006, 0x000006, 0x00000c, 0x00000c,
+  0x00000e, 0x00000e, 0x00000c, 0x00000c, 0x00000e, 0x00000e,
+  0x000000, 0x000000, 0x000002, 0x000002, 0x000004, 0x000004,
+  0x000006, 0x000006, 0x000008, 0x000008, 0x00000a, 0x00000a,
+  0x00000c, 0x00000c, 0x00000e, 0x00000e, 0x000000, 0x000000,
+  0x000002, 0x000002, 0x00000c, 0x00000c, 0x00000e, 0x00000e,
+  0x000000, 0x000000, 0x000002, 0x000002, 0x00000c, 0x00000c,
+  0x00000e, 0x00000e, 0x000000, 0x000000, 0x000002, 0x000002,
+  0x000004, 0x000004, 0x000006, 0x000006, 0x000008, 0x000008,
+  0x00000a, 0x00000a, 0x00000c, 0x00000c, 0x00000e, 0x00000e,
+  0x000080, 0x000080, 0x000082, 0x000082, 0x000084, 0x000084,
+  0x000086, 0x000086, 0x000088, 0x000088, 0x00008a, 0x00008a,
+  0x00008c, 0x00008c, 0x00008e, 0x00008e, 0x000000, 0x000000,
+  0x000002, 0x000002, 0x000004, 0x000004, 0x000006, 0x000006,
+  0x000008, 0x000008, 0x00000a, 0x00000a, 0x00000c, 0x00000c,
+  0x00000e, 0x00000e, 0x000100, 0x000101, 0x000102, 0x000103,
+  0x000104, 0x000105, 0x000106, 0x000107, 0x000108, 0x000109,
+  0x00010a, 0x00010b, 0x00010c, 0x00010d, 0x00010e, 0x00010f,
+  0x000000, 0x000000, 0x000002, 0x000002, 0x000004, 0x000004,
+  0x000006, 0x000006, 0x000008, 0x000008, 0x00000a, 0x00000a,
+  0x00000c, 0x00000c, 0x00000e, 0x00000e, 0x000000, 0x000000,
+  0x000002, 0x000002, 0x000004, 0x000004, 0x000006, 0x000006,
+  0x000008, 0x000008, 0x00000a, 0x00000a, 0x00000c, 0x00000c,
+  0x00000e, 0x00000e, 0x000000, 0x000000, 0x000002, 0x000002,
+  0x000004, 0x000004, 0x000006, 0x000006, 0x000008, 0x000008,
+  0x00000a, 0x00000a, 0x00000c, 0x00000c, 0x00000e, 0x00000e,
+  0x000200, 0x000200, 0x000202, 0x000202, 0x000204, 0x000204,
+  0x000206, 0x000206, 0x000208, 0x000208, 0x00020a, 0x00020a,
+  0x00020c, 0x00020c, 0x00020e, 0x00020e, 0x000000, 0x000000,
+  0x000002, 0x000002, 0x000004, 0x000004, 0x000006, 0x000006,
+  0x000008, 0x000008, 0x00000a, 0x00000a, 0x00000c, 0x00000c,
+  0x00000e, 0x00000e, 0x000040, 0x000041, 0x000041, 0x000042,
+  0x000044, 0x000045, 0x000045, 0x000046, 0x000048, 0x000049,
+  0x000049, 0x00004a, 0x00004c, 0x00004d, 0x00004d, 0x00004e,
+  0x000000, 0x000001, 0x000001, 0x000002, 0x000004, 0x000005,
+  0x000005, 0x000006, 0x000008, 0x000009, 0x000009, 0x00000a,
+  0x00000c, 0x00000d, 0x00000d, 0x00000e, 0x000000, 0x000000,
+  0x000001, 0x000001, 0x000004, 0x000004, 0x000005, 0x000005,
+  0x000008, 0x000008, 0x000009, 0x000009, 0x00000c, 0x00000c,
+  0x00000d, 0x00000d, 0x000000, 0x000001, 0x000001, 0x000002,
+  0x000004, 0x000005, 0x000005, 0x000006, 0x000008, 0x000009,
+  0x000009, 0x00000a, 0x00000c, 0x00000d, 0x00000d, 0x00000e,
+  0x000000, 0x000001, 0x000001, 0x000001, 0x000004, 0x000005,
+  0x000005, 0x000005, 0x000008, 0x000009, 0x000009, 0x000009,
+  0x00000c, 0x00000d, 0x00000d, 0x00000d, 0x000000, 0x000001,
+  0x000001, 0x000002, 0x000004, 0x000005, 0x000005, 0x000006,
+  0x000008, 0x000009, 0x000009, 0x00000a, 0x00000c, 0x00000d,
+  0x00000d, 0x00000e, 0x000001, 0x000001, 0x000001, 0x000002,
+  0x000005, 0x000005, 0x000005, 0x000006, 0x000009, 0x000009,
+  0x000009, 0x00000a, 0x00000d, 0x00000d, 0x00000d, 0x00000e,
+  0x000000, 0x000001, 0x000001, 0x000002, 0x000004, 0x000005,
+  0x000005, 0x000006, 0x000008, 0x000009, 0x000009, 0x00000a,
+  0x00000c, 0x00000d, 0x00000d, 0x00000e, 0x000001, 0x000001,
+  0x000001, 0x000001, 0x000005, 0x000005, 0x000005, 0x000005,
+  0x000009, 0x000009, 0x000009, 0x000009, 0x00000d, 0x00000d,
+  0x00000d, 0x00000d, 0x000000, 0x000001, 0x000001, 0x000002,
+  0x000004, 0x000005, 0x000005, 0x000006, 0x000008, 0x000009,
+  0x000009, 0x00000a, 0x00000c, 0x00000d, 0x00000d, 0x00000e,
+  0x000401, 0x000401, 0x000402, 0x000402, 0x000405, 0x000405,
+  0x000406, 0x000406, 0x000409, 0x000409, 0x00040a, 0x00040a,
+  0x00040d, 0x00040d, 0x00040e, 0x00040e, 0x000000, 0x000001,
+  0x000001, 0x000002, 0x000004, 0x000005, 0x000005, 0x000006,
+  0x000008, 0x000009, 0x000009, 0x00000a, 0x00000c, 0x00000d,
+  0x00000d, 0x00000e, 0x000000, 0x000401, 0x000001, 0x000402,
+  0x000004, 0x000405, 0x000005, 0x000406, 0x000008, 0x000409,
+  0x000009, 0x00040a, 0x00000c, 0x00040d, 0x00000d, 0x00040e,
+  0x000000, 0x000001, 0x000001, 0x000002, 0x000004, 0x000005,
+  0x000005, 0x000006, 0x000008, 0x000009, 0x000009, 0x00000a,
+  0x00000c, 0x00000d, 0x00000d, 0x00000e, 0x000000, 0x000401,
+  0x000001, 0x000402, 0x000004, 0x000405, 0x000005, 0x000406,
+  0x000008, 0x000409, 0x000009, 0x00040a, 0x00000c, 0x00040d,
+  0x00000d, 0x00040e, 0x000000, 0x000001, 0x000001, 0x000002,
+  0x000004, 0x000005, 0x000005, 0x000006, 0x000008, 0x000009,
+  0x000009, 0x00000a, 0x00000c, 0x00000d, 0x00000d, 0x00000e,
+  0x000800, 0x001801, 0x000801, 0x001802, 0x000804, 0x001805,
+  0x000805, 0x001806, 0x000828, 0x001829, 0x000829, 0x00182a,
+  0x00082c, 0x00182d, 0x00082d, 0x00182e, 0x000000, 0x000001,
+  0x000001, 0x000002, 0x000004, 0x000005, 0x000005, 0x000006,
+  0x000008, 0x000009, 0x000009, 0x00000a, 0x00000c, 0x00000d,
+  0x00000d, 0x00000e, 0x001800, 0x000801, 0x001801, 0x000802,
+  0x001804, 0x000805, 0x001805, 0x000806, 0x001828, 0x000829,
+  0x001829, 0x00082a, 0x00182c, 0x00082d, 0x00182d, 0x00082e,
+  0x000000, 0x000001, 0x000001, 0x000002, 0x000004, 0x000005,
+  0x000005, 0x000006, 0x000008, 0x000009, 0x000009, 0x00000a,
+  0x00000c, 0x00000d, 0x00000d, 0x00000e, 0x000000, 0x000001,
+  0x000001, 0x000002, 0x000000, 0x000001, 0x000001, 0x000002,
+  0x000008, 0x000009, 0x000009, 0x00000a, 0x000008, 0x000009,
+  0x000009, 0x00000a, 0x000000, 0x000001, 0x000001, 0x000002,
+  0x000004, 0x000005, 0x000005, 0x000006, 0x000008, 0x000009,
+  0x000009, 0x00000a, 0x00000c, 0x00000d, 0x00000d, 0x00000e,
+  0x000000, 0x000001, 0x000001, 0x000002, 0x000004, 0x000005,
+  0x000005, 0x000006, 0x000000, 0x000001, 0x000001, 0x000002,
+  0x000004, 0x000005, 0x000005, 0x000006, 0x000000, 0x000001,
+  0x000001, 0x000002, 0x000004, 0x000005, 0x000005, 0x000006,
+  0x000008, 0x000009, 0x000009, 0x00000a, 0x00000c, 0x00000d,
+  0x00000d, 0x00000e, 0x000080, 0x000081, 0x000081, 0x000082,
+  0x000084, 0x000085, 0x000085, 0x000086, 0x000088, 0x000089,
+  0x000089, 0x00008a, 0x00008c, 0x00008d, 0x00008d, 0x00008e,
+  0x000000, 0x000001, 0x000001, 0x000002, 0x000004, 0x000005,
+  0x000005, 0x000006, 0x000008, 0x000009, 0x000009, 0x00000a,
+  0x00000c, 0x00000d, 0x00000d, 0x00000e, 0x000100, 0x000101,
+  0x000102, 0x000103, 0x000104, 0x000105, 0x000106, 0x000107,
+  0x000108, 0x000109, 0x00010a, 0x00010b, 0x00010c, 0x00010d,
+  0x00010e, 0x00010f, 0x000000, 0x000001, 0x000001, 0x000002,
+  0x000004, 0x000005, 0x000005, 0x000006, 0x000008, 0x000009,
+  0x000009, 0x00000a, 0x00000c, 0x00000d, 0x00000d, 0x00000e,
+  0x000000, 0x000001, 0x000002, 0x000002, 0x000004, 0x000005,
+  0x000006, 0x000006, 0x000008, 0x000009, 0x00000a, 0x00000a,
+  0x00000c, 0x00000d, 0x00000e, 0x00000e, 0x000000, 0x000001,
+  0x000001, 0x000002, 0x000004, 0x000005, 0x000005, 0x000006,
+  0x000008, 0x000009, 0x000009, 0x00000a, 0x00000c, 0x00000d,
+  0x00000d, 0x00000e, 0x000200, 0x000201, 0x000201, 0x000202,
+  0x000204, 0x000205, 0x000205, 0x000206, 0x000208, 0x000209,
+  0x000209, 0x00020a, 0x00020c, 0x00020d, 0x00020d, 0x00020e,
+  0x000000, 0x000001, 0x000001, 0x000002, 0x000004, 0x000005,
+  0x000005, 0x000006, 0x000008, 0x000009, 0x000009, 0x00000a,
+  0x00000c, 0x00000d, 0x00000d, 0x00000e, 0x000040, 0x000041,
+  0x000041, 0x000042, 0x000044, 0x000045, 0x000045, 0x000046,
+  0x000048, 0x000049, 0x000049, 0x00004a, 0x00004c, 0x00004d,
+  0x00004d, 0x00004e, 0x000000, 0x000001, 0x000001, 0x000002,
+  0x000004, 0x000005, 0x000005, 0x000006, 0x000008, 0x000009,
+  0x000009, 0x00000a, 0x00000c, 0x00000d, 0x00000d, 0x00000e,
+  0x000000, 0x000000, 0x000001, 0x000001, 0x000005, 0x000005,
+  0x000006, 0x000006, 0x000008, 0x000008, 0x000009, 0x000009,
+  0x00000d, 0x00000d, 0x00000e, 0x00000e, 0x000000, 0x000001,
+  0x000001, 0x000002, 0x000004, 0x000005, 0x000005, 0x000006,
+  0x000008, 0x000009, 0x000009, 0x00000a, 0x00000c, 0x00000d,
+  0x00000d, 0x00000e, 0x000000, 0x000001, 0x000001, 0x000001,
+  0x000005, 0x000005, 0x000005, 0x000006, 0x000008, 0x000009,
+  0x000009, 0x000009, 0x00000d, 0x00000d, 0x00000d, 0x00000e,
+  0x000000, 0x000001, 0x000001, 0x000002, 0x000004, 0x000005,
+  0x000005, 0x000006, 0x000008, 0x000009, 0x000009, 0x00000a,
+  0x00000c, 0x00000d, 0x00000d, 0x00000e, 0x000001, 0x000001,
+  0x000001, 0x000002, 0x000004, 0x000005, 0x000005, 0x000005,
+  0x000009, 0x000009, 0x000009, 0x00000a, 0x00000c, 0x00000d,
+  0x00000d, 0x00000d, 0x000000, 0x000001, 0x000001, 0x000002,
+  0x000004, 0x000005, 0x000005, 0x000006, 0x000008, 0x000009,
+  0x000009, 0x00000a, 0x00000c, 0x00000d, 0x00000d, 0x00000e,
+  0x000001, 0x000001, 0x000001, 0x000001, 0x000005, 0x000005,
+  0x000005, 0x000005, 0x000009, 0x000009, 0x000009, 0x000009,
+  0x00000d, 0x00000d, 0x00000d, 0x00000d, 0x000000, 0x000001,
+  0x000001, 0x000002, 0x000004, 0x000005, 0x000005, 0x000006,
+  0x000008, 0x000009, 0x000009, 0x00000a, 0x00000c, 0x00000d,
+  0x00000d, 0x00000e, 0x000401, 0x000401, 0x000402, 0x000402,
+  0x000405, 0x000004, 0x000406, 0x000005, 0x000409, 0x000409,
+  0x00040a, 0x00040a, 0x00040d, 0x00000c, 0x00040e, 0x00000d,
+  0x000000, 0x000001, 0x000001, 0x000002, 0x000004, 0x000005,
+  0x000005, 0x000006, 0x000008, 0x000009, 0x000009, 0x00000a,
+  0x00000c, 0x00000d, 0x00000d, 0x00000e, 0x000000, 0x000401,
+  0x000001, 0x000402, 0x000405, 0x000405, 0x000406, 0x000406,
+  0x000008, 0x000409, 0x000009, 0x00040a, 0x00040d, 0x00040d,
+  0x00040e, 0x00040e, 0x000000, 0x000001, 0x000001, 0x000002,
+  0x000004, 0x000005, 0x000005, 0x000006, 0x000008, 0x000009,
+  0x000009, 0x00000a, 0x00000c, 0x00000d, 0x00000d, 0x00000e,
+  0x000000, 0x000401, 0x000001, 0x000402, 0x000405, 0x000004,
+  0x000406, 0x000005, 0x000008, 0x000409, 0x000009, 0x00040a,
+  0x00040d, 0x00000c, 0x00040e, 0x00000d, 0x000000, 0x000001,
+  0x000001, 0x000002, 0x000004, 0x000005, 0x000005, 0x000006,
+  0x000008, 0x000009, 0x000009, 0x00000a, 0x00000c, 0x00000d,
+  0x00000d, 0x00000e, 0x000800, 0x001801, 0x000801, 0x001802,
+  0x000804, 0x001805, 0x000805, 0x001806, 0x000828, 0x001829,
+  0x000829, 0x00182a, 0x00082c, 0x00182d, 0x00082d, 0x00182e,
+  0x000000, 0x000001, 0x000001, 0x000002, 0x000004, 0x000005,
+  0x000005, 0x000006, 0x000008, 0x000009, 0x000009, 0x00000a,
+  0x00000c, 0x00000d, 0x00000d, 0x00000e, 0x001800, 0x000801,
+  0x001801, 0x000802, 0x001804, 0x000805, 0x001805, 0x000806,
+  0x001828, 0x000829, 0x001829, 0x00082a, 0x00182c, 0x00082d,
+  0x00182d, 0x00082e, 0x000000, 0x000001, 0x000001, 0x000002,
+  0x000004, 0x000005, 0x000005, 0x000006, 0x000008, 0x000009,
+  0x000009, 0x00000a, 0x00000c, 0x00000d, 0x00000d, 0x00000e,
+  0x000004, 0x000005, 0x000005, 0x000006, 0x000004, 0x000005,
+  0x000005, 0x000006, 0x00000c, 0x00000d, 0x00000d, 0x00000e,
+  0x00000c, 0x00000d, 0x00000d, 0x00000e, 0x000000, 0x000001,
+  0x000001, 0x000002, 0x000004, 0x000005, 0x000005, 0x000006,
+  0x000008, 0x000009, 0x000009, 0x00000a, 0x00000c, 0x00000d,
+  0x00000d, 0x00000e, 0x000000, 0x000001, 0x000001, 0x000002,
+  0x00000c, 0x00000d, 0x00000d, 0x00000e, 0x000000, 0x000001,
+  0x000001, 0x000002, 0x00000c, 0x00000d, 0x00000d, 0x00000e,
+  0x000000, 0x000001, 0x000001, 0x000002, 0x000004, 0x000005,
+  0x000005, 0x000006, 0x000008, 0x000009, 0x000009, 0x00000a,
+  0x00000c, 0x00000d, 0x00000d, 0x00000e, 0x000080, 0x000081,
+  0x000081, 0x000082, 0x000084, 0x000085, 0x000085, 0x000086,
+  0x000088, 0x000089, 0x000089, 0x00008a, 0x00008c, 0x00008d,
+  0x00008d, 0x00008e, 0x000000, 0x000001, 0x000001, 0x000002,
+  0x000004, 0x000005, 0x000005, 0x000006, 0x000008, 0x000009,
+  0x000009, 0x00000a, 0x00000c, 0x00000d, 0x00000d, 0x00000e,
+  0x000100, 0x000101, 0x000102, 0x000103, 0x000104, 0x000105,
+  0x000106, 0x000107, 0x000108, 0x000109, 0x00010a, 0x00010b,
+  0x00010c, 0x00010d, 0x00010e, 0x00010f, 0x000000, 0x000001,
+  0x000001, 0x000002, 0x000004, 0x000005, 0x000005, 0x000006,
+  0x000008, 0x000009, 0x000009, 0x00000a, 0x00000c, 0x00000d,
+  0x00000d, 0x00000e, 0x000000, 0x000001, 0x000002, 0x000002,
+  0x000004, 0x000005, 0x000006, 0x000006, 0x000008, 0x000009,
+  0x00000a, 0x00000a, 0x00000c, 0x00000d, 0x00000e, 0x00000e,
+  0x000000, 0x000001, 0x000001, 0x000002, 0x000004, 0x000005,
+  0x000005, 0x000006, 0x000008, 0x000009, 0x000009, 0x00000a,
+  0x00000c, 0x00000d, 0x00000d, 0x00000e, 0x000200, 0x000201,
+  0x000201, 0x000202, 0x000204, 0x000205, 0x000205, 0x000206,
+  0x000208, 0x000209, 0x000209, 0x00020a, 0x00020c, 0x00020d,
+  0x00020d, 0x00020e, 0x000000, 0x000001, 0x000001, 0x000002,
+  0x000004, 0x000005, 0x000005, 0x000006, 0x000008, 0x000009,
+  0x000009, 0x00000a, 0x00000c, 0x00000d, 0x00000d, 0x00000e,
+  0x000041, 0x000042, 0x000042, 0x000043, 0x000045, 0x000046,
+  0x000046, 0x000047, 0x000049, 0x00004a, 0x00004a, 0x00004b,
+  0x00004d, 0x00004e, 0x00004e, 0x00004f, 0x000001, 0x000002,
+  0x000002, 0x000003, 0x000005, 0x000006, 0x000006, 0x000007,
+  0x000009, 0x00000a, 0x00000a, 0x00000b, 0x00000d, 0x00000e,
+  0x00000e, 0x00000f, 0x000001, 0x000001, 0x000002, 0x000002,
+  0x000005, 0x000005, 0x000006, 0x000006, 0x000009, 0x000009,
+  0x00000a, 0x00000a, 0x00000d, 0x00000d, 0x00000e, 0x00000e,
+  0x000001, 0x000002, 0x000002, 0x000003, 0x000005, 0x000006,
+  0x000006, 0x000007, 0x000009, 0x00000a, 0x00000a, 0x00000b,
+  0x00000d, 0x00000e, 0x00000e, 0x00000f, 0x000001, 0x000002,
+  0x000002, 0x000002, 0x000005, 0x000006, 0x000006, 0x000006,
+  0x000009, 0x00000a, 0x00000a, 0x00000a, 0x00000d, 0x00000e,
+  0x00000e, 0x00000e, 0x000001, 0x000002, 0x000002, 0x000003,
+  0x000005, 0x000006, 0x000006, 0x000007, 0x000009, 0x00000a,
+  0x00000a, 0x00000b, 0x00000d, 0x00000e, 0x00000e, 0x00000f,
+  0x000002, 0x000002, 0x000002, 0x000003, 0x000006, 0x000006,
+  0x000006, 0x000007, 0x00000a, 0x00000a, 0x00000a, 0x00000b,
+  0x00000e, 0x00000e, 0x00000e, 0x00000f, 0x000001, 0x000002,
+  0x000002, 0x000003, 0x000005, 0x000006, 0x000006, 0x000007,
+  0x000009, 0x00000a, 0x00000a, 0x00000b, 0x00000d, 0x00000e,
+  0x00000e, 0x00000f, 0x000002, 0x000002, 0x000002, 0x000002,
+  0x000006, 0x000006, 0x000006, 0x000006, 0x00000a, 0x00000a,
+  0x00000a, 0x00000a, 0x00000e, 0x00000e, 0x00000e, 0x00000e,
+  0x000001, 0x000002, 0x000002, 0x000003, 0x000005, 0x000006,
+  0x000006, 0x000007, 0x000009, 0x00000a, 0x00000a, 0x00000b,
+  0x00000d, 0x00000e, 0x00000e, 0x00000f, 0x000402, 0x000402,
+  0x000403, 0x000403, 0x000406, 0x000406, 0x000407, 0x000407,
+  0x00040a, 0x00040a, 0x00040b, 0x00040b, 0x00040e, 0x00040e,
+  0x00040f, 0x00040f, 0x000001, 0x000002, 0x000002, 0x000003,
+  0x000005, 0x000006, 0x000006, 0x000007, 0x000009, 0x00000a,
+  0x00000a, 0x00000b, 0x00000d, 0x00000e, 0x00000e, 0x00000f,
+  0x000001, 0x000402, 0x000002, 0x000403, 0x000005, 0x000406,
+  0x000006, 0x000407, 0x000009, 0x00040a, 0x00000a, 0x00040b,
+  0x00000d, 0x00040e, 0x00000e, 0x00040f, 0x000001, 0x000002,
+  0x000002, 0x000003, 0x000005, 0x000006, 0x000006, 0x000007,
+  0x000009, 0x00000a, 0x00000a, 0x00000b, 0x00000d, 0x00000e,
+  0x00000e, 0x00000f, 0x000001, 0x000402, 0x000002, 0x000403,
+  0x000005, 0x000406, 0x000006, 0x000407, 0x000009, 0x00040a,
+  0x00000a, 0x00040b, 0x00000d, 0x00040e, 0x00000e, 0x00040f,
+  0x000001, 0x000002, 0x000002, 0x000003, 0x000005, 0x000006,
+  0x000006, 0x000007, 0x000009, 0x00000a, 0x00000a, 0x00000b,
+  0x00000d, 0x00000e, 0x00000e, 0x00000f, 0x000801, 0x001802,
+  0x000802, 0x001803, 0x000805, 0x001806, 0x000806, 0x001807,
+  0x000829, 0x00182a, 0x00082a, 0x00182b, 0x00082d, 0x00182e,
+  0x00082e, 0x00182f, 0x000001, 0x000002, 0x000002, 0x000003,
+  0x000005, 0x000006, 0x000006, 0x000007, 0x000009, 0x00000a,
+  0x00000a, 0x00000b, 0x00000d, 0x00000e, 0x00000e, 0x00000f,
+  0x001801, 0x000802, 0x001802, 0x000803, 0x001805, 0x000806,
+  0x001806, 0x000807, 0x001829, 0x00082a, 0x00182a, 0x00082b,
+  0x00182d, 0x00082e, 0x00182e, 0x00082f, 0x000001, 0x000002,
+  0x000002, 0x000003, 0x000005, 0x000006, 0x000006, 0x000007,
+  0x000009, 0x00000a, 0x00000a, 0x00000b, 0x00000d, 0x00000e,
+  0x00000e, 0x00000f, 0x000001, 0x000002, 0x000002, 0x000003,
+  0x000001, 0x000002, 0x000002, 0x000003, 0x000009, 0x00000a,
+  0x00000a, 0x00000b, 0x000009, 0x00000a, 0x00000a, 0x00000b,
+  0x000001, 0x000002, 0x000002, 0x000003, 0x000005, 0x000006,
+  0x000006, 0x000007, 0x000009, 0x00000a, 0x00000a, 0x00000b,
+  0x00000d, 0x00000e, 0x00000e, 0x00000f, 0x000001, 0x000002,
+  0x000002, 0x000003, 0x000005, 0x000006, 0x000006, 0x000007,
+  0x000001, 0x000002, 0x000002, 0x000003, 0x000005, 0x000006,
+  0x000006, 0x000007, 0x000001, 0x000002, 0x000002, 0x000003,
+  0x000005, 0x000006, 0x000006, 0x000007, 0x000009, 0x00000a,
+  0x00000a, 0x00000b, 0x00000d, 0x00000e, 0x00000e, 0x00000f,
+  0x000081, 0x000082, 0x000082, 0x000083, 0x000085, 0x000086,
+  0x000086, 0x000087, 0x000089, 0x00008a, 0x00008a, 0x00008b,
+  0x00008d, 0x00008e, 0x00008e, 0x00008f, 0x000001, 0x000002,
+  0x000002, 0x000003, 0x000005, 0x000006, 0x000006, 0x000007,
+  0x000009, 0x00000a, 0x00000a, 0x00000b, 0x00000d, 0x00000e,
+  0x00000e, 0x00000f, 0x000100, 0x000101, 0x000102, 0x000103,
+  0x000104, 0x000105, 0x000106, 0x000107, 0x000108, 0x000109,
+  0x00010a, 0x00010b, 0x00010c, 0x00010d, 0x00010e, 0x00010f,
+  0x000001, 0x000002, 0x000002, 0x000003, 0x000005, 0x000006,
+  0x000006, 0x000007, 0x000009, 0x00000a, 0x00000a, 0x00000b,
+  0x00000d, 0x00000e, 0x00000e, 0x00000f, 0x000000, 0x000002,
+  0x000002, 0x000003, 0x000004, 0x000006, 0x000006, 0x000007,
+  0x000008, 0x00000a, 0x00000a, 0x00000b, 0x00000c, 0x00000e,
+  0x00000e, 0x00000f, 0x000001, 0x000002, 0x000002, 0x000003,
+  0x000005, 0x000006, 0x000006, 0x000007, 0x000009, 0x00000a,
+  0x00000a, 0x00000b, 0x00000d, 0x00000e, 0x00000e, 0x00000f,
+  0x000201, 0x000202, 0x000202, 0x000203, 0x000205, 0x000206,
+  0x000206, 0x000207, 0x000209, 0x00020a, 0x00020a, 0x00020b,
+  0x00020d, 0x00020e, 0x00020e, 0x00020f, 0x000001, 0x000002,
+  0x000002, 0x000003, 0x000005, 0x000006, 0x000006, 0x000007,
+  0x000009, 0x00000a, 0x00000a, 0x00000b, 0x00000d, 0x00000e,
+  0x00000e, 0x00000f, 0x000041, 0x000042, 0x000042, 0x000043,
+  0x000045, 0x000046, 0x000046, 0x000047, 0x000049, 0x00004a,
+  0x00004a, 0x00004b, 0x00004d, 0x00004e, 0x00004e, 0x00004f,
+  0x000001, 0x000002, 0x000002, 0x000003, 0x000005, 0x000006,
+  0x000006, 0x000007, 0x000009, 0x00000a, 0x00000a, 0x00000b,
+  0x00000d, 0x00000e, 0x00000e, 0x00000f, 0x000001, 0x000001,
+  0x000002, 0x000002, 0x000006, 0x000006, 0x000007, 0x000007,
+  0x000009, 0x000009, 0x00000a, 0x00000a, 0x00000e, 0x00000e,
+  0x00000f, 0x00000f, 0x000001, 0x000002, 0x000002, 0x000003,
+  0x000005, 0x000006, 0x000006, 0x000007, 0x000009, 0x00000a,
+  0x00000a, 0x00000b, 0x00000d, 0x00000e, 0x00000e, 0x00000f,
+  0x000001, 0x000002, 0x000002, 0x000002, 0x000006, 0x000006,
+  0x000006, 0x000007, 0x000009, 0x00000a, 0x00000a, 0x00000a,
+  0x00000e, 0x00000e, 0x00000e, 0x00000f, 0x000001, 0x000002,
+  0x000002, 0x000003, 0x000005, 0x000006, 0x000006, 0x000007,
+  0x000009, 0x00000a, 0x00000a, 0x00000b, 0x00000d, 0x00000e,
+  0x00000e, 0x00000f, 0x000002, 0x000002, 0x000002, 0x000003,
+  0x000005, 0x000006, 0x000006, 0x000006, 0x00000a, 0x00000a,
+  0x00000a, 0x00000b, 0x00000d, 0x00000e, 0x00000e, 0x00000e,
+  0x000001, 0x000002, 0x000002, 0x000003, 0x000005, 0x000006,
+  0x000006, 0x000007, 0x000009, 0x00000a, 0x00000a, 0x00000b,
+  0x00000d, 0x00000e, 0x00000e, 0x00000f, 0x000002, 0x000002,
+  0x000002, 0x000002, 0x000006, 0x000006, 0x000006, 0x000006,
+  0x00000a, 0x00000a, 0x00000a, 0x00000a, 0x00000e, 0x00000e,
+  0x00000e, 0x00000e, 0x000001, 0x000002, 0x000002, 0x000003,
+  0x000005, 0x000006, 0x000006, 0x000007, 0x000009, 0x00000a,
+  0x00000a, 0x00000b, 0x00000d, 0x00000e, 0x00000e, 0x00000f,
+  0x000402, 0x000402, 0x000403, 0x000403, 0x000406, 0x000005,
+  0x000407, 0x000006, 0x00040a, 0x00040a, 0x00040b, 0x00040b,
+  0x00040e, 0x00000d, 0x00040f, 0x00000e, 0x000001, 0x000002,
+  0x000002, 0x000003, 0x000005, 0x000006, 0x000006, 0x000007,
+  0x000009, 0x00000a, 0x00000a, 0x00000b, 0x00000d, 0x00000e,
+  0x00000e, 0x00000f, 0x000001, 0x000402, 0x000002, 0x000403,
+  0x000406, 0x000406, 0x000407, 0x000407, 0x000009, 0x00040a,
+  0x00000a, 0x00040b, 0x00040e, 0x00040e, 0x00040f, 0x00040f,
+  0x000001, 0x000002, 0x000002, 0x000003, 0x000005, 0x000006,
+  0x000006, 0x000007, 0x000009, 0x00000a, 0x00000a, 0x00000b,
+  0x00000d, 0x00000e, 0x00000e, 0x00000f, 0x000001, 0x000402,
+  0x000002, 0x000403, 0x000406, 0x000005, 0x000407, 0x000006,
+  0x000009, 0x00040a, 0x00000a, 0x00040b, 0x00040e, 0x00000d,
+  0x00040f, 0x00000e, 0x000001, 0x000002, 0x000002, 0x000003,
+  0x000005, 0x000006, 0x000006, 0x000007, 0x000009, 0x00000a,
+  0x00000a, 0x00000b, 0x00000d, 0x00000e, 0x00000e, 0x00000f,
+  0x000801, 0x001802, 0x000802, 0x001803, 0x000805, 0x001806,
+  0x000806, 0x001807, 0x000829, 0x00182a, 0x00082a, 0x00182b,
+  0x00082d, 0x00182e, 0x00082e, 0x00182f, 0x000001, 0x000002,
+  0x000002, 0x000003, 0x000005, 0x000006, 0x000006, 0x000007,
+  0x000009, 0x00000a, 0x00000a, 0x00000b, 0x00000d, 0x00000e,
+  0x00000e, 0x00000f, 0x001801, 0x000802, 0x001802, 0x000803,
+  0x001805, 0x000806, 0x001806, 0x000807, 0x001829, 0x00082a,
+  0x00182a, 0x00082b, 0x00182d, 0x00082e, 0x00182e, 0x00082f,
+  0x000001, 0x000002, 0x000002, 0x000003, 0x000005, 0x000006,
+  0x000006, 0x000007, 0x000009, 0x00000a, 0x00000a, 0x00000b,
+  0x00000d, 0x00000e, 0x00000e, 0x00000f, 0x000005, 0x000006,
+  0x000006, 0x000007, 0x000005, 0x000006, 0x000006, 0x000007,
+  0x00000d, 0x00000e, 0x00000e, 0x00000f, 0x00000d, 0x00000e,
+  0x00000e, 0x00000f, 0x000001, 0x000002, 0x000002, 0x000003,
+  0x000005, 0x000006, 0x000006, 0x000007, 0x000009, 0x00000a,
+  0x00000a, 0x00000b, 0x00000d, 0x00000e, 0x00000e, 0x00000f,
+  0x000001, 0x000002, 0x000002, 0x000003, 0x00000d, 0x00000e,
+  0x00000e, 0x00000f, 0x000001, 0x000002, 0x000002, 0x000003,
+  0x00000d, 0x00000e, 0x00000e, 0x00000f, 0x000001, 0x000002,
+  0x000002, 0x000003, 0x000005, 0x000006, 0x000006, 0x000007,
+  0x000009, 0x00000a, 0x00000a, 0x00000b, 0x00000d, 0x00000e,
+  0x00000e, 0x00000f, 0x000081, 0x000082, 0x000082, 0x000083,
+  0x000085, 0x000086, 0x000086, 0x000087, 0x000089, 0x00008a,
+  0x00008a, 0x00008b, 0x00008d, 0x00008e, 0x00008e, 0x00008f,
+  0x000001, 0x000002, 0x000002, 0x000003, 0x000005, 0x000006,
+  0x000006, 0x000007, 0x000009, 0x00000a, 0x00000a, 0x00000b,
+  0x00000d, 0x00000e, 0x00000e, 0x00000f, 0x000100, 0x000101,
+  0x000102, 0x000103, 0x000104, 0x000105, 0x000106, 0x000107,
+  0x000108, 0x000109, 0x00010a, 0x00010b, 0x00010c, 0x00010d,
+  0x00010e, 0x00010f, 0x000001, 0x000002, 0x000002, 0x000003,
+  0x000005, 0x000006, 0x000006, 0x000007, 0x000009, 0x00000a,
+  0x00000a, 0x00000b, 0x00000d, 0x00000e, 0x00000e, 0x00000f,
+  0x000000, 0x000002, 0x000002, 0x000003, 0x000004, 0x000006,
+  0x000006, 0x000007, 0x000008, 0x00000a, 0x00000a, 0x00000b,
+  0x00000c, 0x00000e, 0x00000e, 0x00000f, 0x000001, 0x000002,
+  0x000002, 0x000003, 0x000005, 0x000006, 0x000006, 0x000007,
+  0x000009, 0x00000a, 0x00000a, 0x00000b, 0x00000d, 0x00000e,
+  0x00000e, 0x00000f, 0x000201, 0x000202, 0x000202, 0x000203,
+  0x000205, 0x000206, 0x000206, 0x000207, 0x000209, 0x00020a,
+  0x00020a, 0x00020b, 0x00020d, 0x00020e, 0x00020e, 0x00020f,
+  0x000001, 0x000002, 0x000002, 0x000003, 0x000005, 0x000006,
+  0x000006, 0x000007, 0x000009, 0x00000a, 0x00000a, 0x00000b,
+  0x00000d, 0x00000e, 0x00000e, 0x00000f, 0x000041, 0x000041,
+  0x000041, 0x000041, 0x000045, 0x000045, 0x000045, 0x000045,
+  0x000049, 0x000049, 0x000049, 0x000049, 0x00004d, 0x00004d,
+  0x00004d, 0x00004d, 0x000001, 0x000001, 0x000001, 0x000001,
+  0x000005, 0x000005, 0x000005, 0x000005, 0x000009, 0x000009,
+  0x000009, 0x000009, 0x00000d, 0x00000d, 0x00000d, 0x00000d,
+  0x000001, 0x000001, 0x000001, 0x000001, 0x000005, 0x000005,
+  0x000005, 0x000005, 0x000009, 0x000009, 0x000009, 0x000009,
+  0x00000d, 0x00000d, 0x00000d, 0x00000d, 0x000001, 0x000001,
+  0x000001, 0x000001, 0x000005, 0x000005, 0x000005, 0x000005,
+  0x000009, 0x000009, 0x000009, 0x000009, 0x00000d, 0x00000d,
+  0x00000d, 0x00000d, 0x000001, 0x000001, 0x000001, 0x000001,
+  0x000005, 0x000005, 0x000005, 0x000005, 0x000009, 0x000009,
+  0x000009, 0x000009, 0x00000d, 0x00000d, 0x00000d, 0x00000d,
+  0x000001, 0x000001, 0x000001, 0x000001, 0x000005, 0x000005,
+  0x000005, 0x000005, 0x000009, 0x000009, 0x000009, 0x000009,
+  0x00000d, 0x00000d, 0x00000d, 0x00000d, 0x000001, 0x000001,
+  0x000001, 0x000001, 0x000005, 0x000005, 0x000005, 0x000005,
+  0x000009, 0x000009, 0x000009, 0x000009, 0x00000d, 0x00000d,
+  0x00000d, 0x00000d, 0x000001, 0x000001, 0x000001, 0x000001,
+  0x000005, 0x000005, 0x000005, 0x000005, 0x000009, 0x000009,
+  0x000009, 0x000009, 0x00000d, 0x00000d, 0x00000d, 0x00000d,
+  0x000001, 0x000001, 0x000001, 0x000001, 0x000005, 0x000005,
+  0x000005, 0x000005, 0x000009, 0x000009, 0x000009, 0x000009,
+  0x00000d, 0x00000d, 0x00000d, 0x00000d, 0x000001, 0x000001,
+  0x000001, 0x000001, 0x000005, 0x000005, 0x000005, 0x000005,
+  0x000009, 0x000009, 0x000009, 0x000009, 0x00000d, 0x00000d,
+  0x00000d, 0x00000d, 0x000401, 0x000401, 0x000401, 0x000401,
+  0x000405, 0x000405, 0x000405, 0x000405, 0x000409, 0x000409,
+  0x000409, 0x000409, 0x00040d, 0x00040d, 0x00040d, 0x00040d,
+  0x000001, 0x000001, 0x000001, 0x000001, 0x000005, 0x000005,
+  0x000005, 0x000005, 0x000009, 0x000009, 0x000009, 0x000009,
+  0x00000d, 0x00000d, 0x00000d, 0x00000d, 0x000001, 0x000401,
+  0x000001, 0x000401, 0x000005, 0x000405, 0x000005, 0x000405,
+  0x000009, 0x000409, 0x000009, 0x000409, 0x00000d, 0x00040d,
+  0x00000d, 0x00040d, 0x000001, 0x000001, 0x000001, 0x000001,
+  0x000005, 0x000005, 0x000005, 0x000005, 0x000009, 0x000009,
+  0x000009, 0x000009, 0x00000d, 0x00000d, 0x00000d, 0x00000d,
+  0x000001, 0x000401, 0x000001, 0x000401, 0x000005, 0x000405,
+  0x000005, 0x000405, 0x000009, 0x000409, 0x000009, 0x000409,
+  0x00000d, 0x00040d, 0x00000d, 0x00040d, 0x000001, 0x000001,
+  0x000001, 0x000001, 0x000005, 0x000005, 0x000005, 0x000005,
+  0x000009, 0x000009, 0x000009, 0x000009, 0x00000d, 0x00000d,
+  0x00000d, 0x00000d, 0x000801, 0x001801, 0x000801, 0x001801,
+  0x000805, 0x001805, 0x000805, 0x001805, 0x000829, 0x001829,
+  0x000829, 0x001829, 0x00082d, 0x00182d, 0x00082d, 0x00182d,
+  0x000001, 0x000001, 0x000001, 0x000001, 0x000005, 0x000005,
+  0x000005, 0x000005, 0x000009, 0x000009, 0x000009, 0x000009,
+  0x00000d, 0x00000d, 0x00000d, 0x00000d, 0x001801, 0x000801,
+  0x001801, 0x000801, 0x001805, 0x000805, 0x001805, 0x000805,
+  0x001829, 0x000829, 0x001829, 0x000829, 0x00182d, 0x00082d,
+  0x00182d, 0x00082d, 0x000001, 0x000001, 0x000001, 0x000001,
+  0x000005, 0x000005, 0x000005, 0x000005, 0x000009, 0x000009,
+  0x000009, 0x000009, 0x00000d, 0x00000d, 0x00000d, 0x00000d,
+  0x000001, 0x000001, 0x000001, 0x000001, 0x000001, 0x000001,
+  0x000001, 0x000001, 0x000009, 0x000009, 0x000009, 0x000009,
+  0x000009, 0x000009, 0x000009, 0x000009, 0x000001, 0x000001,
+  0x000001, 0x000001, 0x000005, 0x000005, 0x000005, 0x000005,
+  0x000009, 0x000009, 0x000009, 0x000009, 0x00000d, 0x00000d,
+  0x00000d, 0x00000d, 0x000001, 0x000001, 0x000001, 0x000001,
+  0x000005, 0x000005, 0x000005, 0x000005, 0x000001, 0x000001,
+  0x000001, 0x000001, 0x000005, 0x000005, 0x000005, 0x000005,
+  0x000001, 0x000001, 0x000001, 0x000001, 0x000005, 0x000005,
+  0x000005, 0x000005, 0x000009, 0x000009, 0x000009, 0x000009,
+  0x00000d, 0x00000d, 0x00000d, 0x00000d, 0x000081, 0x000081,
+  0x000081, 0x000081, 0x000085, 0x000085, 0x000085, 0x000085,
+  0x000089, 0x000089, 0x000089, 0x000089, 0x00008d, 0x00008d,
+  0x00008d, 0x00008d, 0x000001, 0x000001, 0x000001, 0x000001,
+  0x000005, 0x000005, 0x000005, 0x000005, 0x000009, 0x000009,
+  0x000009, 0x000009, 0x00000d, 0x00000d, 0x00000d, 0x00000d,
+  0x000100, 0x000101, 0x000102, 0x000103, 0x000104, 0x000105,
+  0x000106, 0x000107, 0x000108, 0x000109, 0x00010a, 0x00010b,
+  0x00010c, 0x00010d, 0x00010e, 0x00010f, 0x000001, 0x000001,
+  0x000001, 0x000001, 0x000005, 0x000005, 0x000005, 0x000005,
+  0x000009, 0x000009, 0x000009, 0x000009, 0x00000d, 0x00000d,
+  0x00000d, 0x00000d, 0x000000, 0x000001, 0x000002, 0x000001,
+  0x000004, 0x000005, 0x000006, 0x000005, 0x000008, 0x000009,
+  0x00000a, 0x000009, 0x00000c, 0x00000d, 0x00000e, 0x00000d,
+  0x000001, 0x000001, 0x000001, 0x000001, 0x000005, 0x000005,
+  0x000005, 0x000005, 0x000009, 0x000009, 0x000009, 0x000009,
+  0x00000d, 0x00000d, 0x00000d, 0x00000d, 0x000201, 0x000201,
+  0x000201, 0x000201, 0x000205, 0x000205, 0x000205, 0x000205,
+  0x000209, 0x000209, 0x000209, 0x000209, 0x00020d, 0x00020d,
+  0x00020d, 0x00020d, 0x000001, 0x000001, 0x000001, 0x000001,
+  0x000005, 0x000005, 0x000005, 0x000005, 0x000009, 0x000009,
+  0x000009, 0x000009, 0x00000d, 0x00000d, 0x00000d, 0x00000d,
+  0x000041, 0x000041, 0x000041, 0x000041, 0x000045, 0x000045,
+  0x000045, 0x000045, 0x000049, 0x000049, 0x000049, 0x000049,
+  0x00004d, 0x00004d, 0x00004d, 0x00004d, 0x000001, 0x000001,
+  0x000001, 0x000001, 0x000005, 0x000005, 0x000005, 0x000005,
+  0x000009, 0x000009, 0x000009, 0x000009, 0x00000d, 0x00000d,
+  0x00000d, 0x00000d, 0x000001, 0x000001, 0x000001, 0x000001,
+  0x000005, 0x000005, 0x000005, 0x000005, 0x000009, 0x000009,
+  0x000009, 0x000009, 0x00000d, 0x00000d, 0x00000d, 0x00000d,
+  0x000001, 0x000001, 0x000001, 0x000001, 0x000005, 0x000005,
+  0x000005, 0x000005, 0x000009, 0x000009, 0x000009, 0x000009,
+  0x00000d, 0x00000d, 0x00000d, 0x00000d, 0x000001, 0x000001,
+  0x000001, 0x000001, 0x000005, 0x000005, 0x000005, 0x000005,
+  0x000009, 0x000009, 0x000009, 0x000009, 0x00000d, 0x00000d,
+  0x00000d, 0x00000d, 0x000001, 0x000001, 0x000001, 0x000001,
+  0x000005, 0x000005, 0x000005, 0x000005, 0x000009, 0x000009,
+  0x000009, 0x000009, 0x00000d, 0x00000d, 0x00000d, 0x00000d,
+  0x000001, 0x000001, 0x000001, 0x000001, 0x000005, 0x000005,
+  0x000005, 0x000005, 0x000009, 0x000009, 0x000009, 0x000009,
+  0x00000d, 0x00000d, 0x00000d, 0x00000d, 0x000001, 0x000001,
+  0x000001, 0x000001, 0x000005, 0x000005, 0x000005, 0x000005,
+  0x000009, 0x000009, 0x000009, 0x000009, 0x00000d, 0x00000d,
+  0x00000d, 0x00000d, 0x000001, 0x000001, 0x000001, 0x000001,
+  0x000005, 0x000005, 0x000005, 0x000005, 0x000009, 0x000009,
+  0x000009, 0x000009, 0x00000d, 0x00000d, 0x00000d, 0x00000d,
+  0x000001, 0x000001, 0x000001, 0x000001, 0x000005, 0x000005,
+  0x000005, 0x000005, 0x000009, 0x000009, 0x000009, 0x000009,
+  0x00000d, 0x00000d, 0x00000d, 0x00000d, 0x000401, 0x000401,
+  0x000401, 0x000401, 0x000405, 0x000005, 0x000405, 0x000005,
+  0x000409, 0x000409, 0x000409, 0x000409, 0x00040d, 0x00000d,
+  0x00040d, 0x00000d, 0x000001, 0x000001, 0x000001, 0x000001,
+  0x000005, 0x000005, 0x000005, 0x000005, 0x000009, 0x000009,
+  0x000009, 0x000009, 0x00000d, 0x00000d, 0x00000d, 0x00000d,
+  0x000001, 0x000401, 0x000001, 0x000401, 0x000405, 0x000405,
+  0x000405, 0x000405, 0x000009, 0x000409, 0x000009, 0x000409,
+  0x00040d, 0x00040d, 0x00040d, 0x00040d, 0x000001, 0x000001,
+  0x000001, 0x000001, 0x000005, 0x000005, 0x000005, 0x000005,
+  0x000009, 0x000009, 0x000009, 0x000009, 0x00000d, 0x00000d,
+  0x00000d, 0x00000d, 0x000001, 0x000401, 0x000001, 0x000401,
+  0x000405, 0x000005, 0x000405, 0x000005, 0x000009, 0x000409,
+  0x000009, 0x000409, 0x00040d, 0x00000d, 0x00040d, 0x00000d,
+  0x000001, 0x000001, 0x000001, 0x000001, 0x000005, 0x000005,
+  0x000005, 0x000005, 0x000009, 0x000009, 0x000009, 0x000009,
+  0x00000d, 0x00000d, 0x00000d, 0x00000d, 0x000801, 0x001801,
+  0x000801, 0x001801, 0x000805, 0x001805, 0x000805, 0x001805,
+  0x000829, 0x001829, 0x000829, 0x001829, 0x00082d, 0x00182d,
+  0x00082d, 0x00182d, 0x000001, 0x000001, 0x000001, 0x000001,
+  0x000005, 0x000005, 0x000005, 0x000005, 0x000009, 0x000009,
+  0x000009, 0x000009, 0x00000d, 0x00000d, 0x00000d, 0x00000d,
+  0x001801, 0x000801, 0x001801, 0x000801, 0x001805, 0x000805,
+  0x001805, 0x000805, 0x001829, 0x000829, 0x001829, 0x000829,
+  0x00182d, 0x00082d, 0x00182d, 0x00082d, 0x000001, 0x000001,
+  0x000001, 0x000001, 0x000005, 0x000005, 0x000005, 0x000005,
+  0x000009, 0x000009, 0x000009, 0x000009, 0x00000d, 0x00000d,
+  0x00000d, 0x00000d, 0x000005, 0x000005, 0x000005, 0x000005,
+  0x000005, 0x000005, 0x000005, 0x000005, 0x00000d, 0x00000d,
+  0x00000d, 0x00000d, 0x00000d, 0x00000d, 0x00000d, 0x00000d,
+  0x000001, 0x000001, 0x000001, 0x000001, 0x000005, 0x000005,
+  0x000005, 0x000005, 0x000009, 0x000009, 0x000009, 0x000009,
+  0x00000d, 0x00000d, 0x00000d, 0x00000d, 0x000001, 0x000001,
+  0x000001, 0x000001, 0x00000d, 0x00000d, 0x00000d, 0x00000d,
+  0x000001, 0x000001, 0x000001, 0x000001, 0x00000d, 0x00000d,
+  0x00000d, 0x00000d, 0x000001, 0x000001, 0x000001, 0x000001,
+  0x000005, 0x000005, 0x000005, 0x000005, 0x000009, 0x000009,
+  0x000009, 0x000009, 0x00000d, 0x00000d, 0x00000d, 0x00000d,
+  0x000081, 0x000081, 0x000081, 0x000081, 0x000085, 0x000085,
+  0x000085, 0x000085, 0x000089, 0x000089, 0x000089, 0x000089,
+  0x00008d, 0x00008d, 0x00008d, 0x00008d, 0x000001, 0x000001,
+  0x000001, 0x000001, 0x000005, 0x000005, 0x000005, 0x000005,
+  0x000009, 0x000009, 0x000009, 0x000009, 0x00000d, 0x00000d,
+  0x00000d, 0x00000d, 0x000100, 0x000101, 0x000102, 0x000103,
+  0x000104, 0x000105, 0x000106, 0x000107, 0x000108, 0x000109,
+  0x00010a, 0x00010b, 0x00010c, 0x00010d, 0x00010e, 0x00010f,
+  0x000001, 0x000001, 0x000001, 0x000001, 0x000005, 0x000005,
+  0x000005, 0x000005, 0x000009, 0x000009, 0x000009, 0x000009,
+  0x00000d, 0x00000d, 0x00000d, 0x00000d, 0x000000, 0x000001,
+  0x000002, 0x000001, 0x000004, 0x000005, 0x000006, 0x000005,
+  0x000008, 0x000009, 0x00000a, 0x000009, 0x00000c, 0x00000d,
+  0x00000e, 0x00000d, 0x000001, 0x000001, 0x000001, 0x000001,
+  0x000005, 0x000005, 0x000005, 0x000005, 0x000009, 0x000009,
+  0x000009, 0x000009, 0x00000d, 0x00000d, 0x00000d, 0x00000d,
+  0x000201, 0x000201, 0x000201, 0x000201, 0x000205, 0x000205,
+  0x000205, 0x000205, 0x000209, 0x000209, 0x000209, 0x000209,
+  0x00020d, 0x00020d, 0x00020d, 0x00020d, 0x000001, 0x000001,
+  0x000001, 0x000001, 0x000005, 0x000005, 0x000005, 0x000005,
+  0x000009, 0x000009, 0x000009, 0x000009, 0x00000d, 0x00000d,
+  0x00000d, 0x00000d, 0x040041, 0x040041, 0x040043, 0x040043,
+  0x040045, 0x040045, 0x040047, 0x040047, 0x040049, 0x040049,
+  0x04004b, 0x04004b, 0x04004d, 0x04004d, 0x04004f, 0x04004f,
+  0x040001, 0x040001, 0x040003, 0x040003, 0x040005, 0x040005,
+  0x040007, 0x040007, 0x040009, 0x040009, 0x04000b, 0x04000b,
+  0x04000d, 0x04000d, 0x04000f, 0x04000f, 0x040001, 0x040001,
+  0x040003, 0x040003, 0x040005, 0x040005, 0x040007, 0x040007,
+  0x040009, 0x040009, 0x04000b, 0x04000b, 0x04000d, 0x04000d,
+  0x04000f, 0x04000f, 0x040001, 0x040001, 0x040003, 0x040003,
+  0x040005, 0x040005, 0x040007, 0x040007, 0x040009, 0x040009,
+  0x04000b, 0x04000b, 0x04000d, 0x04000d, 0x04000f, 0x04000f,
+  0x040001, 0x040001, 0x040001, 0x040003, 0x040005, 0x040005,
+  0x040005, 0x040007, 0x040009, 0x040009, 0x040009, 0x04000b,
+  0x04000d, 0x04000d, 0x04000d, 0x04000f, 0x040001, 0x040001,
+  0x040003, 0x040003, 0x040005, 0x040005, 0x040007, 0x040007,
+  0x040009, 0x040009, 0x04000b, 0x04000b, 0x04000d, 0x04000d,
+  0x04000f, 0x04000f, 0x040001, 0x040003, 0x040003, 0x040003,
+  0x040005, 0x040007, 0x040007, 0x040007, 0x040009, 0x04000b,
+  0x04000b, 0x04000b, 0x04000d, 0x04000f, 0x04000f, 0x04000f,
+  0x040001, 0x040001, 0x040003, 0x040003, 0x040005, 0x040005,
+  0x040007, 0x040007, 0x040009, 0x040009, 0x04000b, 0x04000b,
+  0x04000d, 0x04000d, 0x04000f, 0x04000f, 0x040001, 0x040001,
+  0x040001, 0x040001, 0x040005, 0x040005, 0x040005, 0x040005,
+  0x040009, 0x040009, 0x040009, 0x040009, 0x04000d, 0x04000d,
+  0x04000d, 0x04000d, 0x040001, 0x040001, 0x040003, 0x040003,
+  0x040005, 0x040005, 0x040007, 0x040007, 0x040009, 0x040009,
+  0x04000b, 0x04000b, 0x04000d, 0x04000d, 0x04000f, 0x04000f,
+  0x040401, 0x040401, 0x040403, 0x040403, 0x040405, 0x040405,
+  0x040407, 0x040407, 0x040409, 0x040409, 0x04040b, 0x04040b,
+  0x04040d, 0x04040d, 0x04040f, 0x04040f, 0x040001, 0x040001,
+  0x040003, 0x040003, 0x040005, 0x040005, 0x040007, 0x040007,
+  0x040009, 0x040009, 0x04000b, 0x04000b, 0x04000d, 0x04000d,
+  0x04000f, 0x04000f, 0x040001, 0x040401, 0x040003, 0x040403,
+  0x040005, 0x040405, 0x040007, 0x040407, 0x040009, 0x040409,
+  0x04000b, 0x04040b, 0x04000d, 0x04040d, 0x04000f, 0x04040f,
+  0x040001, 0x040001, 0x040003, 0x040003, 0x040005, 0x040005,
+  0x040007, 0x040007, 0x040009, 0x040009, 0x04000b, 0x04000b,
+  0x04000d, 0x04000d, 0x04000f, 0x04000f, 0x040001, 0x040401,
+  0x040003, 0x040403, 0x040005, 0x040405, 0x040007, 0x040407,
+  0x040009, 0x040409, 0x04000b, 0x04040b, 0x04000d, 0x04040d,
+  0x04000f, 0x04040f, 0x040001, 0x040001, 0x040003, 0x040003,
+  0x040005, 0x040005, 0x040007, 0x040007, 0x040009, 0x040009,
+  0x04000b, 0x04000b, 0x04000d, 0x04000d, 0x04000f, 0x04000f,
+  0x040801, 0x041801, 0x040803, 0x041803, 0x040805, 0x041805,
+  0x040807, 0x041807, 0x040829, 0x041829, 0x04082b, 0x04182b,
+  0x04082d, 0x04182d, 0x04082f, 0x04182f, 0x040001, 0x040001,
+  0x040003, 0x040003, 0x040005, 0x040005, 0x040007, 0x040007,
+  0x040009, 0x040009, 0x04000b, 0x04000b, 0x04000d, 0x04000d,
+  0x04000f, 0x04000f, 0x041801, 0x040801, 0x041803, 0x040803,
+  0x041805, 0x040805, 0x041807, 0x040807, 0x041829, 0x040829,
+  0x04182b, 0x04082b, 0x04182d, 0x04082d, 0x04182f, 0x04082f,
+  0x040001, 0x040001, 0x040003, 0x040003, 0x040005, 0x040005,
+  0x040007, 0x040007, 0x040009, 0x040009, 0x04000b, 0x04000b,
+  0x04000d, 0x04000d, 0x04000f, 0x04000f, 0x040001, 0x040001,
+  0x040003, 0x040003, 0x040001, 0x040001, 0x040003, 0x040003,
+  0x040009, 0x040009, 0x04000b, 0x04000b, 0x040009, 0x040009,
+  0x04000b, 0x04000b, 0x040001, 0x040001, 0x040003, 0x040003,
+  0x040005, 0x040005, 0x040007, 0x040007, 0x040009, 0x040009,
+  0x04000b, 0x04000b, 0x04000d, 0x04000d, 0x04000f, 0x04000f,
+  0x040001, 0x040001, 0x040003, 0x040003, 0x040005, 0x040005,
+  0x040007, 0x040007, 0x040001, 0x040001, 0x040003, 0x040003,
+  0x040005, 0x040005, 0x040007, 0x040007, 0x040001, 0x040001,
+  0x040003, 0x040003, 0x040005, 0x040005, 0x040007, 0x040007,
+  0x040009, 0x040009, 0x04000b, 0x04000b, 0x04000d, 0x04000d,
+  0x04000f, 0x04000f, 0x040081, 0x040081, 0x040083, 0x040083,
+  0x040085, 0x040085, 0x040087, 0x040087, 0x040089, 0x040089,
+  0x04008b, 0x04008b, 0x04008d, 0x04008d, 0x04008f, 0x04008f,
+  0x040001, 0x040001, 0x040003, 0x040003, 0x040005, 0x040005,
+  0x040007, 0x040007, 0x040009, 0x040009, 0x04000b, 0x04000b,
+  0x04000d, 0x04000d, 0x04000f, 0x04000f, 0x000100, 0x000101,
+  0x000102, 0x000103, 0x000104, 0x000105, 0x000106, 0x000107,
+  0x000108, 0x000109, 0x00010a, 0x00010b, 0x00010c, 0x00010d,
+  0x00010e, 0x00010f, 0x040001, 0x040001, 0x040003, 0x040003,
+  0x040005, 0x040005, 0x040007, 0x040007, 0x040009, 0x040009,
+  0x04000b, 0x04000b, 0x04000d, 0x04000d, 0x04000f, 0x04000f,
+  0x000000, 0x040001, 0x000002, 0x040003, 0x000004, 0x040005,
+  0x000006, 0x040007, 0x000008, 0x040009, 0x00000a, 0x04000b,
+  0x00000c, 0x04000d, 0x00000e, 0x04000f, 0x040001, 0x040001,
+  0x040003, 0x040003, 0x040005, 0x040005, 0x040007, 0x040007,
+  0x040009, 0x040009, 0x04000b, 0x04000b, 0x04000d, 0x04000d,
+  0x04000f, 0x04000f, 0x040201, 0x040201, 0x040203, 0x040203,
+  0x040205, 0x040205, 0x040207, 0x040207, 0x040209, 0x040209,
+  0x04020b, 0x04020b, 0x04020d, 0x04020d, 0x04020f, 0x04020f,
+  0x040001, 0x040001, 0x040003, 0x040003, 0x040005, 0x040005,
+  0x040007, 0x040007, 0x040009, 0x040009, 0x04000b, 0x04000b,
+  0x04000d, 0x04000d, 0x04000f, 0x04000f, 0x040041, 0x040041,
+  0x040043, 0x040043, 0x040045, 0x040045, 0x040047, 0x040047,
+  0x040049, 0x040049, 0x04004b, 0x04004b, 0x04004d, 0x04004d,
+  0x04004f, 0x04004f, 0x040001, 0x040001, 0x040003, 0x040003,
+  0x040005, 0x040005, 0x040007, 0x040007, 0x040009, 0x040009,
+  0x04000b, 0x04000b, 0x04000d, 0x04000d, 0x04000f, 0x04000f,
+  0x040001, 0x040001, 0x040003, 0x040003, 0x040005, 0x040005,
+  0x040007, 0x040007, 0x040009, 0x040009, 0x04000b, 0x04000b,
+  0x04000d, 0x04000d, 0x04000f, 0x04000f, 0x040001, 0x040001,
+  0x040003, 0x040003, 0x040005, 0x040005, 0x040007, 0x040007,
+  0x040009, 0x040009, 0x04000b, 0x04000b, 0x04000d, 0x04000d,
+  0x04000f, 0x04000f, 0x040001, 0x040001, 0x040001, 0x040003,
+  0x040005, 0x040007, 0x040007, 0x040007, 0x040009, 0x040009,
+  0x040009, 0x04000b, 0x04000d, 0x04000f, 0x04000f, 0x04000f,
+  0x040001, 0x040001, 0x040003, 0x040003, 0x040005, 0x040005,
+  0x040007, 0x040007, 0x040009, 0x040009, 0x04000b, 0x04000b,
+  0x04000d, 0x04000d, 0x04000f, 0x04000f, 0x040001, 0x040003,
+  0x040003, 0x040003, 0x040005, 0x040005, 0x040005, 0x040007,
+  0x040009, 0x04000b, 0x04000b, 0x04000b, 0x04000d, 0x04000d,
+  0x04000d, 0x04000f, 0x040001, 0x040001, 0x040003, 0x040003,
+  0x040005, 0x040005, 0x040007, 0x040007, 0x040009, 0x040009,
+  0x04000b, 0x04000b, 0x04000d, 0x04000d, 0x04000f, 0x04000f,
+  0x040001, 0x040001, 0x040001, 0x040001, 0x040005, 0x040005,
+  0x040005, 0x040005, 0x040009, 0x040009, 0x040009, 0x040009,
+  0x04000d, 0x04000d, 0x04000d, 0x04000d, 0x040001, 0x040001,
+  0x040003, 0x040003, 0x040005, 0x040005, 0x040007, 0x040007,
+  0x040009, 0x040009, 0x04000b, 0x04000b, 0x04000d, 0x04000d,
+  0x04000f, 0x04000f, 0x040401, 0x040401, 0x040403, 0x040403,
+  0x040405, 0x040005, 0x040407, 0x040007, 0x040409, 0x040409,
+  0x04040b, 0x04040b, 0x04040d, 0x04000d, 0x04040f, 0x04000f,
+  0x040001, 0x040001, 0x040003, 0x040003, 0x040005, 0x040005,
+  0x040007, 0x040007, 0x040009, 0x040009, 0x04000b, 0x04000b,
+  0x04000d, 0x04000d, 0x04000f, 0x04000f, 0x040001, 0x040401,
+  0x040003, 0x040403, 0x040405, 0x040405, 0x040407, 0x040407,
+  0x040009, 0x040409, 0x04000b, 0x04040b, 0x04040d, 0x04040d,
+  0x04040f, 0x04040f, 0x040001, 0x040001, 0x040003, 0x040003,
+  0x040005, 0x040005, 0x040007, 0x040007, 0x040009, 0x040009,
+  0x04000b, 0x04000b, 0x04000d, 0x04000d, 0x04000f, 0x04000f,
+  0x040001, 0x040401, 0x040003, 0x040403, 0x040405, 0x040005,
+  0x040407, 0x040007, 0x040009, 0x040409, 0x04000b, 0x04040b,
+  0x04040d, 0x04000d, 0x04040f, 0x04000f, 0x040001, 0x040001,
+  0x040003, 0x040003, 0x040005, 0x040005, 0x040007, 0x040007,
+  0x040009, 0x040009, 0x04000b, 0x04000b, 0x04000d, 0x04000d,
+  0x04000f, 0x04000f, 0x040801, 0x041801, 0x040803, 0x041803,
+  0x040805, 0x041805, 0x040807, 0x041807, 0x040829, 0x041829,
+  0x04082b, 0x04182b, 0x04082d, 0x04182d, 0x04082f, 0x04182f,
+  0x040001, 0x040001, 0x040003, 0x040003, 0x040005, 0x040005,
+  0x040007, 0x040007, 0x040009, 0x040009, 0x04000b, 0x04000b,
+  0x04000d, 0x04000d, 0x04000f, 0x04000f, 0x041801, 0x040801,
+  0x041803, 0x040803, 0x041805, 0x040805, 0x041807, 0x040807,
+  0x041829, 0x040829, 0x04182b, 0x04082b, 0x04182d, 0x04082d,
+  0x04182f, 0x04082f, 0x040001, 0x040001, 0x040003, 0x040003,
+  0x040005, 0x040005, 0x040007, 0x040007, 0x040009, 0x040009,
+  0x04000b, 0x04000b, 0x04000d, 0x04000d, 0x04000f, 0x04000f,
+  0x040005, 0x040005, 0x040007, 0x040007, 0x040005, 0x040005,
+  0x040007, 0x040007, 0x04000d, 0x04000d, 0x04000f, 0x04000f,
+  0x04000d, 0x04000d, 0x04000f, 0x04000f, 0x040001, 0x040001,
+  0x040003, 0x040003, 0x040005, 0x040005, 0x040007, 0x040007,
+  0x040009, 0x040009, 0x04000b, 0x04000b, 0x04000d, 0x04000d,
+  0x04000f, 0x04000f, 0x040001, 0x040001, 0x040003, 0x040003,
+  0x04000d, 0x04000d, 0x04000f, 0x04000f, 0x040001, 0x040001,
+  0x040003, 0x040003, 0x04000d, 0x04000d, 0x04000f, 0x04000f,
+  0x040001, 0x040001, 0x040003, 0x040003, 0x040005, 0x040005,
+  0x040007, 0x040007, 0x040009, 0x040009, 0x04000b, 0x04000b,
+  0x04000d, 0x04000d, 0x04000f, 0x04000f, 0x040081, 0x040081,
+  0x040083, 0x040083, 0x040085, 0x040085, 0x040087, 0x040087,
+  0x040089, 0x040089, 0x04008b, 0x04008b, 0x04008d, 0x04008d,
+  0x04008f, 0x04008f, 0x040001, 0x040001, 0x040003, 0x040003,
+  0x040005, 0x040005, 0x040007, 0x040007, 0x040009, 0x040009,
+  0x04000b, 0x04000b, 0x04000d, 0x04000d, 0x04000f, 0x04000f,
+  0x000100, 0x000101, 0x000102, 0x000103, 0x000104, 0x000105,
+  0x000106, 0x000107, 0x000108, 0x000109, 0x00010a, 0x00010b,
+  0x00010c, 0x00010d, 0x00010e, 0x00010f, 0x040001, 0x040001,
+  0x040003, 0x040003, 0x040005, 0x040005, 0x040007, 0x040007,
+  0x040009, 0x040009, 0x04000b, 0x04000b, 0x04000d, 0x04000d,
+  0x04000f, 0x04000f, 0x000000, 0x040001, 0x000002, 0x040003,
+  0x000004, 0x040005, 0x000006, 0x040007, 0x000008, 0x040009,
+  0x00000a, 0x04000b, 0x00000c, 0x04000d, 0x00000e, 0x04000f,
+  0x040001, 0x040001, 0x040003, 0x040003, 0x040005, 0x040005,
+  0x040007, 0x040007, 0x040009, 0x040009, 0x04000b, 0x04000b,
+  0x04000d, 0x04000d, 0x04000f, 0x04000f, 0x040201, 0x040201,
+  0x040203, 0x040203, 0x040205, 0x040205, 0x040207, 0x040207,
+  0x040209, 0x040209, 0x04020b, 0x04020b, 0x04020d, 0x04020d,
+  0x04020f, 0x04020f, 0x040001, 0x040001, 0x040003, 0x040003,
+  0x040005, 0x040005, 0x040007, 0x040007, 0x040009, 0x040009,
+  0x04000b, 0x04000b, 0x04000d, 0x04000d, 0x04000f, 0x04000f,
+  0x000040, 0x040041, 0x000042, 0x040043, 0x000044, 0x040045,
+  0x000046, 0x040047, 0x000048, 0x040049, 0x00004a, 0x04004b,
+  0x00004c, 0x04004d, 0x00004e, 0x04004f, 0x000000, 0x040001,
+  0x000002, 0x040003, 0x000004, 0x040005, 0x000006, 0x040007,
+  0x000008, 0x040009, 0x00000a, 0x04000b, 0x00000c, 0x04000d,
+  0x00000e, 0x04000f, 0x000000, 0x000000, 0x000002, 0x000002,
+  0x000004, 0x000004, 0x000006, 0x000006, 0x000008, 0x000008,
+  0x00000a, 0x00000a, 0x00000c, 0x00000c, 0x00000e, 0x00000e,
+  0x000000, 0x040001, 0x000002, 0x040003, 0x000004, 0x040005,
+  0x000006, 0x040007, 0x000008, 0x040009, 0x00000a, 0x04000b,
+  0x00000c, 0x04000d, 0x00000e, 0x04000f, 0x000000, 0x040001,
+  0x040001, 0x000002, 0x000004, 0x040005, 0x040005, 0x000006,
+  0x000008, 0x040009, 0x040009, 0x00000a, 0x00000c, 0x04000d,
+  0x04000d, 0x00000e, 0x000000, 0x040001, 0x000002, 0x040003,
+  0x000004, 0x040005, 0x000006, 0x040007, 0x000008, 0x040009,
+  0x00000a, 0x04000b, 0x00000c, 0x04000d, 0x00000e, 0x04000f,
+  0x040001, 0x000002, 0x000002, 0x040003, 0x040005, 0x000006,
+  0x000006, 0x040007, 0x040009, 0x00000a, 0x00000a, 0x04000b,
+  0x04000d, 0x00000e, 0x00000e, 0x04000f, 0x000000, 0x040001,
+  0x000002, 0x040003, 0x000004, 0x040005, 0x000006, 0x040007,
+  0x000008, 0x040009, 0x00000a, 0x04000b, 0x00000c, 0x04000d,
+  0x00000e, 0x04000f, 0x040001, 0x040001, 0x040001, 0x040001,
+  0x040005, 0x040005, 0x040005, 0x040005, 0x040009, 0x040009,
+  0x040009, 0x040009, 0x04000d, 0x04000d, 0x04000d, 0x04000d,
+  0x000000, 0x040001, 0x000002, 0x040003, 0x000004, 0x040005,
+  0x000006, 0x040007, 0x000008, 0x040009, 0x00000a, 0x04000b,
+  0x00000c, 0x04000d, 0x00000e, 0x04000f, 0x040401, 0x040401,
+  0x040403, 0x040403, 0x040405, 0x040405, 0x040407, 0x040407,
+  0x040409, 0x040409, 0x04040b, 0x04040b, 0x04040d, 0x04040d,
+  0x04040f, 0x04040f, 0x000000, 0x040001, 0x000002, 0x040003,
+  0x000004, 0x040005, 0x000006, 0x040007, 0x000008, 0x040009,
+  0x00000a, 0x04000b, 0x00000c, 0x04000d, 0x00000e, 0x04000f,
+  0x000000, 0x040401, 0x000002, 0x040403, 0x000004, 0x040405,
+  0x000006, 0x040407, 0x000008, 0x040409, 0x00000a, 0x04040b,
+  0x00000c, 0x04040d, 0x00000e, 0x04040f, 0x000000, 0x040001,
+  0x000002, 0x040003, 0x000004, 0x040005, 0x000006, 0x040007,
+  0x000008, 0x040009, 0x00000a, 0x04000b, 0x00000c, 0x04000d,
+  0x00000e, 0x04000f, 0x000000, 0x040401, 0x000002, 0x040403,
+  0x000004, 0x040405, 0x000006, 0x040407, 0x000008, 0x040409,
+  0x00000a, 0x04040b, 0x00000c, 0x04040d, 0x00000e, 0x04040f,
+  0x000000, 0x040001, 0x000002, 0x040003, 0x000004, 0x040005,
+  0x000006, 0x040007, 0x000008, 0x040009, 0x00000a, 0x04000b,
+  0x00000c, 0x04000d, 0x00000e, 0x04000f, 0x000800, 0x041801,
+  0x000802, 0x041803, 0x000804, 0x041805, 0x000806, 0x041807,
+  0x000828, 0x041829, 0x00082a, 0x04182b, 0x00082c, 0x04182d,
+  0x00082e, 0x04182f, 0x000000, 0x040001, 0x000002, 0x040003,
+  0x000004, 0x040005, 0x000006, 0x040007, 0x000008, 0x040009,
+  0x00000a, 0x04000b, 0x00000c, 0x04000d, 0x00000e, 0x04000f,
+  0x001800, 0x040801, 0x001802, 0x040803, 0x001804, 0x040805,
+  0x001806, 0x040807, 0x001828, 0x040829, 0x00182a, 0x04082b,
+  0x00182c, 0x04082d, 0x00182e, 0x04082f, 0x000000, 0x040001,
+  0x000002, 0x040003, 0x000004, 0x040005, 0x000006, 0x040007,
+  0x000008, 0x040009, 0x00000a, 0x04000b, 0x00000c, 0x04000d,
+  0x00000e, 0x04000f, 0x000000, 0x040001, 0x000002, 0x040003,
+  0x000000, 0x040001, 0x000002, 0x040003, 0x000008, 0x040009,
+  0x00000a, 0x04000b, 0x000008, 0x040009, 0x00000a, 0x04000b,
+  0x000000, 0x040001, 0x000002, 0x040003, 0x000004, 0x040005,
+  0x000006, 0x040007, 0x000008, 0x040009, 0x00000a, 0x04000b,
+  0x00000c, 0x04000d, 0x00000e, 0x04000f, 0x000000, 0x040001,
+  0x000002, 0x040003, 0x000004, 0x040005, 0x000006, 0x040007,
+  0x000000, 0x040001, 0x000002, 0x040003, 0x000004, 0x040005,
+  0x000006, 0x040007, 0x000000, 0x040001, 0x000002, 0x040003,
+  0x000004, 0x040005, 0x000006, 0x040007, 0x000008, 0x040009,
+  0x00000a, 0x04000b, 0x00000c, 0x04000d, 0x00000e, 0x04000f,
+  0x000080, 0x040081, 0x000082, 0x040083, 0x000084, 0x040085,
+  0x000086, 0x040087, 0x000088, 0x040089, 0x00008a, 0x04008b,
+  0x00008c, 0x04008d, 0x00008e, 0x04008f, 0x000000, 0x040001,
+  0x000002, 0x040003, 0x000004, 0x040005, 0x000006, 0x040007,
+  0x000008, 0x040009, 0x00000a, 0x04000b, 0x00000c, 0x04000d,
+  0x00000e, 0x04000f, 0x000100, 0x000101, 0x000102, 0x000103,
+  0x000104, 0x000105, 0x000106, 0x000107, 0x000108, 0x000109,
+  0x00010a, 0x00010b, 0x00010c, 0x00010d, 0x00010e, 0x00010f,
+  0x000000, 0x040001, 0x000002, 0x040003, 0x000004, 0x040005,
+  0x000006, 0x040007, 0x000008, 0x040009, 0x00000a, 0x04000b,
+  0x00000c, 0x04000d, 0x00000e, 0x04000f, 0x000000, 0x040001,
+  0x000002, 0x040003, 0x000004, 0x040005, 0x000006, 0x040007,
+  0x000008, 0x040009, 0x00000a, 0x04000b, 0x00000c, 0x04000d,
+  0x00000e, 0x04000f, 0x000000, 0x040001, 0x000002, 0x040003,
+  0x000004, 0x040005, 0x000006, 0x040007, 0x000008, 0x040009,
+  0x00000a, 0x04000b, 0x00000c, 0x04000d, 0x00000e, 0x04000f,
+  0x000200, 0x040201, 0x000202, 0x040203, 0x000204, 0x040205,
+  0x000206, 0x040207, 0x000208, 0x040209, 0x00020a, 0x04020b,
+  0x00020c, 0x04020d, 0x00020e, 0x04020f, 0x000000, 0x040001,
+  0x000002, 0x040003, 0x000004, 0x040005, 0x000006, 0x040007,
+  0x000008, 0x040009, 0x00000a, 0x04000b, 0x00000c, 0x04000d,
+  0x00000e, 0x04000f, 0x000040, 0x040041, 0x000042, 0x040043,
+  0x000044, 0x040045, 0x000046, 0x040047, 0x000048, 0x040049,
+  0x00004a, 0x04004b, 0x00004c, 0x04004d, 0x00004e, 0x04004f,
+  0x000000, 0x040001, 0x000002, 0x040003, 0x000004, 0x040005,
+  0x000006, 0x040007, 0x000008, 0x040009, 0x00000a, 0x04000b,
+  0x00000c, 0x04000d, 0x00000e, 0x04000f, 0x000000, 0x000000,
+  0x000002, 0x000002, 0x040005, 0x040005, 0x040007, 0x040007,
+  0x000008, 0x000008, 0x00000a, 0x00000a, 0x04000d, 0x04000d,
+  0x04000f, 0x04000f, 0x000000, 0x040001, 0x000002, 0x040003,
+  0x000004, 0x040005, 0x000006, 0x040007, 0x000008, 0x040009,
+  0x00000a, 0x04000b, 0x00000c, 0x04000d, 0x00000e, 0x04000f,
+  0x000000, 0x040001, 0x040001, 0x000002, 0x040005, 0x000006,
+  0x000006, 0x040007, 0x000008, 0x040009, 0x040009, 0x00000a,
+  0x04000d, 0x00000e, 0x00000e, 0x04000f, 0x000000, 0x040001,
+  0x000002, 0x040003, 0x000004, 0x040005, 0x000006, 0x040007,
+  0x000008, 0x040009, 0x00000a, 0x04000b, 0x00000c, 0x04000d,
+  0x00000e, 0x04000f, 0x040001, 0x000002, 0x000002, 0x040003,
+  0x000004, 0x040005, 0x040005, 0x000006, 0x040009, 0x00000a,
+  0x00000a, 0x04000b, 0x00000c, 0x04000d, 0x04000d, 0x00000e,
+  0x000000, 0x040001, 0x000002, 0x040003, 0x000004, 0x040005,
+  0x000006, 0x040007, 0x000008, 0x040009, 0x00000a, 0x04000b,
+  0x00000c, 0x04000d, 0x00000e, 0x04000f, 0x040001, 0x040001,
+  0x040001, 0x040001, 0x040005, 0x040005, 0x040005, 0x040005,
+  0x040009, 0x040009, 0x040009, 0x040009, 0x04000d, 0x04000d,
+  0x04000d, 0x04000d, 0x000000, 0x040001, 0x000002, 0x040003,
+  0x000004, 0x040005, 0x000006, 0x040007, 0x000008, 0x040009,
+  0x00000a, 0x04000b, 0x00000c, 0x04000d, 0x00000e, 0x04000f,
+  0x040401, 0x040401, 0x040403, 0x040403, 0x040405, 0x000004,
+  0x040407, 0x000006, 0x040409, 0x040409, 0x04040b, 0x04040b,
+  0x04040d, 0x00000c, 0x04040f, 0x00000e, 0x000000, 0x040001,
+  0x000002, 0x040003, 0x000004, 0x040005, 0x000006, 0x040007,
+  0x000008, 0x040009, 0x00000a, 0x04000b, 0x00000c, 0x04000d,
+  0x00000e, 0x04000f, 0x000000, 0x040401, 0x000002, 0x040403,
+  0x040405, 0x040405, 0x040407, 0x040407, 0x000008, 0x040409,
+  0x00000a, 0x04040b, 0x04040d, 0x04040d, 0x04040f, 0x04040f,
+  0x000000, 0x040001, 0x000002, 0x040003, 0x000004, 0x040005,
+  0x000006, 0x040007, 0x000008, 0x040009, 0x00000a, 0x04000b,
+  0x00000c, 0x04000d, 0x00000e, 0x04000f, 0x000000, 0x040401,
+  0x000002, 0x040403, 0x040405, 0x000004, 0x040407, 0x000006,
+  0x000008, 0x040409, 0x00000a, 0x04040b, 0x04040d, 0x00000c,
+  0x04040f, 0x00000e, 0x000000, 0x040001, 0x000002, 0x040003,
+  0x000004, 0x040005, 0x000006, 0x040007, 0x000008, 0x040009,
+  0x00000a, 0x04000b, 0x00000c, 0x04000d, 0x00000e, 0x04000f,
+  0x000800, 0x041801, 0x000802, 0x041803, 0x000804, 0x041805,
+  0x000806, 0x041807, 0x000828, 0x041829, 0x00082a, 0x04182b,
+  0x00082c, 0x04182d, 0x00082e, 0x04182f, 0x000000, 0x040001,
+  0x000002, 0x040003, 0x000004, 0x040005, 0x000006, 0x040007,
+  0x000008, 0x040009, 0x00000a, 0x04000b, 0x00000c, 0x04000d,
+  0x00000e, 0x04000f, 0x001800, 0x040801, 0x001802, 0x040803,
+  0x001804, 0x040805, 0x001806, 0x040807, 0x001828, 0x040829,
+  0x00182a, 0x04082b, 0x00182c, 0x04082d, 0x00182e, 0x04082f,
+  0x000000, 0x040001, 0x000002, 0x040003, 0x000004, 0x040005,
+  0x000006, 0x040007, 0x000008, 0x040009, 0x00000a, 0x04000b,
+  0x00000c, 0x04000d, 0x00000e, 0x04000f, 0x000004, 0x040005,
+  0x000006, 0x040007, 0x000004, 0x040005, 0x000006, 0x040007,
+  0x00000c, 0x04000d, 0x00000e, 0x04000f, 0x00000c, 0x04000d,
+  0x00000e, 0x04000f, 0x000000, 0x040001, 0x000002, 0x040003,
+  0x000004, 0x040005, 0x000006, 0x040007, 0x000008, 0x040009,
+  0x00000a, 0x04000b, 0x00000c, 0x04000d, 0x00000e, 0x04000f,
+  0x000000, 0x040001, 0x000002, 0x040003, 0x00000c, 0x04000d,
+  0x00000e, 0x04000f, 0x000000, 0x040001, 0x000002, 0x040003,
+  0x00000c, 0x04000d, 0x00000e, 0x04000f, 0x000000, 0x040001,
+  0x000002, 0x040003, 0x000004, 0x040005, 0x000006, 0x040007,
+  0x000008, 0x040009, 0x00000a, 0x04000b, 0x00000c, 0x04000d,
+  0x00000e, 0x04000f, 0x000080, 0x040081, 0x000082, 0x040083,
+  0x000084, 0x040085, 0x000086, 0x040087, 0x000088, 0x040089,
+  0x00008a, 0x04008b, 0x00008c, 0x04008d, 0x00008e, 0x04008f,
+  0x000000, 0x040001, 0x000002, 0x040003, 0x000004, 0x040005,
+  0x000006, 0x040007, 0x000008, 0x040009, 0x00000a, 0x04000b,
+  0x00000c, 0x04000d, 0x00000e, 0x04000f, 0x000100, 0x000101,
+  0x000102, 0x000103, 0x000104, 0x000105, 0x000106, 0x000107,
+  0x000108, 0x000109, 0x00010a, 0x00010b, 0x00010c, 0x00010d,
+  0x00010e, 0x00010f, 0x000000, 0x040001, 0x000002, 0x040003,
+  0x000004, 0x040005, 0x000006, 0x040007, 0x000008, 0x040009,
+  0x00000a, 0x04000b, 0x00000c, 0x04000d, 0x00000e, 0x04000f,
+  0x000000, 0x040001, 0x000002, 0x040003, 0x000004, 0x040005,
+  0x000006, 0x040007, 0x000008, 0x040009, 0x00000a, 0x04000b,
+  0x00000c, 0x04000d, 0x00000e, 0x04000f, 0x000000, 0x040001,
+  0x000002, 0x040003, 0x000004, 0x040005, 0x000006, 0x040007,
+  0x000008, 0x040009, 0x00000a, 0x04000b, 0x00000c, 0x04000d,
+  0x00000e, 0x04000f, 0x000200, 0x040201, 0x000202, 0x040203,
+  0x000204, 0x040205, 0x000206, 0x040207, 0x000208, 0x040209,
+  0x00020a, 0x04020b, 0x00020c, 0x04020d, 0x00020e, 0x04020f,
+  0x000000, 0x040001, 0x000002, 0x040003, 0x000004, 0x040005,
+  0x000006, 0x040007, 0x000008, 0x040009, 0x00000a, 0x04000b,
+  0x00000c, 0x04000d, 0x00000e, 0x04000f, 0x000040, 0x040041,
+  0x000042, 0x040043, 0x000044, 0x040045, 0x000046, 0x040047,
+  0x000048, 0x040049, 0x00004a, 0x04004b, 0x00004c, 0x04004d,
+  0x00004e, 0x04004f, 0x000000, 0x040001, 0x000002, 0x040003,
+  0x000004, 0x040005, 0x000006, 0x040007, 0x000008, 0x040009,
+  0x00000a, 0x04000b, 0x00000c, 0x04000d, 0x00000e, 0x04000f,
+  0x000000, 0x000000, 0x000002, 0x000002, 0x000004, 0x000004,
+  0x000006, 0x000006, 0x000008, 0x000008, 0x00000a, 0x00000a,
+  0x00000c, 0x00000c, 0x00000e, 0x00000e, 0x000000, 0x040001,
+  0x000002, 0x040003, 0x000004, 0x040005, 0x000006, 0x040007,
+  0x000008, 0x040009, 0x00000a, 0x04000b, 0x00000c, 0x04000d,
+  0x00000e, 0x04000f, 0x000000, 0x040001, 0x040001, 0x000002,
+  0x000004, 0x040005, 0x040005, 0x000006, 0x000008, 0x040009,
+  0x040009, 0x00000a, 0x00000c, 0x04000d, 0x04000d, 0x00000e,
+  0x000000, 0x040001, 0x000002, 0x040003, 0x000004, 0x040005,
+  0x000006, 0x040007, 0x000008, 0x040009, 0x00000a, 0x04000b,
+  0x00000c, 0x04000d, 0x00000e, 0x04000f, 0x040001, 0x000002,
+  0x000002, 0x040003, 0x040005, 0x000006, 0x000006, 0x040007,
+  0x040009, 0x00000a, 0x00000a, 0x04000b, 0x04000d, 0x00000e,
+  0x00000e, 0x04000f, 0x000000, 0x040001, 0x000002, 0x040003,
+  0x000004, 0x040005, 0x000006, 0x040007, 0x000008, 0x040009,
+  0x00000a, 0x04000b, 0x00000c, 0x04000d, 0x00000e, 0x04000f,
+  0x040001, 0x040001, 0x040001, 0x040001, 0x040005, 0x040005,
+  0x040005, 0x040005, 0x040009, 0x040009, 0x040009, 0x040009,
+  0x04000d, 0x04000d, 0x04000d, 0x04000d, 0x000000, 0x040001,
+  0x000002, 0x040003, 0x000004, 0x040005, 0x000006, 0x040007,
+  0x000008, 0x040009, 0x00000a, 0x04000b, 0x00000c, 0x04000d,
+  0x00000e, 0x04000f, 0x040401, 0x040401, 0x040403, 0x040403,
+  0x040405, 0x040405, 0x040407, 0x040407, 0x040409, 0x040409,
+  0x04040b, 0x04040b, 0x04040d, 0x04040d, 0x04040f, 0x04040f,
+  0x000000, 0x040001, 0x000002, 0x040003, 0x000004, 0x040005,
+  0x000006, 0x040007, 0x000008, 0x040009, 0x00000a, 0x04000b,
+  0x00000c, 0x04000d, 0x00000e, 0x04000f, 0x000000, 0x040401,
+  0x000002, 0x040403, 0x000004, 0x040405, 0x000006, 0x040407,
+  0x000008, 0x040409, 0x00000a, 0x04040b, 0x00000c, 0x04040d,
+  0x00000e, 0x04040f, 0x000000, 0x040001, 0x000002, 0x040003,
+  0x000004, 0x040005, 0x000006, 0x040007, 0x000008, 0x040009,
+  0x00000a, 0x04000b, 0x00000c, 0x04000d, 0x00000e, 0x04000f,
+  0x000000, 0x040401, 0x000002, 0x040403, 0x000004, 0x040405,
+  0x000006, 0x040407, 0x000008, 0x040409, 0x00000a, 0x04040b,
+  0x00000c, 0x04040d, 0x00000e, 0x04040f, 0x000000, 0x040001,
+  0x000002, 0x040003, 0x000004, 0x040005, 0x000006, 0x040007,
+  0x000008, 0x040009, 0x00000a, 0x04000b, 0x00000c, 0x04000d,
+  0x00000e, 0x04000f, 0x000800, 0x041801, 0x000802, 0x041803,
+  0x000804, 0x041805, 0x000806, 0x041807, 0x000828, 0x041829,
+  0x00082a, 0x04182b, 0x00082c, 0x04182d, 0x00082e, 0x04182f,
+  0x000000, 0x040001, 0x000002, 0x040003, 0x000004, 0x040005,
+  0x000006, 0x040007, 0x000008, 0x040009, 0x00000a, 0x04000b,
+  0x00000c, 0x04000d, 0x00000e, 0x04000f, 0x001800, 0x040801,
+  0x001802, 0x040803, 0x001804, 0x040805, 0x001806, 0x040807,
+  0x001828, 0x040829, 0x00182a, 0x04082b, 0x00182c, 0x04082d,
+  0x00182e, 0x04082f, 0x000000, 0x040001, 0x000002, 0x040003,
+  0x000004, 0x040005, 0x000006, 0x040007, 0x000008, 0x040009,
+  0x00000a, 0x04000b, 0x00000c, 0x04000d, 0x00000e, 0x04000f,
+  0x000000, 0x040001, 0x000002, 0x040003, 0x000000, 0x040001,
+  0x000002, 0x040003, 0x000008, 0x040009, 0x00000a, 0x04000b,
+  0x000008, 0x040009, 0x00000a, 0x04000b, 0x000000, 0x040001,
+  0x000002, 0x040003, 0x000004, 0x040005, 0x000006, 0x040007,
+  0x000008, 0x040009, 0x00000a, 0x04000b, 0x00000c, 0x04000d,
+  0x00000e, 0x04000f, 0x000000, 0x040001, 0x000002, 0x040003,
+  0x000004, 0x040005, 0x000006, 0x040007, 0x000000, 0x040001,
+  0x000002, 0x040003, 0x000004, 0x040005, 0x000006, 0x040007,
+  0x000000, 0x040001, 0x000002, 0x040003, 0x000004, 0x040005,
+  0x000006, 0x040007, 0x000008, 0x040009, 0x00000a, 0x04000b,
+  0x00000c, 0x04000d, 0x00000e, 0x04000f, 0x000080, 0x040081,
+  0x000082, 0x040083, 0x000084, 0x040085, 0x000086, 0x040087,
+  0x000088, 0x040089, 0x00008a, 0x04008b, 0x00008c, 0x04008d,
+  0x00008e, 0x04008f, 0x000000, 0x040001, 0x000002, 0x040003,
+  0x000004, 0x040005, 0x000006, 0x040007, 0x000008, 0x040009,
+  0x00000a, 0x04000b, 0x00000c, 0x04000d, 0x00000e, 0x04000f,
+  0x000100, 0x000101, 0x000102, 0x000103, 0x000104, 0x000105,
+  0x000106, 0x000107, 0x000108, 0x000109, 0x00010a, 0x00010b,
+  0x00010c, 0x00010d, 0x00010e, 0x00010f, 0x000000, 0x040001,
+  0x000002, 0x040003, 0x000004, 0x040005, 0x000006, 0x040007,
+  0x000008, 0x040009, 0x00000a, 0x04000b, 0x00000c, 0x04000d,
+  0x00000e, 0x04000f, 0x000000, 0x040001, 0x000002, 0x040003,
+  0x000004, 0x040005, 0x000006, 0x040007, 0x000008, 0x040009,
+  0x00000a, 0x04000b, 0x00000c, 0x04000d, 0x00000e, 0x04000f,
+  0x000000, 0x040001, 0x000002, 0x040003, 0x000004, 0x040005,
+  0x000006, 0x040007, 0x000008, 0x040009, 0x00000a, 0x04000b,
+  0x00000c, 0x04000d, 0x00000e, 0x04000f, 0x000200, 0x040201,
+  0x000202, 0x040203, 0x000204, 0x040205, 0x000206, 0x040207,
+  0x000208, 0x040209, 0x00020a, 0x04020b, 0x00020c, 0x04020d,
+  0x00020e, 0x04020f, 0x000000, 0x040001, 0x000002, 0x040003,
+  0x000004, 0x040005, 0x000006, 0x040007, 0x000008, 0x040009,
+  0x00000a, 0x04000b, 0x00000c, 0x04000d, 0x00000e, 0x04000f,
+  0x000040, 0x040041, 0x000042, 0x040043, 0x000044, 0x040045,
+  0x000046, 0x040047, 0x000048, 0x040049, 0x00004a, 0x04004b,
+  0x00004c, 0x04004d, 0x00004e, 0x04004f, 0x000000, 0x040001,
+  0x000002, 0x040003, 0x000004, 0x040005, 0x000006, 0x040007,
+  0x000008, 0x040009, 0x00000a, 0x04000b, 0x00000c, 0x04000d,
+  0x00000e, 0x04000f, 0x000000, 0x000000, 0x000002, 0x000002,
+  0x040005, 0x040005, 0x040007, 0x040007, 0x000008, 0x000008,
+  0x00000a, 0x00000a, 0x04000d, 0x04000d, 0x04000f, 0x04000f,
+  0x000000, 0x040001, 0x000002, 0x040003, 0x000004, 0x040005,
+  0x000006, 0x040007, 0x000008, 0x040009, 0x00000a, 0x04000b,
+  0x00000c, 0x04000d, 0x00000e, 0x04000f, 0x000000, 0x040001,
+  0x040001, 0x000002, 0x040005, 0x000006, 0x000006, 0x040007,
+  0x000008, 0x040009, 0x040009, 0x00000a, 0x04000d, 0x00000e,
+  0x00000e, 0x04000f, 0x000000, 0x040001, 0x000002, 0x040003,
+  0x000004, 0x040005, 0x000006, 0x040007, 0x000008, 0x040009,
+  0x00000a, 0x04000b, 0x00000c, 0x04000d, 0x00000e, 0x04000f,
+  0x040001, 0x000002, 0x000002, 0x040003, 0x000004, 0x040005,
+  0x040005, 0x000006, 0x040009, 0x00000a, 0x00000a, 0x04000b,
+  0x00000c, 0x04000d, 0x04000d, 0x00000e, 0x000000, 0x040001,
+  0x000002, 0x040003, 0x000004, 0x040005, 0x000006, 0x040007,
+  0x000008, 0x040009, 0x00000a, 0x04000b, 0x00000c, 0x04000d,
+  0x00000e, 0x04000f, 0x040001, 0x040001, 0x040001, 0x040001,
+  0x040005, 0x040005, 0x040005, 0x040005, 0x040009, 0x040009,
+  0x040009, 0x040009, 0x04000d, 0x04000d, 0x04000d, 0x04000d,
+  0x000000, 0x040001, 0x000002, 0x040003, 0x000004, 0x040005,
+  0x000006, 0x040007, 0x000008, 0x040009, 0x00000a, 0x04000b,
+  0x00000c, 0x04000d, 0x00000e, 0x04000f, 0x040401, 0x040401,
+  0x040403, 0x040403, 0x040405, 0x000004, 0x040407, 0x000006,
+  0x040409, 0x040409, 0x04040b, 0x04040b, 0x04040d, 0x00000c,
+  0x04040f, 0x00000e, 0x000000, 0x040001, 0x000002, 0x040003,
+  0x000004, 0x040005, 0x000006, 0x040007, 0x000008, 0x040009,
+  0x00000a, 0x04000b, 0x00000c, 0x04000d, 0x00000e, 0x04000f,
+  0x000000, 0x040401, 0x000002, 0x040403, 0x040405, 0x040405,
+  0x040407, 0x040407, 0x000008, 0x040409, 0x00000a, 0x04040b,
+  0x04040d, 0x04040d, 0x04040f, 0x04040f, 0x000000, 0x040001,
+  0x000002, 0x040003, 0x000004, 0x040005, 0x000006, 0x040007,
+  0x000008, 0x040009, 0x00000a, 0x04000b, 0x00000c, 0x04000d,
+  0x00000e, 0x04000f, 0x000000, 0x040401, 0x000002, 0x040403,
+  0x040405, 0x000004, 0x040407, 0x000006, 0x000008, 0x040409,
+  0x00000a, 0x04040b, 0x04040d, 0x00000c, 0x04040f, 0x00000e,
+  0x000000, 0x040001, 0x000002, 0x040003, 0x000004, 0x040005,
+  0x000006, 0x040007, 0x000008, 0x040009, 0x00000a, 0x04000b,
+  0x00000c, 0x04000d, 0x00000e, 0x04000f, 0x000800, 0x041801,
+  0x000802, 0x041803, 0x000804, 0x041805, 0x000806, 0x041807,
+  0x000828, 0x041829, 0x00082a, 0x04182b, 0x00082c, 0x04182d,
+  0x00082e, 0x04182f, 0x000000, 0x040001, 0x000002, 0x040003,
+  0x000004, 0x040005, 0x000006, 0x040007, 0x000008, 0x040009,
+  0x00000a, 0x04000b, 0x00000c, 0x04000d, 0x00000e, 0x04000f,
+  0x001800, 0x040801, 0x001802, 0x040803, 0x001804, 0x040805,
+  0x001806, 0x040807, 0x001828, 0x040829, 0x00182a, 0x04082b,
+  0x00182c, 0x04082d, 0x00182e, 0x04082f, 0x000000, 0x040001,
+  0x000002, 0x040003, 0x000004, 0x040005, 0x000006, 0x040007,
+  0x000008, 0x040009, 0x00000a, 0x04000b, 0x00000c, 0x04000d,
+  0x00000e, 0x04000f, 0x000004, 0x040005, 0x000006, 0x040007,
+  0x000004, 0x040005, 0x000006, 0x040007, 0x00000c, 0x04000d,
+  0x00000e, 0x04000f, 0x00000c, 0x04000d, 0x00000e, 0x04000f,
+  0x000000, 0x040001, 0x000002, 0x040003, 0x000004, 0x040005,
+  0x000006, 0x040007, 0x000008, 0x040009, 0x00000a, 0x04000b,
+  0x00000c, 0x04000d, 0x00000e, 0x04000f, 0x000000, 0x040001,
+  0x000002, 0x040003, 0x00000c, 0x04000d, 0x00000e, 0x04000f,
+  0x000000, 0x040001, 0x000002, 0x040003, 0x00000c, 0x04000d,
+  0x00000e, 0x04000f, 0x000000, 0x040001, 0x000002, 0x040003,
+  0x000004, 0x040005, 0x000006, 0x040007, 0x000008, 0x040009,
+  0x00000a, 0x04000b, 0x00000c, 0x04000d, 0x00000e, 0x04000f,
+  0x000080, 0x040081, 0x000082, 0x040083, 0x000084, 0x040085,
+  0x000086, 0x040087, 0x000088, 0x040089, 0x00008a, 0x04008b,
+  0x00008c, 0x04008d, 0x00008e, 0x04008f, 0x000000, 0x040001,
+  0x000002, 0x040003, 0x000004, 0x040005, 0x000006, 0x040007,
+  0x000008, 0x040009, 0x00000a, 0x04000b, 0x00000c, 0x04000d,
+  0x00000e, 0x04000f, 0x000100, 0x000101, 0x000102, 0x000103,
+  0x000104, 0x000105, 0x000106, 0x000107, 0x000108, 0x000109,
+  0x00010a, 0x00010b, 0x00010c, 0x00010d, 0x00010e, 0x00010f,
+  0x000000, 0x040001, 0x000002, 0x040003, 0x000004, 0x040005,
+  0x000006, 0x040007, 0x000008, 0x040009, 0x00000a, 0x04000b,
+  0x00000c, 0x04000d, 0x00000e, 0x04000f, 0x000000, 0x040001,
+  0x000002, 0x040003, 0x000004, 0x040005, 0x000006, 0x040007,
+  0x000008, 0x040009, 0x00000a, 0x04000b, 0x00000c, 0x04000d,
+  0x00000e, 0x04000f, 0x000000, 0x040001, 0x000002, 0x040003,
+  0x000004, 0x040005, 0x000006, 0x040007, 0x000008, 0x040009,
+  0x00000a, 0x04000b, 0x00000c, 0x04000d, 0x00000e, 0x04000f,
+  0x000200, 0x040201, 0x000202, 0x040203, 0x000204, 0x040205,
+  0x000206, 0x040207, 0x000208, 0x040209, 0x00020a, 0x04020b,
+  0x00020c, 0x04020d, 0x00020e, 0x04020f, 0x000000, 0x040001,
+  0x000002, 0x040003, 0x000004, 0x040005, 0x000006, 0x040007,
+  0x000008, 0x040009, 0x00000a, 0x04000b, 0x00000c, 0x04000d,
+  0x00000e, 0x04000f, 0x080040, 0x180041, 0x080042, 0x180043,
+  0x080044, 0x180045, 0x080046, 0x180047, 0x082048, 0x182049,
+  0x08204a, 0x18204b, 0x08204c, 0x18204d, 0x08204e, 0x18204f,
+  0x080000, 0x180001, 0x080002, 0x180003, 0x080004, 0x180005,
+  0x080006, 0x180007, 0x082008, 0x182009, 0x08200a, 0x18200b,
+  0x08200c, 0x18200d, 0x08200e, 0x18200f, 0x080000, 0x080000,
+  0x080002, 0x080002, 0x080004, 0x080004, 0x080006, 0x080006,
+  0x082008, 0x082008, 0x08200a, 0x08200a, 0x08200c, 0x08200c,
+  0x08200e, 0x08200e, 0x080000, 0x180001, 0x080002, 0x180003,
+  0x080004, 0x180005, 0x080006, 0x180007, 0x082008, 0x182009,
+  0x08200a, 0x18200b, 0x08200c, 0x18200d, 0x08200e, 0x18200f,
+  0x080000, 0x180001, 0x180001, 0x080002, 0x080004, 0x180005,
+  0x180005, 0x080006, 0x082008, 0x182009, 0x182009, 0x08200a,
+  0x08200c, 0x18200d, 0x18200d, 0x08200e, 0x080000, 0x180001,
+  0x080002, 0x180003, 0x080004, 0x180005, 0x080006, 0x180007,
+  0x082008, 0x182009, 0x08200a, 0x18200b, 0x08200c, 0x18200d,
+  0x08200e, 0x18200f, 0x180001, 0x080002, 0x080002, 0x180003,
+  0x180005, 0x080006, 0x080006, 0x180007, 0x182009, 0x08200a,
+  0x08200a, 0x18200b, 0x18200d, 0x08200e, 0x08200e, 0x18200f,
+  0x080000, 0x180001, 0x080002, 0x180003, 0x080004, 0x180005,
+  0x080006, 0x180007, 0x082008, 0x182009, 0x08200a, 0x18200b,
+  0x08200c, 0x18200d, 0x08200e, 0x18200f, 0x180001, 0x180001,
+  0x180001, 0x180001, 0x180005, 0x180005, 0x180005, 0x180005,
+  0x182009, 0x182009, 0x182009, 0x182009, 0x18200d, 0x18200d,
+  0x18200d, 0x18200d, 0x080000, 0x180001, 0x080002, 0x180003,
+  0x080004, 0x180005, 0x080006, 0x180007, 0x082008, 0x182009,
+  0x08200a, 0x18200b, 0x08200c, 0x18200d, 0x08200e, 0x18200f,
+  0x180401, 0x180401, 0x180403, 0x180403, 0x180405, 0x180405,
+  0x180407, 0x180407, 0x182409, 0x182409, 0x18240b, 0x18240b,
+  0x18240d, 0x18240d, 0x18240f, 0x18240f, 0x080000, 0x180001,
+  0x080002, 0x180003, 0x080004, 0x180005, 0x080006, 0x180007,
+  0x082008, 0x182009, 0x08200a, 0x18200b, 0x08200c, 0x18200d,
+  0x08200e, 0x18200f, 0x080000, 0x180401, 0x080002, 0x180403,
+  0x080004, 0x180405, 0x080006, 0x180407, 0x082008, 0x182409,
+  0x08200a, 0x18240b, 0x08200c, 0x18240d, 0x08200e, 0x18240f,
+  0x080000, 0x180001, 0x080002, 0x180003, 0x080004, 0x180005,
+  0x080006, 0x180007, 0x082008, 0x182009, 0x08200a, 0x18200b,
+  0x08200c, 0x18200d, 0x08200e, 0x18200f, 0x080000, 0x180401,
+  0x080002, 0x180403, 0x080004, 0x180405, 0x080006, 0x180407,
+  0x082008, 0x182409, 0x08200a, 0x18240b, 0x08200c, 0x18240d,
+  0x08200e, 0x18240f, 0x080000, 0x180001, 0x080002, 0x180003,
+  0x080004, 0x180005, 0x080006, 0x180007, 0x082008, 0x182009,
+  0x08200a, 0x18200b, 0x08200c, 0x18200d, 0x08200e, 0x18200f,
+  0x080800, 0x181801, 0x080802, 0x181803, 0x080804, 0x181805,
+  0x080806, 0x181807, 0x082828, 0x183829, 0x08282a, 0x18382b,
+  0x08282c, 0x18382d, 0x08282e, 0x18382f, 0x080000, 0x180001,
+  0x080002, 0x180003, 0x080004, 0x180005, 0x080006, 0x180007,
+  0x082008, 0x182009, 0x08200a, 0x18200b, 0x08200c, 0x18200d,
+  0x08200e, 0x18200f, 0x081800, 0x180801, 0x081802, 0x180803,
+  0x081804, 0x180805, 0x081806, 0x180807, 0x083828, 0x182829,
+  0x08382a, 0x18282b, 0x08382c, 0x18282d, 0x08382e, 0x18282f,
+  0x080000, 0x180001, 0x080002, 0x180003, 0x080004, 0x180005,
+  0x080006, 0x180007, 0x082008, 0x182009, 0x08200a, 0x18200b,
+  0x08200c, 0x18200d, 0x08200e, 0x18200f, 0x080000, 0x180001,
+  0x080002, 0x180003, 0x080000, 0x180001, 0x080002, 0x180003,
+  0x082008, 0x182009, 0x08200a, 0x18200b, 0x082008, 0x182009,
+  0x08200a, 0x18200b, 0x080000, 0x180001, 0x080002, 0x180003,
+  0x080004, 0x180005, 0x080006, 0x180007, 0x082008, 0x182009,
+  0x08200a, 0x18200b, 0x08200c, 0x18200d, 0x08200e, 0x18200f,
+  0x080000, 0x180001, 0x080002, 0x180003, 0x080004, 0x180005,
+  0x080006, 0x180007, 0x080000, 0x180001, 0x080002, 0x180003,
+  0x080004, 0x180005, 0x080006, 0x180007, 0x080000, 0x180001,
+  0x080002, 0x180003, 0x080004, 0x180005, 0x080006, 0x180007,
+  0x082008, 0x182009, 0x08200a, 0x18200b, 0x08200c, 0x18200d,
+  0x08200e, 0x18200f, 0x080080, 0x180081, 0x080082, 0x180083,
+  0x080084, 0x180085, 0x080086, 0x180087, 0x082088, 0x182089,
+  0x08208a, 0x18208b, 0x08208c, 0x18208d, 0x08208e, 0x18208f,
+  0x080000, 0x180001, 0x080002, 0x180003, 0x080004, 0x180005,
+  0x080006, 0x180007, 0x082008, 0x182009, 0x08200a, 0x18200b,
+  0x08200c, 0x18200d, 0x08200e, 0x18200f, 0x000100, 0x000101,
+  0x000102, 0x000103, 0x000104, 0x000105, 0x000106, 0x000107,
+  0x000108, 0x000109, 0x00010a, 0x00010b, 0x00010c, 0x00010d,
+  0x00010e, 0x00010f, 0x080000, 0x180001, 0x080002, 0x180003,
+  0x080004, 0x180005, 0x080006, 0x180007, 0x082008, 0x182009,
+  0x08200a, 0x18200b, 0x08200c, 0x18200d, 0x08200e, 0x18200f,
+  0x000000, 0x180001, 0x000002, 0x180003, 0x000004, 0x180005,
+  0x000006, 0x180007, 0x000008, 0x182009, 0x00000a, 0x18200b,
+  0x00000c, 0x18200d, 0x00000e, 0x18200f, 0x080000, 0x180001,
+  0x080002, 0x180003, 0x080004, 0x180005, 0x080006, 0x180007,
+  0x082008, 0x182009, 0x08200a, 0x18200b, 0x08200c, 0x18200d,
+  0x08200e, 0x18200f, 0x080200, 0x180201, 0x080202, 0x180203,
+  0x080204, 0x180205, 0x080206, 0x180207, 0x082208, 0x182209,
+  0x08220a, 0x18220b, 0x08220c, 0x18220d, 0x08220e, 0x18220f,
+  0x080000, 0x180001, 0x080002, 0x180003, 0x080004, 0x180005,
+  0x080006, 0x180007, 0x082008, 0x182009, 0x08200a, 0x18200b,
+  0x08200c, 0x18200d, 0x08200e, 0x18200f, 0x080040, 0x180041,
+  0x080042, 0x180043, 0x080044, 0x180045, 0x080046, 0x180047,
+  0x082048, 0x182049, 0x08204a, 0x18204b, 0x08204c, 0x18204d,
+  0x08204e, 0x18204f, 0x080000, 0x180001, 0x080002, 0x180003,
+  0x080004, 0x180005, 0x080006, 0x180007, 0x082008, 0x182009,
+  0x08200a, 0x18200b, 0x08200c, 0x18200d, 0x08200e, 0x18200f,
+  0x080000, 0x080000, 0x080002, 0x080002, 0x180005, 0x180005,
+  0x180007, 0x180007, 0x082008, 0x082008, 0x08200a, 0x08200a,
+  0x18200d, 0x18200d, 0x18200f, 0x18200f, 0x080000, 0x180001,
+  0x080002, 0x180003, 0x080004, 0x180005, 0x080006, 0x180007,
+  0x082008, 0x182009, 0x08200a, 0x18200b, 0x08200c, 0x18200d,
+  0x08200e, 0x18200f, 0x080000, 0x180001, 0x180001, 0x080002,
+  0x180005, 0x080006, 0x080006, 0x180007, 0x082008, 0x182009,
+  0x182009, 0x08200a, 0x18200d, 0x08200e, 0x08200e, 0x18200f,
+  0x080000, 0x180001, 0x080002, 0x180003, 0x080004, 0x180005,
+  0x080006, 0x180007, 0x082008, 0x182009, 0x08200a, 0x18200b,
+  0x08200c, 0x18200d, 0x08200e, 0x18200f, 0x180001, 0x080002,
+  0x080002, 0x180003, 0x080004, 0x180005, 0x180005, 0x080006,
+  0x182009, 0x08200a, 0x08200a, 0x18200b, 0x08200c, 0x18200d,
+  0x18200d, 0x08200e, 0x080000, 0x180001, 0x080002, 0x180003,
+  0x080004, 0x180005, 0x080006, 0x180007, 0x082008, 0x182009,
+  0x08200a, 0x18200b, 0x08200c, 0x18200d, 0x08200e, 0x18200f,
+  0x180001, 0x180001, 0x180001, 0x180001, 0x180005, 0x180005,
+  0x180005, 0x180005, 0x182009, 0x182009, 0x182009, 0x182009,
+  0x18200d, 0x18200d, 0x18200d, 0x18200d, 0x080000, 0x180001,
+  0x080002, 0x180003, 0x080004, 0x180005, 0x080006, 0x180007,
+  0x082008, 0x182009, 0x08200a, 0x18200b, 0x08200c, 0x18200d,
+  0x08200e, 0x18200f, 0x180401, 0x180401, 0x180403, 0x180403,
+  0x180405, 0x080004, 0x180407, 0x080006, 0x182409, 0x182409,
+  0x18240b, 0x18240b, 0x18240d, 0x08200c, 0x18240f, 0x08200e,
+  0x080000, 0x180001, 0x080002, 0x180003, 0x080004, 0x180005,
+  0x080006, 0x180007, 0x082008, 0x182009, 0x08200a, 0x18200b,
+  0x08200c, 0x18200d, 0x08200e, 0x18200f, 0x080000, 0x180401,
+  0x080002, 0x180403, 0x180405, 0x180405, 0x180407, 0x180407,
+  0x082008, 0x182409, 0x08200a, 0x18240b, 0x18240d, 0x18240d,
+  0x18240f, 0x18240f, 0x080000, 0x180001, 0x080002, 0x180003,
+  0x080004, 0x180005, 0x080006, 0x180007, 0x082008, 0x182009,
+  0x08200a, 0x18200b, 0x08200c, 0x18200d, 0x08200e, 0x18200f,
+  0x080000, 0x180401, 0x080002, 0x180403, 0x180405, 0x080004,
+  0x180407, 0x080006, 0x082008, 0x182409, 0x08200a, 0x18240b,
+  0x18240d, 0x08200c, 0x18240f, 0x08200e, 0x080000, 0x180001,
+  0x080002, 0x180003, 0x080004, 0x180005, 0x080006, 0x180007,
+  0x082008, 0x182009, 0x08200a, 0x18200b, 0x08200c, 0x18200d,
+  0x08200e, 0x18200f, 0x080800, 0x181801, 0x080802, 0x181803,
+  0x080804, 0x181805, 0x080806, 0x181807, 0x082828, 0x183829,
+  0x08282a, 0x18382b, 0x08282c, 0x18382d, 0x08282e, 0x18382f,
+  0x080000, 0x180001, 0x080002, 0x180003, 0x080004, 0x180005,
+  0x080006, 0x180007, 0x082008, 0x182009, 0x08200a, 0x18200b,
+  0x08200c, 0x18200d, 0x08200e, 0x18200f, 0x081800, 0x180801,
+  0x081802, 0x180803, 0x081804, 0x180805, 0x081806, 0x180807,
+  0x083828, 0x182829, 0x08382a, 0x18282b, 0x08382c, 0x18282d,
+  0x08382e, 0x18282f, 0x080000, 0x180001, 0x080002, 0x180003,
+  0x080004, 0x180005, 0x080006, 0x180007, 0x082008, 0x182009,
+  0x08200a, 0x18200b, 0x08200c, 0x18200d, 0x08200e, 0x18200f,
+  0x080004, 0x180005, 0x080006, 0x180007, 0x080004, 0x180005,
+  0x080006, 0x180007, 0x08200c, 0x18200d, 0x08200e, 0x18200f,
+  0x08200c, 0x18200d, 0x08200e, 0x18200f, 0x080000, 0x180001,
+  0x080002, 0x180003, 0x080004, 0x180005, 0x080006, 0x180007,
+  0x082008, 0x182009, 0x08200a, 0x18200b, 0x08200c, 0x18200d,
+  0x08200e, 0x18200f, 0x080000, 0x180001, 0x080002, 0x180003,
+  0x08200c, 0x18200d, 0x08200e, 0x18200f, 0x080000, 0x180001,
+  0x080002, 0x180003, 0x08200c, 0x18200d, 0x08200e, 0x18200f,
+  0x080000, 0x180001, 0x080002, 0x180003, 0x080004, 0x180005,
+  0x080006, 0x180007, 0x082008, 0x182009, 0x08200a, 0x18200b,
+  0x08200c, 0x18200d, 0x08200e, 0x18200f, 0x080080, 0x180081,
+  0x080082, 0x180083, 0x080084, 0x180085, 0x080086, 0x180087,
+  0x082088, 0x182089, 0x08208a, 0x18208b, 0x08208c, 0x18208d,
+  0x08208e, 0x18208f, 0x080000, 0x180001, 0x080002, 0x180003,
+  0x080004, 0x180005, 0x080006, 0x180007, 0x082008, 0x182009,
+  0x08200a, 0x18200b, 0x08200c, 0x18200d, 0x08200e, 0x18200f,
+  0x000100, 0x000101, 0x000102, 0x000103, 0x000104, 0x000105,
+  0x000106, 0x000107, 0x000108, 0x000109, 0x00010a, 0x00010b,
+  0x00010c, 0x00010d, 0x00010e, 0x00010f, 0x080000, 0x180001,
+  0x080002, 0x180003, 0x080004, 0x180005, 0x080006, 0x180007,
+  0x082008, 0x182009, 0x08200a, 0x18200b, 0x08200c, 0x18200d,
+  0x08200e, 0x18200f, 0x000000, 0x180001, 0x000002, 0x180003,
+  0x000004, 0x180005, 0x000006, 0x180007, 0x000008, 0x182009,
+  0x00000a, 0x18200b, 0x00000c, 0x18200d, 0x00000e, 0x18200f,
+  0x080000, 0x180001, 0x080002, 0x180003, 0x080004, 0x180005,
+  0x080006, 0x180007, 0x082008, 0x182009, 0x08200a, 0x18200b,
+  0x08200c, 0x18200d, 0x08200e, 0x18200f, 0x080200, 0x180201,
+  0x080202, 0x180203, 0x080204, 0x180205, 0x080206, 0x180207,
+  0x082208, 0x182209, 0x08220a, 0x18220b, 0x08220c, 0x18220d,
+  0x08220e, 0x18220f, 0x080000, 0x180001, 0x080002, 0x180003,
+  0x080004, 0x180005, 0x080006, 0x180007, 0x082008, 0x182009,
+  0x08200a, 0x18200b, 0x08200c, 0x18200d, 0x08200e, 0x18200f,
+  0x180040, 0x080041, 0x180042, 0x080043, 0x180044, 0x080045,
+  0x180046, 0x080047, 0x182048, 0x082049, 0x18204a, 0x08204b,
+  0x18204c, 0x08204d, 0x18204e, 0x08204f, 0x180000, 0x080001,
+  0x180002, 0x080003, 0x180004, 0x080005, 0x180006, 0x080007,
+  0x182008, 0x082009, 0x18200a, 0x08200b, 0x18200c, 0x08200d,
+  0x18200e, 0x08200f, 0x180000, 0x180000, 0x180002, 0x180002,
+  0x180004, 0x180004, 0x180006, 0x180006, 0x182008, 0x182008,
+  0x18200a, 0x18200a, 0x18200c, 0x18200c, 0x18200e, 0x18200e,
+  0x180000, 0x080001, 0x180002, 0x080003, 0x180004, 0x080005,
+  0x180006, 0x080007, 0x182008, 0x082009, 0x18200a, 0x08200b,
+  0x18200c, 0x08200d, 0x18200e, 0x08200f, 0x180000, 0x080001,
+  0x080001, 0x180002, 0x180004, 0x080005, 0x080005, 0x180006,
+  0x182008, 0x082009, 0x082009, 0x18200a, 0x18200c, 0x08200d,
+  0x08200d, 0x18200e, 0x180000, 0x080001, 0x180002, 0x080003,
+  0x180004, 0x080005, 0x180006, 0x080007, 0x182008, 0x082009,
+  0x18200a, 0x08200b, 0x18200c, 0x08200d, 0x18200e, 0x08200f,
+  0x080001, 0x180002, 0x180002, 0x080003, 0x080005, 0x180006,
+  0x180006, 0x080007, 0x082009, 0x18200a, 0x18200a, 0x08200b,
+  0x08200d, 0x18200e, 0x18200e, 0x08200f, 0x180000, 0x080001,
+  0x180002, 0x080003, 0x180004, 0x080005, 0x180006, 0x080007,
+  0x182008, 0x082009, 0x18200a, 0x08200b, 0x18200c, 0x08200d,
+  0x18200e, 0x08200f, 0x080001, 0x080001, 0x080001, 0x080001,
+  0x080005, 0x080005, 0x080005, 0x080005, 0x082009, 0x082009,
+  0x082009, 0x082009, 0x08200d, 0x08200d, 0x08200d, 0x08200d,
+  0x180000, 0x080001, 0x180002, 0x080003, 0x180004, 0x080005,
+  0x180006, 0x080007, 0x182008, 0x082009, 0x18200a, 0x08200b,
+  0x18200c, 0x08200d, 0x18200e, 0x08200f, 0x080401, 0x080401,
+  0x080403, 0x080403, 0x080405, 0x080405, 0x080407, 0x080407,
+  0x082409, 0x082409, 0x08240b, 0x08240b, 0x08240d, 0x08240d,
+  0x08240f, 0x08240f, 0x180000, 0x080001, 0x180002, 0x080003,
+  0x180004, 0x080005, 0x180006, 0x080007, 0x182008, 0x082009,
+  0x18200a, 0x08200b, 0x18200c, 0x08200d, 0x18200e, 0x08200f,
+  0x180000, 0x080401, 0x180002, 0x080403, 0x180004, 0x080405,
+  0x180006, 0x080407, 0x182008, 0x082409, 0x18200a, 0x08240b,
+  0x18200c, 0x08240d, 0x18200e, 0x08240f, 0x180000, 0x080001,
+  0x180002, 0x080003, 0x180004, 0x080005, 0x180006, 0x080007,
+  0x182008, 0x082009, 0x18200a, 0x08200b, 0x18200c, 0x08200d,
+  0x18200e, 0x08200f, 0x180000, 0x080401, 0x180002, 0x080403,
+  0x180004, 0x080405, 0x180006, 0x080407, 0x182008, 0x082409,
+  0x18200a, 0x08240b, 0x18200c, 0x08240d, 0x18200e, 0x08240f,
+  0x180000, 0x080001, 0x180002, 0x080003, 0x180004, 0x080005,
+  0x180006, 0x080007, 0x182008, 0x082009, 0x18200a, 0x08200b,
+  0x18200c, 0x08200d, 0x18200e, 0x08200f, 0x180800, 0x081801,
+  0x180802, 0x081803, 0x180804, 0x081805, 0x180806, 0x081807,
+  0x182828, 0x083829, 0x18282a, 0x08382b, 0x18282c, 0x08382d,
+  0x18282e, 0x08382f, 0x180000, 0x080001, 0x180002, 0x080003,
+  0x180004, 0x080005, 0x180006, 0x080007, 0x182008, 0x082009,
+  0x18200a, 0x08200b, 0x18200c, 0x08200d, 0x18200e, 0x08200f,
+  0x181800, 0x080801, 0x181802, 0x080803, 0x181804, 0x080805,
+  0x181806, 0x080807, 0x183828, 0x082829, 0x18382a, 0x08282b,
+  0x18382c, 0x08282d, 0x18382e, 0x08282f, 0x180000, 0x080001,
+  0x180002, 0x080003, 0x180004, 0x080005, 0x180006, 0x080007,
+  0x182008, 0x082009, 0x18200a, 0x08200b, 0x18200c, 0x08200d,
+  0x18200e, 0x08200f, 0x180000, 0x080001, 0x180002, 0x080003,
+  0x180000, 0x080001, 0x180002, 0x080003, 0x182008, 0x082009,
+  0x18200a, 0x08200b, 0x182008, 0x082009, 0x18200a, 0x08200b,
+  0x180000, 0x080001, 0x180002, 0x080003, 0x180004, 0x080005,
+  0x180006, 0x080007, 0x182008, 0x082009, 0x18200a, 0x08200b,
+  0x18200c, 0x08200d, 0x18200e, 0x08200f, 0x180000, 0x080001,
+  0x180002, 0x080003, 0x180004, 0x080005, 0x180006, 0x080007,
+  0x180000, 0x080001, 0x180002, 0x080003, 0x180004, 0x080005,
+  0x180006, 0x080007, 0x180000, 0x080001, 0x180002, 0x080003,
+  0x180004, 0x080005, 0x180006, 0x080007, 0x182008, 0x082009,
+  0x18200a, 0x08200b, 0x18200c, 0x08200d, 0x18200e, 0x08200f,
+  0x180080, 0x080081, 0x180082, 0x080083, 0x180084, 0x080085,
+  0x180086, 0x080087, 0x182088, 0x082089, 0x18208a, 0x08208b,
+  0x18208c, 0x08208d, 0x18208e, 0x08208f, 0x180000, 0x080001,
+  0x180002, 0x080003, 0x180004, 0x080005, 0x180006, 0x080007,
+  0x182008, 0x082009, 0x18200a, 0x08200b, 0x18200c, 0x08200d,
+  0x18200e, 0x08200f, 0x000100, 0x000101, 0x000102, 0x000103,
+  0x000104, 0x000105, 0x000106, 0x000107, 0x000108, 0x000109,
+  0x00010a, 0x00010b, 0x00010c, 0x00010d, 0x00010e, 0x00010f,
+  0x180000, 0x080001, 0x180002, 0x080003, 0x180004, 0x080005,
+  0x180006, 0x080007, 0x182008, 0x082009, 0x18200a, 0x08200b,
+  0x18200c, 0x08200d, 0x18200e, 0x08200f, 0x000000, 0x080001,
+  0x000002, 0x080003, 0x000004, 0x080005, 0x000006, 0x080007,
+  0x000008, 0x082009, 0x00000a, 0x08200b, 0x00000c, 0x08200d,
+  0x00000e, 0x08200f, 0x180000, 0x080001, 0x180002, 0x080003,
+  0x180004, 0x080005, 0x180006, 0x080007, 0x182008, 0x082009,
+  0x18200a, 0x08200b, 0x18200c, 0x08200d, 0x18200e, 0x08200f,
+  0x180200, 0x080201, 0x180202, 0x080203, 0x180204, 0x080205,
+  0x180206, 0x080207, 0x182208, 0x082209, 0x18220a, 0x08220b,
+  0x18220c, 0x08220d, 0x18220e, 0x08220f, 0x180000, 0x080001,
+  0x180002, 0x080003, 0x180004, 0x080005, 0x180006, 0x080007,
+  0x182008, 0x082009, 0x18200a, 0x08200b, 0x18200c, 0x08200d,
+  0x18200e, 0x08200f, 0x180040, 0x080041, 0x180042, 0x080043,
+  0x180044, 0x080045, 0x180046, 0x080047, 0x182048, 0x082049,
+  0x18204a, 0x08204b, 0x18204c, 0x08204d, 0x18204e, 0x08204f,
+  0x180000, 0x080001, 0x180002, 0x080003, 0x180004, 0x080005,
+  0x180006, 0x080007, 0x182008, 0x082009, 0x18200a, 0x08200b,
+  0x18200c, 0x08200d, 0x18200e, 0x08200f, 0x180000, 0x180000,
+  0x180002, 0x180002, 0x080005, 0x080005, 0x080007, 0x080007,
+  0x182008, 0x182008, 0x18200a, 0x18200a, 0x08200d, 0x08200d,
+  0x08200f, 0x08200f, 0x180000, 0x080001, 0x180002, 0x080003,
+  0x180004, 0x080005, 0x180006, 0x080007, 0x182008, 0x082009,
+  0x18200a, 0x08200b, 0x18200c, 0x08200d, 0x18200e, 0x08200f,
+  0x180000, 0x080001, 0x080001, 0x180002, 0x080005, 0x180006,
+  0x180006, 0x080007, 0x182008, 0x082009, 0x082009, 0x18200a,
+  0x08200d, 0x18200e, 0x18200e, 0x08200f, 0x180000, 0x080001,
+  0x180002, 0x080003, 0x180004, 0x080005, 0x180006, 0x080007,
+  0x182008, 0x082009, 0x18200a, 0x08200b, 0x18200c, 0x08200d,
+  0x18200e, 0x08200f, 0x080001, 0x180002, 0x180002, 0x080003,
+  0x180004, 0x080005, 0x080005, 0x180006, 0x082009, 0x18200a,
+  0x18200a, 0x08200b, 0x18200c, 0x08200d, 0x08200d, 0x18200e,
+  0x180000, 0x080001, 0x180002, 0x080003, 0x180004, 0x080005,
+  0x180006, 0x080007, 0x182008, 0x082009, 0x18200a, 0x08200b,
+  0x18200c, 0x08200d, 0x18200e, 0x08200f, 0x080001, 0x080001,
+  0x080001, 0x080001, 0x080005, 0x080005, 0x080005, 0x080005,
+  0x082009, 0x082009, 0x082009, 0x082009, 0x08200d, 0x08200d,
+  0x08200d, 0x08200d, 0x180000, 0x080001, 0x180002, 0x080003,
+  0x180004, 0x080005, 0x180006, 0x080007, 0x182008, 0x082009,
+  0x18200a, 0x08200b, 0x18200c, 0x08200d, 0x18200e, 0x08200f,
+  0x080401, 0x080401, 0x080403, 0x080403, 0x080405, 0x180004,
+  0x080407, 0x180006, 0x082409, 0x082409, 0x08240b, 0x08240b,
+  0x08240d, 0x18200c, 0x08240f, 0x18200e, 0x180000, 0x080001,
+  0x180002, 0x080003, 0x180004, 0x080005, 0x180006, 0x080007,
+  0x182008, 0x082009, 0x18200a, 0x08200b, 0x18200c, 0x08200d,
+  0x18200e, 0x08200f, 0x180000, 0x080401, 0x180002, 0x080403,
+  0x080405, 0x080405, 0x080407, 0x080407, 0x182008, 0x082409,
+  0x18200a, 0x08240b, 0x08240d, 0x08240d, 0x08240f, 0x08240f,
+  0x180000, 0x080001, 0x180002, 0x080003, 0x180004, 0x080005,
+  0x180006, 0x080007, 0x182008, 0x082009, 0x18200a, 0x08200b,
+  0x18200c, 0x08200d, 0x18200e, 0x08200f, 0x180000, 0x080401,
+  0x180002, 0x080403, 0x080405, 0x180004, 0x080407, 0x180006,
+  0x182008, 0x082409, 0x18200a, 0x08240b, 0x08240d, 0x18200c,
+  0x08240f, 0x18200e, 0x180000, 0x080001, 0x180002, 0x080003,
+  0x180004, 0x080005, 0x180006, 0x080007, 0x182008, 0x082009,
+  0x18200a, 0x08200b, 0x18200c, 0x08200d, 0x18200e, 0x08200f,
+  0x180800, 0x081801, 0x180802, 0x081803, 0x180804, 0x081805,
+  0x180806, 0x081807, 0x182828, 0x083829, 0x18282a, 0x08382b,
+  0x18282c, 0x08382d, 0x18282e, 0x08382f, 0x180000, 0x080001,
+  0x180002, 0x080003, 0x180004, 0x080005, 0x180006, 0x080007,
+  0x182008, 0x082009, 0x18200a, 0x08200b, 0x18200c, 0x08200d,
+  0x18200e, 0x08200f, 0x181800, 0x080801, 0x181802, 0x080803,
+  0x181804, 0x080805, 0x181806, 0x080807, 0x183828, 0x082829,
+  0x18382a, 0x08282b, 0x18382c, 0x08282d, 0x18382e, 0x08282f,
+  0x180000, 0x080001, 0x180002, 0x080003, 0x180004, 0x080005,
+  0x180006, 0x080007, 0x182008, 0x082009, 0x18200a, 0x08200b,
+  0x18200c, 0x08200d, 0x18200e, 0x08200f, 0x180004, 0x080005,
+  0x180006, 0x080007, 0x180004, 0x080005, 0x180006, 0x080007,
+  0x18200c, 0x08200d, 0x18200e, 0x08200f, 0x18200c, 0x08200d,
+  0x18200e, 0x08200f, 0x180000, 0x080001, 0x180002, 0x080003,
+  0x180004, 0x080005, 0x180006, 0x080007, 0x182008, 0x082009,
+  0x18200a, 0x08200b, 0x18200c, 0x08200d, 0x18200e, 0x08200f,
+  0x180000, 0x080001, 0x180002, 0x080003, 0x18200c, 0x08200d,
+  0x18200e, 0x08200f, 0x180000, 0x080001, 0x180002, 0x080003,
+  0x18200c, 0x08200d, 0x18200e, 0x08200f, 0x180000, 0x080001,
+  0x180002, 0x080003, 0x180004, 0x080005, 0x180006, 0x080007,
+  0x182008, 0x082009, 0x18200a, 0x08200b, 0x18200c, 0x08200d,
+  0x18200e, 0x08200f, 0x180080, 0x080081, 0x180082, 0x080083,
+  0x180084, 0x080085, 0x180086, 0x080087, 0x182088, 0x082089,
+  0x18208a, 0x08208b, 0x18208c, 0x08208d, 0x18208e, 0x08208f,
+  0x180000, 0x080001, 0x180002, 0x080003, 0x180004, 0x080005,
+  0x180006, 0x080007, 0x182008, 0x082009, 0x18200a, 0x08200b,
+  0x18200c, 0x08200d, 0x18200e, 0x08200f, 0x000100, 0x000101,
+  0x000102, 0x000103, 0x000104, 0x000105, 0x000106, 0x000107,
+  0x000108, 0x000109, 0x00010a, 0x00010b, 0x00010c, 0x00010d,
+  0x00010e, 0x00010f, 0x180000, 0x080001, 0x180002, 0x080003,
+  0x180004, 0x080005, 0x180006, 0x080007, 0x182008, 0x082009,
+  0x18200a, 0x08200b, 0x18200c, 0x08200d, 0x18200e, 0x08200f,
+  0x000000, 0x080001, 0x000002, 0x080003, 0x000004, 0x080005,
+  0x000006, 0x080007, 0x000008, 0x082009, 0x00000a, 0x08200b,
+  0x00000c, 0x08200d, 0x00000e, 0x08200f, 0x180000, 0x080001,
+  0x180002, 0x080003, 0x180004, 0x080005, 0x180006, 0x080007,
+  0x182008, 0x082009, 0x18200a, 0x08200b, 0x18200c, 0x08200d,
+  0x18200e, 0x08200f, 0x180200, 0x080201, 0x180202, 0x080203,
+  0x180204, 0x080205, 0x180206, 0x080207, 0x182208, 0x082209,
+  0x18220a, 0x08220b, 0x18220c, 0x08220d, 0x18220e, 0x08220f,
+  0x180000, 0x080001, 0x180002, 0x080003, 0x180004, 0x080005,
+  0x180006, 0x080007, 0x182008, 0x082009, 0x18200a, 0x08200b,
+  0x18200c, 0x08200d, 0x18200e, 0x08200f, 0x000040, 0x000041,
+  0x000042, 0x000043, 0x000040, 0x000041, 0x000042, 0x000043,
+  0x000048, 0x000049, 0x00004a, 0x00004b, 0x000048, 0x000049,
+  0x00004a, 0x00004b, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x000008, 0x000009,
+  0x00000a, 0x00000b, 0x000008, 0x000009, 0x00000a, 0x00000b,
+  0x000000, 0x000000, 0x000002, 0x000002, 0x000000, 0x000000,
+  0x000002, 0x000002, 0x000008, 0x000008, 0x00000a, 0x00000a,
+  0x000008, 0x000008, 0x00000a, 0x00000a, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x000008, 0x000009, 0x00000a, 0x00000b, 0x000008, 0x000009,
+  0x00000a, 0x00000b, 0x000000, 0x000001, 0x000001, 0x000002,
+  0x000000, 0x000001, 0x000001, 0x000002, 0x000008, 0x000009,
+  0x000009, 0x00000a, 0x000008, 0x000009, 0x000009, 0x00000a,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x000008, 0x000009, 0x00000a, 0x00000b,
+  0x000008, 0x000009, 0x00000a, 0x00000b, 0x000001, 0x000002,
+  0x000002, 0x000003, 0x000001, 0x000002, 0x000002, 0x000003,
+  0x000009, 0x00000a, 0x00000a, 0x00000b, 0x000009, 0x00000a,
+  0x00000a, 0x00000b, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x000008, 0x000009,
+  0x00000a, 0x00000b, 0x000008, 0x000009, 0x00000a, 0x00000b,
+  0x000001, 0x000001, 0x000001, 0x000001, 0x000001, 0x000001,
+  0x000001, 0x000001, 0x000009, 0x000009, 0x000009, 0x000009,
+  0x000009, 0x000009, 0x000009, 0x000009, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x000008, 0x000009, 0x00000a, 0x00000b, 0x000008, 0x000009,
+  0x00000a, 0x00000b, 0x000401, 0x000401, 0x000403, 0x000403,
+  0x000401, 0x000401, 0x000403, 0x000403, 0x000409, 0x000409,
+  0x00040b, 0x00040b, 0x000409, 0x000409, 0x00040b, 0x00040b,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x000008, 0x000009, 0x00000a, 0x00000b,
+  0x000008, 0x000009, 0x00000a, 0x00000b, 0x000000, 0x000401,
+  0x000002, 0x000403, 0x000000, 0x000401, 0x000002, 0x000403,
+  0x000008, 0x000409, 0x00000a, 0x00040b, 0x000008, 0x000409,
+  0x00000a, 0x00040b, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x000008, 0x000009,
+  0x00000a, 0x00000b, 0x000008, 0x000009, 0x00000a, 0x00000b,
+  0x000000, 0x000401, 0x000002, 0x000403, 0x000000, 0x000401,
+  0x000002, 0x000403, 0x000008, 0x000409, 0x00000a, 0x00040b,
+  0x000008, 0x000409, 0x00000a, 0x00040b, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x000008, 0x000009, 0x00000a, 0x00000b, 0x000008, 0x000009,
+  0x00000a, 0x00000b, 0x000800, 0x001801, 0x000802, 0x001803,
+  0x000800, 0x001801, 0x000802, 0x001803, 0x000828, 0x001829,
+  0x00082a, 0x00182b, 0x000828, 0x001829, 0x00082a, 0x00182b,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x000008, 0x000009, 0x00000a, 0x00000b,
+  0x000008, 0x000009, 0x00000a, 0x00000b, 0x001800, 0x000801,
+  0x001802, 0x000803, 0x001800, 0x000801, 0x001802, 0x000803,
+  0x001828, 0x000829, 0x00182a, 0x00082b, 0x001828, 0x000829,
+  0x00182a, 0x00082b, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x000008, 0x000009,
+  0x00000a, 0x00000b, 0x000008, 0x000009, 0x00000a, 0x00000b,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x000008, 0x000009, 0x00000a, 0x00000b,
+  0x000008, 0x000009, 0x00000a, 0x00000b, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x000008, 0x000009, 0x00000a, 0x00000b, 0x000008, 0x000009,
+  0x00000a, 0x00000b, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x000008, 0x000009, 0x00000a, 0x00000b,
+  0x000008, 0x000009, 0x00000a, 0x00000b, 0x000080, 0x000081,
+  0x000082, 0x000083, 0x000080, 0x000081, 0x000082, 0x000083,
+  0x000088, 0x000089, 0x00008a, 0x00008b, 0x000088, 0x000089,
+  0x00008a, 0x00008b, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x000008, 0x000009,
+  0x00000a, 0x00000b, 0x000008, 0x000009, 0x00000a, 0x00000b,
+  0x000100, 0x000101, 0x000102, 0x000103, 0x000104, 0x000105,
+  0x000106, 0x000107, 0x000108, 0x000109, 0x00010a, 0x00010b,
+  0x00010c, 0x00010d, 0x00010e, 0x00010f, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x000008, 0x000009, 0x00000a, 0x00000b, 0x000008, 0x000009,
+  0x00000a, 0x00000b, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x000004, 0x000001, 0x000006, 0x000003, 0x000008, 0x000009,
+  0x00000a, 0x00000b, 0x00000c, 0x000009, 0x00000e, 0x00000b,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x000008, 0x000009, 0x00000a, 0x00000b,
+  0x000008, 0x000009, 0x00000a, 0x00000b, 0x000200, 0x000201,
+  0x000202, 0x000203, 0x000200, 0x000201, 0x000202, 0x000203,
+  0x000208, 0x000209, 0x00020a, 0x00020b, 0x000208, 0x000209,
+  0x00020a, 0x00020b, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x000008, 0x000009,
+  0x00000a, 0x00000b, 0x000008, 0x000009, 0x00000a, 0x00000b,
+  0x000040, 0x000041, 0x000042, 0x000043, 0x000040, 0x000041,
+  0x000042, 0x000043, 0x000048, 0x000049, 0x00004a, 0x00004b,
+  0x000048, 0x000049, 0x00004a, 0x00004b, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x000008, 0x000009, 0x00000a, 0x00000b, 0x000008, 0x000009,
+  0x00000a, 0x00000b, 0x000000, 0x000000, 0x000002, 0x000002,
+  0x000001, 0x000001, 0x000003, 0x000003, 0x000008, 0x000008,
+  0x00000a, 0x00000a, 0x000009, 0x000009, 0x00000b, 0x00000b,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x000008, 0x000009, 0x00000a, 0x00000b,
+  0x000008, 0x000009, 0x00000a, 0x00000b, 0x000000, 0x000001,
+  0x000001, 0x000002, 0x000001, 0x000002, 0x000002, 0x000003,
+  0x000008, 0x000009, 0x000009, 0x00000a, 0x000009, 0x00000a,
+  0x00000a, 0x00000b, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x000008, 0x000009,
+  0x00000a, 0x00000b, 0x000008, 0x000009, 0x00000a, 0x00000b,
+  0x000001, 0x000002, 0x000002, 0x000003, 0x000000, 0x000001,
+  0x000001, 0x000002, 0x000009, 0x00000a, 0x00000a, 0x00000b,
+  0x000008, 0x000009, 0x000009, 0x00000a, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x000008, 0x000009, 0x00000a, 0x00000b, 0x000008, 0x000009,
+  0x00000a, 0x00000b, 0x000001, 0x000001, 0x000001, 0x000001,
+  0x000001, 0x000001, 0x000001, 0x000001, 0x000009, 0x000009,
+  0x000009, 0x000009, 0x000009, 0x000009, 0x000009, 0x000009,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x000008, 0x000009, 0x00000a, 0x00000b,
+  0x000008, 0x000009, 0x00000a, 0x00000b, 0x000401, 0x000401,
+  0x000403, 0x000403, 0x000401, 0x000000, 0x000403, 0x000002,
+  0x000409, 0x000409, 0x00040b, 0x00040b, 0x000409, 0x000008,
+  0x00040b, 0x00000a, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x000008, 0x000009,
+  0x00000a, 0x00000b, 0x000008, 0x000009, 0x00000a, 0x00000b,
+  0x000000, 0x000401, 0x000002, 0x000403, 0x000401, 0x000401,
+  0x000403, 0x000403, 0x000008, 0x000409, 0x00000a, 0x00040b,
+  0x000409, 0x000409, 0x00040b, 0x00040b, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x000008, 0x000009, 0x00000a, 0x00000b, 0x000008, 0x000009,
+  0x00000a, 0x00000b, 0x000000, 0x000401, 0x000002, 0x000403,
+  0x000401, 0x000000, 0x000403, 0x000002, 0x000008, 0x000409,
+  0x00000a, 0x00040b, 0x000409, 0x000008, 0x00040b, 0x00000a,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x000008, 0x000009, 0x00000a, 0x00000b,
+  0x000008, 0x000009, 0x00000a, 0x00000b, 0x000800, 0x001801,
+  0x000802, 0x001803, 0x000800, 0x001801, 0x000802, 0x001803,
+  0x000828, 0x001829, 0x00082a, 0x00182b, 0x000828, 0x001829,
+  0x00082a, 0x00182b, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x000008, 0x000009,
+  0x00000a, 0x00000b, 0x000008, 0x000009, 0x00000a, 0x00000b,
+  0x001800, 0x000801, 0x001802, 0x000803, 0x001800, 0x000801,
+  0x001802, 0x000803, 0x001828, 0x000829, 0x00182a, 0x00082b,
+  0x001828, 0x000829, 0x00182a, 0x00082b, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x000008, 0x000009, 0x00000a, 0x00000b, 0x000008, 0x000009,
+  0x00000a, 0x00000b, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x000008, 0x000009,
+  0x00000a, 0x00000b, 0x000008, 0x000009, 0x00000a, 0x00000b,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x000008, 0x000009, 0x00000a, 0x00000b,
+  0x000008, 0x000009, 0x00000a, 0x00000b, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x000008, 0x000009, 0x00000a, 0x00000b,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x000008, 0x000009,
+  0x00000a, 0x00000b, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x000008, 0x000009,
+  0x00000a, 0x00000b, 0x000008, 0x000009, 0x00000a, 0x00000b,
+  0x000080, 0x000081, 0x000082, 0x000083, 0x000080, 0x000081,
+  0x000082, 0x000083, 0x000088, 0x000089, 0x00008a, 0x00008b,
+  0x000088, 0x000089, 0x00008a, 0x00008b, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x000008, 0x000009, 0x00000a, 0x00000b, 0x000008, 0x000009,
+  0x00000a, 0x00000b, 0x000100, 0x000101, 0x000102, 0x000103,
+  0x000104, 0x000105, 0x000106, 0x000107, 0x000108, 0x000109,
+  0x00010a, 0x00010b, 0x00010c, 0x00010d, 0x00010e, 0x00010f,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x000008, 0x000009, 0x00000a, 0x00000b,
+  0x000008, 0x000009, 0x00000a, 0x00000b, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x000004, 0x000001, 0x000006, 0x000003,
+  0x000008, 0x000009, 0x00000a, 0x00000b, 0x00000c, 0x000009,
+  0x00000e, 0x00000b, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x000008, 0x000009,
+  0x00000a, 0x00000b, 0x000008, 0x000009, 0x00000a, 0x00000b,
+  0x000200, 0x000201, 0x000202, 0x000203, 0x000200, 0x000201,
+  0x000202, 0x000203, 0x000208, 0x000209, 0x00020a, 0x00020b,
+  0x000208, 0x000209, 0x00020a, 0x00020b, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x000008, 0x000009, 0x00000a, 0x00000b, 0x000008, 0x000009,
+  0x00000a, 0x00000b, 0x000040, 0x000041, 0x000042, 0x000043,
+  0x000044, 0x000045, 0x000046, 0x000047, 0x000040, 0x000041,
+  0x000042, 0x000043, 0x000044, 0x000045, 0x000046, 0x000047,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x000004, 0x000005,
+  0x000006, 0x000007, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x000004, 0x000005, 0x000006, 0x000007, 0x000000, 0x000000,
+  0x000002, 0x000002, 0x000004, 0x000004, 0x000006, 0x000006,
+  0x000000, 0x000000, 0x000002, 0x000002, 0x000004, 0x000004,
+  0x000006, 0x000006, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x000004, 0x000005, 0x000006, 0x000007, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x000004, 0x000005, 0x000006, 0x000007,
+  0x000000, 0x000001, 0x000001, 0x000002, 0x000004, 0x000005,
+  0x000005, 0x000006, 0x000000, 0x000001, 0x000001, 0x000002,
+  0x000004, 0x000005, 0x000005, 0x000006, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x000004, 0x000005, 0x000006, 0x000007,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x000004, 0x000005,
+  0x000006, 0x000007, 0x000001, 0x000002, 0x000002, 0x000003,
+  0x000005, 0x000006, 0x000006, 0x000007, 0x000001, 0x000002,
+  0x000002, 0x000003, 0x000005, 0x000006, 0x000006, 0x000007,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x000004, 0x000005,
+  0x000006, 0x000007, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x000004, 0x000005, 0x000006, 0x000007, 0x000001, 0x000001,
+  0x000001, 0x000001, 0x000005, 0x000005, 0x000005, 0x000005,
+  0x000001, 0x000001, 0x000001, 0x000001, 0x000005, 0x000005,
+  0x000005, 0x000005, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x000004, 0x000005, 0x000006, 0x000007, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x000004, 0x000005, 0x000006, 0x000007,
+  0x000401, 0x000401, 0x000403, 0x000403, 0x000405, 0x000405,
+  0x000407, 0x000407, 0x000401, 0x000401, 0x000403, 0x000403,
+  0x000405, 0x000405, 0x000407, 0x000407, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x000004, 0x000005, 0x000006, 0x000007,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x000004, 0x000005,
+  0x000006, 0x000007, 0x000000, 0x000401, 0x000002, 0x000403,
+  0x000004, 0x000405, 0x000006, 0x000407, 0x000000, 0x000401,
+  0x000002, 0x000403, 0x000004, 0x000405, 0x000006, 0x000407,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x000004, 0x000005,
+  0x000006, 0x000007, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x000004, 0x000005, 0x000006, 0x000007, 0x000000, 0x000401,
+  0x000002, 0x000403, 0x000004, 0x000405, 0x000006, 0x000407,
+  0x000000, 0x000401, 0x000002, 0x000403, 0x000004, 0x000405,
+  0x000006, 0x000407, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x000004, 0x000005, 0x000006, 0x000007, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x000004, 0x000005, 0x000006, 0x000007,
+  0x000800, 0x001801, 0x000802, 0x001803, 0x000804, 0x001805,
+  0x000806, 0x001807, 0x000820, 0x001821, 0x000822, 0x001823,
+  0x000824, 0x001825, 0x000826, 0x001827, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x000004, 0x000005, 0x000006, 0x000007,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x000004, 0x000005,
+  0x000006, 0x000007, 0x001800, 0x000801, 0x001802, 0x000803,
+  0x001804, 0x000805, 0x001806, 0x000807, 0x001820, 0x000821,
+  0x001822, 0x000823, 0x001824, 0x000825, 0x001826, 0x000827,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x000004, 0x000005,
+  0x000006, 0x000007, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x000004, 0x000005, 0x000006, 0x000007, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x000004, 0x000005, 0x000006, 0x000007, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x000004, 0x000005, 0x000006, 0x000007,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x000004, 0x000005,
+  0x000006, 0x000007, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x000004, 0x000005, 0x000006, 0x000007, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x000004, 0x000005, 0x000006, 0x000007,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x000004, 0x000005,
+  0x000006, 0x000007, 0x000080, 0x000081, 0x000082, 0x000083,
+  0x000084, 0x000085, 0x000086, 0x000087, 0x000080, 0x000081,
+  0x000082, 0x000083, 0x000084, 0x000085, 0x000086, 0x000087,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x000004, 0x000005,
+  0x000006, 0x000007, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x000004, 0x000005, 0x000006, 0x000007, 0x000100, 0x000101,
+  0x000102, 0x000103, 0x000104, 0x000105, 0x000106, 0x000107,
+  0x000108, 0x000109, 0x00010a, 0x00010b, 0x00010c, 0x00010d,
+  0x00010e, 0x00010f, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x000004, 0x000005, 0x000006, 0x000007, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x000004, 0x000005, 0x000006, 0x000007,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x000004, 0x000005,
+  0x000006, 0x000007, 0x000008, 0x000001, 0x00000a, 0x000003,
+  0x00000c, 0x000005, 0x00000e, 0x000007, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x000004, 0x000005, 0x000006, 0x000007,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x000004, 0x000005,
+  0x000006, 0x000007, 0x000200, 0x000201, 0x000202, 0x000203,
+  0x000204, 0x000205, 0x000206, 0x000207, 0x000200, 0x000201,
+  0x000202, 0x000203, 0x000204, 0x000205, 0x000206, 0x000207,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x000004, 0x000005,
+  0x000006, 0x000007, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x000004, 0x000005, 0x000006, 0x000007, 0x000040, 0x000041,
+  0x000042, 0x000043, 0x000044, 0x000045, 0x000046, 0x000047,
+  0x000040, 0x000041, 0x000042, 0x000043, 0x000044, 0x000045,
+  0x000046, 0x000047, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x000004, 0x000005, 0x000006, 0x000007, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x000004, 0x000005, 0x000006, 0x000007,
+  0x000000, 0x000000, 0x000002, 0x000002, 0x000005, 0x000005,
+  0x000007, 0x000007, 0x000000, 0x000000, 0x000002, 0x000002,
+  0x000005, 0x000005, 0x000007, 0x000007, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x000004, 0x000005, 0x000006, 0x000007,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x000004, 0x000005,
+  0x000006, 0x000007, 0x000000, 0x000001, 0x000001, 0x000002,
+  0x000005, 0x000006, 0x000006, 0x000007, 0x000000, 0x000001,
+  0x000001, 0x000002, 0x000005, 0x000006, 0x000006, 0x000007,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x000004, 0x000005,
+  0x000006, 0x000007, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x000004, 0x000005, 0x000006, 0x000007, 0x000001, 0x000002,
+  0x000002, 0x000003, 0x000004, 0x000005, 0x000005, 0x000006,
+  0x000001, 0x000002, 0x000002, 0x000003, 0x000004, 0x000005,
+  0x000005, 0x000006, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x000004, 0x000005, 0x000006, 0x000007, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x000004, 0x000005, 0x000006, 0x000007,
+  0x000001, 0x000001, 0x000001, 0x000001, 0x000005, 0x000005,
+  0x000005, 0x000005, 0x000001, 0x000001, 0x000001, 0x000001,
+  0x000005, 0x000005, 0x000005, 0x000005, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x000004, 0x000005, 0x000006, 0x000007,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x000004, 0x000005,
+  0x000006, 0x000007, 0x000401, 0x000401, 0x000403, 0x000403,
+  0x000405, 0x000004, 0x000407, 0x000006, 0x000401, 0x000401,
+  0x000403, 0x000403, 0x000405, 0x000004, 0x000407, 0x000006,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x000004, 0x000005,
+  0x000006, 0x000007, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x000004, 0x000005, 0x000006, 0x000007, 0x000000, 0x000401,
+  0x000002, 0x000403, 0x000405, 0x000405, 0x000407, 0x000407,
+  0x000000, 0x000401, 0x000002, 0x000403, 0x000405, 0x000405,
+  0x000407, 0x000407, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x000004, 0x000005, 0x000006, 0x000007, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x000004, 0x000005, 0x000006, 0x000007,
+  0x000000, 0x000401, 0x000002, 0x000403, 0x000405, 0x000004,
+  0x000407, 0x000006, 0x000000, 0x000401, 0x000002, 0x000403,
+  0x000405, 0x000004, 0x000407, 0x000006, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x000004, 0x000005, 0x000006, 0x000007,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x000004, 0x000005,
+  0x000006, 0x000007, 0x000800, 0x001801, 0x000802, 0x001803,
+  0x000804, 0x001805, 0x000806, 0x001807, 0x000820, 0x001821,
+  0x000822, 0x001823, 0x000824, 0x001825, 0x000826, 0x001827,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x000004, 0x000005,
+  0x000006, 0x000007, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x000004, 0x000005, 0x000006, 0x000007, 0x001800, 0x000801,
+  0x001802, 0x000803, 0x001804, 0x000805, 0x001806, 0x000807,
+  0x001820, 0x000821, 0x001822, 0x000823, 0x001824, 0x000825,
+  0x001826, 0x000827, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x000004, 0x000005, 0x000006, 0x000007, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x000004, 0x000005, 0x000006, 0x000007,
+  0x000004, 0x000005, 0x000006, 0x000007, 0x000004, 0x000005,
+  0x000006, 0x000007, 0x000004, 0x000005, 0x000006, 0x000007,
+  0x000004, 0x000005, 0x000006, 0x000007, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x000004, 0x000005, 0x000006, 0x000007,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x000004, 0x000005,
+  0x000006, 0x000007, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x000004, 0x000005, 0x000006, 0x000007, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x000004, 0x000005, 0x000006, 0x000007,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x000004, 0x000005,
+  0x000006, 0x000007, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x000004, 0x000005, 0x000006, 0x000007, 0x000080, 0x000081,
+  0x000082, 0x000083, 0x000084, 0x000085, 0x000086, 0x000087,
+  0x000080, 0x000081, 0x000082, 0x000083, 0x000084, 0x000085,
+  0x000086, 0x000087, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x000004, 0x000005, 0x000006, 0x000007, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x000004, 0x000005, 0x000006, 0x000007,
+  0x000100, 0x000101, 0x000102, 0x000103, 0x000104, 0x000105,
+  0x000106, 0x000107, 0x000108, 0x000109, 0x00010a, 0x00010b,
+  0x00010c, 0x00010d, 0x00010e, 0x00010f, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x000004, 0x000005, 0x000006, 0x000007,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x000004, 0x000005,
+  0x000006, 0x000007, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x000004, 0x000005, 0x000006, 0x000007, 0x000008, 0x000001,
+  0x00000a, 0x000003, 0x00000c, 0x000005, 0x00000e, 0x000007,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x000004, 0x000005,
+  0x000006, 0x000007, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x000004, 0x000005, 0x000006, 0x000007, 0x000200, 0x000201,
+  0x000202, 0x000203, 0x000204, 0x000205, 0x000206, 0x000207,
+  0x000200, 0x000201, 0x000202, 0x000203, 0x000204, 0x000205,
+  0x000206, 0x000207, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x000004, 0x000005, 0x000006, 0x000007, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x000004, 0x000005, 0x000006, 0x000007,
+  0x008040, 0x008041, 0x008042, 0x008043, 0x008044, 0x008045,
+  0x008046, 0x008047, 0x008048, 0x008049, 0x00804a, 0x00804b,
+  0x00804c, 0x00804d, 0x00804e, 0x00804f, 0x008000, 0x008001,
+  0x008002, 0x008003, 0x008004, 0x008005, 0x008006, 0x008007,
+  0x008008, 0x008009, 0x00800a, 0x00800b, 0x00800c, 0x00800d,
+  0x00800e, 0x00800f, 0x008000, 0x008000, 0x008002, 0x008002,
+  0x008004, 0x008004, 0x008006, 0x008006, 0x008008, 0x008008,
+  0x00800a, 0x00800a, 0x00800c, 0x00800c, 0x00800e, 0x00800e,
+  0x008000, 0x008001, 0x008002, 0x008003, 0x008004, 0x008005,
+  0x008006, 0x008007, 0x008008, 0x008009, 0x00800a, 0x00800b,
+  0x00800c, 0x00800d, 0x00800e, 0x00800f, 0x008000, 0x008001,
+  0x008001, 0x008002, 0x008004, 0x008005, 0x008005, 0x008006,
+  0x008008, 0x008009, 0x008009, 0x00800a, 0x00800c, 0x00800d,
+  0x00800d, 0x00800e, 0x008000, 0x008001, 0x008002, 0x008003,
+  0x008004, 0x008005, 0x008006, 0x008007, 0x008008, 0x008009,
+  0x00800a, 0x00800b, 0x00800c, 0x00800d, 0x00800e, 0x00800f,
+  0x008001, 0x008002, 0x008002, 0x008003, 0x008005, 0x008006,
+  0x008006, 0x008007, 0x008009, 0x00800a, 0x00800a, 0x00800b,
+  0x00800d, 0x00800e, 0x00800e, 0x00800f, 0x008000, 0x008001,
+  0x008002, 0x008003, 0x008004, 0x008005, 0x008006, 0x008007,
+  0x008008, 0x008009, 0x00800a, 0x00800b, 0x00800c, 0x00800d,
+  0x00800e, 0x00800f, 0x008001, 0x008001, 0x008001, 0x008001,
+  0x008005, 0x008005, 0x008005, 0x008005, 0x008009, 0x008009,
+  0x008009, 0x008009, 0x00800d, 0x00800d, 0x00800d, 0x00800d,
+  0x008000, 0x008001, 0x008002, 0x008003, 0x008004, 0x008005,
+  0x008006, 0x008007, 0x008008, 0x008009, 0x00800a, 0x00800b,
+  0x00800c, 0x00800d, 0x00800e, 0x00800f, 0x008401, 0x008401,
+  0x008403, 0x008403, 0x008405, 0x008405, 0x008407, 0x008407,
+  0x008409, 0x008409, 0x00840b, 0x00840b, 0x00840d, 0x00840d,
+  0x00840f, 0x00840f, 0x008000, 0x008001, 0x008002, 0x008003,
+  0x008004, 0x008005, 0x008006, 0x008007, 0x008008, 0x008009,
+  0x00800a, 0x00800b, 0x00800c, 0x00800d, 0x00800e, 0x00800f,
+  0x008000, 0x008401, 0x008002, 0x008403, 0x008004, 0x008405,
+  0x008006, 0x008407, 0x008008, 0x008409, 0x00800a, 0x00840b,
+  0x00800c, 0x00840d, 0x00800e, 0x00840f, 0x008000, 0x008001,
+  0x008002, 0x008003, 0x008004, 0x008005, 0x008006, 0x008007,
+  0x008008, 0x008009, 0x00800a, 0x00800b, 0x00800c, 0x00800d,
+  0x00800e, 0x00800f, 0x008000, 0x008401, 0x008002, 0x008403,
+  0x008004, 0x008405, 0x008006, 0x008407, 0x008008, 0x008409,
+  0x00800a, 0x00840b, 0x00800c, 0x00840d, 0x00800e, 0x00840f,
+  0x008000, 0x008001, 0x008002, 0x008003, 0x008004, 0x008005,
+  0x008006, 0x008007, 0x008008, 0x008009, 0x00800a, 0x00800b,
+  0x00800c, 0x00800d, 0x00800e, 0x00800f, 0x008800, 0x009801,
+  0x008802, 0x009803, 0x008804, 0x009805, 0x008806, 0x009807,
+  0x008828, 0x009829, 0x00882a, 0x00982b, 0x00882c, 0x00982d,
+  0x00882e, 0x00982f, 0x008000, 0x008001, 0x008002, 0x008003,
+  0x008004, 0x008005, 0x008006, 0x008007, 0x008008, 0x008009,
+  0x00800a, 0x00800b, 0x00800c, 0x00800d, 0x00800e, 0x00800f,
+  0x009800, 0x008801, 0x009802, 0x008803, 0x009804, 0x008805,
+  0x009806, 0x008807, 0x009828, 0x008829, 0x00982a, 0x00882b,
+  0x00982c, 0x00882d, 0x00982e, 0x00882f, 0x008000, 0x008001,
+  0x008002, 0x008003, 0x008004, 0x008005, 0x008006, 0x008007,
+  0x008008, 0x008009, 0x00800a, 0x00800b, 0x00800c, 0x00800d,
+  0x00800e, 0x00800f, 0x008000, 0x008001, 0x008002, 0x008003,
+  0x008000, 0x008001, 0x008002, 0x008003, 0x008008, 0x008009,
+  0x00800a, 0x00800b, 0x008008, 0x008009, 0x00800a, 0x00800b,
+  0x008000, 0x008001, 0x008002, 0x008003, 0x008004, 0x008005,
+  0x008006, 0x008007, 0x008008, 0x008009, 0x00800a, 0x00800b,
+  0x00800c, 0x00800d, 0x00800e, 0x00800f, 0x008000, 0x008001,
+  0x008002, 0x008003, 0x008004, 0x008005, 0x008006, 0x008007,
+  0x008000, 0x008001, 0x008002, 0x008003, 0x008004, 0x008005,
+  0x008006, 0x008007, 0x008000, 0x008001, 0x008002, 0x008003,
+  0x008004, 0x008005, 0x008006, 0x008007, 0x008008, 0x008009,
+  0x00800a, 0x00800b, 0x00800c, 0x00800d, 0x00800e, 0x00800f,
+  0x008080, 0x008081, 0x008082, 0x008083, 0x008084, 0x008085,
+  0x008086, 0x008087, 0x008088, 0x008089, 0x00808a, 0x00808b,
+  0x00808c, 0x00808d, 0x00808e, 0x00808f, 0x008000, 0x008001,
+  0x008002, 0x008003, 0x008004, 0x008005, 0x008006, 0x008007,
+  0x008008, 0x008009, 0x00800a, 0x00800b, 0x00800c, 0x00800d,
+  0x00800e, 0x00800f, 0x000100, 0x000101, 0x000102, 0x000103,
+  0x000104, 0x000105, 0x000106, 0x000107, 0x000108, 0x000109,
+  0x00010a, 0x00010b, 0x00010c, 0x00010d, 0x00010e, 0x00010f,
+  0x008000, 0x008001, 0x008002, 0x008003, 0x008004, 0x008005,
+  0x008006, 0x008007, 0x008008, 0x008009, 0x00800a, 0x00800b,
+  0x00800c, 0x00800d, 0x00800e, 0x00800f, 0x000000, 0x008001,
+  0x000002, 0x008003, 0x000004, 0x008005, 0x000006, 0x008007,
+  0x000008, 0x008009, 0x00000a, 0x00800b, 0x00000c, 0x00800d,
+  0x00000e, 0x00800f, 0x008000, 0x008001, 0x008002, 0x008003,
+  0x008004, 0x008005, 0x008006, 0x008007, 0x008008, 0x008009,
+  0x00800a, 0x00800b, 0x00800c, 0x00800d, 0x00800e, 0x00800f,
+  0x008200, 0x008201, 0x008202, 0x008203, 0x008204, 0x008205,
+  0x008206, 0x008207, 0x008208, 0x008209, 0x00820a, 0x00820b,
+  0x00820c, 0x00820d, 0x00820e, 0x00820f, 0x008000, 0x008001,
+  0x008002, 0x008003, 0x008004, 0x008005, 0x008006, 0x008007,
+  0x008008, 0x008009, 0x00800a, 0x00800b, 0x00800c, 0x00800d,
+  0x00800e, 0x00800f, 0x008040, 0x008041, 0x008042, 0x008043,
+  0x008044, 0x008045, 0x008046, 0x008047, 0x008048, 0x008049,
+  0x00804a, 0x00804b, 0x00804c, 0x00804d, 0x00804e, 0x00804f,
+  0x008000, 0x008001, 0x008002, 0x008003, 0x008004, 0x008005,
+  0x008006, 0x008007, 0x008008, 0x008009, 0x00800a, 0x00800b,
+  0x00800c, 0x00800d, 0x00800e, 0x00800f, 0x008000, 0x008000,
+  0x008002, 0x008002, 0x008005, 0x008005, 0x008007, 0x008007,
+  0x008008, 0x008008, 0x00800a, 0x00800a, 0x00800d, 0x00800d,
+  0x00800f, 0x00800f, 0x008000, 0x008001, 0x008002, 0x008003,
+  0x008004, 0x008005, 0x008006, 0x008007, 0x008008, 0x008009,
+  0x00800a, 0x00800b, 0x00800c, 0x00800d, 0x00800e, 0x00800f,
+  0x008000, 0x008001, 0x008001, 0x008002, 0x008005, 0x008006,
+  0x008006, 0x008007, 0x008008, 0x008009, 0x008009, 0x00800a,
+  0x00800d, 0x00800e, 0x00800e, 0x00800f, 0x008000, 0x008001,
+  0x008002, 0x008003, 0x008004, 0x008005, 0x008006, 0x008007,
+  0x008008, 0x008009, 0x00800a, 0x00800b, 0x00800c, 0x00800d,
+  0x00800e, 0x00800f, 0x008001, 0x008002, 0x008002, 0x008003,
+  0x008004, 0x008005, 0x008005, 0x008006, 0x008009, 0x00800a,
+  0x00800a, 0x00800b, 0x00800c, 0x00800d, 0x00800d, 0x00800e,
+  0x008000, 0x008001, 0x008002, 0x008003, 0x008004, 0x008005,
+  0x008006, 0x008007, 0x008008, 0x008009, 0x00800a, 0x00800b,
+  0x00800c, 0x00800d, 0x00800e, 0x00800f, 0x008001, 0x008001,
+  0x008001, 0x008001, 0x008005, 0x008005, 0x008005, 0x008005,
+  0x008009, 0x008009, 0x008009, 0x008009, 0x00800d, 0x00800d,
+  0x00800d, 0x00800d, 0x008000, 0x008001, 0x008002, 0x008003,
+  0x008004, 0x008005, 0x008006, 0x008007, 0x008008, 0x008009,
+  0x00800a, 0x00800b, 0x00800c, 0x00800d, 0x00800e, 0x00800f,
+  0x008401, 0x008401, 0x008403, 0x008403, 0x008405, 0x008004,
+  0x008407, 0x008006, 0x008409, 0x008409, 0x00840b, 0x00840b,
+  0x00840d, 0x00800c, 0x00840f, 0x00800e, 0x008000, 0x008001,
+  0x008002, 0x008003, 0x008004, 0x008005, 0x008006, 0x008007,
+  0x008008, 0x008009, 0x00800a, 0x00800b, 0x00800c, 0x00800d,
+  0x00800e, 0x00800f, 0x008000, 0x008401, 0x008002, 0x008403,
+  0x008405, 0x008405, 0x008407, 0x008407, 0x008008, 0x008409,
+  0x00800a, 0x00840b, 0x00840d, 0x00840d, 0x00840f, 0x00840f,
+  0x008000, 0x008001, 0x008002, 0x008003, 0x008004, 0x008005,
+  0x008006, 0x008007, 0x008008, 0x008009, 0x00800a, 0x00800b,
+  0x00800c, 0x00800d, 0x00800e, 0x00800f, 0x008000, 0x008401,
+  0x008002, 0x008403, 0x008405, 0x008004, 0x008407, 0x008006,
+  0x008008, 0x008409, 0x00800a, 0x00840b, 0x00840d, 0x00800c,
+  0x00840f, 0x00800e, 0x008000, 0x008001, 0x008002, 0x008003,
+  0x008004, 0x008005, 0x008006, 0x008007, 0x008008, 0x008009,
+  0x00800a, 0x00800b, 0x00800c, 0x00800d, 0x00800e, 0x00800f,
+  0x008800, 0x009801, 0x008802, 0x009803, 0x008804, 0x009805,
+  0x008806, 0x009807, 0x008828, 0x009829, 0x00882a, 0x00982b,
+  0x00882c, 0x00982d, 0x00882e, 0x00982f, 0x008000, 0x008001,
+  0x008002, 0x008003, 0x008004, 0x008005, 0x008006, 0x008007,
+  0x008008, 0x008009, 0x00800a, 0x00800b, 0x00800c, 0x00800d,
+  0x00800e, 0x00800f, 0x009800, 0x008801, 0x009802, 0x008803,
+  0x009804, 0x008805, 0x009806, 0x008807, 0x009828, 0x008829,
+  0x00982a, 0x00882b, 0x00982c, 0x00882d, 0x00982e, 0x00882f,
+  0x008000, 0x008001, 0x008002, 0x008003, 0x008004, 0x008005,
+  0x008006, 0x008007, 0x008008, 0x008009, 0x00800a, 0x00800b,
+  0x00800c, 0x00800d, 0x00800e, 0x00800f, 0x008004, 0x008005,
+  0x008006, 0x008007, 0x008004, 0x008005, 0x008006, 0x008007,
+  0x00800c, 0x00800d, 0x00800e, 0x00800f, 0x00800c, 0x00800d,
+  0x00800e, 0x00800f, 0x008000, 0x008001, 0x008002, 0x008003,
+  0x008004, 0x008005, 0x008006, 0x008007, 0x008008, 0x008009,
+  0x00800a, 0x00800b, 0x00800c, 0x00800d, 0x00800e, 0x00800f,
+  0x008000, 0x008001, 0x008002, 0x008003, 0x00800c, 0x00800d,
+  0x00800e, 0x00800f, 0x008000, 0x008001, 0x008002, 0x008003,
+  0x00800c, 0x00800d, 0x00800e, 0x00800f, 0x008000, 0x008001,
+  0x008002, 0x008003, 0x008004, 0x008005, 0x008006, 0x008007,
+  0x008008, 0x008009, 0x00800a, 0x00800b, 0x00800c, 0x00800d,
+  0x00800e, 0x00800f, 0x008080, 0x008081, 0x008082, 0x008083,
+  0x008084, 0x008085, 0x008086, 0x008087, 0x008088, 0x008089,
+  0x00808a, 0x00808b, 0x00808c, 0x00808d, 0x00808e, 0x00808f,
+  0x008000, 0x008001, 0x008002, 0x008003, 0x008004, 0x008005,
+  0x008006, 0x008007, 0x008008, 0x008009, 0x00800a, 0x00800b,
+  0x00800c, 0x00800d, 0x00800e, 0x00800f, 0x000100, 0x000101,
+  0x000102, 0x000103, 0x000104, 0x000105, 0x000106, 0x000107,
+  0x000108, 0x000109, 0x00010a, 0x00010b, 0x00010c, 0x00010d,
+  0x00010e, 0x00010f, 0x008000, 0x008001, 0x008002, 0x008003,
+  0x008004, 0x008005, 0x008006, 0x008007, 0x008008, 0x008009,
+  0x00800a, 0x00800b, 0x00800c, 0x00800d, 0x00800e, 0x00800f,
+  0x000000, 0x008001, 0x000002, 0x008003, 0x000004, 0x008005,
+  0x000006, 0x008007, 0x000008, 0x008009, 0x00000a, 0x00800b,
+  0x00000c, 0x00800d, 0x00000e, 0x00800f, 0x008000, 0x008001,
+  0x008002, 0x008003, 0x008004, 0x008005, 0x008006, 0x008007,
+  0x008008, 0x008009, 0x00800a, 0x00800b, 0x00800c, 0x00800d,
+  0x00800e, 0x00800f, 0x008200, 0x008201, 0x008202, 0x008203,
+  0x008204, 0x008205, 0x008206, 0x008207, 0x008208, 0x008209,
+  0x00820a, 0x00820b, 0x00820c, 0x00820d, 0x00820e, 0x00820f,
+  0x008000, 0x008001, 0x008002, 0x008003, 0x008004, 0x008005,
+  0x008006, 0x008007, 0x008008, 0x008009, 0x00800a, 0x00800b,
+  0x00800c, 0x00800d, 0x00800e, 0x00800f, 0x010050, 0x010051,
+  0x010052, 0x010053, 0x010054, 0x010055, 0x010056, 0x010057,
+  0x010058, 0x010059, 0x01005a, 0x01005b, 0x01005c, 0x01005d,
+  0x01005e, 0x01005f, 0x010010, 0x010011, 0x010012, 0x010013,
+  0x010014, 0x010015, 0x010016, 0x010017, 0x010018, 0x010019,
+  0x01001a, 0x01001b, 0x01001c, 0x01001d, 0x01001e, 0x01001f,
+  0x010010, 0x010010, 0x010012, 0x010012, 0x010014, 0x010014,
+  0x010016, 0x010016, 0x010018, 0x010018, 0x01001a, 0x01001a,
+  0x01001c, 0x01001c, 0x01001e, 0x01001e, 0x010010, 0x010011,
+  0x010012, 0x010013, 0x010014, 0x010015, 0x010016, 0x010017,
+  0x010018, 0x010019, 0x01001a, 0x01001b, 0x01001c, 0x01001d,
+  0x01001e, 0x01001f, 0x010010, 0x010011, 0x010011, 0x010012,
+  0x010014, 0x010015, 0x010015, 0x010016, 0x010018, 0x010019,
+  0x010019, 0x01001a, 0x01001c, 0x01001d, 0x01001d, 0x01001e,
+  0x010010, 0x010011, 0x010012, 0x010013, 0x010014, 0x010015,
+  0x010016, 0x010017, 0x010018, 0x010019, 0x01001a, 0x01001b,
+  0x01001c, 0x01001d, 0x01001e, 0x01001f, 0x010011, 0x010012,
+  0x010012, 0x010013, 0x010015, 0x010016, 0x010016, 0x010017,
+  0x010019, 0x01001a, 0x01001a, 0x01001b, 0x01001d, 0x01001e,
+  0x01001e, 0x01001f, 0x010010, 0x010011, 0x010012, 0x010013,
+  0x010014, 0x010015, 0x010016, 0x010017, 0x010018, 0x010019,
+  0x01001a, 0x01001b, 0x01001c, 0x01001d, 0x01001e, 0x01001f,
+  0x010011, 0x010011, 0x010011, 0x010011, 0x010015, 0x010015,
+  0x010015, 0x010015, 0x010019, 0x010019, 0x010019, 0x010019,
+  0x01001d, 0x01001d, 0x01001d, 0x01001d, 0x010010, 0x010011,
+  0x010012, 0x010013, 0x010014, 0x010015, 0x010016, 0x010017,
+  0x010018, 0x010019, 0x01001a, 0x01001b, 0x01001c, 0x01001d,
+  0x01001e, 0x01001f, 0x010411, 0x010411, 0x010413, 0x010413,
+  0x010415, 0x010415, 0x010417, 0x010417, 0x010419, 0x010419,
+  0x01041b, 0x01041b, 0x01041d, 0x01041d, 0x01041f, 0x01041f,
+  0x010010, 0x010011, 0x010012, 0x010013, 0x010014, 0x010015,
+  0x010016, 0x010017, 0x010018, 0x010019, 0x01001a, 0x01001b,
+  0x01001c, 0x01001d, 0x01001e, 0x01001f, 0x010010, 0x010411,
+  0x010012, 0x010413, 0x010014, 0x010415, 0x010016, 0x010417,
+  0x010018, 0x010419, 0x01001a, 0x01041b, 0x01001c, 0x01041d,
+  0x01001e, 0x01041f, 0x010010, 0x010011, 0x010012, 0x010013,
+  0x010014, 0x010015, 0x010016, 0x010017, 0x010018, 0x010019,
+  0x01001a, 0x01001b, 0x01001c, 0x01001d, 0x01001e, 0x01001f,
+  0x010010, 0x010411, 0x010012, 0x010413, 0x010014, 0x010415,
+  0x010016, 0x010417, 0x010018, 0x010419, 0x01001a, 0x01041b,
+  0x01001c, 0x01041d, 0x01001e, 0x01041f, 0x010010, 0x010011,
+  0x010012, 0x010013, 0x010014, 0x010015, 0x010016, 0x010017,
+  0x010018, 0x010019, 0x01001a, 0x01001b, 0x01001c, 0x01001d,
+  0x01001e, 0x01001f, 0x010810, 0x011811, 0x010812, 0x011813,
+  0x010814, 0x011815, 0x010816, 0x011817, 0x010838, 0x011839,
+  0x01083a, 0x01183b, 0x01083c, 0x01183d, 0x01083e, 0x01183f,
+  0x010010, 0x010011, 0x010012, 0x010013, 0x010014, 0x010015,
+  0x010016, 0x010017, 0x010018, 0x010019, 0x01001a, 0x01001b,
+  0x01001c, 0x01001d, 0x01001e, 0x01001f, 0x011810, 0x010811,
+  0x011812, 0x010813, 0x011814, 0x010815, 0x011816, 0x010817,
+  0x011838, 0x010839, 0x01183a, 0x01083b, 0x01183c, 0x01083d,
+  0x01183e, 0x01083f, 0x010010, 0x010011, 0x010012, 0x010013,
+  0x010014, 0x010015, 0x010016, 0x010017, 0x010018, 0x010019,
+  0x01001a, 0x01001b, 0x01001c, 0x01001d, 0x01001e, 0x01001f,
+  0x010010, 0x010011, 0x010012, 0x010013, 0x010010, 0x010011,
+  0x010012, 0x010013, 0x010018, 0x010019, 0x01001a, 0x01001b,
+  0x010018, 0x010019, 0x01001a, 0x01001b, 0x010010, 0x010011,
+  0x010012, 0x010013, 0x010014, 0x010015, 0x010016, 0x010017,
+  0x010018, 0x010019, 0x01001a, 0x01001b, 0x01001c, 0x01001d,
+  0x01001e, 0x01001f, 0x010010, 0x010011, 0x010012, 0x010013,
+  0x010014, 0x010015, 0x010016, 0x010017, 0x010010, 0x010011,
+  0x010012, 0x010013, 0x010014, 0x010015, 0x010016, 0x010017,
+  0x010010, 0x010011, 0x010012, 0x010013, 0x010014, 0x010015,
+  0x010016, 0x010017, 0x010018, 0x010019, 0x01001a, 0x01001b,
+  0x01001c, 0x01001d, 0x01001e, 0x01001f, 0x010090, 0x010091,
+  0x010092, 0x010093, 0x010094, 0x010095, 0x010096, 0x010097,
+  0x010098, 0x010099, 0x01009a, 0x01009b, 0x01009c, 0x01009d,
+  0x01009e, 0x01009f, 0x010010, 0x010011, 0x010012, 0x010013,
+  0x010014, 0x010015, 0x010016, 0x010017, 0x010018, 0x010019,
+  0x01001a, 0x01001b, 0x01001c, 0x01001d, 0x01001e, 0x01001f,
+  0x000100, 0x000101, 0x000102, 0x000103, 0x000104, 0x000105,
+  0x000106, 0x000107, 0x000108, 0x000109, 0x00010a, 0x00010b,
+  0x00010c, 0x00010d, 0x00010e, 0x00010f, 0x010010, 0x010011,
+  0x010012, 0x010013, 0x010014, 0x010015, 0x010016, 0x010017,
+  0x010018, 0x010019, 0x01001a, 0x01001b, 0x01001c, 0x01001d,
+  0x01001e, 0x01001f, 0x000000, 0x010011, 0x000002, 0x010013,
+  0x000004, 0x010015, 0x000006, 0x010017, 0x000008, 0x010019,
+  0x00000a, 0x01001b, 0x00000c, 0x01001d, 0x00000e, 0x01001f,
+  0x010010, 0x010011, 0x010012, 0x010013, 0x010014, 0x010015,
+  0x010016, 0x010017, 0x010018, 0x010019, 0x01001a, 0x01001b,
+  0x01001c, 0x01001d, 0x01001e, 0x01001f, 0x010210, 0x010211,
+  0x010212, 0x010213, 0x010214, 0x010215, 0x010216, 0x010217,
+  0x010218, 0x010219, 0x01021a, 0x01021b, 0x01021c, 0x01021d,
+  0x01021e, 0x01021f, 0x010010, 0x010011, 0x010012, 0x010013,
+  0x010014, 0x010015, 0x010016, 0x010017, 0x010018, 0x010019,
+  0x01001a, 0x01001b, 0x01001c, 0x01001d, 0x01001e, 0x01001f,
+  0x010050, 0x010051, 0x010052, 0x010053, 0x010054, 0x010055,
+  0x010056, 0x010057, 0x010058, 0x010059, 0x01005a, 0x01005b,
+  0x01005c, 0x01005d, 0x01005e, 0x01005f, 0x010010, 0x010011,
+  0x010012, 0x010013, 0x010014, 0x010015, 0x010016, 0x010017,
+  0x010018, 0x010019, 0x01001a, 0x01001b, 0x01001c, 0x01001d,
+  0x01001e, 0x01001f, 0x010010, 0x010010, 0x010012, 0x010012,
+  0x010015, 0x010015, 0x010017, 0x010017, 0x010018, 0x010018,
+  0x01001a, 0x01001a, 0x01001d, 0x01001d, 0x01001f, 0x01001f,
+  0x010010, 0x010011, 0x010012, 0x010013, 0x010014, 0x010015,
+  0x010016, 0x010017, 0x010018, 0x010019, 0x01001a, 0x01001b,
+  0x01001c, 0x01001d, 0x01001e, 0x01001f, 0x010010, 0x010011,
+  0x010011, 0x010012, 0x010015, 0x010016, 0x010016, 0x010017,
+  0x010018, 0x010019, 0x010019, 0x01001a, 0x01001d, 0x01001e,
+  0x01001e, 0x01001f, 0x010010, 0x010011, 0x010012, 0x010013,
+  0x010014, 0x010015, 0x010016, 0x010017, 0x010018, 0x010019,
+  0x01001a, 0x01001b, 0x01001c, 0x01001d, 0x01001e, 0x01001f,
+  0x010011, 0x010012, 0x010012, 0x010013, 0x010014, 0x010015,
+  0x010015, 0x010016, 0x010019, 0x01001a, 0x01001a, 0x01001b,
+  0x01001c, 0x01001d, 0x01001d, 0x01001e, 0x010010, 0x010011,
+  0x010012, 0x010013, 0x010014, 0x010015, 0x010016, 0x010017,
+  0x010018, 0x010019, 0x01001a, 0x01001b, 0x01001c, 0x01001d,
+  0x01001e, 0x01001f, 0x010011, 0x010011, 0x010011, 0x010011,
+  0x010015, 0x010015, 0x010015, 0x010015, 0x010019, 0x010019,
+  0x010019, 0x010019, 0x01001d, 0x01001d, 0x01001d, 0x01001d,
+  0x010010, 0x010011, 0x010012, 0x010013, 0x010014, 0x010015,
+  0x010016, 0x010017, 0x010018, 0x010019, 0x01001a, 0x01001b,
+  0x01001c, 0x01001d, 0x01001e, 0x01001f, 0x010411, 0x010411,
+  0x010413, 0x010413, 0x010415, 0x010014, 0x010417, 0x010016,
+  0x010419, 0x010419, 0x01041b, 0x01041b, 0x01041d, 0x01001c,
+  0x01041f, 0x01001e, 0x010010, 0x010011, 0x010012, 0x010013,
+  0x010014, 0x010015, 0x010016, 0x010017, 0x010018, 0x010019,
+  0x01001a, 0x01001b, 0x01001c, 0x01001d, 0x01001e, 0x01001f,
+  0x010010, 0x010411, 0x010012, 0x010413, 0x010415, 0x010415,
+  0x010417, 0x010417, 0x010018, 0x010419, 0x01001a, 0x01041b,
+  0x01041d, 0x01041d, 0x01041f, 0x01041f, 0x010010, 0x010011,
+  0x010012, 0x010013, 0x010014, 0x010015, 0x010016, 0x010017,
+  0x010018, 0x010019, 0x01001a, 0x01001b, 0x01001c, 0x01001d,
+  0x01001e, 0x01001f, 0x010010, 0x010411, 0x010012, 0x010413,
+  0x010415, 0x010014, 0x010417, 0x010016, 0x010018, 0x010419,
+  0x01001a, 0x01041b, 0x01041d, 0x01001c, 0x01041f, 0x01001e,
+  0x010010, 0x010011, 0x010012, 0x010013, 0x010014, 0x010015,
+  0x010016, 0x010017, 0x010018, 0x010019, 0x01001a, 0x01001b,
+  0x01001c, 0x01001d, 0x01001e, 0x01001f, 0x010810, 0x011811,
+  0x010812, 0x011813, 0x010814, 0x011815, 0x010816, 0x011817,
+  0x010838, 0x011839, 0x01083a, 0x01183b, 0x01083c, 0x01183d,
+  0x01083e, 0x01183f, 0x010010, 0x010011, 0x010012, 0x010013,
+  0x010014, 0x010015, 0x010016, 0x010017, 0x010018, 0x010019,
+  0x01001a, 0x01001b, 0x01001c, 0x01001d, 0x01001e, 0x01001f,
+  0x011810, 0x010811, 0x011812, 0x010813, 0x011814, 0x010815,
+  0x011816, 0x010817, 0x011838, 0x010839, 0x01183a, 0x01083b,
+  0x01183c, 0x01083d, 0x01183e, 0x01083f, 0x010010, 0x010011,
+  0x010012, 0x010013, 0x010014, 0x010015, 0x010016, 0x010017,
+  0x010018, 0x010019, 0x01001a, 0x01001b, 0x01001c, 0x01001d,
+  0x01001e, 0x01001f, 0x010014, 0x010015, 0x010016, 0x010017,
+  0x010014, 0x010015, 0x010016, 0x010017, 0x01001c, 0x01001d,
+  0x01001e, 0x01001f, 0x01001c, 0x01001d, 0x01001e, 0x01001f,
+  0x010010, 0x010011, 0x010012, 0x010013, 0x010014, 0x010015,
+  0x010016, 0x010017, 0x010018, 0x010019, 0x01001a, 0x01001b,
+  0x01001c, 0x01001d, 0x01001e, 0x01001f, 0x010010, 0x010011,
+  0x010012, 0x010013, 0x01001c, 0x01001d, 0x01001e, 0x01001f,
+  0x010010, 0x010011, 0x010012, 0x010013, 0x01001c, 0x01001d,
+  0x01001e, 0x01001f, 0x010010, 0x010011, 0x010012, 0x010013,
+  0x010014, 0x010015, 0x010016, 0x010017, 0x010018, 0x010019,
+  0x01001a, 0x01001b, 0x01001c, 0x01001d, 0x01001e, 0x01001f,
+  0x010090, 0x010091, 0x010092, 0x010093, 0x010094, 0x010095,
+  0x010096, 0x010097, 0x010098, 0x010099, 0x01009a, 0x01009b,
+  0x01009c, 0x01009d, 0x01009e, 0x01009f, 0x010010, 0x010011,
+  0x010012, 0x010013, 0x010014, 0x010015, 0x010016, 0x010017,
+  0x010018, 0x010019, 0x01001a, 0x01001b, 0x01001c, 0x01001d,
+  0x01001e, 0x01001f, 0x000100, 0x000101, 0x000102, 0x000103,
+  0x000104, 0x000105, 0x000106, 0x000107, 0x000108, 0x000109,
+  0x00010a, 0x00010b, 0x00010c, 0x00010d, 0x00010e, 0x00010f,
+  0x010010, 0x010011, 0x010012, 0x010013, 0x010014, 0x010015,
+  0x010016, 0x010017, 0x010018, 0x010019, 0x01001a, 0x01001b,
+  0x01001c, 0x01001d, 0x01001e, 0x01001f, 0x000000, 0x010011,
+  0x000002, 0x010013, 0x000004, 0x010015, 0x000006, 0x010017,
+  0x000008, 0x010019, 0x00000a, 0x01001b, 0x00000c, 0x01001d,
+  0x00000e, 0x01001f, 0x010010, 0x010011, 0x010012, 0x010013,
+  0x010014, 0x010015, 0x010016, 0x010017, 0x010018, 0x010019,
+  0x01001a, 0x01001b, 0x01001c, 0x01001d, 0x01001e, 0x01001f,
+  0x010210, 0x010211, 0x010212, 0x010213, 0x010214, 0x010215,
+  0x010216, 0x010217, 0x010218, 0x010219, 0x01021a, 0x01021b,
+  0x01021c, 0x01021d, 0x01021e, 0x01021f, 0x010010, 0x010011,
+  0x010012, 0x010013, 0x010014, 0x010015, 0x010016, 0x010017,
+  0x010018, 0x010019, 0x01001a, 0x01001b, 0x01001c, 0x01001d,
+  0x01001e, 0x01001f, 0x000050, 0x000041, 0x000052, 0x000043,
+  0x000054, 0x000045, 0x000056, 0x000047, 0x000058, 0x000049,
+  0x00005a, 0x00004b, 0x00005c, 0x00004d, 0x00005e, 0x00004f,
+  0x000010, 0x000001, 0x000012, 0x000003, 0x000014, 0x000005,
+  0x000016, 0x000007, 0x000018, 0x000009, 0x00001a, 0x00000b,
+  0x00001c, 0x00000d, 0x00001e, 0x00000f, 0x000010, 0x000010,
+  0x000012, 0x000012, 0x000014, 0x000014, 0x000016, 0x000016,
+  0x000018, 0x000018, 0x00001a, 0x00001a, 0x00001c, 0x00001c,
+  0x00001e, 0x00001e, 0x000010, 0x000001, 0x000012, 0x000003,
+  0x000014, 0x000005, 0x000016, 0x000007, 0x000018, 0x000009,
+  0x00001a, 0x00000b, 0x00001c, 0x00000d, 0x00001e, 0x00000f,
+  0x000010, 0x000001, 0x000001, 0x000012, 0x000014, 0x000005,
+  0x000005, 0x000016, 0x000018, 0x000009, 0x000009, 0x00001a,
+  0x00001c, 0x00000d, 0x00000d, 0x00001e, 0x000010, 0x000001,
+  0x000012, 0x000003, 0x000014, 0x000005, 0x000016, 0x000007,
+  0x000018, 0x000009, 0x00001a, 0x00000b, 0x00001c, 0x00000d,
+  0x00001e, 0x00000f, 0x000001, 0x000012, 0x000012, 0x000003,
+  0x000005, 0x000016, 0x000016, 0x000007, 0x000009, 0x00001a,
+  0x00001a, 0x00000b, 0x00000d, 0x00001e, 0x00001e, 0x00000f,
+  0x000010, 0x000001, 0x000012, 0x000003, 0x000014, 0x000005,
+  0x000016, 0x000007, 0x000018, 0x000009, 0x00001a, 0x00000b,
+  0x00001c, 0x00000d, 0x00001e, 0x00000f, 0x000001, 0x000001,
+  0x000001, 0x000001, 0x000005, 0x000005, 0x000005, 0x000005,
+  0x000009, 0x000009, 0x000009, 0x000009, 0x00000d, 0x00000d,
+  0x00000d, 0x00000d, 0x000010, 0x000001, 0x000012, 0x000003,
+  0x000014, 0x000005, 0x000016, 0x000007, 0x000018, 0x000009,
+  0x00001a, 0x00000b, 0x00001c, 0x00000d, 0x00001e, 0x00000f,
+  0x000401, 0x000401, 0x000403, 0x000403, 0x000405, 0x000405,
+  0x000407, 0x000407, 0x000409, 0x000409, 0x00040b, 0x00040b,
+  0x00040d, 0x00040d, 0x00040f, 0x00040f, 0x000010, 0x000001,
+  0x000012, 0x000003, 0x000014, 0x000005, 0x000016, 0x000007,
+  0x000018, 0x000009, 0x00001a, 0x00000b, 0x00001c, 0x00000d,
+  0x00001e, 0x00000f, 0x000010, 0x000401, 0x000012, 0x000403,
+  0x000014, 0x000405, 0x000016, 0x000407, 0x000018, 0x000409,
+  0x00001a, 0x00040b, 0x00001c, 0x00040d, 0x00001e, 0x00040f,
+  0x000010, 0x000001, 0x000012, 0x000003, 0x000014, 0x000005,
+  0x000016, 0x000007, 0x000018, 0x000009, 0x00001a, 0x00000b,
+  0x00001c, 0x00000d, 0x00001e, 0x00000f, 0x000010, 0x000401,
+  0x000012, 0x000403, 0x000014, 0x000405, 0x000016, 0x000407,
+  0x000018, 0x000409, 0x00001a, 0x00040b, 0x00001c, 0x00040d,
+  0x00001e, 0x00040f, 0x000010, 0x000001, 0x000012, 0x000003,
+  0x000014, 0x000005, 0x000016, 0x000007, 0x000018, 0x000009,
+  0x00001a, 0x00000b, 0x00001c, 0x00000d, 0x00001e, 0x00000f,
+  0x000810, 0x001801, 0x000812, 0x001803, 0x000814, 0x001805,
+  0x000816, 0x001807, 0x000838, 0x001829, 0x00083a, 0x00182b,
+  0x00083c, 0x00182d, 0x00083e, 0x00182f, 0x000010, 0x000001,
+  0x000012, 0x000003, 0x000014, 0x000005, 0x000016, 0x000007,
+  0x000018, 0x000009, 0x00001a, 0x00000b, 0x00001c, 0x00000d,
+  0x00001e, 0x00000f, 0x001810, 0x000801, 0x001812, 0x000803,
+  0x001814, 0x000805, 0x001816, 0x000807, 0x001838, 0x000829,
+  0x00183a, 0x00082b, 0x00183c, 0x00082d, 0x00183e, 0x00082f,
+  0x000010, 0x000001, 0x000012, 0x000003, 0x000014, 0x000005,
+  0x000016, 0x000007, 0x000018, 0x000009, 0x00001a, 0x00000b,
+  0x00001c, 0x00000d, 0x00001e, 0x00000f, 0x000010, 0x000001,
+  0x000012, 0x000003, 0x000010, 0x000001, 0x000012, 0x000003,
+  0x000018, 0x000009, 0x00001a, 0x00000b, 0x000018, 0x000009,
+  0x00001a, 0x00000b, 0x000010, 0x000001, 0x000012, 0x000003,
+  0x000014, 0x000005, 0x000016, 0x000007, 0x000018, 0x000009,
+  0x00001a, 0x00000b, 0x00001c, 0x00000d, 0x00001e, 0x00000f,
+  0x000010, 0x000001, 0x000012, 0x000003, 0x000014, 0x000005,
+  0x000016, 0x000007, 0x000010, 0x000001, 0x000012, 0x000003,
+  0x000014, 0x000005, 0x000016, 0x000007, 0x000010, 0x000001,
+  0x000012, 0x000003, 0x000014, 0x000005, 0x000016, 0x000007,
+  0x000018, 0x000009, 0x00001a, 0x00000b, 0x00001c, 0x00000d,
+  0x00001e, 0x00000f, 0x000090, 0x000081, 0x000092, 0x000083,
+  0x000094, 0x000085, 0x000096, 0x000087, 0x000098, 0x000089,
+  0x00009a, 0x00008b, 0x00009c, 0x00008d, 0x00009e, 0x00008f,
+  0x000010, 0x000001, 0x000012, 0x000003, 0x000014, 0x000005,
+  0x000016, 0x000007, 0x000018, 0x000009, 0x00001a, 0x00000b,
+  0x00001c, 0x00000d, 0x00001e, 0x00000f, 0x000100, 0x000101,
+  0x000102, 0x000103, 0x000104, 0x000105, 0x000106, 0x000107,
+  0x000108, 0x000109, 0x00010a, 0x00010b, 0x00010c, 0x00010d,
+  0x00010e, 0x00010f, 0x000010, 0x000001, 0x000012, 0x000003,
+  0x000014, 0x000005, 0x000016, 0x000007, 0x000018, 0x000009,
+  0x00001a, 0x00000b, 0x00001c, 0x00000d, 0x00001e, 0x00000f,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x000004, 0x000005,
+  0x000006, 0x000007, 0x000008, 0x000009, 0x00000a, 0x00000b,
+  0x00000c, 0x00000d, 0x00000e, 0x00000f, 0x000010, 0x000001,
+  0x000012, 0x000003, 0x000014, 0x000005, 0x000016, 0x000007,
+  0x000018, 0x000009, 0x00001a, 0x00000b, 0x00001c, 0x00000d,
+  0x00001e, 0x00000f, 0x000210, 0x000201, 0x000212, 0x000203,
+  0x000214, 0x000205, 0x000216, 0x000207, 0x000218, 0x000209,
+  0x00021a, 0x00020b, 0x00021c, 0x00020d, 0x00021e, 0x00020f,
+  0x000010, 0x000001, 0x000012, 0x000003, 0x000014, 0x000005,
+  0x000016, 0x000007, 0x000018, 0x000009, 0x00001a, 0x00000b,
+  0x00001c, 0x00000d, 0x00001e, 0x00000f, 0x000050, 0x000041,
+  0x000052, 0x000043, 0x000054, 0x000045, 0x000056, 0x000047,
+  0x000058, 0x000049, 0x00005a, 0x00004b, 0x00005c, 0x00004d,
+  0x00005e, 0x00004f, 0x000010, 0x000001, 0x000012, 0x000003,
+  0x000014, 0x000005, 0x000016, 0x000007, 0x000018, 0x000009,
+  0x00001a, 0x00000b, 0x00001c, 0x00000d, 0x00001e, 0x00000f,
+  0x000010, 0x000010, 0x000012, 0x000012, 0x000005, 0x000005,
+  0x000007, 0x000007, 0x000018, 0x000018, 0x00001a, 0x00001a,
+  0x00000d, 0x00000d, 0x00000f, 0x00000f, 0x000010, 0x000001,
+  0x000012, 0x000003, 0x000014, 0x000005, 0x000016, 0x000007,
+  0x000018, 0x000009, 0x00001a, 0x00000b, 0x00001c, 0x00000d,
+  0x00001e, 0x00000f, 0x000010, 0x000001, 0x000001, 0x000012,
+  0x000005, 0x000016, 0x000016, 0x000007, 0x000018, 0x000009,
+  0x000009, 0x00001a, 0x00000d, 0x00001e, 0x00001e, 0x00000f,
+  0x000010, 0x000001, 0x000012, 0x000003, 0x000014, 0x000005,
+  0x000016, 0x000007, 0x000018, 0x000009, 0x00001a, 0x00000b,
+  0x00001c, 0x00000d, 0x00001e, 0x00000f, 0x000001, 0x000012,
+  0x000012, 0x000003, 0x000014, 0x000005, 0x000005, 0x000016,
+  0x000009, 0x00001a, 0x00001a, 0x00000b, 0x00001c, 0x00000d,
+  0x00000d, 0x00001e, 0x000010, 0x000001, 0x000012, 0x000003,
+  0x000014, 0x000005, 0x000016, 0x000007, 0x000018, 0x000009,
+  0x00001a, 0x00000b, 0x00001c, 0x00000d, 0x00001e, 0x00000f,
+  0x000001, 0x000001, 0x000001, 0x000001, 0x000005, 0x000005,
+  0x000005, 0x000005, 0x000009, 0x000009, 0x000009, 0x000009,
+  0x00000d, 0x00000d, 0x00000d, 0x00000d, 0x000010, 0x000001,
+  0x000012, 0x000003, 0x000014, 0x000005, 0x000016, 0x000007,
+  0x000018, 0x000009, 0x00001a, 0x00000b, 0x00001c, 0x00000d,
+  0x00001e, 0x00000f, 0x000401, 0x000401, 0x000403, 0x000403,
+  0x000405, 0x000014, 0x000407, 0x000016, 0x000409, 0x000409,
+  0x00040b, 0x00040b, 0x00040d, 0x00001c, 0x00040f, 0x00001e,
+  0x000010, 0x000001, 0x000012, 0x000003, 0x000014, 0x000005,
+  0x000016, 0x000007, 0x000018, 0x000009, 0x00001a, 0x00000b,
+  0x00001c, 0x00000d, 0x00001e, 0x00000f, 0x000010, 0x000401,
+  0x000012, 0x000403, 0x000405, 0x000405, 0x000407, 0x000407,
+  0x000018, 0x000409, 0x00001a, 0x00040b, 0x00040d, 0x00040d,
+  0x00040f, 0x00040f, 0x000010, 0x000001, 0x000012, 0x000003,
+  0x000014, 0x000005, 0x000016, 0x000007, 0x000018, 0x000009,
+  0x00001a, 0x00000b, 0x00001c, 0x00000d, 0x00001e, 0x00000f,
+  0x000010, 0x000401, 0x000012, 0x000403, 0x000405, 0x000014,
+  0x000407, 0x000016, 0x000018, 0x000409, 0x00001a, 0x00040b,
+  0x00040d, 0x00001c, 0x00040f, 0x00001e, 0x000010, 0x000001,
+  0x000012, 0x000003, 0x000014, 0x000005, 0x000016, 0x000007,
+  0x000018, 0x000009, 0x00001a, 0x00000b, 0x00001c, 0x00000d,
+  0x00001e, 0x00000f, 0x000810, 0x001801, 0x000812, 0x001803,
+  0x000814, 0x001805, 0x000816, 0x001807, 0x000838, 0x001829,
+  0x00083a, 0x00182b, 0x00083c, 0x00182d, 0x00083e, 0x00182f,
+  0x000010, 0x000001, 0x000012, 0x000003, 0x000014, 0x000005,
+  0x000016, 0x000007, 0x000018, 0x000009, 0x00001a, 0x00000b,
+  0x00001c, 0x00000d, 0x00001e, 0x00000f, 0x001810, 0x000801,
+  0x001812, 0x000803, 0x001814, 0x000805, 0x001816, 0x000807,
+  0x001838, 0x000829, 0x00183a, 0x00082b, 0x00183c, 0x00082d,
+  0x00183e, 0x00082f, 0x000010, 0x000001, 0x000012, 0x000003,
+  0x000014, 0x000005, 0x000016, 0x000007, 0x000018, 0x000009,
+  0x00001a, 0x00000b, 0x00001c, 0x00000d, 0x00001e, 0x00000f,
+  0x000014, 0x000005, 0x000016, 0x000007, 0x000014, 0x000005,
+  0x000016, 0x000007, 0x00001c, 0x00000d, 0x00001e, 0x00000f,
+  0x00001c, 0x00000d, 0x00001e, 0x00000f, 0x000010, 0x000001,
+  0x000012, 0x000003, 0x000014, 0x000005, 0x000016, 0x000007,
+  0x000018, 0x000009, 0x00001a, 0x00000b, 0x00001c, 0x00000d,
+  0x00001e, 0x00000f, 0x000010, 0x000001, 0x000012, 0x000003,
+  0x00001c, 0x00000d, 0x00001e, 0x00000f, 0x000010, 0x000001,
+  0x000012, 0x000003, 0x00001c, 0x00000d, 0x00001e, 0x00000f,
+  0x000010, 0x000001, 0x000012, 0x000003, 0x000014, 0x000005,
+  0x000016, 0x000007, 0x000018, 0x000009, 0x00001a, 0x00000b,
+  0x00001c, 0x00000d, 0x00001e, 0x00000f, 0x000090, 0x000081,
+  0x000092, 0x000083, 0x000094, 0x000085, 0x000096, 0x000087,
+  0x000098, 0x000089, 0x00009a, 0x00008b, 0x00009c, 0x00008d,
+  0x00009e, 0x00008f, 0x000010, 0x000001, 0x000012, 0x000003,
+  0x000014, 0x000005, 0x000016, 0x000007, 0x000018, 0x000009,
+  0x00001a, 0x00000b, 0x00001c, 0x00000d, 0x00001e, 0x00000f,
+  0x000100, 0x000101, 0x000102, 0x000103, 0x000104, 0x000105,
+  0x000106, 0x000107, 0x000108, 0x000109, 0x00010a, 0x00010b,
+  0x00010c, 0x00010d, 0x00010e, 0x00010f, 0x000010, 0x000001,
+  0x000012, 0x000003, 0x000014, 0x000005, 0x000016, 0x000007,
+  0x000018, 0x000009, 0x00001a, 0x00000b, 0x00001c, 0x00000d,
+  0x00001e, 0x00000f, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x000004, 0x000005, 0x000006, 0x000007, 0x000008, 0x000009,
+  0x00000a, 0x00000b, 0x00000c, 0x00000d, 0x00000e, 0x00000f,
+  0x000010, 0x000001, 0x000012, 0x000003, 0x000014, 0x000005,
+  0x000016, 0x000007, 0x000018, 0x000009, 0x00001a, 0x00000b,
+  0x00001c, 0x00000d, 0x00001e, 0x00000f, 0x000210, 0x000201,
+  0x000212, 0x000203, 0x000214, 0x000205, 0x000216, 0x000207,
+  0x000218, 0x000209, 0x00021a, 0x00020b, 0x00021c, 0x00020d,
+  0x00021e, 0x00020f, 0x000010, 0x000001, 0x000012, 0x000003,
+  0x000014, 0x000005, 0x000016, 0x000007, 0x000018, 0x000009,
+  0x00001a, 0x00000b, 0x00001c, 0x00000d, 0x00001e, 0x00000f,
+  0x020040, 0x020041, 0x020042, 0x020043, 0x020044, 0x020045,
+  0x020046, 0x020047, 0x020048, 0x020049, 0x02004a, 0x02004b,
+  0x02004c, 0x02004d, 0x02004e, 0x02004f, 0x020000, 0x020001,
+  0x020002, 0x020003, 0x020004, 0x020005, 0x020006, 0x020007,
+  0x020008, 0x020009, 0x02000a, 0x02000b, 0x02000c, 0x02000d,
+  0x02000e, 0x02000f, 0x020000, 0x020000, 0x020002, 0x020002,
+  0x020004, 0x020004, 0x020006, 0x020006, 0x020008, 0x020008,
+  0x02000a, 0x02000a, 0x02000c, 0x02000c, 0x02000e, 0x02000e,
+  0x020000, 0x020001, 0x020002, 0x020003, 0x020004, 0x020005,
+  0x020006, 0x020007, 0x020008, 0x020009, 0x02000a, 0x02000b,
+  0x02000c, 0x02000d, 0x02000e, 0x02000f, 0x020000, 0x020001,
+  0x020001, 0x020002, 0x020004, 0x020005, 0x020005, 0x020006,
+  0x020008, 0x020009, 0x020009, 0x02000a, 0x02000c, 0x02000d,
+  0x02000d, 0x02000e, 0x020000, 0x020001, 0x020002, 0x020003,
+  0x020004, 0x020005, 0x020006, 0x020007, 0x020008, 0x020009,
+  0x02000a, 0x02000b, 0x02000c, 0x02000d, 0x02000e, 0x02000f,
+  0x020001, 0x020002, 0x020002, 0x020003, 0x020005, 0x020006,
+  0x020006, 0x020007, 0x020009, 0x02000a, 0x02000a, 0x02000b,
+  0x02000d, 0x02000e, 0x02000e, 0x02000f, 0x020000, 0x020001,
+  0x020002, 0x020003, 0x020004, 0x020005, 0x020006, 0x020007,
+  0x020008, 0x020009, 0x02000a, 0x02000b, 0x02000c, 0x02000d,
+  0x02000e, 0x02000f, 0x020001, 0x020001, 0x020001, 0x020001,
+  0x020005, 0x020005, 0x020005, 0x020005, 0x020009, 0x020009,
+  0x020009, 0x020009, 0x02000d, 0x02000d, 0x02000d, 0x02000d,
+  0x020000, 0x020001, 0x020002, 0x020003, 0x020004, 0x020005,
+  0x020006, 0x020007, 0x020008, 0x020009, 0x02000a, 0x02000b,
+  0x02000c, 0x02000d, 0x02000e, 0x02000f, 0x020401, 0x020401,
+  0x020403, 0x020403, 0x020405, 0x020405, 0x020407, 0x020407,
+  0x020409, 0x020409, 0x02040b, 0x02040b, 0x02040d, 0x02040d,
+  0x02040f, 0x02040f, 0x020000, 0x020001, 0x020002, 0x020003,
+  0x020004, 0x020005, 0x020006, 0x020007, 0x020008, 0x020009,
+  0x02000a, 0x02000b, 0x02000c, 0x02000d, 0x02000e, 0x02000f,
+  0x020000, 0x020401, 0x020002, 0x020403, 0x020004, 0x020405,
+  0x020006, 0x020407, 0x020008, 0x020409, 0x02000a, 0x02040b,
+  0x02000c, 0x02040d, 0x02000e, 0x02040f, 0x020000, 0x020001,
+  0x020002, 0x020003, 0x020004, 0x020005, 0x020006, 0x020007,
+  0x020008, 0x020009, 0x02000a, 0x02000b, 0x02000c, 0x02000d,
+  0x02000e, 0x02000f, 0x020000, 0x020401, 0x020002, 0x020403,
+  0x020004, 0x020405, 0x020006, 0x020407, 0x020008, 0x020409,
+  0x02000a, 0x02040b, 0x02000c, 0x02040d, 0x02000e, 0x02040f,
+  0x020000, 0x020001, 0x020002, 0x020003, 0x020004, 0x020005,
+  0x020006, 0x020007, 0x020008, 0x020009, 0x02000a, 0x02000b,
+  0x02000c, 0x02000d, 0x02000e, 0x02000f, 0x020800, 0x021801,
+  0x020802, 0x021803, 0x020804, 0x021805, 0x020806, 0x021807,
+  0x020828, 0x021829, 0x02082a, 0x02182b, 0x02082c, 0x02182d,
+  0x02082e, 0x02182f, 0x020000, 0x020001, 0x020002, 0x020003,
+  0x020004, 0x020005, 0x020006, 0x020007, 0x020008, 0x020009,
+  0x02000a, 0x02000b, 0x02000c, 0x02000d, 0x02000e, 0x02000f,
+  0x021800, 0x020801, 0x021802, 0x020803, 0x021804, 0x020805,
+  0x021806, 0x020807, 0x021828, 0x020829, 0x02182a, 0x02082b,
+  0x02182c, 0x02082d, 0x02182e, 0x02082f, 0x020000, 0x020001,
+  0x020002, 0x020003, 0x020004, 0x020005, 0x020006, 0x020007,
+  0x020008, 0x020009, 0x02000a, 0x02000b, 0x02000c, 0x02000d,
+  0x02000e, 0x02000f, 0x020000, 0x020001, 0x020002, 0x020003,
+  0x020000, 0x020001, 0x020002, 0x020003, 0x020008, 0x020009,
+  0x02000a, 0x02000b, 0x020008, 0x020009, 0x02000a, 0x02000b,
+  0x020000, 0x020001, 0x020002, 0x020003, 0x020004, 0x020005,
+  0x020006, 0x020007, 0x020008, 0x020009, 0x02000a, 0x02000b,
+  0x02000c, 0x02000d, 0x02000e, 0x02000f, 0x020000, 0x020001,
+  0x020002, 0x020003, 0x020004, 0x020005, 0x020006, 0x020007,
+  0x020000, 0x020001, 0x020002, 0x020003, 0x020004, 0x020005,
+  0x020006, 0x020007, 0x020000, 0x020001, 0x020002, 0x020003,
+  0x020004, 0x020005, 0x020006, 0x020007, 0x020008, 0x020009,
+  0x02000a, 0x02000b, 0x02000c, 0x02000d, 0x02000e, 0x02000f,
+  0x020080, 0x020081, 0x020082, 0x020083, 0x020084, 0x020085,
+  0x020086, 0x020087, 0x020088, 0x020089, 0x02008a, 0x02008b,
+  0x02008c, 0x02008d, 0x02008e, 0x02008f, 0x020000, 0x020001,
+  0x020002, 0x020003, 0x020004, 0x020005, 0x020006, 0x020007,
+  0x020008, 0x020009, 0x02000a, 0x02000b, 0x02000c, 0x02000d,
+  0x02000e, 0x02000f, 0x000100, 0x000101, 0x000102, 0x000103,
+  0x000104, 0x000105, 0x000106, 0x000107, 0x000108, 0x000109,
+  0x00010a, 0x00010b, 0x00010c, 0x00010d, 0x00010e, 0x00010f,
+  0x020000, 0x020001, 0x020002, 0x020003, 0x020004, 0x020005,
+  0x020006, 0x020007, 0x020008, 0x020009, 0x02000a, 0x02000b,
+  0x02000c, 0x02000d, 0x02000e, 0x02000f, 0x000000, 0x020001,
+  0x000002, 0x020003, 0x000004, 0x020005, 0x000006, 0x020007,
+  0x000008, 0x020009, 0x00000a, 0x02000b, 0x00000c, 0x02000d,
+  0x00000e, 0x02000f, 0x020000, 0x020001, 0x020002, 0x020003,
+  0x020004, 0x020005, 0x020006, 0x020007, 0x020008, 0x020009,
+  0x02000a, 0x02000b, 0x02000c, 0x02000d, 0x02000e, 0x02000f,
+  0x020200, 0x020201, 0x020202, 0x020203, 0x020204, 0x020205,
+  0x020206, 0x020207, 0x020208, 0x020209, 0x02020a, 0x02020b,
+  0x02020c, 0x02020d, 0x02020e, 0x02020f, 0x020000, 0x020001,
+  0x020002, 0x020003, 0x020004, 0x020005, 0x020006, 0x020007,
+  0x020008, 0x020009, 0x02000a, 0x02000b, 0x02000c, 0x02000d,
+  0x02000e, 0x02000f, 0x020040, 0x020041, 0x020042, 0x020043,
+  0x020044, 0x020045, 0x020046, 0x020047, 0x020048, 0x020049,
+  0x02004a, 0x02004b, 0x02004c, 0x02004d, 0x02004e, 0x02004f,
+  0x020000, 0x020001, 0x020002, 0x020003, 0x020004, 0x020005,
+  0x020006, 0x020007, 0x020008, 0x020009, 0x02000a, 0x02000b,
+  0x02000c, 0x02000d, 0x02000e, 0x02000f, 0x020000, 0x020000,
+  0x020002, 0x020002, 0x020005, 0x020005, 0x020007, 0x020007,
+  0x020008, 0x020008, 0x02000a, 0x02000a, 0x02000d, 0x02000d,
+  0x02000f, 0x02000f, 0x020000, 0x020001, 0x020002, 0x020003,
+  0x020004, 0x020005, 0x020006, 0x020007, 0x020008, 0x020009,
+  0x02000a, 0x02000b, 0x02000c, 0x02000d, 0x02000e, 0x02000f,
+  0x020000, 0x020001, 0x020001, 0x020002, 0x020005, 0x020006,
+  0x020006, 0x020007, 0x020008, 0x020009, 0x020009, 0x02000a,
+  0x02000d, 0x02000e, 0x02000e, 0x02000f, 0x020000, 0x020001,
+  0x020002, 0x020003, 0x020004, 0x020005, 0x020006, 0x020007,
+  0x020008, 0x020009, 0x02000a, 0x02000b, 0x02000c, 0x02000d,
+  0x02000e, 0x02000f, 0x020001, 0x020002, 0x020002, 0x020003,
+  0x020004, 0x020005, 0x020005, 0x020006, 0x020009, 0x02000a,
+  0x02000a, 0x02000b, 0x02000c, 0x02000d, 0x02000d, 0x02000e,
+  0x020000, 0x020001, 0x020002, 0x020003, 0x020004, 0x020005,
+  0x020006, 0x020007, 0x020008, 0x020009, 0x02000a, 0x02000b,
+  0x02000c, 0x02000d, 0x02000e, 0x02000f, 0x020001, 0x020001,
+  0x020001, 0x020001, 0x020005, 0x020005, 0x020005, 0x020005,
+  0x020009, 0x020009, 0x020009, 0x020009, 0x02000d, 0x02000d,
+  0x02000d, 0x02000d, 0x020000, 0x020001, 0x020002, 0x020003,
+  0x020004, 0x020005, 0x020006, 0x020007, 0x020008, 0x020009,
+  0x02000a, 0x02000b, 0x02000c, 0x02000d, 0x02000e, 0x02000f,
+  0x020401, 0x020401, 0x020403, 0x020403, 0x020405, 0x020004,
+  0x020407, 0x020006, 0x020409, 0x020409, 0x02040b, 0x02040b,
+  0x02040d, 0x02000c, 0x02040f, 0x02000e, 0x020000, 0x020001,
+  0x020002, 0x020003, 0x020004, 0x020005, 0x020006, 0x020007,
+  0x020008, 0x020009, 0x02000a, 0x02000b, 0x02000c, 0x02000d,
+  0x02000e, 0x02000f, 0x020000, 0x020401, 0x020002, 0x020403,
+  0x020405, 0x020405, 0x020407, 0x020407, 0x020008, 0x020409,
+  0x02000a, 0x02040b, 0x02040d, 0x02040d, 0x02040f, 0x02040f,
+  0x020000, 0x020001, 0x020002, 0x020003, 0x020004, 0x020005,
+  0x020006, 0x020007, 0x020008, 0x020009, 0x02000a, 0x02000b,
+  0x02000c, 0x02000d, 0x02000e, 0x02000f, 0x020000, 0x020401,
+  0x020002, 0x020403, 0x020405, 0x020004, 0x020407, 0x020006,
+  0x020008, 0x020409, 0x02000a, 0x02040b, 0x02040d, 0x02000c,
+  0x02040f, 0x02000e, 0x020000, 0x020001, 0x020002, 0x020003,
+  0x020004, 0x020005, 0x020006, 0x020007, 0x020008, 0x020009,
+  0x02000a, 0x02000b, 0x02000c, 0x02000d, 0x02000e, 0x02000f,
+  0x020800, 0x021801, 0x020802, 0x021803, 0x020804, 0x021805,
+  0x020806, 0x021807, 0x020828, 0x021829, 0x02082a, 0x02182b,
+  0x02082c, 0x02182d, 0x02082e, 0x02182f, 0x020000, 0x020001,
+  0x020002, 0x020003, 0x020004, 0x020005, 0x020006, 0x020007,
+  0x020008, 0x020009, 0x02000a, 0x02000b, 0x02000c, 0x02000d,
+  0x02000e, 0x02000f, 0x021800, 0x020801, 0x021802, 0x020803,
+  0x021804, 0x020805, 0x021806, 0x020807, 0x021828, 0x020829,
+  0x02182a, 0x02082b, 0x02182c, 0x02082d, 0x02182e, 0x02082f,
+  0x020000, 0x020001, 0x020002, 0x020003, 0x020004, 0x020005,
+  0x020006, 0x020007, 0x020008, 0x020009, 0x02000a, 0x02000b,
+  0x02000c, 0x02000d, 0x02000e, 0x02000f, 0x020004, 0x020005,
+  0x020006, 0x020007, 0x020004, 0x020005, 0x020006, 0x020007,
+  0x02000c, 0x02000d, 0x02000e, 0x02000f, 0x02000c, 0x02000d,
+  0x02000e, 0x02000f, 0x020000, 0x020001, 0x020002, 0x020003,
+  0x020004, 0x020005, 0x020006, 0x020007, 0x020008, 0x020009,
+  0x02000a, 0x02000b, 0x02000c, 0x02000d, 0x02000e, 0x02000f,
+  0x020000, 0x020001, 0x020002, 0x020003, 0x02000c, 0x02000d,
+  0x02000e, 0x02000f, 0x020000, 0x020001, 0x020002, 0x020003,
+  0x02000c, 0x02000d, 0x02000e, 0x02000f, 0x020000, 0x020001,
+  0x020002, 0x020003, 0x020004, 0x020005, 0x020006, 0x020007,
+  0x020008, 0x020009, 0x02000a, 0x02000b, 0x02000c, 0x02000d,
+  0x02000e, 0x02000f, 0x020080, 0x020081, 0x020082, 0x020083,
+  0x020084, 0x020085, 0x020086, 0x020087, 0x020088, 0x020089,
+  0x02008a, 0x02008b, 0x02008c, 0x02008d, 0x02008e, 0x02008f,
+  0x020000, 0x020001, 0x020002, 0x020003, 0x020004, 0x020005,
+  0x020006, 0x020007, 0x020008, 0x020009, 0x02000a, 0x02000b,
+  0x02000c, 0x02000d, 0x02000e, 0x02000f, 0x000100, 0x000101,
+  0x000102, 0x000103, 0x000104, 0x000105, 0x000106, 0x000107,
+  0x000108, 0x000109, 0x00010a, 0x00010b, 0x00010c, 0x00010d,
+  0x00010e, 0x00010f, 0x020000, 0x020001, 0x020002, 0x020003,
+  0x020004, 0x020005, 0x020006, 0x020007, 0x020008, 0x020009,
+  0x02000a, 0x02000b, 0x02000c, 0x02000d, 0x02000e, 0x02000f,
+  0x000000, 0x020001, 0x000002, 0x020003, 0x000004, 0x020005,
+  0x000006, 0x020007, 0x000008, 0x020009, 0x00000a, 0x02000b,
+  0x00000c, 0x02000d, 0x00000e, 0x02000f, 0x020000, 0x020001,
+  0x020002, 0x020003, 0x020004, 0x020005, 0x020006, 0x020007,
+  0x020008, 0x020009, 0x02000a, 0x02000b, 0x02000c, 0x02000d,
+  0x02000e, 0x02000f, 0x020200, 0x020201, 0x020202, 0x020203,
+  0x020204, 0x020205, 0x020206, 0x020207, 0x020208, 0x020209,
+  0x02020a, 0x02020b, 0x02020c, 0x02020d, 0x02020e, 0x02020f,
+  0x020000, 0x020001, 0x020002, 0x020003, 0x020004, 0x020005,
+  0x020006, 0x020007, 0x020008, 0x020009, 0x02000a, 0x02000b,
+  0x02000c, 0x02000d, 0x02000e, 0x02000f, 0x004040, 0x004041,
+  0x004042, 0x004043, 0x004044, 0x004045, 0x004046, 0x004047,
+  0x004048, 0x004049, 0x00404a, 0x00404b, 0x00404c, 0x00404d,
+  0x00404e, 0x00404f, 0x004000, 0x004001, 0x004002, 0x004003,
+  0x004004, 0x004005, 0x004006, 0x004007, 0x004008, 0x004009,
+  0x00400a, 0x00400b, 0x00400c, 0x00400d, 0x00400e, 0x00400f,
+  0x004000, 0x004000, 0x004002, 0x004002, 0x004004, 0x004004,
+  0x004006, 0x004006, 0x004008, 0x004008, 0x00400a, 0x00400a,
+  0x00400c, 0x00400c, 0x00400e, 0x00400e, 0x004000, 0x004001,
+  0x004002, 0x004003, 0x004004, 0x004005, 0x004006, 0x004007,
+  0x004008, 0x004009, 0x00400a, 0x00400b, 0x00400c, 0x00400d,
+  0x00400e, 0x00400f, 0x004000, 0x004001, 0x004001, 0x004002,
+  0x004004, 0x004005, 0x004005, 0x004006, 0x004008, 0x004009,
+  0x004009, 0x00400a, 0x00400c, 0x00400d, 0x00400d, 0x00400e,
+  0x004000, 0x004001, 0x004002, 0x004003, 0x004004, 0x004005,
+  0x004006, 0x004007, 0x004008, 0x004009, 0x00400a, 0x00400b,
+  0x00400c, 0x00400d, 0x00400e, 0x00400f, 0x004001, 0x004002,
+  0x004002, 0x004003, 0x004005, 0x004006, 0x004006, 0x004007,
+  0x004009, 0x00400a, 0x00400a, 0x00400b, 0x00400d, 0x00400e,
+  0x00400e, 0x00400f, 0x004000, 0x004001, 0x004002, 0x004003,
+  0x004004, 0x004005, 0x004006, 0x004007, 0x004008, 0x004009,
+  0x00400a, 0x00400b, 0x00400c, 0x00400d, 0x00400e, 0x00400f,
+  0x004001, 0x004001, 0x004001, 0x004001, 0x004005, 0x004005,
+  0x004005, 0x004005, 0x004009, 0x004009, 0x004009, 0x004009,
+  0x00400d, 0x00400d, 0x00400d, 0x00400d, 0x004000, 0x004001,
+  0x004002, 0x004003, 0x004004, 0x004005, 0x004006, 0x004007,
+  0x004008, 0x004009, 0x00400a, 0x00400b, 0x00400c, 0x00400d,
+  0x00400e, 0x00400f, 0x004401, 0x004401, 0x004403, 0x004403,
+  0x004405, 0x004405, 0x004407, 0x004407, 0x004409, 0x004409,
+  0x00440b, 0x00440b, 0x00440d, 0x00440d, 0x00440f, 0x00440f,
+  0x004000, 0x004001, 0x004002, 0x004003, 0x004004, 0x004005,
+  0x004006, 0x004007, 0x004008, 0x004009, 0x00400a, 0x00400b,
+  0x00400c, 0x00400d, 0x00400e, 0x00400f, 0x004000, 0x004401,
+  0x004002, 0x004403, 0x004004, 0x004405, 0x004006, 0x004407,
+  0x004008, 0x004409, 0x00400a, 0x00440b, 0x00400c, 0x00440d,
+  0x00400e, 0x00440f, 0x004000, 0x004001, 0x004002, 0x004003,
+  0x004004, 0x004005, 0x004006, 0x004007, 0x004008, 0x004009,
+  0x00400a, 0x00400b, 0x00400c, 0x00400d, 0x00400e, 0x00400f,
+  0x004000, 0x004401, 0x004002, 0x004403, 0x004004, 0x004405,
+  0x004006, 0x004407, 0x004008, 0x004409, 0x00400a, 0x00440b,
+  0x00400c, 0x00440d, 0x00400e, 0x00440f, 0x004000, 0x004001,
+  0x004002, 0x004003, 0x004004, 0x004005, 0x004006, 0x004007,
+  0x004008, 0x004009, 0x00400a, 0x00400b, 0x00400c, 0x00400d,
+  0x00400e, 0x00400f, 0x004800, 0x005801, 0x004802, 0x005803,
+  0x004804, 0x005805, 0x004806, 0x005807, 0x004828, 0x005829,
+  0x00482a, 0x00582b, 0x00482c, 0x00582d, 0x00482e, 0x00582f,
+  0x004000, 0x004001, 0x004002, 0x004003, 0x004004, 0x004005,
+  0x004006, 0x004007, 0x004008, 0x004009, 0x00400a, 0x00400b,
+  0x00400c, 0x00400d, 0x00400e, 0x00400f, 0x005800, 0x004801,
+  0x005802, 0x004803, 0x005804, 0x004805, 0x005806, 0x004807,
+  0x005828, 0x004829, 0x00582a, 0x00482b, 0x00582c, 0x00482d,
+  0x00582e, 0x00482f, 0x004000, 0x004001, 0x004002, 0x004003,
+  0x004004, 0x004005, 0x004006, 0x004007, 0x004008, 0x004009,
+  0x00400a, 0x00400b, 0x00400c, 0x00400d, 0x00400e, 0x00400f,
+  0x004000, 0x004001, 0x004002, 0x004003, 0x004000, 0x004001,
+  0x004002, 0x004003, 0x004008, 0x004009, 0x00400a, 0x00400b,
+  0x004008, 0x004009, 0x00400a, 0x00400b, 0x004000, 0x004001,
+  0x004002, 0x004003, 0x004004, 0x004005, 0x004006, 0x004007,
+  0x004008, 0x004009, 0x00400a, 0x00400b, 0x00400c, 0x00400d,
+  0x00400e, 0x00400f, 0x004000, 0x004001, 0x004002, 0x004003,
+  0x004004, 0x004005, 0x004006, 0x004007, 0x004000, 0x004001,
+  0x004002, 0x004003, 0x004004, 0x004005, 0x004006, 0x004007,
+  0x004000, 0x004001, 0x004002, 0x004003, 0x004004, 0x004005,
+  0x004006, 0x004007, 0x004008, 0x004009, 0x00400a, 0x00400b,
+  0x00400c, 0x00400d, 0x00400e, 0x00400f, 0x004080, 0x004081,
+  0x004082, 0x004083, 0x004084, 0x004085, 0x004086, 0x004087,
+  0x004088, 0x004089, 0x00408a, 0x00408b, 0x00408c, 0x00408d,
+  0x00408e, 0x00408f, 0x004000, 0x004001, 0x004002, 0x004003,
+  0x004004, 0x004005, 0x004006, 0x004007, 0x004008, 0x004009,
+  0x00400a, 0x00400b, 0x00400c, 0x00400d, 0x00400e, 0x00400f,
+  0x000100, 0x000101, 0x000102, 0x000103, 0x000104, 0x000105,
+  0x000106, 0x000107, 0x000108, 0x000109, 0x00010a, 0x00010b,
+  0x00010c, 0x00010d, 0x00010e, 0x00010f, 0x004000, 0x004001,
+  0x004002, 0x004003, 0x004004, 0x004005, 0x004006, 0x004007,
+  0x004008, 0x004009, 0x00400a, 0x00400b, 0x00400c, 0x00400d,
+  0x00400e, 0x00400f, 0x000000, 0x004001, 0x000002, 0x004003,
+  0x000004, 0x004005, 0x000006, 0x004007, 0x000008, 0x004009,
+  0x00000a, 0x00400b, 0x00000c, 0x00400d, 0x00000e, 0x00400f,
+  0x004000, 0x004001, 0x004002, 0x004003, 0x004004, 0x004005,
+  0x004006, 0x004007, 0x004008, 0x004009, 0x00400a, 0x00400b,
+  0x00400c, 0x00400d, 0x00400e, 0x00400f, 0x004200, 0x004201,
+  0x004202, 0x004203, 0x004204, 0x004205, 0x004206, 0x004207,
+  0x004208, 0x004209, 0x00420a, 0x00420b, 0x00420c, 0x00420d,
+  0x00420e, 0x00420f, 0x004000, 0x004001, 0x004002, 0x004003,
+  0x004004, 0x004005, 0x004006, 0x004007, 0x004008, 0x004009,
+  0x00400a, 0x00400b, 0x00400c, 0x00400d, 0x00400e, 0x00400f,
+  0x004040, 0x004041, 0x004042, 0x004043, 0x004044, 0x004045,
+  0x004046, 0x004047, 0x004048, 0x004049, 0x00404a, 0x00404b,
+  0x00404c, 0x00404d, 0x00404e, 0x00404f, 0x004000, 0x004001,
+  0x004002, 0x004003, 0x004004, 0x004005, 0x004006, 0x004007,
+  0x004008, 0x004009, 0x00400a, 0x00400b, 0x00400c, 0x00400d,
+  0x00400e, 0x00400f, 0x004000, 0x004000, 0x004002, 0x004002,
+  0x004005, 0x004005, 0x004007, 0x004007, 0x004008, 0x004008,
+  0x00400a, 0x00400a, 0x00400d, 0x00400d, 0x00400f, 0x00400f,
+  0x004000, 0x004001, 0x004002, 0x004003, 0x004004, 0x004005,
+  0x004006, 0x004007, 0x004008, 0x004009, 0x00400a, 0x00400b,
+  0x00400c, 0x00400d, 0x00400e, 0x00400f, 0x004000, 0x004001,
+  0x004001, 0x004002, 0x004005, 0x004006, 0x004006, 0x004007,
+  0x004008, 0x004009, 0x004009, 0x00400a, 0x00400d, 0x00400e,
+  0x00400e, 0x00400f, 0x004000, 0x004001, 0x004002, 0x004003,
+  0x004004, 0x004005, 0x004006, 0x004007, 0x004008, 0x004009,
+  0x00400a, 0x00400b, 0x00400c, 0x00400d, 0x00400e, 0x00400f,
+  0x004001, 0x004002, 0x004002, 0x004003, 0x004004, 0x004005,
+  0x004005, 0x004006, 0x004009, 0x00400a, 0x00400a, 0x00400b,
+  0x00400c, 0x00400d, 0x00400d, 0x00400e, 0x004000, 0x004001,
+  0x004002, 0x004003, 0x004004, 0x004005, 0x004006, 0x004007,
+  0x004008, 0x004009, 0x00400a, 0x00400b, 0x00400c, 0x00400d,
+  0x00400e, 0x00400f, 0x004001, 0x004001, 0x004001, 0x004001,
+  0x004005, 0x004005, 0x004005, 0x004005, 0x004009, 0x004009,
+  0x004009, 0x004009, 0x00400d, 0x00400d, 0x00400d, 0x00400d,
+  0x004000, 0x004001, 0x004002, 0x004003, 0x004004, 0x004005,
+  0x004006, 0x004007, 0x004008, 0x004009, 0x00400a, 0x00400b,
+  0x00400c, 0x00400d, 0x00400e, 0x00400f, 0x004401, 0x004401,
+  0x004403, 0x004403, 0x004405, 0x004004, 0x004407, 0x004006,
+  0x004409, 0x004409, 0x00440b, 0x00440b, 0x00440d, 0x00400c,
+  0x00440f, 0x00400e, 0x004000, 0x004001, 0x004002, 0x004003,
+  0x004004, 0x004005, 0x004006, 0x004007, 0x004008, 0x004009,
+  0x00400a, 0x00400b, 0x00400c, 0x00400d, 0x00400e, 0x00400f,
+  0x004000, 0x004401, 0x004002, 0x004403, 0x004405, 0x004405,
+  0x004407, 0x004407, 0x004008, 0x004409, 0x00400a, 0x00440b,
+  0x00440d, 0x00440d, 0x00440f, 0x00440f, 0x004000, 0x004001,
+  0x004002, 0x004003, 0x004004, 0x004005, 0x004006, 0x004007,
+  0x004008, 0x004009, 0x00400a, 0x00400b, 0x00400c, 0x00400d,
+  0x00400e, 0x00400f, 0x004000, 0x004401, 0x004002, 0x004403,
+  0x004405, 0x004004, 0x004407, 0x004006, 0x004008, 0x004409,
+  0x00400a, 0x00440b, 0x00440d, 0x00400c, 0x00440f, 0x00400e,
+  0x004000, 0x004001, 0x004002, 0x004003, 0x004004, 0x004005,
+  0x004006, 0x004007, 0x004008, 0x004009, 0x00400a, 0x00400b,
+  0x00400c, 0x00400d, 0x00400e, 0x00400f, 0x004800, 0x005801,
+  0x004802, 0x005803, 0x004804, 0x005805, 0x004806, 0x005807,
+  0x004828, 0x005829, 0x00482a, 0x00582b, 0x00482c, 0x00582d,
+  0x00482e, 0x00582f, 0x004000, 0x004001, 0x004002, 0x004003,
+  0x004004, 0x004005, 0x004006, 0x004007, 0x004008, 0x004009,
+  0x00400a, 0x00400b, 0x00400c, 0x00400d, 0x00400e, 0x00400f,
+  0x005800, 0x004801, 0x005802, 0x004803, 0x005804, 0x004805,
+  0x005806, 0x004807, 0x005828, 0x004829, 0x00582a, 0x00482b,
+  0x00582c, 0x00482d, 0x00582e, 0x00482f, 0x004000, 0x004001,
+  0x004002, 0x004003, 0x004004, 0x004005, 0x004006, 0x004007,
+  0x004008, 0x004009, 0x00400a, 0x00400b, 0x00400c, 0x00400d,
+  0x00400e, 0x00400f, 0x004004, 0x004005, 0x004006, 0x004007,
+  0x004004, 0x004005, 0x004006, 0x004007, 0x00400c, 0x00400d,
+  0x00400e, 0x00400f, 0x00400c, 0x00400d, 0x00400e, 0x00400f,
+  0x004000, 0x004001, 0x004002, 0x004003, 0x004004, 0x004005,
+  0x004006, 0x004007, 0x004008, 0x004009, 0x00400a, 0x00400b,
+  0x00400c, 0x00400d, 0x00400e, 0x00400f, 0x004000, 0x004001,
+  0x004002, 0x004003, 0x00400c, 0x00400d, 0x00400e, 0x00400f,
+  0x004000, 0x004001, 0x004002, 0x004003, 0x00400c, 0x00400d,
+  0x00400e, 0x00400f, 0x004000, 0x004001, 0x004002, 0x004003,
+  0x004004, 0x004005, 0x004006, 0x004007, 0x004008, 0x004009,
+  0x00400a, 0x00400b, 0x00400c, 0x00400d, 0x00400e, 0x00400f,
+  0x004080, 0x004081, 0x004082, 0x004083, 0x004084, 0x004085,
+  0x004086, 0x004087, 0x004088, 0x004089, 0x00408a, 0x00408b,
+  0x00408c, 0x00408d, 0x00408e, 0x00408f, 0x004000, 0x004001,
+  0x004002, 0x004003, 0x004004, 0x004005, 0x004006, 0x004007,
+  0x004008, 0x004009, 0x00400a, 0x00400b, 0x00400c, 0x00400d,
+  0x00400e, 0x00400f, 0x000100, 0x000101, 0x000102, 0x000103,
+  0x000104, 0x000105, 0x000106, 0x000107, 0x000108, 0x000109,
+  0x00010a, 0x00010b, 0x00010c, 0x00010d, 0x00010e, 0x00010f,
+  0x004000, 0x004001, 0x004002, 0x004003, 0x004004, 0x004005,
+  0x004006, 0x004007, 0x004008, 0x004009, 0x00400a, 0x00400b,
+  0x00400c, 0x00400d, 0x00400e, 0x00400f, 0x000000, 0x004001,
+  0x000002, 0x004003, 0x000004, 0x004005, 0x000006, 0x004007,
+  0x000008, 0x004009, 0x00000a, 0x00400b, 0x00000c, 0x00400d,
+  0x00000e, 0x00400f, 0x004000, 0x004001, 0x004002, 0x004003,
+  0x004004, 0x004005, 0x004006, 0x004007, 0x004008, 0x004009,
+  0x00400a, 0x00400b, 0x00400c, 0x00400d, 0x00400e, 0x00400f,
+  0x004200, 0x004201, 0x004202, 0x004203, 0x004204, 0x004205,
+  0x004206, 0x004207, 0x004208, 0x004209, 0x00420a, 0x00420b,
+  0x00420c, 0x00420d, 0x00420e, 0x00420f, 0x004000, 0x004001,
+  0x004002, 0x004003, 0x004004, 0x004005, 0x004006, 0x004007,
+  0x004008, 0x004009, 0x00400a, 0x00400b, 0x00400c, 0x00400d,
+  0x00400e, 0x00400f, 0x000040, 0x000040, 0x000042, 0x000042,
+  0x000045, 0x000045, 0x000047, 0x000047, 0x000048, 0x000048,
+  0x00004a, 0x00004a, 0x00004d, 0x00004d, 0x00004f, 0x00004f,
+  0x000000, 0x000000, 0x000002, 0x000002, 0x000005, 0x000005,
+  0x000007, 0x000007, 0x000008, 0x000008, 0x00000a, 0x00000a,
+  0x00000d, 0x00000d, 0x00000f, 0x00000f, 0x000000, 0x000000,
+  0x000002, 0x000002, 0x000005, 0x000005, 0x000007, 0x000007,
+  0x000008, 0x000008, 0x00000a, 0x00000a, 0x00000d, 0x00000d,
+  0x00000f, 0x00000f, 0x000000, 0x000000, 0x000002, 0x000002,
+  0x000005, 0x000005, 0x000007, 0x000007, 0x000008, 0x000008,
+  0x00000a, 0x00000a, 0x00000d, 0x00000d, 0x00000f, 0x00000f,
+  0x000000, 0x000000, 0x000000, 0x000002, 0x000005, 0x000005,
+  0x000005, 0x000007, 0x000008, 0x000008, 0x000008, 0x00000a,
+  0x00000d, 0x00000d, 0x00000d, 0x00000f, 0x000000, 0x000000,
+  0x000002, 0x000002, 0x000005, 0x000005, 0x000007, 0x000007,
+  0x000008, 0x000008, 0x00000a, 0x00000a, 0x00000d, 0x00000d,
+  0x00000f, 0x00000f, 0x000000, 0x000002, 0x000002, 0x000002,
+  0x000005, 0x000007, 0x000007, 0x000007, 0x000008, 0x00000a,
+  0x00000a, 0x00000a, 0x00000d, 0x00000f, 0x00000f, 0x00000f,
+  0x000000, 0x000000, 0x000002, 0x000002, 0x000005, 0x000005,
+  0x000007, 0x000007, 0x000008, 0x000008, 0x00000a, 0x00000a,
+  0x00000d, 0x00000d, 0x00000f, 0x00000f, 0x000000, 0x000000,
+  0x000000, 0x000000, 0x000005, 0x000005, 0x000005, 0x000005,
+  0x000008, 0x000008, 0x000008, 0x000008, 0x00000d, 0x00000d,
+  0x00000d, 0x00000d, 0x000000, 0x000000, 0x000002, 0x000002,
+  0x000005, 0x000005, 0x000007, 0x000007, 0x000008, 0x000008,
+  0x00000a, 0x00000a, 0x00000d, 0x00000d, 0x00000f, 0x00000f,
+  0x000400, 0x000400, 0x000402, 0x000402, 0x000405, 0x000405,
+  0x000407, 0x000407, 0x000408, 0x000408, 0x00040a, 0x00040a,
+  0x00040d, 0x00040d, 0x00040f, 0x00040f, 0x000000, 0x000000,
+  0x000002, 0x000002, 0x000005, 0x000005, 0x000007, 0x000007,
+  0x000008, 0x000008, 0x00000a, 0x00000a, 0x00000d, 0x00000d,
+  0x00000f, 0x00000f, 0x000000, 0x000400, 0x000002, 0x000402,
+  0x000005, 0x000405, 0x000007, 0x000407, 0x000008, 0x000408,
+  0x00000a, 0x00040a, 0x00000d, 0x00040d, 0x00000f, 0x00040f,
+  0x000000, 0x000000, 0x000002, 0x000002, 0x000005, 0x000005,
+  0x000007, 0x000007, 0x000008, 0x000008, 0x00000a, 0x00000a,
+  0x00000d, 0x00000d, 0x00000f, 0x00000f, 0x000000, 0x000400,
+  0x000002, 0x000402, 0x000005, 0x000405, 0x000007, 0x000407,
+  0x000008, 0x000408, 0x00000a, 0x00040a, 0x00000d, 0x00040d,
+  0x00000f, 0x00040f, 0x000000, 0x000000, 0x000002, 0x000002,
+  0x000005, 0x000005, 0x000007, 0x000007, 0x000008, 0x000008,
+  0x00000a, 0x00000a, 0x00000d, 0x00000d, 0x00000f, 0x00000f,
+  0x000800, 0x001800, 0x000802, 0x001802, 0x000805, 0x001805,
+  0x000807, 0x001807, 0x000828, 0x001828, 0x00082a, 0x00182a,
+  0x00082d, 0x00182d, 0x00082f, 0x00182f, 0x000000, 0x000000,
+  0x000002, 0x000002, 0x000005, 0x000005, 0x000007, 0x000007,
+  0x000008, 0x000008, 0x00000a, 0x00000a, 0x00000d, 0x00000d,
+  0x00000f, 0x00000f, 0x001800, 0x000800, 0x001802, 0x000802,
+  0x001805, 0x000805, 0x001807, 0x000807, 0x001828, 0x000828,
+  0x00182a, 0x00082a, 0x00182d, 0x00082d, 0x00182f, 0x00082f,
+  0x000000, 0x000000, 0x000002, 0x000002, 0x000005, 0x000005,
+  0x000007, 0x000007, 0x000008, 0x000008, 0x00000a, 0x00000a,
+  0x00000d, 0x00000d, 0x00000f, 0x00000f, 0x000000, 0x000000,
+  0x000002, 0x000002, 0x000000, 0x000000, 0x000002, 0x000002,
+  0x000008, 0x000008, 0x00000a, 0x00000a, 0x000008, 0x000008,
+  0x00000a, 0x00000a, 0x000000, 0x000000, 0x000002, 0x000002,
+  0x000005, 0x000005, 0x000007, 0x000007, 0x000008, 0x000008,
+  0x00000a, 0x00000a, 0x00000d, 0x00000d, 0x00000f, 0x00000f,
+  0x000000, 0x000000, 0x000002, 0x000002, 0x000005, 0x000005,
+  0x000007, 0x000007, 0x000000, 0x000000, 0x000002, 0x000002,
+  0x000005, 0x000005, 0x000007, 0x000007, 0x000000, 0x000000,
+  0x000002, 0x000002, 0x000005, 0x000005, 0x000007, 0x000007,
+  0x000008, 0x000008, 0x00000a, 0x00000a, 0x00000d, 0x00000d,
+  0x00000f, 0x00000f, 0x000080, 0x000080, 0x000082, 0x000082,
+  0x000085, 0x000085, 0x000087, 0x000087, 0x000088, 0x000088,
+  0x00008a, 0x00008a, 0x00008d, 0x00008d, 0x00008f, 0x00008f,
+  0x000000, 0x000000, 0x000002, 0x000002, 0x000005, 0x000005,
+  0x000007, 0x000007, 0x000008, 0x000008, 0x00000a, 0x00000a,
+  0x00000d, 0x00000d, 0x00000f, 0x00000f, 0x000100, 0x000101,
+  0x000102, 0x000103, 0x000104, 0x000105, 0x000106, 0x000107,
+  0x000108, 0x000109, 0x00010a, 0x00010b, 0x00010c, 0x00010d,
+  0x00010e, 0x00010f, 0x000000, 0x000000, 0x000002, 0x000002,
+  0x000005, 0x000005, 0x000007, 0x000007, 0x000008, 0x000008,
+  0x00000a, 0x00000a, 0x00000d, 0x00000d, 0x00000f, 0x00000f,
+  0x000000, 0x000000, 0x000002, 0x000002, 0x000004, 0x000005,
+  0x000006, 0x000007, 0x000008, 0x000008, 0x00000a, 0x00000a,
+  0x00000c, 0x00000d, 0x00000e, 0x00000f, 0x000000, 0x000000,
+  0x000002, 0x000002, 0x000005, 0x000005, 0x000007, 0x000007,
+  0x000008, 0x000008, 0x00000a, 0x00000a, 0x00000d, 0x00000d,
+  0x00000f, 0x00000f, 0x000200, 0x000200, 0x000202, 0x000202,
+  0x000205, 0x000205, 0x000207, 0x000207, 0x000208, 0x000208,
+  0x00020a, 0x00020a, 0x00020d, 0x00020d, 0x00020f, 0x00020f,
+  0x000000, 0x000000, 0x000002, 0x000002, 0x000005, 0x000005,
+  0x000007, 0x000007, 0x000008, 0x000008, 0x00000a, 0x00000a,
+  0x00000d, 0x00000d, 0x00000f, 0x00000f, 0x000040, 0x000040,
+  0x000042, 0x000042, 0x000045, 0x000045, 0x000047, 0x000047,
+  0x000048, 0x000048, 0x00004a, 0x00004a, 0x00004d, 0x00004d,
+  0x00004f, 0x00004f, 0x000000, 0x000000, 0x000002, 0x000002,
+  0x000005, 0x000005, 0x000007, 0x000007, 0x000008, 0x000008,
+  0x00000a, 0x00000a, 0x00000d, 0x00000d, 0x00000f, 0x00000f,
+  0x000000, 0x000000, 0x000002, 0x000002, 0x000005, 0x000005,
+  0x000007, 0x000007, 0x000008, 0x000008, 0x00000a, 0x00000a,
+  0x00000d, 0x00000d, 0x00000f, 0x00000f, 0x000000, 0x000000,
+  0x000002, 0x000002, 0x000005, 0x000005, 0x000007, 0x000007,
+  0x000008, 0x000008, 0x00000a, 0x00000a, 0x00000d, 0x00000d,
+  0x00000f, 0x00000f, 0x000000, 0x000000, 0x000000, 0x000002,
+  0x000005, 0x000007, 0x000007, 0x000007, 0x000008, 0x000008,
+  0x000008, 0x00000a, 0x00000d, 0x00000f, 0x00000f, 0x00000f,
+  0x000000, 0x000000, 0x000002, 0x000002, 0x000005, 0x000005,
+  0x000007, 0x000007, 0x000008, 0x000008, 0x00000a, 0x00000a,
+  0x00000d, 0x00000d, 0x00000f, 0x00000f, 0x000000, 0x000002,
+  0x000002, 0x000002, 0x000005, 0x000005, 0x000005, 0x000007,
+  0x000008, 0x00000a, 0x00000a, 0x00000a, 0x00000d, 0x00000d,
+  0x00000d, 0x00000f, 0x000000, 0x000000, 0x000002, 0x000002,
+  0x000005, 0x000005, 0x000007, 0x000007, 0x000008, 0x000008,
+  0x00000a, 0x00000a, 0x00000d, 0x00000d, 0x00000f, 0x00000f,
+  0x000000, 0x000000, 0x000000, 0x000000, 0x000005, 0x000005,
+  0x000005, 0x000005, 0x000008, 0x000008, 0x000008, 0x000008,
+  0x00000d, 0x00000d, 0x00000d, 0x00000d, 0x000000, 0x000000,
+  0x000002, 0x000002, 0x000005, 0x000005, 0x000007, 0x000007,
+  0x000008, 0x000008, 0x00000a, 0x00000a, 0x00000d, 0x00000d,
+  0x00000f, 0x00000f, 0x000400, 0x000400, 0x000402, 0x000402,
+  0x000405, 0x000005, 0x000407, 0x000007, 0x000408, 0x000408,
+  0x00040a, 0x00040a, 0x00040d, 0x00000d, 0x00040f, 0x00000f,
+  0x000000, 0x000000, 0x000002, 0x000002, 0x000005, 0x000005,
+  0x000007, 0x000007, 0x000008, 0x000008, 0x00000a, 0x00000a,
+  0x00000d, 0x00000d, 0x00000f, 0x00000f, 0x000000, 0x000400,
+  0x000002, 0x000402, 0x000405, 0x000405, 0x000407, 0x000407,
+  0x000008, 0x000408, 0x00000a, 0x00040a, 0x00040d, 0x00040d,
+  0x00040f, 0x00040f, 0x000000, 0x000000, 0x000002, 0x000002,
+  0x000005, 0x000005, 0x000007, 0x000007, 0x000008, 0x000008,
+  0x00000a, 0x00000a, 0x00000d, 0x00000d, 0x00000f, 0x00000f,
+  0x000000, 0x000400, 0x000002, 0x000402, 0x000405, 0x000005,
+  0x000407, 0x000007, 0x000008, 0x000408, 0x00000a, 0x00040a,
+  0x00040d, 0x00000d, 0x00040f, 0x00000f, 0x000000, 0x000000,
+  0x000002, 0x000002, 0x000005, 0x000005, 0x000007, 0x000007,
+  0x000008, 0x000008, 0x00000a, 0x00000a, 0x00000d, 0x00000d,
+  0x00000f, 0x00000f, 0x000800, 0x001800, 0x000802, 0x001802,
+  0x000805, 0x001805, 0x000807, 0x001807, 0x000828, 0x001828,
+  0x00082a, 0x00182a, 0x00082d, 0x00182d, 0x00082f, 0x00182f,
+  0x000000, 0x000000, 0x000002, 0x000002, 0x000005, 0x000005,
+  0x000007, 0x000007, 0x000008, 0x000008, 0x00000a, 0x00000a,
+  0x00000d, 0x00000d, 0x00000f, 0x00000f, 0x001800, 0x000800,
+  0x001802, 0x000802, 0x001805, 0x000805, 0x001807, 0x000807,
+  0x001828, 0x000828, 0x00182a, 0x00082a, 0x00182d, 0x00082d,
+  0x00182f, 0x00082f, 0x000000, 0x000000, 0x000002, 0x000002,
+  0x000005, 0x000005, 0x000007, 0x000007, 0x000008, 0x000008,
+  0x00000a, 0x00000a, 0x00000d, 0x00000d, 0x00000f, 0x00000f,
+  0x000005, 0x000005, 0x000007, 0x000007, 0x000005, 0x000005,
+  0x000007, 0x000007, 0x00000d, 0x00000d, 0x00000f, 0x00000f,
+  0x00000d, 0x00000d, 0x00000f, 0x00000f, 0x000000, 0x000000,
+  0x000002, 0x000002, 0x000005, 0x000005, 0x000007, 0x000007,
+  0x000008, 0x000008, 0x00000a, 0x00000a, 0x00000d, 0x00000d,
+  0x00000f, 0x00000f, 0x000000, 0x000000, 0x000002, 0x000002,
+  0x00000d, 0x00000d, 0x00000f, 0x00000f, 0x000000, 0x000000,
+  0x000002, 0x000002, 0x00000d, 0x00000d, 0x00000f, 0x00000f,
+  0x000000, 0x000000, 0x000002, 0x000002, 0x000005, 0x000005,
+  0x000007, 0x000007, 0x000008, 0x000008, 0x00000a, 0x00000a,
+  0x00000d, 0x00000d, 0x00000f, 0x00000f, 0x000080, 0x000080,
+  0x000082, 0x000082, 0x000085, 0x000085, 0x000087, 0x000087,
+  0x000088, 0x000088, 0x00008a, 0x00008a, 0x00008d, 0x00008d,
+  0x00008f, 0x00008f, 0x000000, 0x000000, 0x000002, 0x000002,
+  0x000005, 0x000005, 0x000007, 0x000007, 0x000008, 0x000008,
+  0x00000a, 0x00000a, 0x00000d, 0x00000d, 0x00000f, 0x00000f,
+  0x000100, 0x000101, 0x000102, 0x000103, 0x000104, 0x000105,
+  0x000106, 0x000107, 0x000108, 0x000109, 0x00010a, 0x00010b,
+  0x00010c, 0x00010d, 0x00010e, 0x00010f, 0x000000, 0x000000,
+  0x000002, 0x000002, 0x000005, 0x000005, 0x000007, 0x000007,
+  0x000008, 0x000008, 0x00000a, 0x00000a, 0x00000d, 0x00000d,
+  0x00000f, 0x00000f, 0x000000, 0x000000, 0x000002, 0x000002,
+  0x000004, 0x000005, 0x000006, 0x000007, 0x000008, 0x000008,
+  0x00000a, 0x00000a, 0x00000c, 0x00000d, 0x00000e, 0x00000f,
+  0x000000, 0x000000, 0x000002, 0x000002, 0x000005, 0x000005,
+  0x000007, 0x000007, 0x000008, 0x000008, 0x00000a, 0x00000a,
+  0x00000d, 0x00000d, 0x00000f, 0x00000f, 0x000200, 0x000200,
+  0x000202, 0x000202, 0x000205, 0x000205, 0x000207, 0x000207,
+  0x000208, 0x000208, 0x00020a, 0x00020a, 0x00020d, 0x00020d,
+  0x00020f, 0x00020f, 0x000000, 0x000000, 0x000002, 0x000002,
+  0x000005, 0x000005, 0x000007, 0x000007, 0x000008, 0x000008,
+  0x00000a, 0x00000a, 0x00000d, 0x00000d, 0x00000f, 0x00000f,
+  0x000040, 0x000041, 0x000041, 0x000042, 0x000045, 0x000046,
+  0x000046, 0x000047, 0x000048, 0x000049, 0x000049, 0x00004a,
+  0x00004d, 0x00004e, 0x00004e, 0x00004f, 0x000000, 0x000001,
+  0x000001, 0x000002, 0x000005, 0x000006, 0x000006, 0x000007,
+  0x000008, 0x000009, 0x000009, 0x00000a, 0x00000d, 0x00000e,
+  0x00000e, 0x00000f, 0x000000, 0x000000, 0x000001, 0x000001,
+  0x000005, 0x000005, 0x000006, 0x000006, 0x000008, 0x000008,
+  0x000009, 0x000009, 0x00000d, 0x00000d, 0x00000e, 0x00000e,
+  0x000000, 0x000001, 0x000001, 0x000002, 0x000005, 0x000006,
+  0x000006, 0x000007, 0x000008, 0x000009, 0x000009, 0x00000a,
+  0x00000d, 0x00000e, 0x00000e, 0x00000f, 0x000000, 0x000001,
+  0x000001, 0x000001, 0x000005, 0x000006, 0x000006, 0x000006,
+  0x000008, 0x000009, 0x000009, 0x000009, 0x00000d, 0x00000e,
+  0x00000e, 0x00000e, 0x000000, 0x000001, 0x000001, 0x000002,
+  0x000005, 0x000006, 0x000006, 0x000007, 0x000008, 0x000009,
+  0x000009, 0x00000a, 0x00000d, 0x00000e, 0x00000e, 0x00000f,
+  0x000001, 0x000001, 0x000001, 0x000002, 0x000006, 0x000006,
+  0x000006, 0x000007, 0x000009, 0x000009, 0x000009, 0x00000a,
+  0x00000e, 0x00000e, 0x00000e, 0x00000f, 0x000000, 0x000001,
+  0x000001, 0x000002, 0x000005, 0x000006, 0x000006, 0x000007,
+  0x000008, 0x000009, 0x000009, 0x00000a, 0x00000d, 0x00000e,
+  0x00000e, 0x00000f, 0x000001, 0x000001, 0x000001, 0x000001,
+  0x000006, 0x000006, 0x000006, 0x000006, 0x000009, 0x000009,
+  0x000009, 0x000009, 0x00000e, 0x00000e, 0x00000e, 0x00000e,
+  0x000000, 0x000001, 0x000001, 0x000002, 0x000005, 0x000006,
+  0x000006, 0x000007, 0x000008, 0x000009, 0x000009, 0x00000a,
+  0x00000d, 0x00000e, 0x00000e, 0x00000f, 0x000401, 0x000401,
+  0x000402, 0x000402, 0x000406, 0x000406, 0x000407, 0x000407,
+  0x000409, 0x000409, 0x00040a, 0x00040a, 0x00040e, 0x00040e,
+  0x00040f, 0x00040f, 0x000000, 0x000001, 0x000001, 0x000002,
+  0x000005, 0x000006, 0x000006, 0x000007, 0x000008, 0x000009,
+  0x000009, 0x00000a, 0x00000d, 0x00000e, 0x00000e, 0x00000f,
+  0x000000, 0x000401, 0x000001, 0x000402, 0x000005, 0x000406,
+  0x000006, 0x000407, 0x000008, 0x000409, 0x000009, 0x00040a,
+  0x00000d, 0x00040e, 0x00000e, 0x00040f, 0x000000, 0x000001,
+  0x000001, 0x000002, 0x000005, 0x000006, 0x000006, 0x000007,
+  0x000008, 0x000009, 0x000009, 0x00000a, 0x00000d, 0x00000e,
+  0x00000e, 0x00000f, 0x000000, 0x000401, 0x000001, 0x000402,
+  0x000005, 0x000406, 0x000006, 0x000407, 0x000008, 0x000409,
+  0x000009, 0x00040a, 0x00000d, 0x00040e, 0x00000e, 0x00040f,
+  0x000000, 0x000001, 0x000001, 0x000002, 0x000005, 0x000006,
+  0x000006, 0x000007, 0x000008, 0x000009, 0x000009, 0x00000a,
+  0x00000d, 0x00000e, 0x00000e, 0x00000f, 0x000800, 0x001801,
+  0x000801, 0x001802, 0x000805, 0x001806, 0x000806, 0x001807,
+  0x000828, 0x001829, 0x000829, 0x00182a, 0x00082d, 0x00182e,
+  0x00082e, 0x00182f, 0x000000, 0x000001, 0x000001, 0x000002,
+  0x000005, 0x000006, 0x000006, 0x000007, 0x000008, 0x000009,
+  0x000009, 0x00000a, 0x00000d, 0x00000e, 0x00000e, 0x00000f,
+  0x001800, 0x000801, 0x001801, 0x000802, 0x001805, 0x000806,
+  0x001806, 0x000807, 0x001828, 0x000829, 0x001829, 0x00082a,
+  0x00182d, 0x00082e, 0x00182e, 0x00082f, 0x000000, 0x000001,
+  0x000001, 0x000002, 0x000005, 0x000006, 0x000006, 0x000007,
+  0x000008, 0x000009, 0x000009, 0x00000a, 0x00000d, 0x00000e,
+  0x00000e, 0x00000f, 0x000000, 0x000001, 0x000001, 0x000002,
+  0x000000, 0x000001, 0x000001, 0x000002, 0x000008, 0x000009,
+  0x000009, 0x00000a, 0x000008, 0x000009, 0x000009, 0x00000a,
+  0x000000, 0x000001, 0x000001, 0x000002, 0x000005, 0x000006,
+  0x000006, 0x000007, 0x000008, 0x000009, 0x000009, 0x00000a,
+  0x00000d, 0x00000e, 0x00000e, 0x00000f, 0x000000, 0x000001,
+  0x000001, 0x000002, 0x000005, 0x000006, 0x000006, 0x000007,
+  0x000000, 0x000001, 0x000001, 0x000002, 0x000005, 0x000006,
+  0x000006, 0x000007, 0x000000, 0x000001, 0x000001, 0x000002,
+  0x000005, 0x000006, 0x000006, 0x000007, 0x000008, 0x000009,
+  0x000009, 0x00000a, 0x00000d, 0x00000e, 0x00000e, 0x00000f,
+  0x000080, 0x000081, 0x000081, 0x000082, 0x000085, 0x000086,
+  0x000086, 0x000087, 0x000088, 0x000089, 0x000089, 0x00008a,
+  0x00008d, 0x00008e, 0x00008e, 0x00008f, 0x000000, 0x000001,
+  0x000001, 0x000002, 0x000005, 0x000006, 0x000006, 0x000007,
+  0x000008, 0x000009, 0x000009, 0x00000a, 0x00000d, 0x00000e,
+  0x00000e, 0x00000f, 0x000100, 0x000101, 0x000102, 0x000103,
+  0x000104, 0x000105, 0x000106, 0x000107, 0x000108, 0x000109,
+  0x00010a, 0x00010b, 0x00010c, 0x00010d, 0x00010e, 0x00010f,
+  0x000000, 0x000001, 0x000001, 0x000002, 0x000005, 0x000006,
+  0x000006, 0x000007, 0x000008, 0x000009, 0x000009, 0x00000a,
+  0x00000d, 0x00000e, 0x00000e, 0x00000f, 0x000000, 0x000001,
+  0x000002, 0x000002, 0x000004, 0x000006, 0x000006, 0x000007,
+  0x000008, 0x000009, 0x00000a, 0x00000a, 0x00000c, 0x00000e,
+  0x00000e, 0x00000f, 0x000000, 0x000001, 0x000001, 0x000002,
+  0x000005, 0x000006, 0x000006, 0x000007, 0x000008, 0x000009,
+  0x000009, 0x00000a, 0x00000d, 0x00000e, 0x00000e, 0x00000f,
+  0x000200, 0x000201, 0x000201, 0x000202, 0x000205, 0x000206,
+  0x000206, 0x000207, 0x000208, 0x000209, 0x000209, 0x00020a,
+  0x00020d, 0x00020e, 0x00020e, 0x00020f, 0x000000, 0x000001,
+  0x000001, 0x000002, 0x000005, 0x000006, 0x000006, 0x000007,
+  0x000008, 0x000009, 0x000009, 0x00000a, 0x00000d, 0x00000e,
+  0x00000e, 0x00000f, 0x000040, 0x000041, 0x000041, 0x000042,
+  0x000045, 0x000046, 0x000046, 0x000047, 0x000048, 0x000049,
+  0x000049, 0x00004a, 0x00004d, 0x00004e, 0x00004e, 0x00004f,
+  0x000000, 0x000001, 0x000001, 0x000002, 0x000005, 0x000006,
+  0x000006, 0x000007, 0x000008, 0x000009, 0x000009, 0x00000a,
+  0x00000d, 0x00000e, 0x00000e, 0x00000f, 0x000000, 0x000000,
+  0x000001, 0x000001, 0x000006, 0x000006, 0x000007, 0x000007,
+  0x000008, 0x000008, 0x000009, 0x000009, 0x00000e, 0x00000e,
+  0x00000f, 0x00000f, 0x000000, 0x000001, 0x000001, 0x000002,
+  0x000005, 0x000006, 0x000006, 0x000007, 0x000008, 0x000009,
+  0x000009, 0x00000a, 0x00000d, 0x00000e, 0x00000e, 0x00000f,
+  0x000000, 0x000001, 0x000001, 0x000001, 0x000006, 0x000006,
+  0x000006, 0x000007, 0x000008, 0x000009, 0x000009, 0x000009,
+  0x00000e, 0x00000e, 0x00000e, 0x00000f, 0x000000, 0x000001,
+  0x000001, 0x000002, 0x000005, 0x000006, 0x000006, 0x000007,
+  0x000008, 0x000009, 0x000009, 0x00000a, 0x00000d, 0x00000e,
+  0x00000e, 0x00000f, 0x000001, 0x000001, 0x000001, 0x000002,
+  0x000005, 0x000006, 0x000006, 0x000006, 0x000009, 0x000009,
+  0x000009, 0x00000a, 0x00000d, 0x00000e, 0x00000e, 0x00000e,
+  0x000000, 0x000001, 0x000001, 0x000002, 0x000005, 0x000006,
+  0x000006, 0x000007, 0x000008, 0x000009, 0x000009, 0x00000a,
+  0x00000d, 0x00000e, 0x00000e, 0x00000f, 0x000001, 0x000001,
+  0x000001, 0x000001, 0x000006, 0x000006, 0x000006, 0x000006,
+  0x000009, 0x000009, 0x000009, 0x000009, 0x00000e, 0x00000e,
+  0x00000e, 0x00000e, 0x000000, 0x000001, 0x000001, 0x000002,
+  0x000005, 0x000006, 0x000006, 0x000007, 0x000008, 0x000009,
+  0x000009, 0x00000a, 0x00000d, 0x00000e, 0x00000e, 0x00000f,
+  0x000401, 0x000401, 0x000402, 0x000402, 0x000406, 0x000005,
+  0x000407, 0x000006, 0x000409, 0x000409, 0x00040a, 0x00040a,
+  0x00040e, 0x00000d, 0x00040f, 0x00000e, 0x000000, 0x000001,
+  0x000001, 0x000002, 0x000005, 0x000006, 0x000006, 0x000007,
+  0x000008, 0x000009, 0x000009, 0x00000a, 0x00000d, 0x00000e,
+  0x00000e, 0x00000f, 0x000000, 0x000401, 0x000001, 0x000402,
+  0x000406, 0x000406, 0x000407, 0x000407, 0x000008, 0x000409,
+  0x000009, 0x00040a, 0x00040e, 0x00040e, 0x00040f, 0x00040f,
+  0x000000, 0x000001, 0x000001, 0x000002, 0x000005, 0x000006,
+  0x000006, 0x000007, 0x000008, 0x000009, 0x000009, 0x00000a,
+  0x00000d, 0x00000e, 0x00000e, 0x00000f, 0x000000, 0x000401,
+  0x000001, 0x000402, 0x000406, 0x000005, 0x000407, 0x000006,
+  0x000008, 0x000409, 0x000009, 0x00040a, 0x00040e, 0x00000d,
+  0x00040f, 0x00000e, 0x000000, 0x000001, 0x000001, 0x000002,
+  0x000005, 0x000006, 0x000006, 0x000007, 0x000008, 0x000009,
+  0x000009, 0x00000a, 0x00000d, 0x00000e, 0x00000e, 0x00000f,
+  0x000800, 0x001801, 0x000801, 0x001802, 0x000805, 0x001806,
+  0x000806, 0x001807, 0x000828, 0x001829, 0x000829, 0x00182a,
+  0x00082d, 0x00182e, 0x00082e, 0x00182f, 0x000000, 0x000001,
+  0x000001, 0x000002, 0x000005, 0x000006, 0x000006, 0x000007,
+  0x000008, 0x000009, 0x000009, 0x00000a, 0x00000d, 0x00000e,
+  0x00000e, 0x00000f, 0x001800, 0x000801, 0x001801, 0x000802,
+  0x001805, 0x000806, 0x001806, 0x000807, 0x001828, 0x000829,
+  0x001829, 0x00082a, 0x00182d, 0x00082e, 0x00182e, 0x00082f,
+  0x000000, 0x000001, 0x000001, 0x000002, 0x000005, 0x000006,
+  0x000006, 0x000007, 0x000008, 0x000009, 0x000009, 0x00000a,
+  0x00000d, 0x00000e, 0x00000e, 0x00000f, 0x000005, 0x000006,
+  0x000006, 0x000007, 0x000005, 0x000006, 0x000006, 0x000007,
+  0x00000d, 0x00000e, 0x00000e, 0x00000f, 0x00000d, 0x00000e,
+  0x00000e, 0x00000f, 0x000000, 0x000001, 0x000001, 0x000002,
+  0x000005, 0x000006, 0x000006, 0x000007, 0x000008, 0x000009,
+  0x000009, 0x00000a, 0x00000d, 0x00000e, 0x00000e, 0x00000f,
+  0x000000, 0x000001, 0x000001, 0x000002, 0x00000d, 0x00000e,
+  0x00000e, 0x00000f, 0x000000, 0x000001, 0x000001, 0x000002,
+  0x00000d, 0x00000e, 0x00000e, 0x00000f, 0x000000, 0x000001,
+  0x000001, 0x000002, 0x000005, 0x000006, 0x000006, 0x000007,
+  0x000008, 0x000009, 0x000009, 0x00000a, 0x00000d, 0x00000e,
+  0x00000e, 0x00000f, 0x000080, 0x000081, 0x000081, 0x000082,
+  0x000085, 0x000086, 0x000086, 0x000087, 0x000088, 0x000089,
+  0x000089, 0x00008a, 0x00008d, 0x00008e, 0x00008e, 0x00008f,
+  0x000000, 0x000001, 0x000001, 0x000002, 0x000005, 0x000006,
+  0x000006, 0x000007, 0x000008, 0x000009, 0x000009, 0x00000a,
+  0x00000d, 0x00000e, 0x00000e, 0x00000f, 0x000100, 0x000101,
+  0x000102, 0x000103, 0x000104, 0x000105, 0x000106, 0x000107,
+  0x000108, 0x000109, 0x00010a, 0x00010b, 0x00010c, 0x00010d,
+  0x00010e, 0x00010f, 0x000000, 0x000001, 0x000001, 0x000002,
+  0x000005, 0x000006, 0x000006, 0x000007, 0x000008, 0x000009,
+  0x000009, 0x00000a, 0x00000d, 0x00000e, 0x00000e, 0x00000f,
+  0x000000, 0x000001, 0x000002, 0x000002, 0x000004, 0x000006,
+  0x000006, 0x000007, 0x000008, 0x000009, 0x00000a, 0x00000a,
+  0x00000c, 0x00000e, 0x00000e, 0x00000f, 0x000000, 0x000001,
+  0x000001, 0x000002, 0x000005, 0x000006, 0x000006, 0x000007,
+  0x000008, 0x000009, 0x000009, 0x00000a, 0x00000d, 0x00000e,
+  0x00000e, 0x00000f, 0x000200, 0x000201, 0x000201, 0x000202,
+  0x000205, 0x000206, 0x000206, 0x000207, 0x000208, 0x000209,
+  0x000209, 0x00020a, 0x00020d, 0x00020e, 0x00020e, 0x00020f,
+  0x000000, 0x000001, 0x000001, 0x000002, 0x000005, 0x000006,
+  0x000006, 0x000007, 0x000008, 0x000009, 0x000009, 0x00000a,
+  0x00000d, 0x00000e, 0x00000e, 0x00000f, 0x000041, 0x000042,
+  0x000042, 0x000043, 0x000044, 0x000045, 0x000045, 0x000046,
+  0x000049, 0x00004a, 0x00004a, 0x00004b, 0x00004c, 0x00004d,
+  0x00004d, 0x00004e, 0x000001, 0x000002, 0x000002, 0x000003,
+  0x000004, 0x000005, 0x000005, 0x000006, 0x000009, 0x00000a,
+  0x00000a, 0x00000b, 0x00000c, 0x00000d, 0x00000d, 0x00000e,
+  0x000001, 0x000001, 0x000002, 0x000002, 0x000004, 0x000004,
+  0x000005, 0x000005, 0x000009, 0x000009, 0x00000a, 0x00000a,
+  0x00000c, 0x00000c, 0x00000d, 0x00000d, 0x000001, 0x000002,
+  0x000002, 0x000003, 0x000004, 0x000005, 0x000005, 0x000006,
+  0x000009, 0x00000a, 0x00000a, 0x00000b, 0x00000c, 0x00000d,
+  0x00000d, 0x00000e, 0x000001, 0x000002, 0x000002, 0x000002,
+  0x000004, 0x000005, 0x000005, 0x000005, 0x000009, 0x00000a,
+  0x00000a, 0x00000a, 0x00000c, 0x00000d, 0x00000d, 0x00000d,
+  0x000001, 0x000002, 0x000002, 0x000003, 0x000004, 0x000005,
+  0x000005, 0x000006, 0x000009, 0x00000a, 0x00000a, 0x00000b,
+  0x00000c, 0x00000d, 0x00000d, 0x00000e, 0x000002, 0x000002,
+  0x000002, 0x000003, 0x000005, 0x000005, 0x000005, 0x000006,
+  0x00000a, 0x00000a, 0x00000a, 0x00000b, 0x00000d, 0x00000d,
+  0x00000d, 0x00000e, 0x000001, 0x000002, 0x000002, 0x000003,
+  0x000004, 0x000005, 0x000005, 0x000006, 0x000009, 0x00000a,
+  0x00000a, 0x00000b, 0x00000c, 0x00000d, 0x00000d, 0x00000e,
+  0x000002, 0x000002, 0x000002, 0x000002, 0x000005, 0x000005,
+  0x000005, 0x000005, 0x00000a, 0x00000a, 0x00000a, 0x00000a,
+  0x00000d, 0x00000d, 0x00000d, 0x00000d, 0x000001, 0x000002,
+  0x000002, 0x000003, 0x000004, 0x000005, 0x000005, 0x000006,
+  0x000009, 0x00000a, 0x00000a, 0x00000b, 0x00000c, 0x00000d,
+  0x00000d, 0x00000e, 0x000402, 0x000402, 0x000403, 0x000403,
+  0x000405, 0x000405, 0x000406, 0x000406, 0x00040a, 0x00040a,
+  0x00040b, 0x00040b, 0x00040d, 0x00040d, 0x00040e, 0x00040e,
+  0x000001, 0x000002, 0x000002, 0x000003, 0x000004, 0x000005,
+  0x000005, 0x000006, 0x000009, 0x00000a, 0x00000a, 0x00000b,
+  0x00000c, 0x00000d, 0x00000d, 0x00000e, 0x000001, 0x000402,
+  0x000002, 0x000403, 0x000004, 0x000405, 0x000005, 0x000406,
+  0x000009, 0x00040a, 0x00000a, 0x00040b, 0x00000c, 0x00040d,
+  0x00000d, 0x00040e, 0x000001, 0x000002, 0x000002, 0x000003,
+  0x000004, 0x000005, 0x000005, 0x000006, 0x000009, 0x00000a,
+  0x00000a, 0x00000b, 0x00000c, 0x00000d, 0x00000d, 0x00000e,
+  0x000001, 0x000402, 0x000002, 0x000403, 0x000004, 0x000405,
+  0x000005, 0x000406, 0x000009, 0x00040a, 0x00000a, 0x00040b,
+  0x00000c, 0x00040d, 0x00000d, 0x00040e, 0x000001, 0x000002,
+  0x000002, 0x000003, 0x000004, 0x000005, 0x000005, 0x000006,
+  0x000009, 0x00000a, 0x00000a, 0x00000b, 0x00000c, 0x00000d,
+  0x00000d, 0x00000e, 0x000801, 0x001802, 0x000802, 0x001803,
+  0x000804, 0x001805, 0x000805, 0x001806, 0x000829, 0x00182a,
+  0x00082a, 0x00182b, 0x00082c, 0x00182d, 0x00082d, 0x00182e,
+  0x000001, 0x000002, 0x000002, 0x000003, 0x000004, 0x000005,
+  0x000005, 0x000006, 0x000009, 0x00000a, 0x00000a, 0x00000b,
+  0x00000c, 0x00000d, 0x00000d, 0x00000e, 0x001801, 0x000802,
+  0x001802, 0x000803, 0x001804, 0x000805, 0x001805, 0x000806,
+  0x001829, 0x00082a, 0x00182a, 0x00082b, 0x00182c, 0x00082d,
+  0x00182d, 0x00082e, 0x000001, 0x000002, 0x000002, 0x000003,
+  0x000004, 0x000005, 0x000005, 0x000006, 0x000009, 0x00000a,
+  0x00000a, 0x00000b, 0x00000c, 0x00000d, 0x00000d, 0x00000e,
+  0x000001, 0x000002, 0x000002, 0x000003, 0x000001, 0x000002,
+  0x000002, 0x000003, 0x000009, 0x00000a, 0x00000a, 0x00000b,
+  0x000009, 0x00000a, 0x00000a, 0x00000b, 0x000001, 0x000002,
+  0x000002, 0x000003, 0x000004, 0x000005, 0x000005, 0x000006,
+  0x000009, 0x00000a, 0x00000a, 0x00000b, 0x00000c, 0x00000d,
+  0x00000d, 0x00000e, 0x000001, 0x000002, 0x000002, 0x000003,
+  0x000004, 0x000005, 0x000005, 0x000006, 0x000001, 0x000002,
+  0x000002, 0x000003, 0x000004, 0x000005, 0x000005, 0x000006,
+  0x000001, 0x000002, 0x000002, 0x000003, 0x000004, 0x000005,
+  0x000005, 0x000006, 0x000009, 0x00000a, 0x00000a, 0x00000b,
+  0x00000c, 0x00000d, 0x00000d, 0x00000e, 0x000081, 0x000082,
+  0x000082, 0x000083, 0x000084, 0x000085, 0x000085, 0x000086,
+  0x000089, 0x00008a, 0x00008a, 0x00008b, 0x00008c, 0x00008d,
+  0x00008d, 0x00008e, 0x000001, 0x000002, 0x000002, 0x000003,
+  0x000004, 0x000005, 0x000005, 0x000006, 0x000009, 0x00000a,
+  0x00000a, 0x00000b, 0x00000c, 0x00000d, 0x00000d, 0x00000e,
+  0x000100, 0x000101, 0x000102, 0x000103, 0x000104, 0x000105,
+  0x000106, 0x000107, 0x000108, 0x000109, 0x00010a, 0x00010b,
+  0x00010c, 0x00010d, 0x00010e, 0x00010f, 0x000001, 0x000002,
+  0x000002, 0x000003, 0x000004, 0x000005, 0x000005, 0x000006,
+  0x000009, 0x00000a, 0x00000a, 0x00000b, 0x00000c, 0x00000d,
+  0x00000d, 0x00000e, 0x000000, 0x000002, 0x000002, 0x000003,
+  0x000004, 0x000005, 0x000006, 0x000006, 0x000008, 0x00000a,
+  0x00000a, 0x00000b, 0x00000c, 0x00000d, 0x00000e, 0x00000e,
+  0x000001, 0x000002, 0x000002, 0x000003, 0x000004, 0x000005,
+  0x000005, 0x000006, 0x000009, 0x00000a, 0x00000a, 0x00000b,
+  0x00000c, 0x00000d, 0x00000d, 0x00000e, 0x000201, 0x000202,
+  0x000202, 0x000203, 0x000204, 0x000205, 0x000205, 0x000206,
+  0x000209, 0x00020a, 0x00020a, 0x00020b, 0x00020c, 0x00020d,
+  0x00020d, 0x00020e, 0x000001, 0x000002, 0x000002, 0x000003,
+  0x000004, 0x000005, 0x000005, 0x000006, 0x000009, 0x00000a,
+  0x00000a, 0x00000b, 0x00000c, 0x00000d, 0x00000d, 0x00000e,
+  0x000041, 0x000042, 0x000042, 0x000043, 0x000044, 0x000045,
+  0x000045, 0x000046, 0x000049, 0x00004a, 0x00004a, 0x00004b,
+  0x00004c, 0x00004d, 0x00004d, 0x00004e, 0x000001, 0x000002,
+  0x000002, 0x000003, 0x000004, 0x000005, 0x000005, 0x000006,
+  0x000009, 0x00000a, 0x00000a, 0x00000b, 0x00000c, 0x00000d,
+  0x00000d, 0x00000e, 0x000001, 0x000001, 0x000002, 0x000002,
+  0x000005, 0x000005, 0x000006, 0x000006, 0x000009, 0x000009,
+  0x00000a, 0x00000a, 0x00000d, 0x00000d, 0x00000e, 0x00000e,
+  0x000001, 0x000002, 0x000002, 0x000003, 0x000004, 0x000005,
+  0x000005, 0x000006, 0x000009, 0x00000a, 0x00000a, 0x00000b,
+  0x00000c, 0x00000d, 0x00000d, 0x00000e, 0x000001, 0x000002,
+  0x000002, 0x000002, 0x000005, 0x000005, 0x000005, 0x000006,
+  0x000009, 0x00000a, 0x00000a, 0x00000a, 0x00000d, 0x00000d,
+  0x00000d, 0x00000e, 0x000001, 0x000002, 0x000002, 0x000003,
+  0x000004, 0x000005, 0x000005, 0x000006, 0x000009, 0x00000a,
+  0x00000a, 0x00000b, 0x00000c, 0x00000d, 0x00000d, 0x00000e,
+  0x000002, 0x000002, 0x000002, 0x000003, 0x000004, 0x000005,
+  0x000005, 0x000005, 0x00000a, 0x00000a, 0x00000a, 0x00000b,
+  0x00000c, 0x00000d, 0x00000d, 0x00000d, 0x000001, 0x000002,
+  0x000002, 0x000003, 0x000004, 0x000005, 0x000005, 0x000006,
+  0x000009, 0x00000a, 0x00000a, 0x00000b, 0x00000c, 0x00000d,
+  0x00000d, 0x00000e, 0x000002, 0x000002, 0x000002, 0x000002,
+  0x000005, 0x000005, 0x000005, 0x000005, 0x00000a, 0x00000a,
+  0x00000a, 0x00000a, 0x00000d, 0x00000d, 0x00000d, 0x00000d,
+  0x000001, 0x000002, 0x000002, 0x000003, 0x000004, 0x000005,
+  0x000005, 0x000006, 0x000009, 0x00000a, 0x00000a, 0x00000b,
+  0x00000c, 0x00000d, 0x00000d, 0x00000e, 0x000402, 0x000402,
+  0x000403, 0x000403, 0x000405, 0x000004, 0x000406, 0x000005,
+  0x00040a, 0x00040a, 0x00040b, 0x00040b, 0x00040d, 0x00000c,
+  0x00040e, 0x00000d, 0x000001, 0x000002, 0x000002, 0x000003,
+  0x000004, 0x000005, 0x000005, 0x000006, 0x000009, 0x00000a,
+  0x00000a, 0x00000b, 0x00000c, 0x00000d, 0x00000d, 0x00000e,
+  0x000001, 0x000402, 0x000002, 0x000403, 0x000405, 0x000405,
+  0x000406, 0x000406, 0x000009, 0x00040a, 0x00000a, 0x00040b,
+  0x00040d, 0x00040d, 0x00040e, 0x00040e, 0x000001, 0x000002,
+  0x000002, 0x000003, 0x000004, 0x000005, 0x000005, 0x000006,
+  0x000009, 0x00000a, 0x00000a, 0x00000b, 0x00000c, 0x00000d,
+  0x00000d, 0x00000e, 0x000001, 0x000402, 0x000002, 0x000403,
+  0x000405, 0x000004, 0x000406, 0x000005, 0x000009, 0x00040a,
+  0x00000a, 0x00040b, 0x00040d, 0x00000c, 0x00040e, 0x00000d,
+  0x000001, 0x000002, 0x000002, 0x000003, 0x000004, 0x000005,
+  0x000005, 0x000006, 0x000009, 0x00000a, 0x00000a, 0x00000b,
+  0x00000c, 0x00000d, 0x00000d, 0x00000e, 0x000801, 0x001802,
+  0x000802, 0x001803, 0x000804, 0x001805, 0x000805, 0x001806,
+  0x000829, 0x00182a, 0x00082a, 0x00182b, 0x00082c, 0x00182d,
+  0x00082d, 0x00182e, 0x000001, 0x000002, 0x000002, 0x000003,
+  0x000004, 0x000005, 0x000005, 0x000006, 0x000009, 0x00000a,
+  0x00000a, 0x00000b, 0x00000c, 0x00000d, 0x00000d, 0x00000e,
+  0x001801, 0x000802, 0x001802, 0x000803, 0x001804, 0x000805,
+  0x001805, 0x000806, 0x001829, 0x00082a, 0x00182a, 0x00082b,
+  0x00182c, 0x00082d, 0x00182d, 0x00082e, 0x000001, 0x000002,
+  0x000002, 0x000003, 0x000004, 0x000005, 0x000005, 0x000006,
+  0x000009, 0x00000a, 0x00000a, 0x00000b, 0x00000c, 0x00000d,
+  0x00000d, 0x00000e, 0x000004, 0x000005, 0x000005, 0x000006,
+  0x000004, 0x000005, 0x000005, 0x000006, 0x00000c, 0x00000d,
+  0x00000d, 0x00000e, 0x00000c, 0x00000d, 0x00000d, 0x00000e,
+  0x000001, 0x000002, 0x000002, 0x000003, 0x000004, 0x000005,
+  0x000005, 0x000006, 0x000009, 0x00000a, 0x00000a, 0x00000b,
+  0x00000c, 0x00000d, 0x00000d, 0x00000e, 0x000001, 0x000002,
+  0x000002, 0x000003, 0x00000c, 0x00000d, 0x00000d, 0x00000e,
+  0x000001, 0x000002, 0x000002, 0x000003, 0x00000c, 0x00000d,
+  0x00000d, 0x00000e, 0x000001, 0x000002, 0x000002, 0x000003,
+  0x000004, 0x000005, 0x000005, 0x000006, 0x000009, 0x00000a,
+  0x00000a, 0x00000b, 0x00000c, 0x00000d, 0x00000d, 0x00000e,
+  0x000081, 0x000082, 0x000082, 0x000083, 0x000084, 0x000085,
+  0x000085, 0x000086, 0x000089, 0x00008a, 0x00008a, 0x00008b,
+  0x00008c, 0x00008d, 0x00008d, 0x00008e, 0x000001, 0x000002,
+  0x000002, 0x000003, 0x000004, 0x000005, 0x000005, 0x000006,
+  0x000009, 0x00000a, 0x00000a, 0x00000b, 0x00000c, 0x00000d,
+  0x00000d, 0x00000e, 0x000100, 0x000101, 0x000102, 0x000103,
+  0x000104, 0x000105, 0x000106, 0x000107, 0x000108, 0x000109,
+  0x00010a, 0x00010b, 0x00010c, 0x00010d, 0x00010e, 0x00010f,
+  0x000001, 0x000002, 0x000002, 0x000003, 0x000004, 0x000005,
+  0x000005, 0x000006, 0x000009, 0x00000a, 0x00000a, 0x00000b,
+  0x00000c, 0x00000d, 0x00000d, 0x00000e, 0x000000, 0x000002,
+  0x000002, 0x000003, 0x000004, 0x000005, 0x000006, 0x000006,
+  0x000008, 0x00000a, 0x00000a, 0x00000b, 0x00000c, 0x00000d,
+  0x00000e, 0x00000e, 0x000001, 0x000002, 0x000002, 0x000003,
+  0x000004, 0x000005, 0x000005, 0x000006, 0x000009, 0x00000a,
+  0x00000a, 0x00000b, 0x00000c, 0x00000d, 0x00000d, 0x00000e,
+  0x000201, 0x000202, 0x000202, 0x000203, 0x000204, 0x000205,
+  0x000205, 0x000206, 0x000209, 0x00020a, 0x00020a, 0x00020b,
+  0x00020c, 0x00020d, 0x00020d, 0x00020e, 0x000001, 0x000002,
+  0x000002, 0x000003, 0x000004, 0x000005, 0x000005, 0x000006,
+  0x000009, 0x00000a, 0x00000a, 0x00000b, 0x00000c, 0x00000d,
+  0x00000d, 0x00000e, 0x000041, 0x000041, 0x000041, 0x000041,
+  0x000045, 0x000045, 0x000045, 0x000045, 0x000049, 0x000049,
+  0x000049, 0x000049, 0x00004d, 0x00004d, 0x00004d, 0x00004d,
+  0x000001, 0x000001, 0x000001, 0x000001, 0x000005, 0x000005,
+  0x000005, 0x000005, 0x000009, 0x000009, 0x000009, 0x000009,
+  0x00000d, 0x00000d, 0x00000d, 0x00000d, 0x000001, 0x000001,
+  0x000001, 0x000001, 0x000005, 0x000005, 0x000005, 0x000005,
+  0x000009, 0x000009, 0x000009, 0x000009, 0x00000d, 0x00000d,
+  0x00000d, 0x00000d, 0x000001, 0x000001, 0x000001, 0x000001,
+  0x000005, 0x000005, 0x000005, 0x000005, 0x000009, 0x000009,
+  0x000009, 0x000009, 0x00000d, 0x00000d, 0x00000d, 0x00000d,
+  0x000001, 0x000001, 0x000001, 0x000001, 0x000005, 0x000005,
+  0x000005, 0x000005, 0x000009, 0x000009, 0x000009, 0x000009,
+  0x00000d, 0x00000d, 0x00000d, 0x00000d, 0x000001, 0x000001,
+  0x000001, 0x000001, 0x000005, 0x000005, 0x000005, 0x000005,
+  0x000009, 0x000009, 0x000009, 0x000009, 0x00000d, 0x00000d,
+  0x00000d, 0x00000d, 0x000001, 0x000001, 0x000001, 0x000001,
+  0x000005, 0x000005, 0x000005, 0x000005, 0x000009, 0x000009,
+  0x000009, 0x000009, 0x00000d, 0x00000d, 0x00000d, 0x00000d,
+  0x000001, 0x000001, 0x000001, 0x000001, 0x000005, 0x000005,
+  0x000005, 0x000005, 0x000009, 0x000009, 0x000009, 0x000009,
+  0x00000d, 0x00000d, 0x00000d, 0x00000d, 0x000001, 0x000001,
+  0x000001, 0x000001, 0x000005, 0x000005, 0x000005, 0x000005,
+  0x000009, 0x000009, 0x000009, 0x000009, 0x00000d, 0x00000d,
+  0x00000d, 0x00000d, 0x000001, 0x000001, 0x000001, 0x000001,
+  0x000005, 0x000005, 0x000005, 0x000005, 0x000009, 0x000009,
+  0x000009, 0x000009, 0x00000d, 0x00000d, 0x00000d, 0x00000d,
+  0x000401, 0x000401, 0x000401, 0x000401, 0x000405, 0x000405,
+  0x000405, 0x000405, 0x000409, 0x000409, 0x000409, 0x000409,
+  0x00040d, 0x00040d, 0x00040d, 0x00040d, 0x000001, 0x000001,
+  0x000001, 0x000001, 0x000005, 0x000005, 0x000005, 0x000005,
+  0x000009, 0x000009, 0x000009, 0x000009, 0x00000d, 0x00000d,
+  0x00000d, 0x00000d, 0x000001, 0x000401, 0x000001, 0x000401,
+  0x000005, 0x000405, 0x000005, 0x000405, 0x000009, 0x000409,
+  0x000009, 0x000409, 0x00000d, 0x00040d, 0x00000d, 0x00040d,
+  0x000001, 0x000001, 0x000001, 0x000001, 0x000005, 0x000005,
+  0x000005, 0x000005, 0x000009, 0x000009, 0x000009, 0x000009,
+  0x00000d, 0x00000d, 0x00000d, 0x00000d, 0x000001, 0x000401,
+  0x000001, 0x000401, 0x000005, 0x000405, 0x000005, 0x000405,
+  0x000009, 0x000409, 0x000009, 0x000409, 0x00000d, 0x00040d,
+  0x00000d, 0x00040d, 0x000001, 0x000001, 0x000001, 0x000001,
+  0x000005, 0x000005, 0x000005, 0x000005, 0x000009, 0x000009,
+  0x000009, 0x000009, 0x00000d, 0x00000d, 0x00000d, 0x00000d,
+  0x000801, 0x001801, 0x000801, 0x001801, 0x000805, 0x001805,
+  0x000805, 0x001805, 0x000829, 0x001829, 0x000829, 0x001829,
+  0x00082d, 0x00182d, 0x00082d, 0x00182d, 0x000001, 0x000001,
+  0x000001, 0x000001, 0x000005, 0x000005, 0x000005, 0x000005,
+  0x000009, 0x000009, 0x000009, 0x000009, 0x00000d, 0x00000d,
+  0x00000d, 0x00000d, 0x001801, 0x000801, 0x001801, 0x000801,
+  0x001805, 0x000805, 0x001805, 0x000805, 0x001829, 0x000829,
+  0x001829, 0x000829, 0x00182d, 0x00082d, 0x00182d, 0x00082d,
+  0x000001, 0x000001, 0x000001, 0x000001, 0x000005, 0x000005,
+  0x000005, 0x000005, 0x000009, 0x000009, 0x000009, 0x000009,
+  0x00000d, 0x00000d, 0x00000d, 0x00000d, 0x000001, 0x000001,
+  0x000001, 0x000001, 0x000001, 0x000001, 0x000001, 0x000001,
+  0x000009, 0x000009, 0x000009, 0x000009, 0x000009, 0x000009,
+  0x000009, 0x000009, 0x000001, 0x000001, 0x000001, 0x000001,
+  0x000005, 0x000005, 0x000005, 0x000005, 0x000009, 0x000009,
+  0x000009, 0x000009, 0x00000d, 0x00000d, 0x00000d, 0x00000d,
+  0x000001, 0x000001, 0x000001, 0x000001, 0x000005, 0x000005,
+  0x000005, 0x000005, 0x000001, 0x000001, 0x000001, 0x000001,
+  0x000005, 0x000005, 0x000005, 0x000005, 0x000001, 0x000001,
+  0x000001, 0x000001, 0x000005, 0x000005, 0x000005, 0x000005,
+  0x000009, 0x000009, 0x000009, 0x000009, 0x00000d, 0x00000d,
+  0x00000d, 0x00000d, 0x000081, 0x000081, 0x000081, 0x000081,
+  0x000085, 0x000085, 0x000085, 0x000085, 0x000089, 0x000089,
+  0x000089, 0x000089, 0x00008d, 0x00008d, 0x00008d, 0x00008d,
+  0x000001, 0x000001, 0x000001, 0x000001, 0x000005, 0x000005,
+  0x000005, 0x000005, 0x000009, 0x000009, 0x000009, 0x000009,
+  0x00000d, 0x00000d, 0x00000d, 0x00000d, 0x000100, 0x000101,
+  0x000102, 0x000103, 0x000104, 0x000105, 0x000106, 0x000107,
+  0x000108, 0x000109, 0x00010a, 0x00010b, 0x00010c, 0x00010d,
+  0x00010e, 0x00010f, 0x000001, 0x000001, 0x000001, 0x000001,
+  0x000005, 0x000005, 0x000005, 0x000005, 0x000009, 0x000009,
+  0x000009, 0x000009, 0x00000d, 0x00000d, 0x00000d, 0x00000d,
+  0x000000, 0x000001, 0x000002, 0x000001, 0x000004, 0x000005,
+  0x000006, 0x000005, 0x000008, 0x000009, 0x00000a, 0x000009,
+  0x00000c, 0x00000d, 0x00000e, 0x00000d, 0x000001, 0x000001,
+  0x000001, 0x000001, 0x000005, 0x000005, 0x000005, 0x000005,
+  0x000009, 0x000009, 0x000009, 0x000009, 0x00000d, 0x00000d,
+  0x00000d, 0x00000d, 0x000201, 0x000201, 0x000201, 0x000201,
+  0x000205, 0x000205, 0x000205, 0x000205, 0x000209, 0x000209,
+  0x000209, 0x000209, 0x00020d, 0x00020d, 0x00020d, 0x00020d,
+  0x000001, 0x000001, 0x000001, 0x000001, 0x000005, 0x000005,
+  0x000005, 0x000005, 0x000009, 0x000009, 0x000009, 0x000009,
+  0x00000d, 0x00000d, 0x00000d, 0x00000d, 0x000041, 0x000041,
+  0x000041, 0x000041, 0x000045, 0x000045, 0x000045, 0x000045,
+  0x000049, 0x000049, 0x000049, 0x000049, 0x00004d, 0x00004d,
+  0x00004d, 0x00004d, 0x000001, 0x000001, 0x000001, 0x000001,
+  0x000005, 0x000005, 0x000005, 0x000005, 0x000009, 0x000009,
+  0x000009, 0x000009, 0x00000d, 0x00000d, 0x00000d, 0x00000d,
+  0x000001, 0x000001, 0x000001, 0x000001, 0x000005, 0x000005,
+  0x000005, 0x000005, 0x000009, 0x000009, 0x000009, 0x000009,
+  0x00000d, 0x00000d, 0x00000d, 0x00000d, 0x000001, 0x000001,
+  0x000001, 0x000001, 0x000005, 0x000005, 0x000005, 0x000005,
+  0x000009, 0x000009, 0x000009, 0x000009, 0x00000d, 0x00000d,
+  0x00000d, 0x00000d, 0x000001, 0x000001, 0x000001, 0x000001,
+  0x000005, 0x000005, 0x000005, 0x000005, 0x000009, 0x000009,
+  0x000009, 0x000009, 0x00000d, 0x00000d, 0x00000d, 0x00000d,
+  0x000001, 0x000001, 0x000001, 0x000001, 0x000005, 0x000005,
+  0x000005, 0x000005, 0x000009, 0x000009, 0x000009, 0x000009,
+  0x00000d, 0x00000d, 0x00000d, 0x00000d, 0x000001, 0x000001,
+  0x000001, 0x000001, 0x000005, 0x000005, 0x000005, 0x000005,
+  0x000009, 0x000009, 0x000009, 0x000009, 0x00000d, 0x00000d,
+  0x00000d, 0x00000d, 0x000001, 0x000001, 0x000001, 0x000001,
+  0x000005, 0x000005, 0x000005, 0x000005, 0x000009, 0x000009,
+  0x000009, 0x000009, 0x00000d, 0x00000d, 0x00000d, 0x00000d,
+  0x000001, 0x000001, 0x000001, 0x000001, 0x000005, 0x000005,
+  0x000005, 0x000005, 0x000009, 0x000009, 0x000009, 0x000009,
+  0x00000d, 0x00000d, 0x00000d, 0x00000d, 0x000001, 0x000001,
+  0x000001, 0x000001, 0x000005, 0x000005, 0x000005, 0x000005,
+  0x000009, 0x000009, 0x000009, 0x000009, 0x00000d, 0x00000d,
+  0x00000d, 0x00000d, 0x000401, 0x000401, 0x000401, 0x000401,
+  0x000405, 0x000005, 0x000405, 0x000005, 0x000409, 0x000409,
+  0x000409, 0x000409, 0x00040d, 0x00000d, 0x00040d, 0x00000d,
+  0x000001, 0x000001, 0x000001, 0x000001, 0x000005, 0x000005,
+  0x000005, 0x000005, 0x000009, 0x000009, 0x000009, 0x000009,
+  0x00000d, 0x00000d, 0x00000d, 0x00000d, 0x000001, 0x000401,
+  0x000001, 0x000401, 0x000405, 0x000405, 0x000405, 0x000405,
+  0x000009, 0x000409, 0x000009, 0x000409, 0x00040d, 0x00040d,
+  0x00040d, 0x00040d, 0x000001, 0x000001, 0x000001, 0x000001,
+  0x000005, 0x000005, 0x000005, 0x000005, 0x000009, 0x000009,
+  0x000009, 0x000009, 0x00000d, 0x00000d, 0x00000d, 0x00000d,
+  0x000001, 0x000401, 0x000001, 0x000401, 0x000405, 0x000005,
+  0x000405, 0x000005, 0x000009, 0x000409, 0x000009, 0x000409,
+  0x00040d, 0x00000d, 0x00040d, 0x00000d, 0x000001, 0x000001,
+  0x000001, 0x000001, 0x000005, 0x000005, 0x000005, 0x000005,
+  0x000009, 0x000009, 0x000009, 0x000009, 0x00000d, 0x00000d,
+  0x00000d, 0x00000d, 0x000801, 0x001801, 0x000801, 0x001801,
+  0x000805, 0x001805, 0x000805, 0x001805, 0x000829, 0x001829,
+  0x000829, 0x001829, 0x00082d, 0x00182d, 0x00082d, 0x00182d,
+  0x000001, 0x000001, 0x000001, 0x000001, 0x000005, 0x000005,
+  0x000005, 0x000005, 0x000009, 0x000009, 0x000009, 0x000009,
+  0x00000d, 0x00000d, 0x00000d, 0x00000d, 0x001801, 0x000801,
+  0x001801, 0x000801, 0x001805, 0x000805, 0x001805, 0x000805,
+  0x001829, 0x000829, 0x001829, 0x000829, 0x00182d, 0x00082d,
+  0x00182d, 0x00082d, 0x000001, 0x000001, 0x000001, 0x000001,
+  0x000005, 0x000005, 0x000005, 0x000005, 0x000009, 0x000009,
+  0x000009, 0x000009, 0x00000d, 0x00000d, 0x00000d, 0x00000d,
+  0x000005, 0x000005, 0x000005, 0x000005, 0x000005, 0x000005,
+  0x000005, 0x000005, 0x00000d, 0x00000d, 0x00000d, 0x00000d,
+  0x00000d, 0x00000d, 0x00000d, 0x00000d, 0x000001, 0x000001,
+  0x000001, 0x000001, 0x000005, 0x000005, 0x000005, 0x000005,
+  0x000009, 0x000009, 0x000009, 0x000009, 0x00000d, 0x00000d,
+  0x00000d, 0x00000d, 0x000001, 0x000001, 0x000001, 0x000001,
+  0x00000d, 0x00000d, 0x00000d, 0x00000d, 0x000001, 0x000001,
+  0x000001, 0x000001, 0x00000d, 0x00000d, 0x00000d, 0x00000d,
+  0x000001, 0x000001, 0x000001, 0x000001, 0x000005, 0x000005,
+  0x000005, 0x000005, 0x000009, 0x000009, 0x000009, 0x000009,
+  0x00000d, 0x00000d, 0x00000d, 0x00000d, 0x000081, 0x000081,
+  0x000081, 0x000081, 0x000085, 0x000085, 0x000085, 0x000085,
+  0x000089, 0x000089, 0x000089, 0x000089, 0x00008d, 0x00008d,
+  0x00008d, 0x00008d, 0x000001, 0x000001, 0x000001, 0x000001,
+  0x000005, 0x000005, 0x000005, 0x000005, 0x000009, 0x000009,
+  0x000009, 0x000009, 0x00000d, 0x00000d, 0x00000d, 0x00000d,
+  0x000100, 0x000101, 0x000102, 0x000103, 0x000104, 0x000105,
+  0x000106, 0x000107, 0x000108, 0x000109, 0x00010a, 0x00010b,
+  0x00010c, 0x00010d, 0x00010e, 0x00010f, 0x000001, 0x000001,
+  0x000001, 0x000001, 0x000005, 0x000005, 0x000005, 0x000005,
+  0x000009, 0x000009, 0x000009, 0x000009, 0x00000d, 0x00000d,
+  0x00000d, 0x00000d, 0x000000, 0x000001, 0x000002, 0x000001,
+  0x000004, 0x000005, 0x000006, 0x000005, 0x000008, 0x000009,
+  0x00000a, 0x000009, 0x00000c, 0x00000d, 0x00000e, 0x00000d,
+  0x000001, 0x000001, 0x000001, 0x000001, 0x000005, 0x000005,
+  0x000005, 0x000005, 0x000009, 0x000009, 0x000009, 0x000009,
+  0x00000d, 0x00000d, 0x00000d, 0x00000d, 0x000201, 0x000201,
+  0x000201, 0x000201, 0x000205, 0x000205, 0x000205, 0x000205,
+  0x000209, 0x000209, 0x000209, 0x000209, 0x00020d, 0x00020d,
+  0x00020d, 0x00020d, 0x000001, 0x000001, 0x000001, 0x000001,
+  0x000005, 0x000005, 0x000005, 0x000005, 0x000009, 0x000009,
+  0x000009, 0x000009, 0x00000d, 0x00000d, 0x00000d, 0x00000d,
+  0x040041, 0x040041, 0x040043, 0x040043, 0x040045, 0x000044,
+  0x040047, 0x000046, 0x040049, 0x040049, 0x04004b, 0x04004b,
+  0x04004d, 0x00004c, 0x04004f, 0x00004e, 0x040001, 0x040001,
+  0x040003, 0x040003, 0x040005, 0x000004, 0x040007, 0x000006,
+  0x040009, 0x040009, 0x04000b, 0x04000b, 0x04000d, 0x00000c,
+  0x04000f, 0x00000e, 0x040001, 0x040001, 0x040003, 0x040003,
+  0x040005, 0x040005, 0x040007, 0x040007, 0x040009, 0x040009,
+  0x04000b, 0x04000b, 0x04000d, 0x04000d, 0x04000f, 0x04000f,
+  0x040001, 0x040001, 0x040003, 0x040003, 0x040005, 0x000004,
+  0x040007, 0x000006, 0x040009, 0x040009, 0x04000b, 0x04000b,
+  0x04000d, 0x00000c, 0x04000f, 0x00000e, 0x040001, 0x040001,
+  0x040001, 0x040003, 0x040005, 0x000004, 0x000004, 0x040007,
+  0x040009, 0x040009, 0x040009, 0x04000b, 0x04000d, 0x00000c,
+  0x00000c, 0x04000f, 0x040001, 0x040001, 0x040003, 0x040003,
+  0x040005, 0x000004, 0x040007, 0x000006, 0x040009, 0x040009,
+  0x04000b, 0x04000b, 0x04000d, 0x00000c, 0x04000f, 0x00000e,
+  0x040001, 0x040003, 0x040003, 0x040003, 0x000004, 0x040007,
+  0x040007, 0x000006, 0x040009, 0x04000b, 0x04000b, 0x04000b,
+  0x00000c, 0x04000f, 0x04000f, 0x00000e, 0x040001, 0x040001,
+  0x040003, 0x040003, 0x040005, 0x000004, 0x040007, 0x000006,
+  0x040009, 0x040009, 0x04000b, 0x04000b, 0x04000d, 0x00000c,
+  0x04000f, 0x00000e, 0x040001, 0x040001, 0x040001, 0x040001,
+  0x000004, 0x000004, 0x000004, 0x000004, 0x040009, 0x040009,
+  0x040009, 0x040009, 0x00000c, 0x00000c, 0x00000c, 0x00000c,
+  0x040001, 0x040001, 0x040003, 0x040003, 0x040005, 0x000004,
+  0x040007, 0x000006, 0x040009, 0x040009, 0x04000b, 0x04000b,
+  0x04000d, 0x00000c, 0x04000f, 0x00000e, 0x040401, 0x040401,
+  0x040403, 0x040403, 0x000404, 0x000404, 0x000406, 0x000406,
+  0x040409, 0x040409, 0x04040b, 0x04040b, 0x00040c, 0x00040c,
+  0x00040e, 0x00040e, 0x040001, 0x040001, 0x040003, 0x040003,
+  0x040005, 0x000004, 0x040007, 0x000006, 0x040009, 0x040009,
+  0x04000b, 0x04000b, 0x04000d, 0x00000c, 0x04000f, 0x00000e,
+  0x040001, 0x040401, 0x040003, 0x040403, 0x040005, 0x000404,
+  0x040007, 0x000406, 0x040009, 0x040409, 0x04000b, 0x04040b,
+  0x04000d, 0x00040c, 0x04000f, 0x00040e, 0x040001, 0x040001,
+  0x040003, 0x040003, 0x040005, 0x000004, 0x040007, 0x000006,
+  0x040009, 0x040009, 0x04000b, 0x04000b, 0x04000d, 0x00000c,
+  0x04000f, 0x00000e, 0x040001, 0x040401, 0x040003, 0x040403,
+  0x040005, 0x000404, 0x040007, 0x000406, 0x040009, 0x040409,
+  0x04000b, 0x04040b, 0x04000d, 0x00040c, 0x04000f, 0x00040e,
+  0x040001, 0x040001, 0x040003, 0x040003, 0x040005, 0x000004,
+  0x040007, 0x000006, 0x040009, 0x040009, 0x04000b, 0x04000b,
+  0x04000d, 0x00000c, 0x04000f, 0x00000e, 0x040801, 0x041801,
+  0x040803, 0x041803, 0x040805, 0x001804, 0x040807, 0x001806,
+  0x040829, 0x041829, 0x04082b, 0x04182b, 0x04082d, 0x00182c,
+  0x04082f, 0x00182e, 0x040001, 0x040001, 0x040003, 0x040003,
+  0x040005, 0x000004, 0x040007, 0x000006, 0x040009, 0x040009,
+  0x04000b, 0x04000b, 0x04000d, 0x00000c, 0x04000f, 0x00000e,
+  0x041801, 0x040801, 0x041803, 0x040803, 0x041805, 0x000804,
+  0x041807, 0x000806, 0x041829, 0x040829, 0x04182b, 0x04082b,
+  0x04182d, 0x00082c, 0x04182f, 0x00082e, 0x040001, 0x040001,
+  0x040003, 0x040003, 0x040005, 0x000004, 0x040007, 0x000006,
+  0x040009, 0x040009, 0x04000b, 0x04000b, 0x04000d, 0x00000c,
+  0x04000f, 0x00000e, 0x040001, 0x040001, 0x040003, 0x040003,
+  0x040001, 0x040001, 0x040003, 0x040003, 0x040009, 0x040009,
+  0x04000b, 0x04000b, 0x040009, 0x040009, 0x04000b, 0x04000b,
+  0x040001, 0x040001, 0x040003, 0x040003, 0x040005, 0x000004,
+  0x040007, 0x000006, 0x040009, 0x040009, 0x04000b, 0x04000b,
+  0x04000d, 0x00000c, 0x04000f, 0x00000e, 0x040001, 0x040001,
+  0x040003, 0x040003, 0x040005, 0x000004, 0x040007, 0x000006,
+  0x040001, 0x040001, 0x040003, 0x040003, 0x040005, 0x000004,
+  0x040007, 0x000006, 0x040001, 0x040001, 0x040003, 0x040003,
+  0x040005, 0x000004, 0x040007, 0x000006, 0x040009, 0x040009,
+  0x04000b, 0x04000b, 0x04000d, 0x00000c, 0x04000f, 0x00000e,
+  0x040081, 0x040081, 0x040083, 0x040083, 0x040085, 0x000084,
+  0x040087, 0x000086, 0x040089, 0x040089, 0x04008b, 0x04008b,
+  0x04008d, 0x00008c, 0x04008f, 0x00008e, 0x040001, 0x040001,
+  0x040003, 0x040003, 0x040005, 0x000004, 0x040007, 0x000006,
+  0x040009, 0x040009, 0x04000b, 0x04000b, 0x04000d, 0x00000c,
+  0x04000f, 0x00000e, 0x000100, 0x000101, 0x000102, 0x000103,
+  0x000104, 0x000105, 0x000106, 0x000107, 0x000108, 0x000109,
+  0x00010a, 0x00010b, 0x00010c, 0x00010d, 0x00010e, 0x00010f,
+  0x040001, 0x040001, 0x040003, 0x040003, 0x040005, 0x000004,
+  0x040007, 0x000006, 0x040009, 0x040009, 0x04000b, 0x04000b,
+  0x04000d, 0x00000c, 0x04000f, 0x00000e, 0x000000, 0x040001,
+  0x000002, 0x040003, 0x000004, 0x000004, 0x000006, 0x000006,
+  0x000008, 0x040009, 0x00000a, 0x04000b, 0x00000c, 0x00000c,
+  0x00000e, 0x00000e, 0x040001, 0x040001, 0x040003, 0x040003,
+  0x040005, 0x000004, 0x040007, 0x000006, 0x040009, 0x040009,
+  0x04000b, 0x04000b, 0x04000d, 0x00000c, 0x04000f, 0x00000e,
+  0x040201, 0x040201, 0x040203, 0x040203, 0x040205, 0x000204,
+  0x040207, 0x000206, 0x040209, 0x040209, 0x04020b, 0x04020b,
+  0x04020d, 0x00020c, 0x04020f, 0x00020e, 0x040001, 0x040001,
+  0x040003, 0x040003, 0x040005, 0x000004, 0x040007, 0x000006,
+  0x040009, 0x040009, 0x04000b, 0x04000b, 0x04000d, 0x00000c,
+  0x04000f, 0x00000e, 0x040041, 0x040041, 0x040043, 0x040043,
+  0x040045, 0x000044, 0x040047, 0x000046, 0x040049, 0x040049,
+  0x04004b, 0x04004b, 0x04004d, 0x00004c, 0x04004f, 0x00004e,
+  0x040001, 0x040001, 0x040003, 0x040003, 0x040005, 0x000004,
+  0x040007, 0x000006, 0x040009, 0x040009, 0x04000b, 0x04000b,
+  0x04000d, 0x00000c, 0x04000f, 0x00000e, 0x040001, 0x040001,
+  0x040003, 0x040003, 0x000004, 0x000004, 0x000006, 0x000006,
+  0x040009, 0x040009, 0x04000b, 0x04000b, 0x00000c, 0x00000c,
+  0x00000e, 0x00000e, 0x040001, 0x040001, 0x040003, 0x040003,
+  0x040005, 0x000004, 0x040007, 0x000006, 0x040009, 0x040009,
+  0x04000b, 0x04000b, 0x04000d, 0x00000c, 0x04000f, 0x00000e,
+  0x040001, 0x040001, 0x040001, 0x040003, 0x000004, 0x040007,
+  0x040007, 0x000006, 0x040009, 0x040009, 0x040009, 0x04000b,
+  0x00000c, 0x04000f, 0x04000f, 0x00000e, 0x040001, 0x040001,
+  0x040003, 0x040003, 0x040005, 0x000004, 0x040007, 0x000006,
+  0x040009, 0x040009, 0x04000b, 0x04000b, 0x04000d, 0x00000c,
+  0x04000f, 0x00000e, 0x040001, 0x040003, 0x040003, 0x040003,
+  0x040005, 0x000004, 0x000004, 0x040007, 0x040009, 0x04000b,
+  0x04000b, 0x04000b, 0x04000d, 0x00000c, 0x00000c, 0x04000f,
+  0x040001, 0x040001, 0x040003, 0x040003, 0x040005, 0x000004,
+  0x040007, 0x000006, 0x040009, 0x040009, 0x04000b, 0x04000b,
+  0x04000d, 0x00000c, 0x04000f, 0x00000e, 0x040001, 0x040001,
+  0x040001, 0x040001, 0x000004, 0x000004, 0x000004, 0x000004,
+  0x040009, 0x040009, 0x040009, 0x040009, 0x00000c, 0x00000c,
+  0x00000c, 0x00000c, 0x040001, 0x040001, 0x040003, 0x040003,
+  0x040005, 0x000004, 0x040007, 0x000006, 0x040009, 0x040009,
+  0x04000b, 0x04000b, 0x04000d, 0x00000c, 0x04000f, 0x00000e,
+  0x040401, 0x040401, 0x040403, 0x040403, 0x000404, 0x040005,
+  0x000406, 0x040007, 0x040409, 0x040409, 0x04040b, 0x04040b,
+  0x00040c, 0x04000d, 0x00040e, 0x04000f, 0x040001, 0x040001,
+  0x040003, 0x040003, 0x040005, 0x000004, 0x040007, 0x000006,
+  0x040009, 0x040009, 0x04000b, 0x04000b, 0x04000d, 0x00000c,
+  0x04000f, 0x00000e, 0x040001, 0x040401, 0x040003, 0x040403,
+  0x000404, 0x000404, 0x000406, 0x000406, 0x040009, 0x040409,
+  0x04000b, 0x04040b, 0x00040c, 0x00040c, 0x00040e, 0x00040e,
+  0x040001, 0x040001, 0x040003, 0x040003, 0x040005, 0x000004,
+  0x040007, 0x000006, 0x040009, 0x040009, 0x04000b, 0x04000b,
+  0x04000d, 0x00000c, 0x04000f, 0x00000e, 0x040001, 0x040401,
+  0x040003, 0x040403, 0x000404, 0x040005, 0x000406, 0x040007,
+  0x040009, 0x040409, 0x04000b, 0x04040b, 0x00040c, 0x04000d,
+  0x00040e, 0x04000f, 0x040001, 0x040001, 0x040003, 0x040003,
+  0x040005, 0x000004, 0x040007, 0x000006, 0x040009, 0x040009,
+  0x04000b, 0x04000b, 0x04000d, 0x00000c, 0x04000f, 0x00000e,
+  0x040801, 0x041801, 0x040803, 0x041803, 0x040805, 0x001804,
+  0x040807, 0x001806, 0x040829, 0x041829, 0x04082b, 0x04182b,
+  0x04082d, 0x00182c, 0x04082f, 0x00182e, 0x040001, 0x040001,
+  0x040003, 0x040003, 0x040005, 0x000004, 0x040007, 0x000006,
+  0x040009, 0x040009, 0x04000b, 0x04000b, 0x04000d, 0x00000c,
+  0x04000f, 0x00000e, 0x041801, 0x040801, 0x041803, 0x040803,
+  0x041805, 0x000804, 0x041807, 0x000806, 0x041829, 0x040829,
+  0x04182b, 0x04082b, 0x04182d, 0x00082c, 0x04182f, 0x00082e,
+  0x040001, 0x040001, 0x040003, 0x040003, 0x040005, 0x000004,
+  0x040007, 0x000006, 0x040009, 0x040009, 0x04000b, 0x04000b,
+  0x04000d, 0x00000c, 0x04000f, 0x00000e, 0x040005, 0x000004,
+  0x040007, 0x000006, 0x040005, 0x000004, 0x040007, 0x000006,
+  0x04000d, 0x00000c, 0x04000f, 0x00000e, 0x04000d, 0x00000c,
+  0x04000f, 0x00000e, 0x040001, 0x040001, 0x040003, 0x040003,
+  0x040005, 0x000004, 0x040007, 0x000006, 0x040009, 0x040009,
+  0x04000b, 0x04000b, 0x04000d, 0x00000c, 0x04000f, 0x00000e,
+  0x040001, 0x040001, 0x040003, 0x040003, 0x04000d, 0x00000c,
+  0x04000f, 0x00000e, 0x040001, 0x040001, 0x040003, 0x040003,
+  0x04000d, 0x00000c, 0x04000f, 0x00000e, 0x040001, 0x040001,
+  0x040003, 0x040003, 0x040005, 0x000004, 0x040007, 0x000006,
+  0x040009, 0x040009, 0x04000b, 0x04000b, 0x04000d, 0x00000c,
+  0x04000f, 0x00000e, 0x040081, 0x040081, 0x040083, 0x040083,
+  0x040085, 0x000084, 0x040087, 0x000086, 0x040089, 0x040089,
+  0x04008b, 0x04008b, 0x04008d, 0x00008c, 0x04008f, 0x00008e,
+  0x040001, 0x040001, 0x040003, 0x040003, 0x040005, 0x000004,
+  0x040007, 0x000006, 0x040009, 0x040009, 0x04000b, 0x04000b,
+  0x04000d, 0x00000c, 0x04000f, 0x00000e, 0x000100, 0x000101,
+  0x000102, 0x000103, 0x000104, 0x000105, 0x000106, 0x000107,
+  0x000108, 0x000109, 0x00010a, 0x00010b, 0x00010c, 0x00010d,
+  0x00010e, 0x00010f, 0x040001, 0x040001, 0x040003, 0x040003,
+  0x040005, 0x000004, 0x040007, 0x000006, 0x040009, 0x040009,
+  0x04000b, 0x04000b, 0x04000d, 0x00000c, 0x04000f, 0x00000e,
+  0x000000, 0x040001, 0x000002, 0x040003, 0x000004, 0x000004,
+  0x000006, 0x000006, 0x000008, 0x040009, 0x00000a, 0x04000b,
+  0x00000c, 0x00000c, 0x00000e, 0x00000e, 0x040001, 0x040001,
+  0x040003, 0x040003, 0x040005, 0x000004, 0x040007, 0x000006,
+  0x040009, 0x040009, 0x04000b, 0x04000b, 0x04000d, 0x00000c,
+  0x04000f, 0x00000e, 0x040201, 0x040201, 0x040203, 0x040203,
+  0x040205, 0x000204, 0x040207, 0x000206, 0x040209, 0x040209,
+  0x04020b, 0x04020b, 0x04020d, 0x00020c, 0x04020f, 0x00020e,
+  0x040001, 0x040001, 0x040003, 0x040003, 0x040005, 0x000004,
+  0x040007, 0x000006, 0x040009, 0x040009, 0x04000b, 0x04000b,
+  0x04000d, 0x00000c, 0x04000f, 0x00000e, 0x000040, 0x040041,
+  0x000042, 0x040043, 0x040045, 0x040045, 0x040047, 0x040047,
+  0x000048, 0x040049, 0x00004a, 0x04004b, 0x04004d, 0x04004d,
+  0x04004f, 0x04004f, 0x000000, 0x040001, 0x000002, 0x040003,
+  0x040005, 0x040005, 0x040007, 0x040007, 0x000008, 0x040009,
+  0x00000a, 0x04000b, 0x04000d, 0x04000d, 0x04000f, 0x04000f,
+  0x000000, 0x000000, 0x000002, 0x000002, 0x040005, 0x040005,
+  0x040007, 0x040007, 0x000008, 0x000008, 0x00000a, 0x00000a,
+  0x04000d, 0x04000d, 0x04000f, 0x04000f, 0x000000, 0x040001,
+  0x000002, 0x040003, 0x040005, 0x040005, 0x040007, 0x040007,
+  0x000008, 0x040009, 0x00000a, 0x04000b, 0x04000d, 0x04000d,
+  0x04000f, 0x04000f, 0x000000, 0x040001, 0x040001, 0x000002,
+  0x040005, 0x040005, 0x040005, 0x040007, 0x000008, 0x040009,
+  0x040009, 0x00000a, 0x04000d, 0x04000d, 0x04000d, 0x04000f,
+  0x000000, 0x040001, 0x000002, 0x040003, 0x040005, 0x040005,
+  0x040007, 0x040007, 0x000008, 0x040009, 0x00000a, 0x04000b,
+  0x04000d, 0x04000d, 0x04000f, 0x04000f, 0x040001, 0x000002,
+  0x000002, 0x040003, 0x040005, 0x040007, 0x040007, 0x040007,
+  0x040009, 0x00000a, 0x00000a, 0x04000b, 0x04000d, 0x04000f,
+  0x04000f, 0x04000f, 0x000000, 0x040001, 0x000002, 0x040003,
+  0x040005, 0x040005, 0x040007, 0x040007, 0x000008, 0x040009,
+  0x00000a, 0x04000b, 0x04000d, 0x04000d, 0x04000f, 0x04000f,
+  0x040001, 0x040001, 0x040001, 0x040001, 0x040005, 0x040005,
+  0x040005, 0x040005, 0x040009, 0x040009, 0x040009, 0x040009,
+  0x04000d, 0x04000d, 0x04000d, 0x04000d, 0x000000, 0x040001,
+  0x000002, 0x040003, 0x040005, 0x040005, 0x040007, 0x040007,
+  0x000008, 0x040009, 0x00000a, 0x04000b, 0x04000d, 0x04000d,
+  0x04000f, 0x04000f, 0x040401, 0x040401, 0x040403, 0x040403,
+  0x040405, 0x040405, 0x040407, 0x040407, 0x040409, 0x040409,
+  0x04040b, 0x04040b, 0x04040d, 0x04040d, 0x04040f, 0x04040f,
+  0x000000, 0x040001, 0x000002, 0x040003, 0x040005, 0x040005,
+  0x040007, 0x040007, 0x000008, 0x040009, 0x00000a, 0x04000b,
+  0x04000d, 0x04000d, 0x04000f, 0x04000f, 0x000000, 0x040401,
+  0x000002, 0x040403, 0x040005, 0x040405, 0x040007, 0x040407,
+  0x000008, 0x040409, 0x00000a, 0x04040b, 0x04000d, 0x04040d,
+  0x04000f, 0x04040f, 0x000000, 0x040001, 0x000002, 0x040003,
+  0x040005, 0x040005, 0x040007, 0x040007, 0x000008, 0x040009,
+  0x00000a, 0x04000b, 0x04000d, 0x04000d, 0x04000f, 0x04000f,
+  0x000000, 0x040401, 0x000002, 0x040403, 0x040005, 0x040405,
+  0x040007, 0x040407, 0x000008, 0x040409, 0x00000a, 0x04040b,
+  0x04000d, 0x04040d, 0x04000f, 0x04040f, 0x000000, 0x040001,
+  0x000002, 0x040003, 0x040005, 0x040005, 0x040007, 0x040007,
+  0x000008, 0x040009, 0x00000a, 0x04000b, 0x04000d, 0x04000d,
+  0x04000f, 0x04000f, 0x000800, 0x041801, 0x000802, 0x041803,
+  0x040805, 0x041805, 0x040807, 0x041807, 0x000828, 0x041829,
+  0x00082a, 0x04182b, 0x04082d, 0x04182d, 0x04082f, 0x04182f,
+  0x000000, 0x040001, 0x000002, 0x040003, 0x040005, 0x040005,
+  0x040007, 0x040007, 0x000008, 0x040009, 0x00000a, 0x04000b,
+  0x04000d, 0x04000d, 0x04000f, 0x04000f, 0x001800, 0x040801,
+  0x001802, 0x040803, 0x041805, 0x040805, 0x041807, 0x040807,
+  0x001828, 0x040829, 0x00182a, 0x04082b, 0x04182d, 0x04082d,
+  0x04182f, 0x04082f, 0x000000, 0x040001, 0x000002, 0x040003,
+  0x040005, 0x040005, 0x040007, 0x040007, 0x000008, 0x040009,
+  0x00000a, 0x04000b, 0x04000d, 0x04000d, 0x04000f, 0x04000f,
+  0x000000, 0x040001, 0x000002, 0x040003, 0x000000, 0x040001,
+  0x000002, 0x040003, 0x000008, 0x040009, 0x00000a, 0x04000b,
+  0x000008, 0x040009, 0x00000a, 0x04000b, 0x000000, 0x040001,
+  0x000002, 0x040003, 0x040005, 0x040005, 0x040007, 0x040007,
+  0x000008, 0x040009, 0x00000a, 0x04000b, 0x04000d, 0x04000d,
+  0x04000f, 0x04000f, 0x000000, 0x040001, 0x000002, 0x040003,
+  0x040005, 0x040005, 0x040007, 0x040007, 0x000000, 0x040001,
+  0x000002, 0x040003, 0x040005, 0x040005, 0x040007, 0x040007,
+  0x000000, 0x040001, 0x000002, 0x040003, 0x040005, 0x040005,
+  0x040007, 0x040007, 0x000008, 0x040009, 0x00000a, 0x04000b,
+  0x04000d, 0x04000d, 0x04000f, 0x04000f, 0x000080, 0x040081,
+  0x000082, 0x040083, 0x040085, 0x040085, 0x040087, 0x040087,
+  0x000088, 0x040089, 0x00008a, 0x04008b, 0x04008d, 0x04008d,
+  0x04008f, 0x04008f, 0x000000, 0x040001, 0x000002, 0x040003,
+  0x040005, 0x040005, 0x040007, 0x040007, 0x000008, 0x040009,
+  0x00000a, 0x04000b, 0x04000d, 0x04000d, 0x04000f, 0x04000f,
+  0x000100, 0x000101, 0x000102, 0x000103, 0x000104, 0x000105,
+  0x000106, 0x000107, 0x000108, 0x000109, 0x00010a, 0x00010b,
+  0x00010c, 0x00010d, 0x00010e, 0x00010f, 0x000000, 0x040001,
+  0x000002, 0x040003, 0x040005, 0x040005, 0x040007, 0x040007,
+  0x000008, 0x040009, 0x00000a, 0x04000b, 0x04000d, 0x04000d,
+  0x04000f, 0x04000f, 0x000000, 0x040001, 0x000002, 0x040003,
+  0x000004, 0x040005, 0x000006, 0x040007, 0x000008, 0x040009,
+  0x00000a, 0x04000b, 0x00000c, 0x04000d, 0x00000e, 0x04000f,
+  0x000000, 0x040001, 0x000002, 0x040003, 0x040005, 0x040005,
+  0x040007, 0x040007, 0x000008, 0x040009, 0x00000a, 0x04000b,
+  0x04000d, 0x04000d, 0x04000f, 0x04000f, 0x000200, 0x040201,
+  0x000202, 0x040203, 0x040205, 0x040205, 0x040207, 0x040207,
+  0x000208, 0x040209, 0x00020a, 0x04020b, 0x04020d, 0x04020d,
+  0x04020f, 0x04020f, 0x000000, 0x040001, 0x000002, 0x040003,
+  0x040005, 0x040005, 0x040007, 0x040007, 0x000008, 0x040009,
+  0x00000a, 0x04000b, 0x04000d, 0x04000d, 0x04000f, 0x04000f,
+  0x000040, 0x040041, 0x000042, 0x040043, 0x040045, 0x040045,
+  0x040047, 0x040047, 0x000048, 0x040049, 0x00004a, 0x04004b,
+  0x04004d, 0x04004d, 0x04004f, 0x04004f, 0x000000, 0x040001,
+  0x000002, 0x040003, 0x040005, 0x040005, 0x040007, 0x040007,
+  0x000008, 0x040009, 0x00000a, 0x04000b, 0x04000d, 0x04000d,
+  0x04000f, 0x04000f, 0x000000, 0x000000, 0x000002, 0x000002,
+  0x040005, 0x040005, 0x040007, 0x040007, 0x000008, 0x000008,
+  0x00000a, 0x00000a, 0x04000d, 0x04000d, 0x04000f, 0x04000f,
+  0x000000, 0x040001, 0x000002, 0x040003, 0x040005, 0x040005,
+  0x040007, 0x040007, 0x000008, 0x040009, 0x00000a, 0x04000b,
+  0x04000d, 0x04000d, 0x04000f, 0x04000f, 0x000000, 0x040001,
+  0x040001, 0x000002, 0x040005, 0x040007, 0x040007, 0x040007,
+  0x000008, 0x040009, 0x040009, 0x00000a, 0x04000d, 0x04000f,
+  0x04000f, 0x04000f, 0x000000, 0x040001, 0x000002, 0x040003,
+  0x040005, 0x040005, 0x040007, 0x040007, 0x000008, 0x040009,
+  0x00000a, 0x04000b, 0x04000d, 0x04000d, 0x04000f, 0x04000f,
+  0x040001, 0x000002, 0x000002, 0x040003, 0x040005, 0x040005,
+  0x040005, 0x040007, 0x040009, 0x00000a, 0x00000a, 0x04000b,
+  0x04000d, 0x04000d, 0x04000d, 0x04000f, 0x000000, 0x040001,
+  0x000002, 0x040003, 0x040005, 0x040005, 0x040007, 0x040007,
+  0x000008, 0x040009, 0x00000a, 0x04000b, 0x04000d, 0x04000d,
+  0x04000f, 0x04000f, 0x040001, 0x040001, 0x040001, 0x040001,
+  0x040005, 0x040005, 0x040005, 0x040005, 0x040009, 0x040009,
+  0x040009, 0x040009, 0x04000d, 0x04000d, 0x04000d, 0x04000d,
+  0x000000, 0x040001, 0x000002, 0x040003, 0x040005, 0x040005,
+  0x040007, 0x040007, 0x000008, 0x040009, 0x00000a, 0x04000b,
+  0x04000d, 0x04000d, 0x04000f, 0x04000f, 0x040401, 0x040401,
+  0x040403, 0x040403, 0x040405, 0x040005, 0x040407, 0x040007,
+  0x040409, 0x040409, 0x04040b, 0x04040b, 0x04040d, 0x04000d,
+  0x04040f, 0x04000f, 0x000000, 0x040001, 0x000002, 0x040003,
+  0x040005, 0x040005, 0x040007, 0x040007, 0x000008, 0x040009,
+  0x00000a, 0x04000b, 0x04000d, 0x04000d, 0x04000f, 0x04000f,
+  0x000000, 0x040401, 0x000002, 0x040403, 0x040405, 0x040405,
+  0x040407, 0x040407, 0x000008, 0x040409, 0x00000a, 0x04040b,
+  0x04040d, 0x04040d, 0x04040f, 0x04040f, 0x000000, 0x040001,
+  0x000002, 0x040003, 0x040005, 0x040005, 0x040007, 0x040007,
+  0x000008, 0x040009, 0x00000a, 0x04000b, 0x04000d, 0x04000d,
+  0x04000f, 0x04000f, 0x000000, 0x040401, 0x000002, 0x040403,
+  0x040405, 0x040005, 0x040407, 0x040007, 0x000008, 0x040409,
+  0x00000a, 0x04040b, 0x04040d, 0x04000d, 0x04040f, 0x04000f,
+  0x000000, 0x040001, 0x000002, 0x040003, 0x040005, 0x040005,
+  0x040007, 0x040007, 0x000008, 0x040009, 0x00000a, 0x04000b,
+  0x04000d, 0x04000d, 0x04000f, 0x04000f, 0x000800, 0x041801,
+  0x000802, 0x041803, 0x040805, 0x041805, 0x040807, 0x041807,
+  0x000828, 0x041829, 0x00082a, 0x04182b, 0x04082d, 0x04182d,
+  0x04082f, 0x04182f, 0x000000, 0x040001, 0x000002, 0x040003,
+  0x040005, 0x040005, 0x040007, 0x040007, 0x000008, 0x040009,
+  0x00000a, 0x04000b, 0x04000d, 0x04000d, 0x04000f, 0x04000f,
+  0x001800, 0x040801, 0x001802, 0x040803, 0x041805, 0x040805,
+  0x041807, 0x040807, 0x001828, 0x040829, 0x00182a, 0x04082b,
+  0x04182d, 0x04082d, 0x04182f, 0x04082f, 0x000000, 0x040001,
+  0x000002, 0x040003, 0x040005, 0x040005, 0x040007, 0x040007,
+  0x000008, 0x040009, 0x00000a, 0x04000b, 0x04000d, 0x04000d,
+  0x04000f, 0x04000f, 0x040005, 0x040005, 0x040007, 0x040007,
+  0x040005, 0x040005, 0x040007, 0x040007, 0x04000d, 0x04000d,
+  0x04000f, 0x04000f, 0x04000d, 0x04000d, 0x04000f, 0x04000f,
+  0x000000, 0x040001, 0x000002, 0x040003, 0x040005, 0x040005,
+  0x040007, 0x040007, 0x000008, 0x040009, 0x00000a, 0x04000b,
+  0x04000d, 0x04000d, 0x04000f, 0x04000f, 0x000000, 0x040001,
+  0x000002, 0x040003, 0x04000d, 0x04000d, 0x04000f, 0x04000f,
+  0x000000, 0x040001, 0x000002, 0x040003, 0x04000d, 0x04000d,
+  0x04000f, 0x04000f, 0x000000, 0x040001, 0x000002, 0x040003,
+  0x040005, 0x040005, 0x040007, 0x040007, 0x000008, 0x040009,
+  0x00000a, 0x04000b, 0x04000d, 0x04000d, 0x04000f, 0x04000f,
+  0x000080, 0x040081, 0x000082, 0x040083, 0x040085, 0x040085,
+  0x040087, 0x040087, 0x000088, 0x040089, 0x00008a, 0x04008b,
+  0x04008d, 0x04008d, 0x04008f, 0x04008f, 0x000000, 0x040001,
+  0x000002, 0x040003, 0x040005, 0x040005, 0x040007, 0x040007,
+  0x000008, 0x040009, 0x00000a, 0x04000b, 0x04000d, 0x04000d,
+  0x04000f, 0x04000f, 0x000100, 0x000101, 0x000102, 0x000103,
+  0x000104, 0x000105, 0x000106, 0x000107, 0x000108, 0x000109,
+  0x00010a, 0x00010b, 0x00010c, 0x00010d, 0x00010e, 0x00010f,
+  0x000000, 0x040001, 0x000002, 0x040003, 0x040005, 0x040005,
+  0x040007, 0x040007, 0x000008, 0x040009, 0x00000a, 0x04000b,
+  0x04000d, 0x04000d, 0x04000f, 0x04000f, 0x000000, 0x040001,
+  0x000002, 0x040003, 0x000004, 0x040005, 0x000006, 0x040007,
+  0x000008, 0x040009, 0x00000a, 0x04000b, 0x00000c, 0x04000d,
+  0x00000e, 0x04000f, 0x000000, 0x040001, 0x000002, 0x040003,
+  0x040005, 0x040005, 0x040007, 0x040007, 0x000008, 0x040009,
+  0x00000a, 0x04000b, 0x04000d, 0x04000d, 0x04000f, 0x04000f,
+  0x000200, 0x040201, 0x000202, 0x040203, 0x040205, 0x040205,
+  0x040207, 0x040207, 0x000208, 0x040209, 0x00020a, 0x04020b,
+  0x04020d, 0x04020d, 0x04020f, 0x04020f, 0x000000, 0x040001,
+  0x000002, 0x040003, 0x040005, 0x040005, 0x040007, 0x040007,
+  0x000008, 0x040009, 0x00000a, 0x04000b, 0x04000d, 0x04000d,
+  0x04000f, 0x04000f, 0x000040, 0x040041, 0x000042, 0x040043,
+  0x040045, 0x000044, 0x040047, 0x000046, 0x000048, 0x040049,
+  0x00004a, 0x04004b, 0x04004d, 0x00004c, 0x04004f, 0x00004e,
+  0x000000, 0x040001, 0x000002, 0x040003, 0x040005, 0x000004,
+  0x040007, 0x000006, 0x000008, 0x040009, 0x00000a, 0x04000b,
+  0x04000d, 0x00000c, 0x04000f, 0x00000e, 0x000000, 0x000000,
+  0x000002, 0x000002, 0x040005, 0x040005, 0x040007, 0x040007,
+  0x000008, 0x000008, 0x00000a, 0x00000a, 0x04000d, 0x04000d,
+  0x04000f, 0x04000f, 0x000000, 0x040001, 0x000002, 0x040003,
+  0x040005, 0x000004, 0x040007, 0x000006, 0x000008, 0x040009,
+  0x00000a, 0x04000b, 0x04000d, 0x00000c, 0x04000f, 0x00000e,
+  0x000000, 0x040001, 0x040001, 0x000002, 0x040005, 0x000004,
+  0x000004, 0x040007, 0x000008, 0x040009, 0x040009, 0x00000a,
+  0x04000d, 0x00000c, 0x00000c, 0x04000f, 0x000000, 0x040001,
+  0x000002, 0x040003, 0x040005, 0x000004, 0x040007, 0x000006,
+  0x000008, 0x040009, 0x00000a, 0x04000b, 0x04000d, 0x00000c,
+  0x04000f, 0x00000e, 0x040001, 0x000002, 0x000002, 0x040003,
+  0x000004, 0x040007, 0x040007, 0x000006, 0x040009, 0x00000a,
+  0x00000a, 0x04000b, 0x00000c, 0x04000f, 0x04000f, 0x00000e,
+  0x000000, 0x040001, 0x000002, 0x040003, 0x040005, 0x000004,
+  0x040007, 0x000006, 0x000008, 0x040009, 0x00000a, 0x04000b,
+  0x04000d, 0x00000c, 0x04000f, 0x00000e, 0x040001, 0x040001,
+  0x040001, 0x040001, 0x000004, 0x000004, 0x000004, 0x000004,
+  0x040009, 0x040009, 0x040009, 0x040009, 0x00000c, 0x00000c,
+  0x00000c, 0x00000c, 0x000000, 0x040001, 0x000002, 0x040003,
+  0x040005, 0x000004, 0x040007, 0x000006, 0x000008, 0x040009,
+  0x00000a, 0x04000b, 0x04000d, 0x00000c, 0x04000f, 0x00000e,
+  0x040401, 0x040401, 0x040403, 0x040403, 0x000404, 0x000404,
+  0x000406, 0x000406, 0x040409, 0x040409, 0x04040b, 0x04040b,
+  0x00040c, 0x00040c, 0x00040e, 0x00040e, 0x000000, 0x040001,
+  0x000002, 0x040003, 0x040005, 0x000004, 0x040007, 0x000006,
+  0x000008, 0x040009, 0x00000a, 0x04000b, 0x04000d, 0x00000c,
+  0x04000f, 0x00000e, 0x000000, 0x040401, 0x000002, 0x040403,
+  0x040005, 0x000404, 0x040007, 0x000406, 0x000008, 0x040409,
+  0x00000a, 0x04040b, 0x04000d, 0x00040c, 0x04000f, 0x00040e,
+  0x000000, 0x040001, 0x000002, 0x040003, 0x040005, 0x000004,
+  0x040007, 0x000006, 0x000008, 0x040009, 0x00000a, 0x04000b,
+  0x04000d, 0x00000c, 0x04000f, 0x00000e, 0x000000, 0x040401,
+  0x000002, 0x040403, 0x040005, 0x000404, 0x040007, 0x000406,
+  0x000008, 0x040409, 0x00000a, 0x04040b, 0x04000d, 0x00040c,
+  0x04000f, 0x00040e, 0x000000, 0x040001, 0x000002, 0x040003,
+  0x040005, 0x000004, 0x040007, 0x000006, 0x000008, 0x040009,
+  0x00000a, 0x04000b, 0x04000d, 0x00000c, 0x04000f, 0x00000e,
+  0x000800, 0x041801, 0x000802, 0x041803, 0x040805, 0x001804,
+  0x040807, 0x001806, 0x000828, 0x041829, 0x00082a, 0x04182b,
+  0x04082d, 0x00182c, 0x04082f, 0x00182e, 0x000000, 0x040001,
+  0x000002, 0x040003, 0x040005, 0x000004, 0x040007, 0x000006,
+  0x000008, 0x040009, 0x00000a, 0x04000b, 0x04000d, 0x00000c,
+  0x04000f, 0x00000e, 0x001800, 0x040801, 0x001802, 0x040803,
+  0x041805, 0x000804, 0x041807, 0x000806, 0x001828, 0x040829,
+  0x00182a, 0x04082b, 0x04182d, 0x00082c, 0x04182f, 0x00082e,
+  0x000000, 0x040001, 0x000002, 0x040003, 0x040005, 0x000004,
+  0x040007, 0x000006, 0x000008, 0x040009, 0x00000a, 0x04000b,
+  0x04000d, 0x00000c, 0x04000f, 0x00000e, 0x000000, 0x040001,
+  0x000002, 0x040003, 0x000000, 0x040001, 0x000002, 0x040003,
+  0x000008, 0x040009, 0x00000a, 0x04000b, 0x000008, 0x040009,
+  0x00000a, 0x04000b, 0x000000, 0x040001, 0x000002, 0x040003,
+  0x040005, 0x000004, 0x040007, 0x000006, 0x000008, 0x040009,
+  0x00000a, 0x04000b, 0x04000d, 0x00000c, 0x04000f, 0x00000e,
+  0x000000, 0x040001, 0x000002, 0x040003, 0x040005, 0x000004,
+  0x040007, 0x000006, 0x000000, 0x040001, 0x000002, 0x040003,
+  0x040005, 0x000004, 0x040007, 0x000006, 0x000000, 0x040001,
+  0x000002, 0x040003, 0x040005, 0x000004, 0x040007, 0x000006,
+  0x000008, 0x040009, 0x00000a, 0x04000b, 0x04000d, 0x00000c,
+  0x04000f, 0x00000e, 0x000080, 0x040081, 0x000082, 0x040083,
+  0x040085, 0x000084, 0x040087, 0x000086, 0x000088, 0x040089,
+  0x00008a, 0x04008b, 0x04008d, 0x00008c, 0x04008f, 0x00008e,
+  0x000000, 0x040001, 0x000002, 0x040003, 0x040005, 0x000004,
+  0x040007, 0x000006, 0x000008, 0x040009, 0x00000a, 0x04000b,
+  0x04000d, 0x00000c, 0x04000f, 0x00000e, 0x000100, 0x000101,
+  0x000102, 0x000103, 0x000104, 0x000105, 0x000106, 0x000107,
+  0x000108, 0x000109, 0x00010a, 0x00010b, 0x00010c, 0x00010d,
+  0x00010e, 0x00010f, 0x000000, 0x040001, 0x000002, 0x040003,
+  0x040005, 0x000004, 0x040007, 0x000006, 0x000008, 0x040009,
+  0x00000a, 0x04000b, 0x04000d, 0x00000c, 0x04000f, 0x00000e,
+  0x000000, 0x040001, 0x000002, 0x040003, 0x000004, 0x000004,
+  0x000006, 0x000006, 0x000008, 0x040009, 0x00000a, 0x04000b,
+  0x00000c, 0x00000c, 0x00000e, 0x00000e, 0x000000, 0x040001,
+  0x000002, 0x040003, 0x040005, 0x000004, 0x040007, 0x000006,
+  0x000008, 0x040009, 0x00000a, 0x04000b, 0x04000d, 0x00000c,
+  0x04000f, 0x00000e, 0x000200, 0x040201, 0x000202, 0x040203,
+  0x040205, 0x000204, 0x040207, 0x000206, 0x000208, 0x040209,
+  0x00020a, 0x04020b, 0x04020d, 0x00020c, 0x04020f, 0x00020e,
+  0x000000, 0x040001, 0x000002, 0x040003, 0x040005, 0x000004,
+  0x040007, 0x000006, 0x000008, 0x040009, 0x00000a, 0x04000b,
+  0x04000d, 0x00000c, 0x04000f, 0x00000e, 0x000040, 0x040041,
+  0x000042, 0x040043, 0x040045, 0x000044, 0x040047, 0x000046,
+  0x000048, 0x040049, 0x00004a, 0x04004b, 0x04004d, 0x00004c,
+  0x04004f, 0x00004e, 0x000000, 0x040001, 0x000002, 0x040003,
+  0x040005, 0x000004, 0x040007, 0x000006, 0x000008, 0x040009,
+  0x00000a, 0x04000b, 0x04000d, 0x00000c, 0x04000f, 0x00000e,
+  0x000000, 0x000000, 0x000002, 0x000002, 0x000004, 0x000004,
+  0x000006, 0x000006, 0x000008, 0x000008, 0x00000a, 0x00000a,
+  0x00000c, 0x00000c, 0x00000e, 0x00000e, 0x000000, 0x040001,
+  0x000002, 0x040003, 0x040005, 0x000004, 0x040007, 0x000006,
+  0x000008, 0x040009, 0x00000a, 0x04000b, 0x04000d, 0x00000c,
+  0x04000f, 0x00000e, 0x000000, 0x040001, 0x040001, 0x000002,
+  0x000004, 0x040007, 0x040007, 0x000006, 0x000008, 0x040009,
+  0x040009, 0x00000a, 0x00000c, 0x04000f, 0x04000f, 0x00000e,
+  0x000000, 0x040001, 0x000002, 0x040003, 0x040005, 0x000004,
+  0x040007, 0x000006, 0x000008, 0x040009, 0x00000a, 0x04000b,
+  0x04000d, 0x00000c, 0x04000f, 0x00000e, 0x040001, 0x000002,
+  0x000002, 0x040003, 0x040005, 0x000004, 0x000004, 0x040007,
+  0x040009, 0x00000a, 0x00000a, 0x04000b, 0x04000d, 0x00000c,
+  0x00000c, 0x04000f, 0x000000, 0x040001, 0x000002, 0x040003,
+  0x040005, 0x000004, 0x040007, 0x000006, 0x000008, 0x040009,
+  0x00000a, 0x04000b, 0x04000d, 0x00000c, 0x04000f, 0x00000e,
+  0x040001, 0x040001, 0x040001, 0x040001, 0x000004, 0x000004,
+  0x000004, 0x000004, 0x040009, 0x040009, 0x040009, 0x040009,
+  0x00000c, 0x00000c, 0x00000c, 0x00000c, 0x000000, 0x040001,
+  0x000002, 0x040003, 0x040005, 0x000004, 0x040007, 0x000006,
+  0x000008, 0x040009, 0x00000a, 0x04000b, 0x04000d, 0x00000c,
+  0x04000f, 0x00000e, 0x040401, 0x040401, 0x040403, 0x040403,
+  0x000404, 0x040005, 0x000406, 0x040007, 0x040409, 0x040409,
+  0x04040b, 0x04040b, 0x00040c, 0x04000d, 0x00040e, 0x04000f,
+  0x000000, 0x040001, 0x000002, 0x040003, 0x040005, 0x000004,
+  0x040007, 0x000006, 0x000008, 0x040009, 0x00000a, 0x04000b,
+  0x04000d, 0x00000c, 0x04000f, 0x00000e, 0x000000, 0x040401,
+  0x000002, 0x040403, 0x000404, 0x000404, 0x000406, 0x000406,
+  0x000008, 0x040409, 0x00000a, 0x04040b, 0x00040c, 0x00040c,
+  0x00040e, 0x00040e, 0x000000, 0x040001, 0x000002, 0x040003,
+  0x040005, 0x000004, 0x040007, 0x000006, 0x000008, 0x040009,
+  0x00000a, 0x04000b, 0x04000d, 0x00000c, 0x04000f, 0x00000e,
+  0x000000, 0x040401, 0x000002, 0x040403, 0x000404, 0x040005,
+  0x000406, 0x040007, 0x000008, 0x040409, 0x00000a, 0x04040b,
+  0x00040c, 0x04000d, 0x00040e, 0x04000f, 0x000000, 0x040001,
+  0x000002, 0x040003, 0x040005, 0x000004, 0x040007, 0x000006,
+  0x000008, 0x040009, 0x00000a, 0x04000b, 0x04000d, 0x00000c,
+  0x04000f, 0x00000e, 0x000800, 0x041801, 0x000802, 0x041803,
+  0x040805, 0x001804, 0x040807, 0x001806, 0x000828, 0x041829,
+  0x00082a, 0x04182b, 0x04082d, 0x00182c, 0x04082f, 0x00182e,
+  0x000000, 0x040001, 0x000002, 0x040003, 0x040005, 0x000004,
+  0x040007, 0x000006, 0x000008, 0x040009, 0x00000a, 0x04000b,
+  0x04000d, 0x00000c, 0x04000f, 0x00000e, 0x001800, 0x040801,
+  0x001802, 0x040803, 0x041805, 0x000804, 0x041807, 0x000806,
+  0x001828, 0x040829, 0x00182a, 0x04082b, 0x04182d, 0x00082c,
+  0x04182f, 0x00082e, 0x000000, 0x040001, 0x000002, 0x040003,
+  0x040005, 0x000004, 0x040007, 0x000006, 0x000008, 0x040009,
+  0x00000a, 0x04000b, 0x04000d, 0x00000c, 0x04000f, 0x00000e,
+  0x040005, 0x000004, 0x040007, 0x000006, 0x040005, 0x000004,
+  0x040007, 0x000006, 0x04000d, 0x00000c, 0x04000f, 0x00000e,
+  0x04000d, 0x00000c, 0x04000f, 0x00000e, 0x000000, 0x040001,
+  0x000002, 0x040003, 0x040005, 0x000004, 0x040007, 0x000006,
+  0x000008, 0x040009, 0x00000a, 0x04000b, 0x04000d, 0x00000c,
+  0x04000f, 0x00000e, 0x000000, 0x040001, 0x000002, 0x040003,
+  0x04000d, 0x00000c, 0x04000f, 0x00000e, 0x000000, 0x040001,
+  0x000002, 0x040003, 0x04000d, 0x00000c, 0x04000f, 0x00000e,
+  0x000000, 0x040001, 0x000002, 0x040003, 0x040005, 0x000004,
+  0x040007, 0x000006, 0x000008, 0x040009, 0x00000a, 0x04000b,
+  0x04000d, 0x00000c, 0x04000f, 0x00000e, 0x000080, 0x040081,
+  0x000082, 0x040083, 0x040085, 0x000084, 0x040087, 0x000086,
+  0x000088, 0x040089, 0x00008a, 0x04008b, 0x04008d, 0x00008c,
+  0x04008f, 0x00008e, 0x000000, 0x040001, 0x000002, 0x040003,
+  0x040005, 0x000004, 0x040007, 0x000006, 0x000008, 0x040009,
+  0x00000a, 0x04000b, 0x04000d, 0x00000c, 0x04000f, 0x00000e,
+  0x000100, 0x000101, 0x000102, 0x000103, 0x000104, 0x000105,
+  0x000106, 0x000107, 0x000108, 0x000109, 0x00010a, 0x00010b,
+  0x00010c, 0x00010d, 0x00010e, 0x00010f, 0x000000, 0x040001,
+  0x000002, 0x040003, 0x040005, 0x000004, 0x040007, 0x000006,
+  0x000008, 0x040009, 0x00000a, 0x04000b, 0x04000d, 0x00000c,
+  0x04000f, 0x00000e, 0x000000, 0x040001, 0x000002, 0x040003,
+  0x000004, 0x000004, 0x000006, 0x000006, 0x000008, 0x040009,
+  0x00000a, 0x04000b, 0x00000c, 0x00000c, 0x00000e, 0x00000e,
+  0x000000, 0x040001, 0x000002, 0x040003, 0x040005, 0x000004,
+  0x040007, 0x000006, 0x000008, 0x040009, 0x00000a, 0x04000b,
+  0x04000d, 0x00000c, 0x04000f, 0x00000e, 0x000200, 0x040201,
+  0x000202, 0x040203, 0x040205, 0x000204, 0x040207, 0x000206,
+  0x000208, 0x040209, 0x00020a, 0x04020b, 0x04020d, 0x00020c,
+  0x04020f, 0x00020e, 0x000000, 0x040001, 0x000002, 0x040003,
+  0x040005, 0x000004, 0x040007, 0x000006, 0x000008, 0x040009,
+  0x00000a, 0x04000b, 0x04000d, 0x00000c, 0x04000f, 0x00000e,
+  0x080040, 0x180041, 0x080042, 0x180043, 0x080044, 0x180045,
+  0x080046, 0x180047, 0x082048, 0x182049, 0x08204a, 0x18204b,
+  0x08204c, 0x18204d, 0x08204e, 0x18204f, 0x080000, 0x180001,
+  0x080002, 0x180003, 0x080004, 0x180005, 0x080006, 0x180007,
+  0x082008, 0x182009, 0x08200a, 0x18200b, 0x08200c, 0x18200d,
+  0x08200e, 0x18200f, 0x080000, 0x080000, 0x080002, 0x080002,
+  0x080004, 0x080004, 0x080006, 0x080006, 0x082008, 0x082008,
+  0x08200a, 0x08200a, 0x08200c, 0x08200c, 0x08200e, 0x08200e,
+  0x080000, 0x180001, 0x080002, 0x180003, 0x080004, 0x180005,
+  0x080006, 0x180007, 0x082008, 0x182009, 0x08200a, 0x18200b,
+  0x08200c, 0x18200d, 0x08200e, 0x18200f, 0x080000, 0x180001,
+  0x180001, 0x080002, 0x080004, 0x180005, 0x180005, 0x080006,
+  0x082008, 0x182009, 0x182009, 0x08200a, 0x08200c, 0x18200d,
+  0x18200d, 0x08200e, 0x080000, 0x180001, 0x080002, 0x180003,
+  0x080004, 0x180005, 0x080006, 0x180007, 0x082008, 0x182009,
+  0x08200a, 0x18200b, 0x08200c, 0x18200d, 0x08200e, 0x18200f,
+  0x180001, 0x080002, 0x080002, 0x180003, 0x180005, 0x080006,
+  0x080006, 0x180007, 0x182009, 0x08200a, 0x08200a, 0x18200b,
+  0x18200d, 0x08200e, 0x08200e, 0x18200f, 0x080000, 0x180001,
+  0x080002, 0x180003, 0x080004, 0x180005, 0x080006, 0x180007,
+  0x082008, 0x182009, 0x08200a, 0x18200b, 0x08200c, 0x18200d,
+  0x08200e, 0x18200f, 0x180001, 0x180001, 0x180001, 0x180001,
+  0x180005, 0x180005, 0x180005, 0x180005, 0x182009, 0x182009,
+  0x182009, 0x182009, 0x18200d, 0x18200d, 0x18200d, 0x18200d,
+  0x080000, 0x180001, 0x080002, 0x180003, 0x080004, 0x180005,
+  0x080006, 0x180007, 0x082008, 0x182009, 0x08200a, 0x18200b,
+  0x08200c, 0x18200d, 0x08200e, 0x18200f, 0x180401, 0x180401,
+  0x180403, 0x180403, 0x180405, 0x180405, 0x180407, 0x180407,
+  0x182409, 0x182409, 0x18240b, 0x18240b, 0x18240d, 0x18240d,
+  0x18240f, 0x18240f, 0x080000, 0x180001, 0x080002, 0x180003,
+  0x080004, 0x180005, 0x080006, 0x180007, 0x082008, 0x182009,
+  0x08200a, 0x18200b, 0x08200c, 0x18200d, 0x08200e, 0x18200f,
+  0x080000, 0x180401, 0x080002, 0x180403, 0x080004, 0x180405,
+  0x080006, 0x180407, 0x082008, 0x182409, 0x08200a, 0x18240b,
+  0x08200c, 0x18240d, 0x08200e, 0x18240f, 0x080000, 0x180001,
+  0x080002, 0x180003, 0x080004, 0x180005, 0x080006, 0x180007,
+  0x082008, 0x182009, 0x08200a, 0x18200b, 0x08200c, 0x18200d,
+  0x08200e, 0x18200f, 0x080000, 0x180401, 0x080002, 0x180403,
+  0x080004, 0x180405, 0x080006, 0x180407, 0x082008, 0x182409,
+  0x08200a, 0x18240b, 0x08200c, 0x18240d, 0x08200e, 0x18240f,
+  0x080000, 0x180001, 0x080002, 0x180003, 0x080004, 0x180005,
+  0x080006, 0x180007, 0x082008, 0x182009, 0x08200a, 0x18200b,
+  0x08200c, 0x18200d, 0x08200e, 0x18200f, 0x080800, 0x181801,
+  0x080802, 0x181803, 0x080804, 0x181805, 0x080806, 0x181807,
+  0x082828, 0x183829, 0x08282a, 0x18382b, 0x08282c, 0x18382d,
+  0x08282e, 0x18382f, 0x080000, 0x180001, 0x080002, 0x180003,
+  0x080004, 0x180005, 0x080006, 0x180007, 0x082008, 0x182009,
+  0x08200a, 0x18200b, 0x08200c, 0x18200d, 0x08200e, 0x18200f,
+  0x081800, 0x180801, 0x081802, 0x180803, 0x081804, 0x180805,
+  0x081806, 0x180807, 0x083828, 0x182829, 0x08382a, 0x18282b,
+  0x08382c, 0x18282d, 0x08382e, 0x18282f, 0x080000, 0x180001,
+  0x080002, 0x180003, 0x080004, 0x180005, 0x080006, 0x180007,
+  0x082008, 0x182009, 0x08200a, 0x18200b, 0x08200c, 0x18200d,
+  0x08200e, 0x18200f, 0x080000, 0x180001, 0x080002, 0x180003,
+  0x080000, 0x180001, 0x080002, 0x180003, 0x082008, 0x182009,
+  0x08200a, 0x18200b, 0x082008, 0x182009, 0x08200a, 0x18200b,
+  0x080000, 0x180001, 0x080002, 0x180003, 0x080004, 0x180005,
+  0x080006, 0x180007, 0x082008, 0x182009, 0x08200a, 0x18200b,
+  0x08200c, 0x18200d, 0x08200e, 0x18200f, 0x080000, 0x180001,
+  0x080002, 0x180003, 0x080004, 0x180005, 0x080006, 0x180007,
+  0x080000, 0x180001, 0x080002, 0x180003, 0x080004, 0x180005,
+  0x080006, 0x180007, 0x080000, 0x180001, 0x080002, 0x180003,
+  0x080004, 0x180005, 0x080006, 0x180007, 0x082008, 0x182009,
+  0x08200a, 0x18200b, 0x08200c, 0x18200d, 0x08200e, 0x18200f,
+  0x080080, 0x180081, 0x080082, 0x180083, 0x080084, 0x180085,
+  0x080086, 0x180087, 0x082088, 0x182089, 0x08208a, 0x18208b,
+  0x08208c, 0x18208d, 0x08208e, 0x18208f, 0x080000, 0x180001,
+  0x080002, 0x180003, 0x080004, 0x180005, 0x080006, 0x180007,
+  0x082008, 0x182009, 0x08200a, 0x18200b, 0x08200c, 0x18200d,
+  0x08200e, 0x18200f, 0x000100, 0x000101, 0x000102, 0x000103,
+  0x000104, 0x000105, 0x000106, 0x000107, 0x000108, 0x000109,
+  0x00010a, 0x00010b, 0x00010c, 0x00010d, 0x00010e, 0x00010f,
+  0x080000, 0x180001, 0x080002, 0x180003, 0x080004, 0x180005,
+  0x080006, 0x180007, 0x082008, 0x182009, 0x08200a, 0x18200b,
+  0x08200c, 0x18200d, 0x08200e, 0x18200f, 0x000000, 0x180001,
+  0x000002, 0x180003, 0x000004, 0x180005, 0x000006, 0x180007,
+  0x000008, 0x182009, 0x00000a, 0x18200b, 0x00000c, 0x18200d,
+  0x00000e, 0x18200f, 0x080000, 0x180001, 0x080002, 0x180003,
+  0x080004, 0x180005, 0x080006, 0x180007, 0x082008, 0x182009,
+  0x08200a, 0x18200b, 0x08200c, 0x18200d, 0x08200e, 0x18200f,
+  0x080200, 0x180201, 0x080202, 0x180203, 0x080204, 0x180205,
+  0x080206, 0x180207, 0x082208, 0x182209, 0x08220a, 0x18220b,
+  0x08220c, 0x18220d, 0x08220e, 0x18220f, 0x080000, 0x180001,
+  0x080002, 0x180003, 0x080004, 0x180005, 0x080006, 0x180007,
+  0x082008, 0x182009, 0x08200a, 0x18200b, 0x08200c, 0x18200d,
+  0x08200e, 0x18200f, 0x080040, 0x180041, 0x080042, 0x180043,
+  0x080044, 0x180045, 0x080046, 0x180047, 0x082048, 0x182049,
+  0x08204a, 0x18204b, 0x08204c, 0x18204d, 0x08204e, 0x18204f,
+  0x080000, 0x180001, 0x080002, 0x180003, 0x080004, 0x180005,
+  0x080006, 0x180007, 0x082008, 0x182009, 0x08200a, 0x18200b,
+  0x08200c, 0x18200d, 0x08200e, 0x18200f, 0x080000, 0x080000,
+  0x080002, 0x080002, 0x180005, 0x180005, 0x180007, 0x180007,
+  0x082008, 0x082008, 0x08200a, 0x08200a, 0x18200d, 0x18200d,
+  0x18200f, 0x18200f, 0x080000, 0x180001, 0x080002, 0x180003,
+  0x080004, 0x180005, 0x080006, 0x180007, 0x082008, 0x182009,
+  0x08200a, 0x18200b, 0x08200c, 0x18200d, 0x08200e, 0x18200f,
+  0x080000, 0x180001, 0x180001, 0x080002, 0x180005, 0x080006,
+  0x080006, 0x180007, 0x082008, 0x182009, 0x182009, 0x08200a,
+  0x18200d, 0x08200e, 0x08200e, 0x18200f, 0x080000, 0x180001,
+  0x080002, 0x180003, 0x080004, 0x180005, 0x080006, 0x180007,
+  0x082008, 0x182009, 0x08200a, 0x18200b, 0x08200c, 0x18200d,
+  0x08200e, 0x18200f, 0x180001, 0x080002, 0x080002, 0x180003,
+  0x080004, 0x180005, 0x180005, 0x080006, 0x182009, 0x08200a,
+  0x08200a, 0x18200b, 0x08200c, 0x18200d, 0x18200d, 0x08200e,
+  0x080000, 0x180001, 0x080002, 0x180003, 0x080004, 0x180005,
+  0x080006, 0x180007, 0x082008, 0x182009, 0x08200a, 0x18200b,
+  0x08200c, 0x18200d, 0x08200e, 0x18200f, 0x180001, 0x180001,
+  0x180001, 0x180001, 0x180005, 0x180005, 0x180005, 0x180005,
+  0x182009, 0x182009, 0x182009, 0x182009, 0x18200d, 0x18200d,
+  0x18200d, 0x18200d, 0x080000, 0x180001, 0x080002, 0x180003,
+  0x080004, 0x180005, 0x080006, 0x180007, 0x082008, 0x182009,
+  0x08200a, 0x18200b, 0x08200c, 0x18200d, 0x08200e, 0x18200f,
+  0x180401, 0x180401, 0x180403, 0x180403, 0x180405, 0x080004,
+  0x180407, 0x080006, 0x182409, 0x182409, 0x18240b, 0x18240b,
+  0x18240d, 0x08200c, 0x18240f, 0x08200e, 0x080000, 0x180001,
+  0x080002, 0x180003, 0x080004, 0x180005, 0x080006, 0x180007,
+  0x082008, 0x182009, 0x08200a, 0x18200b, 0x08200c, 0x18200d,
+  0x08200e, 0x18200f, 0x080000, 0x180401, 0x080002, 0x180403,
+  0x180405, 0x180405, 0x180407, 0x180407, 0x082008, 0x182409,
+  0x08200a, 0x18240b, 0x18240d, 0x18240d, 0x18240f, 0x18240f,
+  0x080000, 0x180001, 0x080002, 0x180003, 0x080004, 0x180005,
+  0x080006, 0x180007, 0x082008, 0x182009, 0x08200a, 0x18200b,
+  0x08200c, 0x18200d, 0x08200e, 0x18200f, 0x080000, 0x180401,
+  0x080002, 0x180403, 0x180405, 0x080004, 0x180407, 0x080006,
+  0x082008, 0x182409, 0x08200a, 0x18240b, 0x18240d, 0x08200c,
+  0x18240f, 0x08200e, 0x080000, 0x180001, 0x080002, 0x180003,
+  0x080004, 0x180005, 0x080006, 0x180007, 0x082008, 0x182009,
+  0x08200a, 0x18200b, 0x08200c, 0x18200d, 0x08200e, 0x18200f,
+  0x080800, 0x181801, 0x080802, 0x181803, 0x080804, 0x181805,
+  0x080806, 0x181807, 0x082828, 0x183829, 0x08282a, 0x18382b,
+  0x08282c, 0x18382d, 0x08282e, 0x18382f, 0x080000, 0x180001,
+  0x080002, 0x180003, 0x080004, 0x180005, 0x080006, 0x180007,
+  0x082008, 0x182009, 0x08200a, 0x18200b, 0x08200c, 0x18200d,
+  0x08200e, 0x18200f, 0x081800, 0x180801, 0x081802, 0x180803,
+  0x081804, 0x180805, 0x081806, 0x180807, 0x083828, 0x182829,
+  0x08382a, 0x18282b, 0x08382c, 0x18282d, 0x08382e, 0x18282f,
+  0x080000, 0x180001, 0x080002, 0x180003, 0x080004, 0x180005,
+  0x080006, 0x180007, 0x082008, 0x182009, 0x08200a, 0x18200b,
+  0x08200c, 0x18200d, 0x08200e, 0x18200f, 0x080004, 0x180005,
+  0x080006, 0x180007, 0x080004, 0x180005, 0x080006, 0x180007,
+  0x08200c, 0x18200d, 0x08200e, 0x18200f, 0x08200c, 0x18200d,
+  0x08200e, 0x18200f, 0x080000, 0x180001, 0x080002, 0x180003,
+  0x080004, 0x180005, 0x080006, 0x180007, 0x082008, 0x182009,
+  0x08200a, 0x18200b, 0x08200c, 0x18200d, 0x08200e, 0x18200f,
+  0x080000, 0x180001, 0x080002, 0x180003, 0x08200c, 0x18200d,
+  0x08200e, 0x18200f, 0x080000, 0x180001, 0x080002, 0x180003,
+  0x08200c, 0x18200d, 0x08200e, 0x18200f, 0x080000, 0x180001,
+  0x080002, 0x180003, 0x080004, 0x180005, 0x080006, 0x180007,
+  0x082008, 0x182009, 0x08200a, 0x18200b, 0x08200c, 0x18200d,
+  0x08200e, 0x18200f, 0x080080, 0x180081, 0x080082, 0x180083,
+  0x080084, 0x180085, 0x080086, 0x180087, 0x082088, 0x182089,
+  0x08208a, 0x18208b, 0x08208c, 0x18208d, 0x08208e, 0x18208f,
+  0x080000, 0x180001, 0x080002, 0x180003, 0x080004, 0x180005,
+  0x080006, 0x180007, 0x082008, 0x182009, 0x08200a, 0x18200b,
+  0x08200c, 0x18200d, 0x08200e, 0x18200f, 0x000100, 0x000101,
+  0x000102, 0x000103, 0x000104, 0x000105, 0x000106, 0x000107,
+  0x000108, 0x000109, 0x00010a, 0x00010b, 0x00010c, 0x00010d,
+  0x00010e, 0x00010f, 0x080000, 0x180001, 0x080002, 0x180003,
+  0x080004, 0x180005, 0x080006, 0x180007, 0x082008, 0x182009,
+  0x08200a, 0x18200b, 0x08200c, 0x18200d, 0x08200e, 0x18200f,
+  0x000000, 0x180001, 0x000002, 0x180003, 0x000004, 0x180005,
+  0x000006, 0x180007, 0x000008, 0x182009, 0x00000a, 0x18200b,
+  0x00000c, 0x18200d, 0x00000e, 0x18200f, 0x080000, 0x180001,
+  0x080002, 0x180003, 0x080004, 0x180005, 0x080006, 0x180007,
+  0x082008, 0x182009, 0x08200a, 0x18200b, 0x08200c, 0x18200d,
+  0x08200e, 0x18200f, 0x080200, 0x180201, 0x080202, 0x180203,
+  0x080204, 0x180205, 0x080206, 0x180207, 0x082208, 0x182209,
+  0x08220a, 0x18220b, 0x08220c, 0x18220d, 0x08220e, 0x18220f,
+  0x080000, 0x180001, 0x080002, 0x180003, 0x080004, 0x180005,
+  0x080006, 0x180007, 0x082008, 0x182009, 0x08200a, 0x18200b,
+  0x08200c, 0x18200d, 0x08200e, 0x18200f, 0x180040, 0x080041,
+  0x180042, 0x080043, 0x180044, 0x080045, 0x180046, 0x080047,
+  0x182048, 0x082049, 0x18204a, 0x08204b, 0x18204c, 0x08204d,
+  0x18204e, 0x08204f, 0x180000, 0x080001, 0x180002, 0x080003,
+  0x180004, 0x080005, 0x180006, 0x080007, 0x182008, 0x082009,
+  0x18200a, 0x08200b, 0x18200c, 0x08200d, 0x18200e, 0x08200f,
+  0x180000, 0x180000, 0x180002, 0x180002, 0x180004, 0x180004,
+  0x180006, 0x180006, 0x182008, 0x182008, 0x18200a, 0x18200a,
+  0x18200c, 0x18200c, 0x18200e, 0x18200e, 0x180000, 0x080001,
+  0x180002, 0x080003, 0x180004, 0x080005, 0x180006, 0x080007,
+  0x182008, 0x082009, 0x18200a, 0x08200b, 0x18200c, 0x08200d,
+  0x18200e, 0x08200f, 0x180000, 0x080001, 0x080001, 0x180002,
+  0x180004, 0x080005, 0x080005, 0x180006, 0x182008, 0x082009,
+  0x082009, 0x18200a, 0x18200c, 0x08200d, 0x08200d, 0x18200e,
+  0x180000, 0x080001, 0x180002, 0x080003, 0x180004, 0x080005,
+  0x180006, 0x080007, 0x182008, 0x082009, 0x18200a, 0x08200b,
+  0x18200c, 0x08200d, 0x18200e, 0x08200f, 0x080001, 0x180002,
+  0x180002, 0x080003, 0x080005, 0x180006, 0x180006, 0x080007,
+  0x082009, 0x18200a, 0x18200a, 0x08200b, 0x08200d, 0x18200e,
+  0x18200e, 0x08200f, 0x180000, 0x080001, 0x180002, 0x080003,
+  0x180004, 0x080005, 0x180006, 0x080007, 0x182008, 0x082009,
+  0x18200a, 0x08200b, 0x18200c, 0x08200d, 0x18200e, 0x08200f,
+  0x080001, 0x080001, 0x080001, 0x080001, 0x080005, 0x080005,
+  0x080005, 0x080005, 0x082009, 0x082009, 0x082009, 0x082009,
+  0x08200d, 0x08200d, 0x08200d, 0x08200d, 0x180000, 0x080001,
+  0x180002, 0x080003, 0x180004, 0x080005, 0x180006, 0x080007,
+  0x182008, 0x082009, 0x18200a, 0x08200b, 0x18200c, 0x08200d,
+  0x18200e, 0x08200f, 0x080401, 0x080401, 0x080403, 0x080403,
+  0x080405, 0x080405, 0x080407, 0x080407, 0x082409, 0x082409,
+  0x08240b, 0x08240b, 0x08240d, 0x08240d, 0x08240f, 0x08240f,
+  0x180000, 0x080001, 0x180002, 0x080003, 0x180004, 0x080005,
+  0x180006, 0x080007, 0x182008, 0x082009, 0x18200a, 0x08200b,
+  0x18200c, 0x08200d, 0x18200e, 0x08200f, 0x180000, 0x080401,
+  0x180002, 0x080403, 0x180004, 0x080405, 0x180006, 0x080407,
+  0x182008, 0x082409, 0x18200a, 0x08240b, 0x18200c, 0x08240d,
+  0x18200e, 0x08240f, 0x180000, 0x080001, 0x180002, 0x080003,
+  0x180004, 0x080005, 0x180006, 0x080007, 0x182008, 0x082009,
+  0x18200a, 0x08200b, 0x18200c, 0x08200d, 0x18200e, 0x08200f,
+  0x180000, 0x080401, 0x180002, 0x080403, 0x180004, 0x080405,
+  0x180006, 0x080407, 0x182008, 0x082409, 0x18200a, 0x08240b,
+  0x18200c, 0x08240d, 0x18200e, 0x08240f, 0x180000, 0x080001,
+  0x180002, 0x080003, 0x180004, 0x080005, 0x180006, 0x080007,
+  0x182008, 0x082009, 0x18200a, 0x08200b, 0x18200c, 0x08200d,
+  0x18200e, 0x08200f, 0x180800, 0x081801, 0x180802, 0x081803,
+  0x180804, 0x081805, 0x180806, 0x081807, 0x182828, 0x083829,
+  0x18282a, 0x08382b, 0x18282c, 0x08382d, 0x18282e, 0x08382f,
+  0x180000, 0x080001, 0x180002, 0x080003, 0x180004, 0x080005,
+  0x180006, 0x080007, 0x182008, 0x082009, 0x18200a, 0x08200b,
+  0x18200c, 0x08200d, 0x18200e, 0x08200f, 0x181800, 0x080801,
+  0x181802, 0x080803, 0x181804, 0x080805, 0x181806, 0x080807,
+  0x183828, 0x082829, 0x18382a, 0x08282b, 0x18382c, 0x08282d,
+  0x18382e, 0x08282f, 0x180000, 0x080001, 0x180002, 0x080003,
+  0x180004, 0x080005, 0x180006, 0x080007, 0x182008, 0x082009,
+  0x18200a, 0x08200b, 0x18200c, 0x08200d, 0x18200e, 0x08200f,
+  0x180000, 0x080001, 0x180002, 0x080003, 0x180000, 0x080001,
+  0x180002, 0x080003, 0x182008, 0x082009, 0x18200a, 0x08200b,
+  0x182008, 0x082009, 0x18200a, 0x08200b, 0x180000, 0x080001,
+  0x180002, 0x080003, 0x180004, 0x080005, 0x180006, 0x080007,
+  0x182008, 0x082009, 0x18200a, 0x08200b, 0x18200c, 0x08200d,
+  0x18200e, 0x08200f, 0x180000, 0x080001, 0x180002, 0x080003,
+  0x180004, 0x080005, 0x180006, 0x080007, 0x180000, 0x080001,
+  0x180002, 0x080003, 0x180004, 0x080005, 0x180006, 0x080007,
+  0x180000, 0x080001, 0x180002, 0x080003, 0x180004, 0x080005,
+  0x180006, 0x080007, 0x182008, 0x082009, 0x18200a, 0x08200b,
+  0x18200c, 0x08200d, 0x18200e, 0x08200f, 0x180080, 0x080081,
+  0x180082, 0x080083, 0x180084, 0x080085, 0x180086, 0x080087,
+  0x182088, 0x082089, 0x18208a, 0x08208b, 0x18208c, 0x08208d,
+  0x18208e, 0x08208f, 0x180000, 0x080001, 0x180002, 0x080003,
+  0x180004, 0x080005, 0x180006, 0x080007, 0x182008, 0x082009,
+  0x18200a, 0x08200b, 0x18200c, 0x08200d, 0x18200e, 0x08200f,
+  0x000100, 0x000101, 0x000102, 0x000103, 0x000104, 0x000105,
+  0x000106, 0x000107, 0x000108, 0x000109, 0x00010a, 0x00010b,
+  0x00010c, 0x00010d, 0x00010e, 0x00010f, 0x180000, 0x080001,
+  0x180002, 0x080003, 0x180004, 0x080005, 0x180006, 0x080007,
+  0x182008, 0x082009, 0x18200a, 0x08200b, 0x18200c, 0x08200d,
+  0x18200e, 0x08200f, 0x000000, 0x080001, 0x000002, 0x080003,
+  0x000004, 0x080005, 0x000006, 0x080007, 0x000008, 0x082009,
+  0x00000a, 0x08200b, 0x00000c, 0x08200d, 0x00000e, 0x08200f,
+  0x180000, 0x080001, 0x180002, 0x080003, 0x180004, 0x080005,
+  0x180006, 0x080007, 0x182008, 0x082009, 0x18200a, 0x08200b,
+  0x18200c, 0x08200d, 0x18200e, 0x08200f, 0x180200, 0x080201,
+  0x180202, 0x080203, 0x180204, 0x080205, 0x180206, 0x080207,
+  0x182208, 0x082209, 0x18220a, 0x08220b, 0x18220c, 0x08220d,
+  0x18220e, 0x08220f, 0x180000, 0x080001, 0x180002, 0x080003,
+  0x180004, 0x080005, 0x180006, 0x080007, 0x182008, 0x082009,
+  0x18200a, 0x08200b, 0x18200c, 0x08200d, 0x18200e, 0x08200f,
+  0x180040, 0x080041, 0x180042, 0x080043, 0x180044, 0x080045,
+  0x180046, 0x080047, 0x182048, 0x082049, 0x18204a, 0x08204b,
+  0x18204c, 0x08204d, 0x18204e, 0x08204f, 0x180000, 0x080001,
+  0x180002, 0x080003, 0x180004, 0x080005, 0x180006, 0x080007,
+  0x182008, 0x082009, 0x18200a, 0x08200b, 0x18200c, 0x08200d,
+  0x18200e, 0x08200f, 0x180000, 0x180000, 0x180002, 0x180002,
+  0x080005, 0x080005, 0x080007, 0x080007, 0x182008, 0x182008,
+  0x18200a, 0x18200a, 0x08200d, 0x08200d, 0x08200f, 0x08200f,
+  0x180000, 0x080001, 0x180002, 0x080003, 0x180004, 0x080005,
+  0x180006, 0x080007, 0x182008, 0x082009, 0x18200a, 0x08200b,
+  0x18200c, 0x08200d, 0x18200e, 0x08200f, 0x180000, 0x080001,
+  0x080001, 0x180002, 0x080005, 0x180006, 0x180006, 0x080007,
+  0x182008, 0x082009, 0x082009, 0x18200a, 0x08200d, 0x18200e,
+  0x18200e, 0x08200f, 0x180000, 0x080001, 0x180002, 0x080003,
+  0x180004, 0x080005, 0x180006, 0x080007, 0x182008, 0x082009,
+  0x18200a, 0x08200b, 0x18200c, 0x08200d, 0x18200e, 0x08200f,
+  0x080001, 0x180002, 0x180002, 0x080003, 0x180004, 0x080005,
+  0x080005, 0x180006, 0x082009, 0x18200a, 0x18200a, 0x08200b,
+  0x18200c, 0x08200d, 0x08200d, 0x18200e, 0x180000, 0x080001,
+  0x180002, 0x080003, 0x180004, 0x080005, 0x180006, 0x080007,
+  0x182008, 0x082009, 0x18200a, 0x08200b, 0x18200c, 0x08200d,
+  0x18200e, 0x08200f, 0x080001, 0x080001, 0x080001, 0x080001,
+  0x080005, 0x080005, 0x080005, 0x080005, 0x082009, 0x082009,
+  0x082009, 0x082009, 0x08200d, 0x08200d, 0x08200d, 0x08200d,
+  0x180000, 0x080001, 0x180002, 0x080003, 0x180004, 0x080005,
+  0x180006, 0x080007, 0x182008, 0x082009, 0x18200a, 0x08200b,
+  0x18200c, 0x08200d, 0x18200e, 0x08200f, 0x080401, 0x080401,
+  0x080403, 0x080403, 0x080405, 0x180004, 0x080407, 0x180006,
+  0x082409, 0x082409, 0x08240b, 0x08240b, 0x08240d, 0x18200c,
+  0x08240f, 0x18200e, 0x180000, 0x080001, 0x180002, 0x080003,
+  0x180004, 0x080005, 0x180006, 0x080007, 0x182008, 0x082009,
+  0x18200a, 0x08200b, 0x18200c, 0x08200d, 0x18200e, 0x08200f,
+  0x180000, 0x080401, 0x180002, 0x080403, 0x080405, 0x080405,
+  0x080407, 0x080407, 0x182008, 0x082409, 0x18200a, 0x08240b,
+  0x08240d, 0x08240d, 0x08240f, 0x08240f, 0x180000, 0x080001,
+  0x180002, 0x080003, 0x180004, 0x080005, 0x180006, 0x080007,
+  0x182008, 0x082009, 0x18200a, 0x08200b, 0x18200c, 0x08200d,
+  0x18200e, 0x08200f, 0x180000, 0x080401, 0x180002, 0x080403,
+  0x080405, 0x180004, 0x080407, 0x180006, 0x182008, 0x082409,
+  0x18200a, 0x08240b, 0x08240d, 0x18200c, 0x08240f, 0x18200e,
+  0x180000, 0x080001, 0x180002, 0x080003, 0x180004, 0x080005,
+  0x180006, 0x080007, 0x182008, 0x082009, 0x18200a, 0x08200b,
+  0x18200c, 0x08200d, 0x18200e, 0x08200f, 0x180800, 0x081801,
+  0x180802, 0x081803, 0x180804, 0x081805, 0x180806, 0x081807,
+  0x182828, 0x083829, 0x18282a, 0x08382b, 0x18282c, 0x08382d,
+  0x18282e, 0x08382f, 0x180000, 0x080001, 0x180002, 0x080003,
+  0x180004, 0x080005, 0x180006, 0x080007, 0x182008, 0x082009,
+  0x18200a, 0x08200b, 0x18200c, 0x08200d, 0x18200e, 0x08200f,
+  0x181800, 0x080801, 0x181802, 0x080803, 0x181804, 0x080805,
+  0x181806, 0x080807, 0x183828, 0x082829, 0x18382a, 0x08282b,
+  0x18382c, 0x08282d, 0x18382e, 0x08282f, 0x180000, 0x080001,
+  0x180002, 0x080003, 0x180004, 0x080005, 0x180006, 0x080007,
+  0x182008, 0x082009, 0x18200a, 0x08200b, 0x18200c, 0x08200d,
+  0x18200e, 0x08200f, 0x180004, 0x080005, 0x180006, 0x080007,
+  0x180004, 0x080005, 0x180006, 0x080007, 0x18200c, 0x08200d,
+  0x18200e, 0x08200f, 0x18200c, 0x08200d, 0x18200e, 0x08200f,
+  0x180000, 0x080001, 0x180002, 0x080003, 0x180004, 0x080005,
+  0x180006, 0x080007, 0x182008, 0x082009, 0x18200a, 0x08200b,
+  0x18200c, 0x08200d, 0x18200e, 0x08200f, 0x180000, 0x080001,
+  0x180002, 0x080003, 0x18200c, 0x08200d, 0x18200e, 0x08200f,
+  0x180000, 0x080001, 0x180002, 0x080003, 0x18200c, 0x08200d,
+  0x18200e, 0x08200f, 0x180000, 0x080001, 0x180002, 0x080003,
+  0x180004, 0x080005, 0x180006, 0x080007, 0x182008, 0x082009,
+  0x18200a, 0x08200b, 0x18200c, 0x08200d, 0x18200e, 0x08200f,
+  0x180080, 0x080081, 0x180082, 0x080083, 0x180084, 0x080085,
+  0x180086, 0x080087, 0x182088, 0x082089, 0x18208a, 0x08208b,
+  0x18208c, 0x08208d, 0x18208e, 0x08208f, 0x180000, 0x080001,
+  0x180002, 0x080003, 0x180004, 0x080005, 0x180006, 0x080007,
+  0x182008, 0x082009, 0x18200a, 0x08200b, 0x18200c, 0x08200d,
+  0x18200e, 0x08200f, 0x000100, 0x000101, 0x000102, 0x000103,
+  0x000104, 0x000105, 0x000106, 0x000107, 0x000108, 0x000109,
+  0x00010a, 0x00010b, 0x00010c, 0x00010d, 0x00010e, 0x00010f,
+  0x180000, 0x080001, 0x180002, 0x080003, 0x180004, 0x080005,
+  0x180006, 0x080007, 0x182008, 0x082009, 0x18200a, 0x08200b,
+  0x18200c, 0x08200d, 0x18200e, 0x08200f, 0x000000, 0x080001,
+  0x000002, 0x080003, 0x000004, 0x080005, 0x000006, 0x080007,
+  0x000008, 0x082009, 0x00000a, 0x08200b, 0x00000c, 0x08200d,
+  0x00000e, 0x08200f, 0x180000, 0x080001, 0x180002, 0x080003,
+  0x180004, 0x080005, 0x180006, 0x080007, 0x182008, 0x082009,
+  0x18200a, 0x08200b, 0x18200c, 0x08200d, 0x18200e, 0x08200f,
+  0x180200, 0x080201, 0x180202, 0x080203, 0x180204, 0x080205,
+  0x180206, 0x080207, 0x182208, 0x082209, 0x18220a, 0x08220b,
+  0x18220c, 0x08220d, 0x18220e, 0x08220f, 0x180000, 0x080001,
+  0x180002, 0x080003, 0x180004, 0x080005, 0x180006, 0x080007,
+  0x182008, 0x082009, 0x18200a, 0x08200b, 0x18200c, 0x08200d,
+  0x18200e, 0x08200f, 0x000044, 0x000045, 0x000046, 0x000047,
+  0x000044, 0x000045, 0x000046, 0x000047, 0x00004c, 0x00004d,
+  0x00004e, 0x00004f, 0x00004c, 0x00004d, 0x00004e, 0x00004f,
+  0x000004, 0x000005, 0x000006, 0x000007, 0x000004, 0x000005,
+  0x000006, 0x000007, 0x00000c, 0x00000d, 0x00000e, 0x00000f,
+  0x00000c, 0x00000d, 0x00000e, 0x00000f, 0x000004, 0x000004,
+  0x000006, 0x000006, 0x000004, 0x000004, 0x000006, 0x000006,
+  0x00000c, 0x00000c, 0x00000e, 0x00000e, 0x00000c, 0x00000c,
+  0x00000e, 0x00000e, 0x000004, 0x000005, 0x000006, 0x000007,
+  0x000004, 0x000005, 0x000006, 0x000007, 0x00000c, 0x00000d,
+  0x00000e, 0x00000f, 0x00000c, 0x00000d, 0x00000e, 0x00000f,
+  0x000004, 0x000005, 0x000005, 0x000006, 0x000004, 0x000005,
+  0x000005, 0x000006, 0x00000c, 0x00000d, 0x00000d, 0x00000e,
+  0x00000c, 0x00000d, 0x00000d, 0x00000e, 0x000004, 0x000005,
+  0x000006, 0x000007, 0x000004, 0x000005, 0x000006, 0x000007,
+  0x00000c, 0x00000d, 0x00000e, 0x00000f, 0x00000c, 0x00000d,
+  0x00000e, 0x00000f, 0x000005, 0x000006, 0x000006, 0x000007,
+  0x000005, 0x000006, 0x000006, 0x000007, 0x00000d, 0x00000e,
+  0x00000e, 0x00000f, 0x00000d, 0x00000e, 0x00000e, 0x00000f,
+  0x000004, 0x000005, 0x000006, 0x000007, 0x000004, 0x000005,
+  0x000006, 0x000007, 0x00000c, 0x00000d, 0x00000e, 0x00000f,
+  0x00000c, 0x00000d, 0x00000e, 0x00000f, 0x000005, 0x000005,
+  0x000005, 0x000005, 0x000005, 0x000005, 0x000005, 0x000005,
+  0x00000d, 0x00000d, 0x00000d, 0x00000d, 0x00000d, 0x00000d,
+  0x00000d, 0x00000d, 0x000004, 0x000005, 0x000006, 0x000007,
+  0x000004, 0x000005, 0x000006, 0x000007, 0x00000c, 0x00000d,
+  0x00000e, 0x00000f, 0x00000c, 0x00000d, 0x00000e, 0x00000f,
+  0x000405, 0x000405, 0x000407, 0x000407, 0x000405, 0x000405,
+  0x000407, 0x000407, 0x00040d, 0x00040d, 0x00040f, 0x00040f,
+  0x00040d, 0x00040d, 0x00040f, 0x00040f, 0x000004, 0x000005,
+  0x000006, 0x000007, 0x000004, 0x000005, 0x000006, 0x000007,
+  0x00000c, 0x00000d, 0x00000e, 0x00000f, 0x00000c, 0x00000d,
+  0x00000e, 0x00000f, 0x000004, 0x000405, 0x000006, 0x000407,
+  0x000004, 0x000405, 0x000006, 0x000407, 0x00000c, 0x00040d,
+  0x00000e, 0x00040f, 0x00000c, 0x00040d, 0x00000e, 0x00040f,
+  0x000004, 0x000005, 0x000006, 0x000007, 0x000004, 0x000005,
+  0x000006, 0x000007, 0x00000c, 0x00000d, 0x00000e, 0x00000f,
+  0x00000c, 0x00000d, 0x00000e, 0x00000f, 0x000004, 0x000405,
+  0x000006, 0x000407, 0x000004, 0x000405, 0x000006, 0x000407,
+  0x00000c, 0x00040d, 0x00000e, 0x00040f, 0x00000c, 0x00040d,
+  0x00000e, 0x00040f, 0x000004, 0x000005, 0x000006, 0x000007,
+  0x000004, 0x000005, 0x000006, 0x000007, 0x00000c, 0x00000d,
+  0x00000e, 0x00000f, 0x00000c, 0x00000d, 0x00000e, 0x00000f,
+  0x000804, 0x001805, 0x000806, 0x001807, 0x000804, 0x001805,
+  0x000806, 0x001807, 0x00082c, 0x00182d, 0x00082e, 0x00182f,
+  0x00082c, 0x00182d, 0x00082e, 0x00182f, 0x000004, 0x000005,
+  0x000006, 0x000007, 0x000004, 0x000005, 0x000006, 0x000007,
+  0x00000c, 0x00000d, 0x00000e, 0x00000f, 0x00000c, 0x00000d,
+  0x00000e, 0x00000f, 0x001804, 0x000805, 0x001806, 0x000807,
+  0x001804, 0x000805, 0x001806, 0x000807, 0x00182c, 0x00082d,
+  0x00182e, 0x00082f, 0x00182c, 0x00082d, 0x00182e, 0x00082f,
+  0x000004, 0x000005, 0x000006, 0x000007, 0x000004, 0x000005,
+  0x000006, 0x000007, 0x00000c, 0x00000d, 0x00000e, 0x00000f,
+  0x00000c, 0x00000d, 0x00000e, 0x00000f, 0x000004, 0x000005,
+  0x000006, 0x000007, 0x000004, 0x000005, 0x000006, 0x000007,
+  0x00000c, 0x00000d, 0x00000e, 0x00000f, 0x00000c, 0x00000d,
+  0x00000e, 0x00000f, 0x000004, 0x000005, 0x000006, 0x000007,
+  0x000004, 0x000005, 0x000006, 0x000007, 0x00000c, 0x00000d,
+  0x00000e, 0x00000f, 0x00000c, 0x00000d, 0x00000e, 0x00000f,
+  0x000004, 0x000005, 0x000006, 0x000007, 0x000004, 0x000005,
+  0x000006, 0x000007, 0x000004, 0x000005, 0x000006, 0x000007,
+  0x000004, 0x000005, 0x000006, 0x000007, 0x000004, 0x000005,
+  0x000006, 0x000007, 0x000004, 0x000005, 0x000006, 0x000007,
+  0x00000c, 0x00000d, 0x00000e, 0x00000f, 0x00000c, 0x00000d,
+  0x00000e, 0x00000f, 0x000084, 0x000085, 0x000086, 0x000087,
+  0x000084, 0x000085, 0x000086, 0x000087, 0x00008c, 0x00008d,
+  0x00008e, 0x00008f, 0x00008c, 0x00008d, 0x00008e, 0x00008f,
+  0x000004, 0x000005, 0x000006, 0x000007, 0x000004, 0x000005,
+  0x000006, 0x000007, 0x00000c, 0x00000d, 0x00000e, 0x00000f,
+  0x00000c, 0x00000d, 0x00000e, 0x00000f, 0x000100, 0x000101,
+  0x000102, 0x000103, 0x000104, 0x000105, 0x000106, 0x000107,
+  0x000108, 0x000109, 0x00010a, 0x00010b, 0x00010c, 0x00010d,
+  0x00010e, 0x00010f, 0x000004, 0x000005, 0x000006, 0x000007,
+  0x000004, 0x000005, 0x000006, 0x000007, 0x00000c, 0x00000d,
+  0x00000e, 0x00000f, 0x00000c, 0x00000d, 0x00000e, 0x00000f,
+  0x000000, 0x000005, 0x000002, 0x000007, 0x000004, 0x000005,
+  0x000006, 0x000007, 0x000008, 0x00000d, 0x00000a, 0x00000f,
+  0x00000c, 0x00000d, 0x00000e, 0x00000f, 0x000004, 0x000005,
+  0x000006, 0x000007, 0x000004, 0x000005, 0x000006, 0x000007,
+  0x00000c, 0x00000d, 0x00000e, 0x00000f, 0x00000c, 0x00000d,
+  0x00000e, 0x00000f, 0x000204, 0x000205, 0x000206, 0x000207,
+  0x000204, 0x000205, 0x000206, 0x000207, 0x00020c, 0x00020d,
+  0x00020e, 0x00020f, 0x00020c, 0x00020d, 0x00020e, 0x00020f,
+  0x000004, 0x000005, 0x000006, 0x000007, 0x000004, 0x000005,
+  0x000006, 0x000007, 0x00000c, 0x00000d, 0x00000e, 0x00000f,
+  0x00000c, 0x00000d, 0x00000e, 0x00000f, 0x000044, 0x000045,
+  0x000046, 0x000047, 0x000044, 0x000045, 0x000046, 0x000047,
+  0x00004c, 0x00004d, 0x00004e, 0x00004f, 0x00004c, 0x00004d,
+  0x00004e, 0x00004f, 0x000004, 0x000005, 0x000006, 0x000007,
+  0x000004, 0x000005, 0x000006, 0x000007, 0x00000c, 0x00000d,
+  0x00000e, 0x00000f, 0x00000c, 0x00000d, 0x00000e, 0x00000f,
+  0x000004, 0x000004, 0x000006, 0x000006, 0x000005, 0x000005,
+  0x000007, 0x000007, 0x00000c, 0x00000c, 0x00000e, 0x00000e,
+  0x00000d, 0x00000d, 0x00000f, 0x00000f, 0x000004, 0x000005,
+  0x000006, 0x000007, 0x000004, 0x000005, 0x000006, 0x000007,
+  0x00000c, 0x00000d, 0x00000e, 0x00000f, 0x00000c, 0x00000d,
+  0x00000e, 0x00000f, 0x000004, 0x000005, 0x000005, 0x000006,
+  0x000005, 0x000006, 0x000006, 0x000007, 0x00000c, 0x00000d,
+  0x00000d, 0x00000e, 0x00000d, 0x00000e, 0x00000e, 0x00000f,
+  0x000004, 0x000005, 0x000006, 0x000007, 0x000004, 0x000005,
+  0x000006, 0x000007, 0x00000c, 0x00000d, 0x00000e, 0x00000f,
+  0x00000c, 0x00000d, 0x00000e, 0x00000f, 0x000005, 0x000006,
+  0x000006, 0x000007, 0x000004, 0x000005, 0x000005, 0x000006,
+  0x00000d, 0x00000e, 0x00000e, 0x00000f, 0x00000c, 0x00000d,
+  0x00000d, 0x00000e, 0x000004, 0x000005, 0x000006, 0x000007,
+  0x000004, 0x000005, 0x000006, 0x000007, 0x00000c, 0x00000d,
+  0x00000e, 0x00000f, 0x00000c, 0x00000d, 0x00000e, 0x00000f,
+  0x000005, 0x000005, 0x000005, 0x000005, 0x000005, 0x000005,
+  0x000005, 0x000005, 0x00000d, 0x00000d, 0x00000d, 0x00000d,
+  0x00000d, 0x00000d, 0x00000d, 0x00000d, 0x000004, 0x000005,
+  0x000006, 0x000007, 0x000004, 0x000005, 0x000006, 0x000007,
+  0x00000c, 0x00000d, 0x00000e, 0x00000f, 0x00000c, 0x00000d,
+  0x00000e, 0x00000f, 0x000405, 0x000405, 0x000407, 0x000407,
+  0x000405, 0x000004, 0x000407, 0x000006, 0x00040d, 0x00040d,
+  0x00040f, 0x00040f, 0x00040d, 0x00000c, 0x00040f, 0x00000e,
+  0x000004, 0x000005, 0x000006, 0x000007, 0x000004, 0x000005,
+  0x000006, 0x000007, 0x00000c, 0x00000d, 0x00000e, 0x00000f,
+  0x00000c, 0x00000d, 0x00000e, 0x00000f, 0x000004, 0x000405,
+  0x000006, 0x000407, 0x000405, 0x000405, 0x000407, 0x000407,
+  0x00000c, 0x00040d, 0x00000e, 0x00040f, 0x00040d, 0x00040d,
+  0x00040f, 0x00040f, 0x000004, 0x000005, 0x000006, 0x000007,
+  0x000004, 0x000005, 0x000006, 0x000007, 0x00000c, 0x00000d,
+  0x00000e, 0x00000f, 0x00000c, 0x00000d, 0x00000e, 0x00000f,
+  0x000004, 0x000405, 0x000006, 0x000407, 0x000405, 0x000004,
+  0x000407, 0x000006, 0x00000c, 0x00040d, 0x00000e, 0x00040f,
+  0x00040d, 0x00000c, 0x00040f, 0x00000e, 0x000004, 0x000005,
+  0x000006, 0x000007, 0x000004, 0x000005, 0x000006, 0x000007,
+  0x00000c, 0x00000d, 0x00000e, 0x00000f, 0x00000c, 0x00000d,
+  0x00000e, 0x00000f, 0x000804, 0x001805, 0x000806, 0x001807,
+  0x000804, 0x001805, 0x000806, 0x001807, 0x00082c, 0x00182d,
+  0x00082e, 0x00182f, 0x00082c, 0x00182d, 0x00082e, 0x00182f,
+  0x000004, 0x000005, 0x000006, 0x000007, 0x000004, 0x000005,
+  0x000006, 0x000007, 0x00000c, 0x00000d, 0x00000e, 0x00000f,
+  0x00000c, 0x00000d, 0x00000e, 0x00000f, 0x001804, 0x000805,
+  0x001806, 0x000807, 0x001804, 0x000805, 0x001806, 0x000807,
+  0x00182c, 0x00082d, 0x00182e, 0x00082f, 0x00182c, 0x00082d,
+  0x00182e, 0x00082f, 0x000004, 0x000005, 0x000006, 0x000007,
+  0x000004, 0x000005, 0x000006, 0x000007, 0x00000c, 0x00000d,
+  0x00000e, 0x00000f, 0x00000c, 0x00000d, 0x00000e, 0x00000f,
+  0x000004, 0x000005, 0x000006, 0x000007, 0x000004, 0x000005,
+  0x000006, 0x000007, 0x00000c, 0x00000d, 0x00000e, 0x00000f,
+  0x00000c, 0x00000d, 0x00000e, 0x00000f, 0x000004, 0x000005,
+  0x000006, 0x000007, 0x000004, 0x000005, 0x000006, 0x000007,
+  0x00000c, 0x00000d, 0x00000e, 0x00000f, 0x00000c, 0x00000d,
+  0x00000e, 0x00000f, 0x000004, 0x000005, 0x000006, 0x000007,
+  0x00000c, 0x00000d, 0x00000e, 0x00000f, 0x000004, 0x000005,
+  0x000006, 0x000007, 0x00000c, 0x00000d, 0x00000e, 0x00000f,
+  0x000004, 0x000005, 0x000006, 0x000007, 0x000004, 0x000005,
+  0x000006, 0x000007, 0x00000c, 0x00000d, 0x00000e, 0x00000f,
+  0x00000c, 0x00000d, 0x00000e, 0x00000f, 0x000084, 0x000085,
+  0x000086, 0x000087, 0x000084, 0x000085, 0x000086, 0x000087,
+  0x00008c, 0x00008d, 0x00008e, 0x00008f, 0x00008c, 0x00008d,
+  0x00008e, 0x00008f, 0x000004, 0x000005, 0x000006, 0x000007,
+  0x000004, 0x000005, 0x000006, 0x000007, 0x00000c, 0x00000d,
+  0x00000e, 0x00000f, 0x00000c, 0x00000d, 0x00000e, 0x00000f,
+  0x000100, 0x000101, 0x000102, 0x000103, 0x000104, 0x000105,
+  0x000106, 0x000107, 0x000108, 0x000109, 0x00010a, 0x00010b,
+  0x00010c, 0x00010d, 0x00010e, 0x00010f, 0x000004, 0x000005,
+  0x000006, 0x000007, 0x000004, 0x000005, 0x000006, 0x000007,
+  0x00000c, 0x00000d, 0x00000e, 0x00000f, 0x00000c, 0x00000d,
+  0x00000e, 0x00000f, 0x000000, 0x000005, 0x000002, 0x000007,
+  0x000004, 0x000005, 0x000006, 0x000007, 0x000008, 0x00000d,
+  0x00000a, 0x00000f, 0x00000c, 0x00000d, 0x00000e, 0x00000f,
+  0x000004, 0x000005, 0x000006, 0x000007, 0x000004, 0x000005,
+  0x000006, 0x000007, 0x00000c, 0x00000d, 0x00000e, 0x00000f,
+  0x00000c, 0x00000d, 0x00000e, 0x00000f, 0x000204, 0x000205,
+  0x000206, 0x000207, 0x000204, 0x000205, 0x000206, 0x000207,
+  0x00020c, 0x00020d, 0x00020e, 0x00020f, 0x00020c, 0x00020d,
+  0x00020e, 0x00020f, 0x000004, 0x000005, 0x000006, 0x000007,
+  0x000004, 0x000005, 0x000006, 0x000007, 0x00000c, 0x00000d,
+  0x00000e, 0x00000f, 0x00000c, 0x00000d, 0x00000e, 0x00000f,
+  0x000040, 0x000041, 0x000042, 0x000043, 0x00004c, 0x00004d,
+  0x00004e, 0x00004f, 0x000040, 0x000041, 0x000042, 0x000043,
+  0x00004c, 0x00004d, 0x00004e, 0x00004f, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x00000c, 0x00000d, 0x00000e, 0x00000f,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x00000c, 0x00000d,
+  0x00000e, 0x00000f, 0x000000, 0x000000, 0x000002, 0x000002,
+  0x00000c, 0x00000c, 0x00000e, 0x00000e, 0x000000, 0x000000,
+  0x000002, 0x000002, 0x00000c, 0x00000c, 0x00000e, 0x00000e,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x00000c, 0x00000d,
+  0x00000e, 0x00000f, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x00000c, 0x00000d, 0x00000e, 0x00000f, 0x000000, 0x000001,
+  0x000001, 0x000002, 0x00000c, 0x00000d, 0x00000d, 0x00000e,
+  0x000000, 0x000001, 0x000001, 0x000002, 0x00000c, 0x00000d,
+  0x00000d, 0x00000e, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x00000c, 0x00000d, 0x00000e, 0x00000f, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x00000c, 0x00000d, 0x00000e, 0x00000f,
+  0x000001, 0x000002, 0x000002, 0x000003, 0x00000d, 0x00000e,
+  0x00000e, 0x00000f, 0x000001, 0x000002, 0x000002, 0x000003,
+  0x00000d, 0x00000e, 0x00000e, 0x00000f, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x00000c, 0x00000d, 0x00000e, 0x00000f,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x00000c, 0x00000d,
+  0x00000e, 0x00000f, 0x000001, 0x000001, 0x000001, 0x000001,
+  0x00000d, 0x00000d, 0x00000d, 0x00000d, 0x000001, 0x000001,
+  0x000001, 0x000001, 0x00000d, 0x00000d, 0x00000d, 0x00000d,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x00000c, 0x00000d,
+  0x00000e, 0x00000f, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x00000c, 0x00000d, 0x00000e, 0x00000f, 0x000401, 0x000401,
+  0x000403, 0x000403, 0x00040d, 0x00040d, 0x00040f, 0x00040f,
+  0x000401, 0x000401, 0x000403, 0x000403, 0x00040d, 0x00040d,
+  0x00040f, 0x00040f, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x00000c, 0x00000d, 0x00000e, 0x00000f, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x00000c, 0x00000d, 0x00000e, 0x00000f,
+  0x000000, 0x000401, 0x000002, 0x000403, 0x00000c, 0x00040d,
+  0x00000e, 0x00040f, 0x000000, 0x000401, 0x000002, 0x000403,
+  0x00000c, 0x00040d, 0x00000e, 0x00040f, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x00000c, 0x00000d, 0x00000e, 0x00000f,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x00000c, 0x00000d,
+  0x00000e, 0x00000f, 0x000000, 0x000401, 0x000002, 0x000403,
+  0x00000c, 0x00040d, 0x00000e, 0x00040f, 0x000000, 0x000401,
+  0x000002, 0x000403, 0x00000c, 0x00040d, 0x00000e, 0x00040f,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x00000c, 0x00000d,
+  0x00000e, 0x00000f, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x00000c, 0x00000d, 0x00000e, 0x00000f, 0x000800, 0x001801,
+  0x000802, 0x001803, 0x00080c, 0x00180d, 0x00080e, 0x00180f,
+  0x000820, 0x001821, 0x000822, 0x001823, 0x00082c, 0x00182d,
+  0x00082e, 0x00182f, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x00000c, 0x00000d, 0x00000e, 0x00000f, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x00000c, 0x00000d, 0x00000e, 0x00000f,
+  0x001800, 0x000801, 0x001802, 0x000803, 0x00180c, 0x00080d,
+  0x00180e, 0x00080f, 0x001820, 0x000821, 0x001822, 0x000823,
+  0x00182c, 0x00082d, 0x00182e, 0x00082f, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x00000c, 0x00000d, 0x00000e, 0x00000f,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x00000c, 0x00000d,
+  0x00000e, 0x00000f, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x00000c, 0x00000d,
+  0x00000e, 0x00000f, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x00000c, 0x00000d, 0x00000e, 0x00000f, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x00000c, 0x00000d, 0x00000e, 0x00000f,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x00000c, 0x00000d,
+  0x00000e, 0x00000f, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x00000c, 0x00000d, 0x00000e, 0x00000f, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x00000c, 0x00000d, 0x00000e, 0x00000f,
+  0x000080, 0x000081, 0x000082, 0x000083, 0x00008c, 0x00008d,
+  0x00008e, 0x00008f, 0x000080, 0x000081, 0x000082, 0x000083,
+  0x00008c, 0x00008d, 0x00008e, 0x00008f, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x00000c, 0x00000d, 0x00000e, 0x00000f,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x00000c, 0x00000d,
+  0x00000e, 0x00000f, 0x000100, 0x000101, 0x000102, 0x000103,
+  0x000104, 0x000105, 0x000106, 0x000107, 0x000108, 0x000109,
+  0x00010a, 0x00010b, 0x00010c, 0x00010d, 0x00010e, 0x00010f,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x00000c, 0x00000d,
+  0x00000e, 0x00000f, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x00000c, 0x00000d, 0x00000e, 0x00000f, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x000004, 0x00000d, 0x000006, 0x00000f,
+  0x000008, 0x000001, 0x00000a, 0x000003, 0x00000c, 0x00000d,
+  0x00000e, 0x00000f, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x00000c, 0x00000d, 0x00000e, 0x00000f, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x00000c, 0x00000d, 0x00000e, 0x00000f,
+  0x000200, 0x000201, 0x000202, 0x000203, 0x00020c, 0x00020d,
+  0x00020e, 0x00020f, 0x000200, 0x000201, 0x000202, 0x000203,
+  0x00020c, 0x00020d, 0x00020e, 0x00020f, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x00000c, 0x00000d, 0x00000e, 0x00000f,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x00000c, 0x00000d,
+  0x00000e, 0x00000f, 0x000040, 0x000041, 0x000042, 0x000043,
+  0x00004c, 0x00004d, 0x00004e, 0x00004f, 0x000040, 0x000041,
+  0x000042, 0x000043, 0x00004c, 0x00004d, 0x00004e, 0x00004f,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x00000c, 0x00000d,
+  0x00000e, 0x00000f, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x00000c, 0x00000d, 0x00000e, 0x00000f, 0x000000, 0x000000,
+  0x000002, 0x000002, 0x00000d, 0x00000d, 0x00000f, 0x00000f,
+  0x000000, 0x000000, 0x000002, 0x000002, 0x00000d, 0x00000d,
+  0x00000f, 0x00000f, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x00000c, 0x00000d, 0x00000e, 0x00000f, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x00000c, 0x00000d, 0x00000e, 0x00000f,
+  0x000000, 0x000001, 0x000001, 0x000002, 0x00000d, 0x00000e,
+  0x00000e, 0x00000f, 0x000000, 0x000001, 0x000001, 0x000002,
+  0x00000d, 0x00000e, 0x00000e, 0x00000f, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x00000c, 0x00000d, 0x00000e, 0x00000f,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x00000c, 0x00000d,
+  0x00000e, 0x00000f, 0x000001, 0x000002, 0x000002, 0x000003,
+  0x00000c, 0x00000d, 0x00000d, 0x00000e, 0x000001, 0x000002,
+  0x000002, 0x000003, 0x00000c, 0x00000d, 0x00000d, 0x00000e,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x00000c, 0x00000d,
+  0x00000e, 0x00000f, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x00000c, 0x00000d, 0x00000e, 0x00000f, 0x000001, 0x000001,
+  0x000001, 0x000001, 0x00000d, 0x00000d, 0x00000d, 0x00000d,
+  0x000001, 0x000001, 0x000001, 0x000001, 0x00000d, 0x00000d,
+  0x00000d, 0x00000d, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x00000c, 0x00000d, 0x00000e, 0x00000f, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x00000c, 0x00000d, 0x00000e, 0x00000f,
+  0x000401, 0x000401, 0x000403, 0x000403, 0x00040d, 0x00000c,
+  0x00040f, 0x00000e, 0x000401, 0x000401, 0x000403, 0x000403,
+  0x00040d, 0x00000c, 0x00040f, 0x00000e, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x00000c, 0x00000d, 0x00000e, 0x00000f,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x00000c, 0x00000d,
+  0x00000e, 0x00000f, 0x000000, 0x000401, 0x000002, 0x000403,
+  0x00040d, 0x00040d, 0x00040f, 0x00040f, 0x000000, 0x000401,
+  0x000002, 0x000403, 0x00040d, 0x00040d, 0x00040f, 0x00040f,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x00000c, 0x00000d,
+  0x00000e, 0x00000f, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x00000c, 0x00000d, 0x00000e, 0x00000f, 0x000000, 0x000401,
+  0x000002, 0x000403, 0x00040d, 0x00000c, 0x00040f, 0x00000e,
+  0x000000, 0x000401, 0x000002, 0x000403, 0x00040d, 0x00000c,
+  0x00040f, 0x00000e, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x00000c, 0x00000d, 0x00000e, 0x00000f, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x00000c, 0x00000d, 0x00000e, 0x00000f,
+  0x000800, 0x001801, 0x000802, 0x001803, 0x00080c, 0x00180d,
+  0x00080e, 0x00180f, 0x000820, 0x001821, 0x000822, 0x001823,
+  0x00082c, 0x00182d, 0x00082e, 0x00182f, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x00000c, 0x00000d, 0x00000e, 0x00000f,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x00000c, 0x00000d,
+  0x00000e, 0x00000f, 0x001800, 0x000801, 0x001802, 0x000803,
+  0x00180c, 0x00080d, 0x00180e, 0x00080f, 0x001820, 0x000821,
+  0x001822, 0x000823, 0x00182c, 0x00082d, 0x00182e, 0x00082f,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x00000c, 0x00000d,
+  0x00000e, 0x00000f, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x00000c, 0x00000d, 0x00000e, 0x00000f, 0x00000c, 0x00000d,
+  0x00000e, 0x00000f, 0x00000c, 0x00000d, 0x00000e, 0x00000f,
+  0x00000c, 0x00000d, 0x00000e, 0x00000f, 0x00000c, 0x00000d,
+  0x00000e, 0x00000f, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x00000c, 0x00000d, 0x00000e, 0x00000f, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x00000c, 0x00000d, 0x00000e, 0x00000f,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x00000c, 0x00000d,
+  0x00000e, 0x00000f, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x00000c, 0x00000d, 0x00000e, 0x00000f, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x00000c, 0x00000d, 0x00000e, 0x00000f,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x00000c, 0x00000d,
+  0x00000e, 0x00000f, 0x000080, 0x000081, 0x000082, 0x000083,
+  0x00008c, 0x00008d, 0x00008e, 0x00008f, 0x000080, 0x000081,
+  0x000082, 0x000083, 0x00008c, 0x00008d, 0x00008e, 0x00008f,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x00000c, 0x00000d,
+  0x00000e, 0x00000f, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x00000c, 0x00000d, 0x00000e, 0x00000f, 0x000100, 0x000101,
+  0x000102, 0x000103, 0x000104, 0x000105, 0x000106, 0x000107,
+  0x000108, 0x000109, 0x00010a, 0x00010b, 0x00010c, 0x00010d,
+  0x00010e, 0x00010f, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x00000c, 0x00000d, 0x00000e, 0x00000f, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x00000c, 0x00000d, 0x00000e, 0x00000f,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x000004, 0x00000d,
+  0x000006, 0x00000f, 0x000008, 0x000001, 0x00000a, 0x000003,
+  0x00000c, 0x00000d, 0x00000e, 0x00000f, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x00000c, 0x00000d, 0x00000e, 0x00000f,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x00000c, 0x00000d,
+  0x00000e, 0x00000f, 0x000200, 0x000201, 0x000202, 0x000203,
+  0x00020c, 0x00020d, 0x00020e, 0x00020f, 0x000200, 0x000201,
+  0x000202, 0x000203, 0x00020c, 0x00020d, 0x00020e, 0x00020f,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x00000c, 0x00000d,
+  0x00000e, 0x00000f, 0x000000, 0x000001, 0x000002, 0x000003,
+  0x00000c, 0x00000d, 0x00000e, 0x00000f, 0x008040, 0x008041,
+  0x008042, 0x008043, 0x008044, 0x008045, 0x008046, 0x008047,
+  0x008048, 0x008049, 0x00804a, 0x00804b, 0x00804c, 0x00804d,
+  0x00804e, 0x00804f, 0x008000, 0x008001, 0x008002, 0x008003,
+  0x008004, 0x008005, 0x008006, 0x008007, 0x008008, 0x008009,
+  0x00800a, 0x00800b, 0x00800c, 0x00800d, 0x00800e, 0x00800f,
+  0x008000, 0x008000, 0x008002, 0x008002, 0x008004, 0x008004,
+  0x008006, 0x008006, 0x008008, 0x008008, 0x00800a, 0x00800a,
+  0x00800c, 0x00800c, 0x00800e, 0x00800e, 0x008000, 0x008001,
+  0x008002, 0x008003, 0x008004, 0x008005, 0x008006, 0x008007,
+  0x008008, 0x008009, 0x00800a, 0x00800b, 0x00800c, 0x00800d,
+  0x00800e, 0x00800f, 0x008000, 0x008001, 0x008001, 0x008002,
+  0x008004, 0x008005, 0x008005, 0x008006, 0x008008, 0x008009,
+  0x008009, 0x00800a, 0x00800c, 0x00800d, 0x00800d, 0x00800e,
+  0x008000, 0x008001, 0x008002, 0x008003, 0x008004, 0x008005,
+  0x008006, 0x008007, 0x008008, 0x008009, 0x00800a, 0x00800b,
+  0x00800c, 0x00800d, 0x00800e, 0x00800f, 0x008001, 0x008002,
+  0x008002, 0x008003, 0x008005, 0x008006, 0x008006, 0x008007,
+  0x008009, 0x00800a, 0x00800a, 0x00800b, 0x00800d, 0x00800e,
+  0x00800e, 0x00800f, 0x008000, 0x008001, 0x008002, 0x008003,
+  0x008004, 0x008005, 0x008006, 0x008007, 0x008008, 0x008009,
+  0x00800a, 0x00800b, 0x00800c, 0x00800d, 0x00800e, 0x00800f,
+  0x008001, 0x008001, 0x008001, 0x008001, 0x008005, 0x008005,
+  0x008005, 0x008005, 0x008009, 0x008009, 0x008009, 0x008009,
+  0x00800d, 0x00800d, 0x00800d, 0x00800d, 0x008000, 0x008001,
+  0x008002, 0x008003, 0x008004, 0x008005, 0x008006, 0x008007,
+  0x008008, 0x008009, 0x00800a, 0x00800b, 0x00800c, 0x00800d,
+  0x00800e, 0x00800f, 0x008401, 0x008401, 0x008403, 0x008403,
+  0x008405, 0x008405, 0x008407, 0x008407, 0x008409, 0x008409,
+  0x00840b, 0x00840b, 0x00840d, 0x00840d, 0x00840f, 0x00840f,
+  0x008000, 0x008001, 0x008002, 0x008003, 0x008004, 0x008005,
+  0x008006, 0x008007, 0x008008, 0x008009, 0x00800a, 0x00800b,
+  0x00800c, 0x00800d, 0x00800e, 0x00800f, 0x008000, 0x008401,
+  0x008002, 0x008403, 0x008004, 0x008405, 0x008006, 0x008407,
+  0x008008, 0x008409, 0x00800a, 0x00840b, 0x00800c, 0x00840d,
+  0x00800e, 0x00840f, 0x008000, 0x008001, 0x008002, 0x008003,
+  0x008004, 0x008005, 0x008006, 0x008007, 0x008008, 0x008009,
+  0x00800a, 0x00800b, 0x00800c, 0x00800d, 0x00800e, 0x00800f,
+  0x008000, 0x008401, 0x008002, 0x008403, 0x008004, 0x008405,
+  0x008006, 0x008407, 0x008008, 0x008409, 0x00800a, 0x00840b,
+  0x00800c, 0x00840d, 0x00800e, 0x00840f, 0x008000, 0x008001,
+  0x008002, 0x008003, 0x008004, 0x008005, 0x008006, 0x008007,
+  0x008008, 0x008009, 0x00800a, 0x00800b, 0x00800c, 0x00800d,
+  0x00800e, 0x00800f, 0x008800, 0x009801, 0x008802, 0x009803,
+  0x008804, 0x009805, 0x008806, 0x009807, 0x008828, 0x009829,
+  0x00882a, 0x00982b, 0x00882c, 0x00982d, 0x00882e, 0x00982f,
+  0x008000, 0x008001, 0x008002, 0x008003, 0x008004, 0x008005,
+  0x008006, 0x008007, 0x008008, 0x008009, 0x00800a, 0x00800b,
+  0x00800c, 0x00800d, 0x00800e, 0x00800f, 0x009800, 0x008801,
+  0x009802, 0x008803, 0x009804, 0x008805, 0x009806, 0x008807,
+  0x009828, 0x008829, 0x00982a, 0x00882b, 0x00982c, 0x00882d,
+  0x00982e, 0x00882f, 0x008000, 0x008001, 0x008002, 0x008003,
+  0x008004, 0x008005, 0x008006, 0x008007, 0x008008, 0x008009,
+  0x00800a, 0x00800b, 0x00800c, 0x00800d, 0x00800e, 0x00800f,
+  0x008000, 0x008001, 0x008002, 0x008003, 0x008000, 0x008001,
+  0x008002, 0x008003, 0x008008, 0x008009, 0x00800a, 0x00800b,
+  0x008008, 0x008009, 0x00800a, 0x00800b, 0x008000, 0x008001,
+  0x008002, 0x008003, 0x008004, 0x008005, 0x008006, 0x008007,
+  0x008008, 0x008009, 0x00800a, 0x00800b, 0x00800c, 0x00800d,
+  0x00800e, 0x00800f, 0x008000, 0x008001, 0x008002, 0x008003,
+  0x008004, 0x008005, 0x008006, 0x008007, 0x008000, 0x008001,
+  0x008002, 0x008003, 0x008004, 0x008005, 0x008006, 0x008007,
+  0x008000, 0x008001, 0x008002, 0x008003, 0x008004, 0x008005,
+  0x008006, 0x008007, 0x008008, 0x008009, 0x00800a, 0x00800b,
+  0x00800c, 0x00800d, 0x00800e, 0x00800f, 0x008080, 0x008081,
+  0x008082, 0x008083, 0x008084, 0x008085, 0x008086, 0x008087,
+  0x008088, 0x008089, 0x00808a, 0x00808b, 0x00808c, 0x00808d,
+  0x00808e, 0x00808f, 0x008000, 0x008001, 0x008002, 0x008003,
+  0x008004, 0x008005, 0x008006, 0x008007, 0x008008, 0x008009,
+  0x00800a, 0x00800b, 0x00800c, 0x00800d, 0x00800e, 0x00800f,
+  0x000100, 0x000101, 0x000102, 0x000103, 0x000104, 0x000105,
+  0x000106, 0x000107, 0x000108, 0x000109, 0x00010a, 0x00010b,
+  0x00010c, 0x00010d, 0x00010e, 0x00010f, 0x008000, 0x008001,
+  0x008002, 0x008003, 0x008004, 0x008005, 0x008006, 0x008007,
+  0x008008, 0x008009, 0x00800a, 0x00800b, 0x00800c, 0x00800d,
+  0x00800e, 0x00800f, 0x000000, 0x008001, 0x000002, 0x008003,
+  0x000004, 0x008005, 0x000006, 0x008007, 0x000008, 0x008009,
+  0x00000a, 0x00800b, 0x00000c, 0x00800d, 0x00000e, 0x00800f,
+  0x008000, 0x008001, 0x008002, 0x008003, 0x008004, 0x008005,
+  0x008006, 0x008007, 0x008008, 0x008009, 0x00800a, 0x00800b,
+  0x00800c, 0x00800d, 0x00800e, 0x00800f, 0x008200, 0x008201,
+  0x008202, 0x008203, 0x008204, 0x008205, 0x008206, 0x008207,
+  0x008208, 0x008209, 0x00820a, 0x00820b, 0x00820c, 0x00820d,
+  0x00820e, 0x00820f, 0x008000, 0x008001, 0x008002, 0x008003,
+  0x008004, 0x008005, 0x008006, 0x008007, 0x008008, 0x008009,
+  0x00800a, 0x00800b, 0x00800c, 0x00800d, 0x00800e, 0x00800f,
+  0x008040, 0x008041, 0x008042, 0x008043, 0x008044, 0x008045,
+  0x008046, 0x008047, 0x008048, 0x008049, 0x00804a, 0x00804b,
+  0x00804c, 0x00804d, 0x00804e, 0x00804f, 0x008000, 0x008001,
+  0x008002, 0x008003, 0x008004, 0x008005, 0x008006, 0x008007,
+  0x008008, 0x008009, 0x00800a, 0x00800b, 0x00800c, 0x00800d,
+  0x00800e, 0x00800f, 0x008000, 0x008000, 0x008002, 0x008002,
+  0x008005, 0x008005, 0x008007, 0x008007, 0x008008, 0x008008,
+  0x00800a, 0x00800a, 0x00800d, 0x00800d, 0x00800f, 0x00800f,
+  0x008000, 0x008001, 0x008002, 0x008003, 0x008004, 0x008005,
+  0x008006, 0x008007, 0x008008, 0x008009, 0x00800a, 0x00800b,
+  0x00800c, 0x00800d, 0x00800e, 0x00800f, 0x008000, 0x008001,
+  0x008001, 0x008002, 0x008005, 0x008006, 0x008006, 0x008007,
+  0x008008, 0x008009, 0x008009, 0x00800a, 0x00800d, 0x00800e,
+  0x00800e, 0x00800f, 0x008000, 0x008001, 0x008002, 0x008003,
+  0x008004, 0x008005, 0x008006, 0x008007, 0x008008, 0x008009,
+  0x00800a, 0x00800b, 0x00800c, 0x00800d, 0x00800e, 0x00800f,
+  0x008001, 0x008002, 0x008002, 0x008003, 0x008004, 0x008005,
+  0x008005, 0x008006, 0x008009, 0x00800a, 0x00800a, 0x00800b,
+  0x00800c, 0x00800d, 0x00800d, 0x00800e, 0x008000, 0x008001,
+  0x008002, 0x008003, 0x008004, 0x008005, 0x008006, 0x008007,
+  0x008008, 0x008009, 0x00800a, 0x00800b, 0x00800c, 0x00800d,
+  0x00800e, 0x00800f, 0x008001, 0x008001, 0x008001, 0x008001,
+  0x008005, 0x008005, 0x008005, 0x008005, 0x008009, 0x008009,
+  0x008009, 0x008009, 0x00800d, 0x00800d, 0x00800d, 0x00800d,
+  0x008000, 0x008001, 0x008002, 0x008003, 0x008004, 0x008005,
+  0x008006, 0x008007, 0x008008, 0x008009, 0x00800a, 0x00800b,
+  0x00800c, 0x00800d, 0x00800e, 0x00800f, 0x008401, 0x008401,
+  0x008403, 0x008403, 0x008405, 0x008004, 0x008407, 0x008006,
+  0x008409, 0x008409, 0x00840b, 0x00840b, 0x00840d, 0x00800c,
+  0x00840f, 0x00800e, 0x008000, 0x008001, 0x008002, 0x008003,
+  0x008004, 0x008005, 0x008006, 0x008007, 0x008008, 0x008009,
+  0x00800a, 0x00800b, 0x00800c, 0x00800d, 0x00800e, 0x00800f,
+  0x008000, 0x008401, 0x008002, 0x008403, 0x008405, 0x008405,
+  0x008407, 0x008407, 0x008008, 0x008409, 0x00800a, 0x00840b,
+  0x00840d, 0x00840d, 0x00840f, 0x00840f, 0x008000, 0x008001,
+  0x008002, 0x008003, 0x008004, 0x008005, 0x008006, 0x008007,
+  0x008008, 0x008009, 0x00800a, 0x00800b, 0x00800c, 0x00800d,
+  0x00800e, 0x00800f, 0x008000, 0x008401, 0x008002, 0x008403,
+  0x008405, 0x008004, 0x008407, 0x008006, 0x008008, 0x008409,
+  0x00800a, 0x00840b, 0x00840d, 0x00800c, 0x00840f, 0x00800e,
+  0x008000, 0x008001, 0x008002, 0x008003, 0x008004, 0x008005,
+  0x008006, 0x008007, 0x008008, 0x008009, 0x00800a, 0x00800b,
+  0x00800c, 0x00800d, 0x00800e, 0x00800f, 0x008800, 0x009801,
+  0x008802, 0x009803, 0x008804, 0x009805, 0x008806, 0x009807,
+  0x008828, 0x009829, 0x00882a, 0x00982b, 0x00882c, 0x00982d,
+  0x00882e, 0x00982f, 0x008000, 0x008001, 0x008002, 0x008003,
+  0x008004, 0x008005, 0x008006, 0x008007, 0x008008, 0x008009,
+  0x00800a, 0x00800b, 0x00800c, 0x00800d, 0x00800e, 0x00800f,
+  0x009800, 0x008801, 0x009802, 0x008803, 0x009804, 0x008805,
+  0x009806, 0x008807, 0x009828, 0x008829, 0x00982a, 0x00882b,
+  0x00982c, 0x00882d, 0x00982e, 0x00882f, 0x008000, 0x008001,
+  0x008002, 0x008003, 0x008004, 0x008005, 0x008006, 0x008007,
+  0x008008, 0x008009, 0x00800a, 0x00800b, 0x00800c, 0x00800d,
+  0x00800e, 0x00800f, 0x008004, 0x008005, 0x008006, 0x008007,
+  0x008004, 0x008005, 0x008006, 0x008007, 0x00800c, 0x00800d,
+  0x00800e, 0x00800f, 0x00800c, 0x00800d, 0x00800e, 0x00800f,
+  0x008000, 0x008001, 0x008002, 0x008003, 0x008004, 0x008005,
+  0x008006, 0x008007, 0x008008, 0x008009, 0x00800a, 0x00800b,
+  0x00800c, 0x00800d, 0x00800e, 0x00800f, 0x008000, 0x008001,
+  0x008002, 0x008003, 0x00800c, 0x00800d, 0x00800e, 0x00800f,
+  0x008000, 0x008001, 0x008002, 0x008003, 0x00800c, 0x00800d,
+  0x00800e, 0x00800f, 0x008000, 0x008001, 0x008002, 0x008003,
+  0x008004, 0x008005, 0x008006, 0x008007, 0x008008, 0x008009,
+  0x00800a, 0x00800b, 0x00800c, 0x00800d, 0x00800e, 0x00800f,
+  0x008080, 0x008081, 0x008082, 0x008083, 0x008084, 0x008085,
+  0x008086, 0x008087, 0x008088, 0x008089, 0x00808a, 0x00808b,
+  0x00808c, 0x00808d, 0x00808e, 0x00808f, 0x008000, 0x008001,
+  0x008002, 0x008003, 0x008004, 0x008005, 0x008006, 0x008007,
+  0x008008, 0x008009, 0x00800a, 0x00800b, 0x00800c, 0x00800d,
+  0x00800e, 0x00800f, 0x000100, 0x000101, 0x000102, 0x000103,
+  0x000104, 0x000105, 0x000106, 0x000107, 0x000108, 0x000109,
+  0x00010a, 0x00010b, 0x00010c, 0x00010d, 0x00010e, 0x00010f,
+  0x008000, 0x008001, 0x008002, 0x008003, 0x008004, 0x008005,
+  0x008006, 0x008007, 0x008008, 0x008009, 0x00800a, 0x00800b,
+  0x00800c, 0x00800d, 0x00800e, 0x00800f, 0x000000, 0x008001,
+  0x000002, 0x008003, 0x000004, 0x008005, 0x000006, 0x008007,
+  0x000008, 0x008009, 0x00000a, 0x00800b, 0x00000c, 0x00800d,
+  0x00000e, 0x00800f, 0x008000, 0x008001, 0x008002, 0x008003,
+  0x008004, 0x008005, 0x008006, 0x008007, 0x008008, 0x008009,
+  0x00800a, 0x00800b, 0x00800c, 0x00800d, 0x00800e, 0x00800f,
+  0x008200, 0x008201, 0x008202, 0x008203, 0x008204, 0x008205,
+  0x008206, 0x008207, 0x008208, 0x008209, 0x00820a, 0x00820b,
+  0x00820c, 0x00820d, 0x00820e, 0x00820f, 0x008000, 0x008001,
+  0x008002, 0x008003, 0x008004, 0x008005, 0x008006, 0x008007,
+  0x008008, 0x008009, 0x00800a, 0x00800b, 0x00800c, 0x00800d,
+  0x00800e, 0x00800f, 0x010050, 0x010051, 0x010052, 0x010053,
+  0x010054, 0x010055, 0x010056, 0x010057, 0x010058, 0x010059,
+  0x01005a, 0x01005b, 0x01005c, 0x01005d, 0x01005e, 0x01005f,
+  0x010010, 0x010011, 0x010012, 0x010013, 0x010014, 0x010015,
+  0x010016, 0x010017, 0x010018, 0x010019, 0x01001a, 0x01001b,
+  0x01001c, 0x01001d, 0x01001e, 0x01001f, 0x010010, 0x010010,
+  0x010012, 0x010012, 0x010014, 0x010014, 0x010016, 0x010016,
+  0x010018, 0x010018, 0x01001a, 0x01001a, 0x01001c, 0x01001c,
+  0x01001e, 0x01001e, 0x010010, 0x010011, 0x010012, 0x010013,
+  0x010014, 0x010015, 0x010016, 0x010017, 0x010018, 0x010019,
+  0x01001a, 0x01001b, 0x01001c, 0x01001d, 0x01001e, 0x01001f,
+  0x010010, 0x010011, 0x010011, 0x010012, 0x010014, 0x010015,
+  0x010015, 0x010016, 0x010018, 0x010019, 0x010019, 0x01001a,
+  0x01001c, 0x01001d, 0x01001d, 0x01001e, 0x010010, 0x010011,
+  0x010012, 0x010013, 0x010014, 0x010015, 0x010016, 0x010017,
+  0x010018, 0x010019, 0x01001a, 0x01001b, 0x01001c, 0x01001d,
+  0x01001e, 0x01001f, 0x010011, 0x010012, 0x010012, 0x010013,
+  0x010015, 0x010016, 0x010016, 0x010017, 0x010019, 0x01001a,
+  0x01001a, 0x01001b, 0x01001d, 0x01001e, 0x01001e, 0x01001f,
+  0x010010, 0x010011, 0x010012, 0x010013, 0x010014, 0x010015,
+  0x010016, 0x010017, 0x010018, 0x010019, 0x01001a, 0x01001b,
+  0x01001c, 0x01001d, 0x01001e, 0x01001f, 0x010011, 0x010011,
+  0x010011, 0x010011, 0x010015, 0x010015, 0x010015, 0x010015,
+  0x010019, 0x010019, 0x010019, 0x010019, 0x01001d, 0x01001d,
+  0x01001d, 0x01001d, 0x010010, 0x010011, 0x010012, 0x010013,
+  0x010014, 0x010015, 0x010016, 0x010017, 0x010018, 0x010019,
+  0x01001a, 0x01001b, 0x01001c, 0x01001d, 0x01001e, 0x01001f,
+  0x010411, 0x010411, 0x010413, 0x010413, 0x010415, 0x010415,
+  0x010417, 0x010417, 0x010419, 0x010419, 0x01041b, 0x01041b,
+  0x01041d, 0x01041d, 0x01041f, 0x01041f, 0x010010, 0x010011,
+  0x010012, 0x010013, 0x010014, 0x010015, 0x010016, 0x010017,
+  0x010018, 0x010019, 0x01001a, 0x01001b, 0x01001c, 0x01001d,
+  0x01001e, 0x01001f, 0x010010, 0x010411, 0x010012, 0x010413,
+  0x010014, 0x010415, 0x010016, 0x010417, 0x010018, 0x010419,
+  0x01001a, 0x01041b, 0x01001c, 0x01041d, 0x01001e, 0x01041f,
+  0x010010, 0x010011, 0x010012, 0x010013, 0x010014, 0x010015,
+  0x010016, 0x010017, 0x010018, 0x010019, 0x01001a, 0x01001b,
+  0x01001c, 0x01001d, 0x01001e, 0x01001f, 0x010010, 0x010411,
+  0x010012, 0x010413, 0x010014, 0x010415, 0x010016, 0x010417,
+  0x010018, 0x010419, 0x01001a, 0x01041b, 0x01001c, 0x01041d,
+  0x01001e, 0x01041f, 0x010010, 0x010011, 0x010012, 0x010013,
+  0x010014, 0x010015, 0x010016, 0x010017, 0x010018, 0x010019,
+  0x01001a, 0x01001b, 0x01001c, 0x01001d, 0x01001e, 0x01001f,
+  0x010810, 0x011811, 0x010812, 0x011813, 0x010814, 0x011815,
+  0x010816, 0x011817, 0x010838, 0x011839, 0x01083a, 0x01183b,
+  0x01083c, 0x01183d, 0x01083e, 0x01183f, 0x010010, 0x010011,
+  0x010012, 0x010013, 0x010014, 0x010015, 0x010016, 0x010017,
+  0x010018, 0x010019, 0x01001a, 0x01001b, 0x01001c, 0x01001d,
+  0x01001e, 0x01001f, 0x011810, 0x010811, 0x011812, 0x010813,
+  0x011814, 0x010815, 0x011816, 0x010817, 0x011838, 0x010839,
+  0x01183a, 0x01083b, 0x01183c, 0x01083d, 0x01183e, 0x01083f,
+  0x010010, 0x010011, 0x010012, 0x010013, 0x010014, 0x010015,
+  0x010016, 0x010017, 0x010018, 0x010019, 0x01001a, 0x01001b,
+  0x01001c, 0x01001d, 0x01001e, 0x01001f, 0x010010, 0x010011,
+  0x010012, 0x010013, 0x010010, 0x010011, 0x010012, 0x010013,
+  0x010018, 0x010019, 0x01001a, 0x01001b, 0x010018, 0x010019,
+  0x01001a, 0x01001b, 0x010010, 0x010011, 0x010012, 0x010013,
+  0x010014, 0x010015, 0x010016, 0x010017, 0x010018, 0x010019,
+  0x01001a, 0x01001b, 0x01001c, 0x01001d, 0x01001e, 0x01001f,
+  0x010010, 0x010011, 0x010012, 0x010013, 0x010014, 0x010015,
+  0x010016, 0x010017, 0x010010, 0x010011, 0x010012, 0x010013,
+  0x010014, 0x010015, 0x010016, 0x010017, 0x010010, 0x010011,
+  0x010012, 0x010013, 0x010014, 0x010015, 0x010016, 0x010017,
+  0x010018, 0x010019, 0x01001a, 0x01001b, 0x01001c, 0x01001d,
+  0x01001e, 0x01001f, 0x010090, 0x010091, 0x010092, 0x010093,
+  0x010094, 0x010095, 0x010096, 0x010097, 0x010098, 0x010099,
+  0x01009a, 0x01009b, 0x01009c, 0x01009d, 0x01009e, 0x01009f,
+  0x010010, 0x010011, 0x010012, 0x010013, 0x010014, 0x010015,
+  0x010016, 0x010017, 0x010018, 0x010019, 0x01001a, 0x01001b,
+  0x01001c, 0x01001d, 0x01001e, 0x01001f, 0x000100, 0x000101,
+  0x000102, 0x000103, 0x000104, 0x000105, 0x000106, 0x000107,
+  0x000108, 0x000109, 0x00010a, 0x00010b, 0x00010c, 0x00010d,
+  0x00010e, 0x00010f, 0x010010, 0x010011, 0x010012, 0x010013,
+  0x010014, 0x010015, 0x010016, 0x010017, 0x010018, 0x010019,
+  0x01001a, 0x01001b, 0x01001c, 0x01001d, 0x01001e, 0x01001f,
+  0x000000, 0x010011, 0x000002, 0x010013, 0x000004, 0x010015,
+  0x000006, 0x010017, 0x000008, 0x010019, 0x00000a, 0x01001b,
+  0x00000c, 0x01001d, 0x00000e, 0x01001f, 0x010010, 0x010011,
+  0x010012, 0x010013, 0x010014, 0x010015, 0x010016, 0x010017,
+  0x010018, 0x010019, 0x01001a, 0x01001b, 0x01001c, 0x01001d,
+  0x01001e, 0x01001f, 0x010210, 0x010211, 0x010212, 0x010213,
+  0x010214, 0x010215, 0x010216, 0x010217, 0x010218, 0x010219,
+  0x01021a, 0x01021b, 0x01021c, 0x01021d, 0x01021e, 0x01021f,
+  0x010010, 0x010011, 0x010012, 0x010013, 0x010014, 0x010015,
+  0x010016, 0x010017, 0x010018, 0x010019, 0x01001a, 0x01001b,
+  0x01001c, 0x01001d, 0x01001e, 0x01001f, 0x010050, 0x010051,
+  0x010052, 0x010053, 0x010054, 0x010055, 0x010056, 0x010057,
+  0x010058, 0x010059, 0x01005a, 0x01005b, 0x01005c, 0x01005d,
+  0x01005e, 0x01005f, 0x010010, 0x010011, 0x010012, 0x010013,
+  0x010014, 0x010015, 0x010016, 0x010017, 0x010018, 0x010019,
+  0x01001a, 0x01001b, 0x01001c, 0x01001d, 0x01001e, 0x01001f,
+  0x010010, 0x010010, 0x010012, 0x010012, 0x010015, 0x010015,
+  0x010017, 0x010017, 0x010018, 0x010018, 0x01001a, 0x01001a,
+  0x01001d, 0x01001d, 0x01001f, 0x01001f, 0x010010, 0x010011,
+  0x010012, 0x010013, 0x010014, 0x010015, 0x010016, 0x010017,
+  0x010018, 0x010019, 0x01001a, 0x01001b, 0x01001c, 0x01001d,
+  0x01001e, 0x01001f, 0x010010, 0x010011, 0x010011, 0x010012,
+  0x010015, 0x010016, 0x010016, 0x010017, 0x010018, 0x010019,
+  0x010019, 0x01001a, 0x01001d, 0x01001e, 0x01001e, 0x01001f,
+  0x010010, 0x010011, 0x010012, 0x010013, 0x010014, 0x010015,
+  0x010016, 0x010017, 0x010018, 0x010019, 0x01001a, 0x01001b,
+  0x01001c, 0x01001d, 0x01001e, 0x01001f, 0x010011, 0x010012,
+  0x010012, 0x010013, 0x010014, 0x010015, 0x010015, 0x010016,
+  0x010019, 0x01001a, 0x01001a, 0x01001b, 0x01001c, 0x01001d,
+  0x01001d, 0x01001e, 0x010010, 0x010011, 0x010012, 0x010013,
+  0x010014, 0x010015, 0x010016, 0x010017, 0x010018, 0x010019,
+  0x01001a, 0x01001b, 0x01001c, 0x01001d, 0x01001e, 0x01001f,
+  0x010011, 0x010011, 0x010011, 0x010011, 0x010015, 0x010015,
+  0x010015, 0x010015, 0x010019, 0x010019, 0x010019, 0x010019,
+  0x01001d, 0x01001d, 0x01001d, 0x01001d, 0x010010, 0x010011,
+  0x010012, 0x010013, 0x010014, 0x010015, 0x010016, 0x010017,
+  0x010018, 0x010019, 0x01001a, 0x01001b, 0x01001c, 0x01001d,
+  0x01001e, 0x01001f, 0x010411, 0x010411, 0x010413, 0x010413,
+  0x010415, 0x010014, 0x010417, 0x010016, 0x010419, 0x010419,
+  0x01041b, 0x01041b, 0x01041d, 0x01001c, 0x01041f, 0x01001e,
+  0x010010, 0x010011, 0x010012, 0x010013, 0x010014, 0x010015,
+  0x010016, 0x010017, 0x010018, 0x010019, 0x01001a, 0x01001b,
+  0x01001c, 0x01001d, 0x01001e, 0x01001f, 0x010010, 0x010411,
+  0x010012, 0x010413, 0x010415, 0x010415, 0x010417, 0x010417,
+  0x010018, 0x010419, 0x01001a, 0x01041b, 0x01041d, 0x01041d,
+  0x01041f, 0x01041f, 0x010010, 0x010011, 0x010012, 0x010013,
+  0x010014, 0x010015, 0x010016, 0x010017, 0x010018, 0x010019,
+  0x01001a, 0x01001b, 0x01001c, 0x01001d, 0x01001e, 0x01001f,
+  0x010010, 0x010411, 0x010012, 0x010413, 0x010415, 0x010014,
+  0x010417, 0x010016, 0x010018, 0x010419, 0x01001a, 0x01041b,
+  0x01041d, 0x01001c, 0x01041f, 0x01001e, 0x010010, 0x010011,
+  0x010012, 0x010013, 0x010014, 0x010015, 0x010016, 0x010017,
+  0x010018, 0x010019, 0x01001a, 0x01001b, 0x01001c, 0x01001d,
+  0x01001e, 0x01001f, 0x010810, 0x011811, 0x010812, 0x011813,
+  0x010814, 0x011815, 0x010816, 0x011817, 0x010838, 0x011839,
+  0x01083a, 0x01183b, 0x01083c, 0x01183d, 0x01083e, 0x01183f,
+  0x010010, 0x010011, 0x010012, 0x010013, 0x010014, 0x010015,
+  0x010016, 0x010017, 0x010018, 0x010019, 0x01001a, 0x01001b,
+  0x01001c, 0x01001d, 0x01001e, 0x01001f, 0x011810, 0x010811,
+  0x011812, 0x010813, 0x011814, 0x010815, 0x011816, 0x010817,
+  0x011838, 0x010839, 0x01183a, 0x01083b, 0x01183c, 0x01083d,
+  0x01183e, 0x01083f, 0x010010, 0x010011, 0x010012, 0x010013,
+  0x010014, 0x010015, 0x010016, 0x010017, 0x010018, 0x010019,
+  0x01001a, 0x01001b, 0x01001c, 0x01001d, 0x01001e, 0x01001f,
+  0x010014, 0x010015, 0x010016, 0x010017, 0x010014, 0x010015,
+  0x010016, 0x010017, 0x01001c, 0x01001d, 0x01001e, 0x01001f,
+  0x01001c, 0x01001d, 0x01001e, 0x01001f, 0x010010, 0x010011,
+  0x010012, 0x010013, 0x010014, 0x010015, 0x010016, 0x010017,
+  0x010018, 0x010019, 0x01001a, 0x01001b, 0x01001c, 0x01001d,
+  0x01001e, 0x01001f, 0x010010, 0x010011, 0x010012, 0x010013,
+  0x01001c, 0x01001d, 0x01001e, 0x01001f, 0x010010, 0x010011,
+  0x010012, 0x010013, 0x01001c, 0x01001d, 0x01001e, 0x01001f,
+  0x010010, 0x010011, 0x010012, 0x010013, 0x010014, 0x010015,
+  0x010016, 0x010017, 0x010018, 0x010019, 0x01001a, 0x01001b,
+  0x01001c, 0x01001d, 0x01001e, 0x01001f, 0x010090, 0x010091,
+  0x010092, 0x010093, 0x010094, 0x010095, 0x010096, 0x010097,
+  0x010098, 0x010099, 0x01009a, 0x01009b, 0x01009c, 0x01009d,
+  0x01009e, 0x01009f, 0x010010, 0x010011, 0x010012, 0x010013,
+  0x010014, 0x010015, 0x010016, 0x010017, 0x010018, 0x010019,
+  0x01001a, 0x01001b, 0x01001c, 0x01001d, 0x01001e, 0x01001f,
+  0x000100, 0x000101, 0x000102, 0x000103, 0x000104, 0x000105,
+  0x000106, 0x000107, 0x000108, 0x000109, 0x00010a, 0x00010b,
+  0x00010c, 0x00010d, 0x00010e, 0x00010f, 0x010010, 0x010011,
+  0x010012, 0x010013, 0x010014, 0x010015, 0x010016, 0x010017,
+  0x010018, 0x010019, 0x01001a, 0x01001b, 0x01001c, 0x01001d,
+  0x01001e, 0x01001f, 0x000000, 0x010011, 0x000002, 0x010013,
+  0x000004, 0x010015, 0x000006, 0x010017, 0x000008, 0x010019,
+  0x00000a, 0x01001b, 0x00000c, 0x01001d, 0x00000e, 0x01001f,
+  0x010010, 0x010011, 0x010012, 0x010013, 0x010014, 0x010015,
+  0x010016, 0x010017, 0x010018, 0x010019, 0x01001a, 0x01001b,
+  0x01001c, 0x01001d, 0x01001e, 0x01001f, 0x010210, 0x010211,
+  0x010212, 0x010213, 0x010214, 0x010215, 0x010216, 0x010217,
+  0x010218, 0x010219, 0x01021a, 0x01021b, 0x01021c, 0x01021d,
+  0x01021e, 0x01021f, 0x010010, 0x010011, 0x010012, 0x010013,
+  0x010014, 0x010015, 0x010016, 0x010017, 0x010018, 0x010019,
+  0x01001a, 0x01001b, 0x01001c, 0x01001d, 0x01001e, 0x01001f,
+  0x000050, 0x000041, 0x000052, 0x000043, 0x000054, 0x000045,
+  0x000056, 0x000047, 0x000058, 0x000049, 0x00005a, 0x00004b,
+  0x00005c, 0x00004d, 0x00005e, 0x00004f, 0x000010, 0x000001,
+  0x000012, 0x000003, 0x000014, 0x000005, 0x000016, 0x000007,
+  0x000018, 0x000009, 0x00001a, 0x00000b, 0x00001c, 0x00000d,
+  0x00001e, 0x00000f, 0x000010, 0x000010, 0x000012, 0x000012,
+  0x000014, 0x000014, 0x000016, 0x000016, 0x000018, 0x000018,
+  0x00001a, 0x00001a, 0x00001c, 0x00001c, 0x00001e, 0x00001e,
+  0x000010, 0x000001, 0x000012, 0x000003, 0x000014, 0x000005,
+  0x000016, 0x000007, 0x000018, 0x000009, 0x00001a, 0x00000b,
+  0x00001c, 0x00000d, 0x00001e, 0x00000f, 0x000010, 0x000001,
+  0x000001, 0x000012, 0x000014, 0x000005, 0x000005, 0x000016,
+  0x000018, 0x000009, 0x000009, 0x00001a, 0x00001c, 0x00000d,
+  0x00000d, 0x00001e, 0x000010, 0x000001, 0x000012, 0x000003,
+  0x000014, 0x000005, 0x000016, 0x000007, 0x000018, 0x000009,
+  0x00001a, 0x00000b, 0x00001c, 0x00000d, 0x00001e, 0x00000f,
+  0x000001, 0x000012, 0x000012, 0x000003, 0x000005, 0x000016,
+  0x000016, 0x000007, 0x000009, 0x00001a, 0x00001a, 0x00000b,
+  0x00000d, 0x00001e, 0x00001e, 0x00000f, 0x000010, 0x000001,
+  0x000012, 0x000003, 0x000014, 0x000005, 0x000016, 0x000007,
+  0x000018, 0x000009, 0x00001a, 0x00000b, 0x00001c, 0x00000d,
+  0x00001e, 0x00000f, 0x000001, 0x000001, 0x000001, 0x000001,
+  0x000005, 0x000005, 0x000005, 0x000005, 0x000009, 0x000009,
+  0x000009, 0x000009, 0x00000d, 0x00000d, 0x00000d, 0x00000d,
+  0x000010, 0x000001, 0x000012, 0x000003, 0x000014, 0x000005,
+  0x000016, 0x000007, 0x000018, 0x000009, 0x00001a, 0x00000b,
+  0x00001c, 0x00000d, 0x00001e, 0x00000f, 0x000401, 0x000401,
+  0x000403, 0x000403, 0x000405, 0x000405, 0x000407, 0x000407,
+  0x000409, 0x000409, 0x00040b, 0x00040b, 0x00040d, 0x00040d,
+  0x00040f, 0x00040f, 0x000010, 0x000001, 0x000012, 0x000003,
+  0x000014, 0x000005, 0x000016, 0x000007, 0x000018, 0x000009,
+  0x00001a, 0x00000b, 0x00001c, 0x00000d, 0x00001e, 0x00000f,
+  0x000010, 0x000401, 0x000012, 0x000403, 0x000014, 0x000405,
+  0x000016, 0x000407, 0x000018, 0x000409, 0x00001a, 0x00040b,
+  0x00001c, 0x00040d, 0x00001e, 0x00040f, 0x000010, 0x000001,
+  0x000012, 0x000003, 0x000014, 0x000005, 0x000016, 0x000007,
+  0x000018, 0x000009, 0x00001a, 0x00000b, 0x00001c, 0x00000d,
+  0x00001e, 0x00000f, 0x000010, 0x000401, 0x000012, 0x000403,
+  0x000014, 0x000405, 0x000016, 0x000407, 0x000018, 0x000409,
+  0x00001a, 0x00040b, 0x00001c, 0x00040d, 0x00001e, 0x00040f,
+  0x000010, 0x000001, 0x000012, 0x000003, 0x000014, 0x000005,
+  0x000016, 0x000007, 0x000018, 0x000009, 0x00001a, 0x00000b,
+  0x00001c, 0x00000d, 0x00001e, 0x00000f, 0x000810, 0x001801,
+  0x000812, 0x001803, 0x000814, 0x001805, 0x000816, 0x001807,
+  0x000838, 0x001829, 0x00083a, 0x00182b, 0x00083c, 0x00182d,
+  0x00083e, 0x00182f, 0x000010, 0x000001, 0x000012, 0x000003,
+  0x000014, 0x000005, 0x000016, 0x000007, 0x000018, 0x000009,
+  0x00001a, 0x00000b, 0x00001c, 0x00000d, 0x00001e, 0x00000f,
+  0x001810, 0x000801, 0x001812, 0x000803, 0x001814, 0x000805,
+  0x001816, 0x000807, 0x001838, 0x000829, 0x00183a, 0x00082b,
+  0x00183c, 0x00082d, 0x00183e, 0x00082f, 0x000010, 0x000001,
+  0x000012, 0x000003, 0x000014, 0x000005, 0x000016, 0x000007,
+  0x000018, 0x000009, 0x00001a, 0x00000b, 0x00001c, 0x00000d,
+  0x00001e, 0x00000f, 0x000010, 0x000001, 0x000012, 0x000003,
+  0x000010, 0x000001, 0x000012, 0x000003, 0x000018, 0x000009,
+  0x00001a, 0x00000b, 0x000018, 0x000009, 0x00001a, 0x00000b,
+  0x000010, 0x000001, 0x000012, 0x000003, 0x000014, 0x000005,
+  0x000016, 0x000007, 0x000018, 0x000009, 0x00001a, 0x00000b,
+  0x00001c, 0x00000d, 0x00001e, 0x00000f, 0x000010, 0x000001,
+  0x000012, 0x000003, 0x000014, 0x000005, 0x000016, 0x000007,
+  0x000010, 0x000001, 0x000012, 0x000003, 0x000014, 0x000005,
+  0x000016, 0x000007, 0x000010, 0x000001, 0x000012, 0x000003,
+  0x000014, 0x000005, 0x000016, 0x000007, 0x000018, 0x000009,
+  0x00001a, 0x00000b, 0x00001c, 0x00000d, 0x00001e, 0x00000f,
+  0x000090, 0x000081, 0x000092, 0x000083, 0x000094, 0x000085,
+  0x000096, 0x000087, 0x000098, 0x000089, 0x00009a, 0x00008b,
+  0x00009c, 0x00008d, 0x00009e, 0x00008f, 0x000010, 0x000001,
+  0x000012, 0x000003, 0x000014, 0x000005, 0x000016, 0x000007,
+  0x000018, 0x000009, 0x00001a, 0x00000b, 0x00001c, 0x00000d,
+  0x00001e, 0x00000f, 0x000100, 0x000101, 0x000102, 0x000103,
+  0x000104, 0x000105, 0x000106, 0x000107, 0x000108, 0x000109,
+  0x00010a, 0x00010b, 0x00010c, 0x00010d, 0x00010e, 0x00010f,
+  0x000010, 0x000001, 0x000012, 0x000003, 0x000014, 0x000005,
+  0x000016, 0x000007, 0x000018, 0x000009, 0x00001a, 0x00000b,
+  0x00001c, 0x00000d, 0x00001e, 0x00000f, 0x000000, 0x000001,
+  0x000002, 0x000003, 0x000004, 0x000005, 0x000006, 0x000007,
+  0x000008, 0x000009, 0x00000a, 0x00000b, 0x00000c, 0x00000d,
+  0x00000e, 0x00000f, 0x000010, 0x000001, 0x000012, 0x000003,
+  0x000014, 0x000005, 0x000016, 0x000007, 0x000018, 0x000009,
+  0x00001a, 0x00000b, 0x00001c, 0x00000d, 0x00001e, 0x00000f,
+  0x000210, 0x000201, 0x000212, 0x000203, 0x000214, 0x000205,
+  0x000216, 0x000207, 0x000218, 0x000209, 0x00021a, 0x00020b,
+  0x00021c, 0x00020d, 0x00021e, 0x00020f, 0x000010, 0x000001,
+  0x000012, 0x000003, 0x000014, 0x000005, 0x000016, 0x000007,
+  0x000018, 0x000009, 0x00001a, 0x00000b, 0x00001c, 0x00000d,
+  0x00001e, 0x00000f, 0x000050, 0x000041, 0x000052, 0x000043,
+  0x000054, 0x000045, 0x000056, 0x000047, 0x000058, 0x000049,
+  0x00005a, 0x00004b, 0x00005c, 0x00004d, 0x00005e, 0x00004f,
+  0x000010, 0x000001, 0x000012, 0x000003, 0x000014, 0x000005,
+  0x000016, 0x000007, 0x000018, 0x000009, 0x00001a, 0x00000b,
+  0x00001c, 0x00000d, 0x00001e, 0x00000f, 0x000010, 0x000010,
+  0x000012, 0x000012, 0x000005, 0x000005, 0x000007, 0x000007,
+  0x000018, 0x000018, 0x00001a, 0x00001a, 0x00000d, 0x00000d,
+  0x00000f, 0x00000f, 0x000010, 0x000001, 0x000012, 0x000003,
+  0x000014, 0x000005, 0x000016, 0x000007, 0x000018, 0x000009,
+  0x00001a, 0x00000b, 0x00001c, 0x00000d, 0x00001e, 0x00000f,
+  0x000010, 0x000001, 0x000001, 0x000012, 0x000005, 0x000016,
+  0x000016, 0x000007, 0x000018, 0x000009, 0x000009, 0x00001a,
+  0x00000d, 0x00001e, 0x00001e, 0x00000f, 0x000010, 0x000001,
+  0x000012, 0x000003, 0x000014, 0x000005, 0x000016, 0x000007,
+  0x000018, 0x000009, 0x00001a, 0x00000b, 0x00001c, 0x00000d,
+  0x00001e, 0x00000f, 0x000001, 0x000012, 0x000012, 0x000003,
+  0x000014, 0x000005, 0x000005, 0x000016, 0x000009, 0x00001a,
+  0x00001a, 0x00000b, 0x00001c, 0x00000d, 0x00000d, 0x00001e,
+  0x000010, 0x000001, 0x000012, 0x000003, 0x000014, 0x000005,
+  0x000016, 0x000007, 0x000018, 0x000009, 0x00001a, 0x00000b,
+  0x00001c, 0x00000d, 0x00001e, 0x00000f, 0x000001, 0x000001,
+  0x000001, 0x000001, 0x000005, 0x000005, 0x000005, 0x000005,
+  0x000009, 0x000009, 0x000009, 0x000009, 0x00000d, 0x00000d,
+  0x00000d, 0x00000d, 0x000010, 0x000001, 0x000012, 0x000003,
+  0x000014, 0x000005, 0x000016, 0x000007, 0x000018, 0x000009,
+  0x00001a, 0x00000b, 0x00001c, 0x00000d, 0x00001e, 0x00000f,
+  0x000401, 0x000401, 0x000403, 0x000403, 0x000405, 0x000014,
+  0x000407, 0x000016, 0x000409, 0x000409, 0x00040b, 0x00040b,
+  0x00040d, 0x00001c, 0x00040f, 0x00001e, 0x000010, 0x000001,
+  0x000012, 0x000003, 0x000014, 0x000005, 0x000016, 0x000007,
+  0x000018, 0x000009, 0x00001a, 0x00000b, 0x00001c, 0x00000d,
+  0x00001e, 0x00000f, 0x000010, 0x000401, 0x000012, 0x000403,
+  0x000405, 0x000405, 0x000407, 0x000407, 0x000018, 0x000409,
+  0x00001a, 0x00040b, 0x00040d, 0x00040d, 0x00040f, 0x00040f,
+  0x000010, 0x000001, 0x000012, 0x000003, 0x000014, 0x000005,
+  0x000016, 0x000007, 0x000018, 0x000009, 0x00001a, 0x00000b,
+  0x00001c, 0x00000d, 0x00001e, 0x00000f, 0x000010, 0x000401,
+  0x000012, 0x000403, 0x000405, 0x000014, 0x000407, 0x000016,
+  0x000018, 0x000409, 0x00001a, 0x00040b, 0x00040d, 0x00001c,
+  0x00040f, 0x00001e, 0x000010, 0x000001, 0x000012, 0x000003,
+  0x000014, 0x000005, 0x000016, 0x000007, 0x000018, 0x000009,
+  0x00001a, 0x00000b, 0x00001c, 0x00000d, 0x00001e, 0x00000f,
+  0x000810, 0x001801, 0x000812, 0x001803, 0x000814, 0x001805,
+  0x000816, 0x001807, 0x000838, 0x001829, 0x00083a, 0x00182b,
+  0x00083c, 0x00182d, 0x00083e, 0x00182f, 0x000010, 0x000001,
+  0x000012, 0x000003, 0x000014, 0x000005, 0x000016, 0x000007,
+  0x000018, 0x000009, 0x00001a, 0x00000b, 0x00001c, 0x00000d,
+  0x00001e, 0x00000f, 0x001810, 0x000801, 0x001812, 0x000803,
+  0x001814, 0x000805, 0x001816, 0x000807, 0x001838, 0x000829,
+  0x00183a, 0x00082b, 0x00183c, 0x00082d, 0x00183e, 0x00082f,
+  0x000010, 0x000001, 0x000012, 0x000003, 0x000014, 0x000005,
+  0x000016, 0x000007, 0x000018, 0x000009, 0x00001a, 0x00000b,
+  0x00001c, 0x00000d, 0x00001e, 0x00000f, 0x000014, 0x000005,
+  0x000016, 0x000007, 0x000014, 0x000005, 0x000016, 0x000007,
+  0x00001c, 0x00000d, 0x00001e, 0x00000f, 0x00001c, 0x00000d,
+  0x00001e, 0x00000f, 0x000010, 0x000001, 0x000012, 0x000003,
+  0x000014, 0x000005, 0x000016, 0x000007, 0x000018, 0x000009,
+  0x00001a, 0x00000b, 0x00001c, 0x00000d, 0x00001e, 0x00000f,
+  0x000010, 0x000001, 0x000012, 0x000003, 0x00001c, 0x00000d,
+  0x00001e, 0x00000f, 0x000010, 0x000001, 0x000012, 0x000003,
+  0x00001c, 0x00000d, 0x00001e, 0x00000f, 0x000010, 0x000001,
+  0x000012, 0x000003, 0x000014, 0x000005, 0x000016, 0x000007,
+  0x000018, 0x000009, 0x00001a, 0x00000b, 0x00001c, 0x00000d,
+  0x00001e, 0x00000f, 0x000090, 0x000081, 0x000092, 0x000083,
+  0x000094, 0x000085, 0x000096, 0x000087, 0x000098, 0x000089,
+  0x00009a, 0x00008b, 0x00009c, 0x00008d, 0x00009e, 0x00008f,
+  0x000010, 0x000001, 0x000012, 0x000003, 0x000014, 0x000005,
+  0x000016, 0x000007, 0x000018, 0x000009, 0x00001a, 0x00000b,
+  0x00001c, 0x00000d, 0x00001e, 0x00000f, 0x000100, 0x000101,
+  0x000102, 0x000103, 0x000104, 0x000105, 0x000106, 0x000107,
+  0x000108, 0x000109, 0x00010a, 0x00010b, 0x00010c, 0x00010d,
+  0x00010e, 0x00010f, 0x000010, 0x000001, 0x000012, 0x000003,
+  0x000014, 0x000005, 0x000016, 0x000007, 0x000018, 0x000009,
+  0x00001a, 0x00000b, 0x00001c, 0x00000d, 0x00001e, 0x00000f,
+  0x000000, 0x000001, 0x000002, 0x000003, 0x000004, 0x000005,
+  0x000006, 0x000007, 0x000008, 0x000009, 0x00000a, 0x00000b,
+  0x00000c, 0x00000d, 0x00000e, 0x00000f, 0x000010, 0x000001,
+  0x000012, 0x000003, 0x000014, 0x000005, 0x000016, 0x000007,
+  0x000018, 0x000009, 0x00001a, 0x00000b, 0x00001c, 0x00000d,
+  0x00001e, 0x00000f, 0x000210, 0x000201, 0x000212, 0x000203,
+  0x000214, 0x000205, 0x000216, 0x000207, 0x000218, 0x000209,
+  0x00021a, 0x00020b, 0x00021c, 0x00020d, 0x00021e, 0x00020f,
+  0x000010, 0x000001, 0x000012, 0x000003, 0x000014, 0x000005,
+  0x000016, 0x000007, 0x000018, 0x000009, 0x00001a, 0x00000b,
+  0x00001c, 0x00000d, 0x00001e, 0x00000f, 0x020040, 0x020041,
+  0x020042, 0x020043, 0x020044, 0x020045, 0x020046, 0x020047,
+  0x020048, 0x020049, 0x02004a, 0x02004b, 0x02004c, 0x02004d,
+  0x02004e, 0x02004f, 0x020000, 0x020001, 0x020002, 0x020003,
+  0x020004, 0x020005, 0x020006, 0x020007, 0x020008, 0x020009,
+  0x02000a, 0x02000b, 0x02000c, 0x02000d, 0x02000e, 0x02000f,
+  0x020000, 0x020000, 0x020002, 0x020002, 0x020004, 0x020004,
+  0x020006, 0x020006, 0x020008, 0x020008, 0x02000a, 0x02000a,
+  0x02000c, 0x02000c, 0x02000e, 0x02000e, 0x020000, 0x020001,
+  0x020002, 0x020003, 0x020004, 0x020005, 0x020006, 0x020007,
+  0x020008, 0x020009, 0x02000a, 0x02000b, 0x02000c, 0x02000d,
+  0x02000e, 0x02000f, 0x020000, 0x020001, 0x020001, 0x020002,
+  0x020004, 0x020005, 0x020005, 0x020006, 0x020008, 0x020009,
+  0x020009, 0x02000a, 0x02000c, 0x02000d, 0x02000d, 0x02000e,
+  0x020000, 0x020001, 0x020002, 0x020003, 0x020004, 0x020005,
+  0x020006, 0x020007, 0x020008, 0x020009, 0x02000a, 0x02000b,
+  0x02000c, 0x02000d, 0x02000e, 0x02000f, 0x020001, 0x020002,
+  0x020002, 0x020003, 0x020005, 0x020006, 0x020006, 0x020007,
+  0x020009, 0x02000a, 0x02000a, 0x02000b, 0x02000d, 0x02000e,
+  0x02000e, 0x02000f, 0x020000, 0x020001, 0x020002, 0x020003,
+  0x020004, 0x020005, 0x020006, 0x020007, 0x020008, 0x020009,
+  0x02000a, 0x02000b, 0x02000c, 0x02000d, 0x02000e, 0x02000f,
+  0x020001, 0x020001, 0x020001, 0x020001, 0x020005, 0x020005,
+  0x020005, 0x020005, 0x020009, 0x020009, 0x020009, 0x020009,
+  0x02000d, 0x02000d, 0x02000d, 0x02000d, 0x020000, 0x020001,
+  0x020002, 0x020003, 0x020004, 0x020005, 0x020006, 0x020007,
+  0x020008, 0x020009, 0x02000a, 0x02000b, 0x02000c, 0x02000d,
+  0x02000e, 0x02000f, 0x020401, 0x020401, 0x020403, 0x020403,
+  0x020405, 0x020405, 0x020407, 0x020407, 0x020409, 0x020409,
+  0x02040b, 0x02040b, 0x02040d, 0x02040d, 0x02040f, 0x02040f,
+  0x020000, 0x020001, 0x020002, 0x020003, 0x020004, 0x020005,
+  0x020006, 0x020007, 0x020008, 0x020009, 0x02000a, 0x02000b,
+  0x02000c, 0x02000d, 0x02000e, 0x02000f, 0x020000, 0x020401,
+  0x020002, 0x020403, 0x020004, 0x020405, 0x020006, 0x020407,
+  0x020008, 0x020409, 0x02000a, 0x02040b, 0x02000c, 0x02040d,
+  0x02000e, 0x02040f, 0x020000, 0x020001, 0x020002, 0x020003,
+  0x020004, 0x020005, 0x020006, 0x020007, 0x020008, 0x020009,
+  0x02000a, 0x02000b, 0x02000c, 0x02000d, 0x02000e, 0x02000f,
+  0x020000, 0x020401, 0x020002, 0x020403, 0x020004, 0x020405,
+  0x020006, 0x020407, 0x020008, 0x020409, 0x02000a, 0x02040b,
+  0x02000c, 0x02040d, 0x02000e, 0x02040f, 0x020000, 0x020001,
+  0x020002, 0x020003, 0x020004, 0x020005, 0x020006, 0x020007,
+  0x020008, 0x020009, 0x02000a, 0x02000b, 0x02000c, 0x02000d,
+  0x02000e, 0x02000f, 0x020800, 0x021801, 0x020802, 0x021803,
+  0x020804, 0x021805, 0x020806, 0x021807, 0x020828, 0x021829,
+  0x02082a, 0x02182b, 0x02082c, 0x02182d, 0x02082e, 0x02182f,
+  0x020000, 0x020001, 0x020002, 0x020003, 0x020004, 0x020005,
+  0x020006, 0x020007, 0x020008, 0x020009, 0x02000a, 0x02000b,
+  0x02000c, 0x02000d, 0x02000e, 0x02000f, 0x021800, 0x020801,
+  0x021802, 0x020803, 0x021804, 0x020805, 0x021806, 0x020807,
+  0x021828, 0x020829, 0x02182a, 0x02082b, 0x02182c, 0x02082d,
+  0x02182e, 0x02082f, 0x020000, 0x020001, 0x020002, 0x020003,
+  0x020004, 0x020005, 0x020006, 0x020007, 0x020008, 0x020009,
+  0x02000a, 0x02000b, 0x02000c, 0x02000d, 0x02000e, 0x02000f,
+  0x020000, 0x020001, 0x020002, 0x020003, 0x020000, 0x020001,
+  0x020002, 0x020003, 0x020008, 0x020009, 0x02000a, 0x02000b,
+  0x020008, 0x020009, 0x02000a, 0x02000b, 0x020000, 0x020001,
+  0x020002, 0x020003, 0x020004, 0x020005, 0x020006, 0x020007,
+  0x020008, 0x020009, 0x02000a, 0x02000b, 0x02000c, 0x02000d,
+  0x02000e, 0x02000f, 0x020000, 0x020001, 0x020002, 0x020003,
+  0x020004, 0x020005, 0x020006, 0x020007, 0x020000, 0x020001,
+  0x020002, 0x020003, 0x020004, 0x020005, 0x020006, 0x020007,
+  0x020000, 0x020001, 0x020002, 0x020003, 0x020004, 0x020005,
+  0x020006, 0x020007, 0x020008, 0x020009, 0x02000a, 0x02000b,
+  0x02000c, 0x02000d, 0x02000e, 0x02000f, 0x020080, 0x020081,
+  0x020082, 0x020083, 0x020084, 0x020085, 0x020086, 0x020087,
+  0x020088, 0x020089, 0x02008a, 0x02008b, 0x02008c, 0x02008d,
+  0x02008e, 0x02008f, 0x020000, 0x020001, 0x020002, 0x020003,
+  0x020004, 0x020005, 0x020006, 0x020007, 0x020008, 0x020009,
+  0x02000a, 0x02000b, 0x02000c, 0x02000d, 0x02000e, 0x02000f,
+  0x000100, 0x000101, 0x000102, 0x000103, 0x000104, 0x000105,
+  0x000106, 0x000107, 0x000108, 0x000109, 0x00010a, 0x00010b,
+  0x00010c, 0x00010d, 0x00010e, 0x00010f, 0x020000, 0x020001,
+  0x020002, 0x020003, 0x020004, 0x020005, 0x020006, 0x020007,
+  0x020008, 0x020009, 0x02000a, 0x02000b, 0x02000c, 0x02000d,
+  0x02000e, 0x02000f, 0x000000, 0x020001, 0x000002, 0x020003,
+  0x000004, 0x020005, 0x000006, 0x020007, 0x000008, 0x020009,
+  0x00000a, 0x02000b, 0x00000c, 0x02000d, 0x00000e, 0x02000f,
+  0x020000, 0x020001, 0x020002, 0x020003, 0x020004, 0x020005,
+  0x020006, 0x020007, 0x020008, 0x020009, 0x02000a, 0x02000b,
+  0x02000c, 0x02000d, 0x02000e, 0x02000f, 0x020200, 0x020201,
+  0x020202, 0x020203, 0x020204, 0x020205, 0x020206, 0x020207,
+  0x020208, 0x020209, 0x02020a, 0x02020b, 0x02020c, 0x02020d,
+  0x02020e, 0x02020f, 0x020000, 0x020001, 0x020002, 0x020003,
+  0x020004, 0x020005, 0x020006, 0x020007, 0x020008, 0x020009,
+  0x02000a, 0x02000b, 0x02000c, 0x02000d, 0x02000e, 0x02000f,
+  0x020040, 0x020041, 0x020042, 0x020043, 0x020044, 0x020045,
+  0x020046, 0x020047, 0x020048, 0x020049, 0x02004a, 0x02004b,
+  0x02004c, 0x02004d, 0x02004e, 0x02004f, 0x020000, 0x020001,
+  0x020002, 0x020003, 0x020004, 0x020005, 0x020006, 0x020007,
+  0x020008, 0x020009, 0x02000a, 0x02000b, 0x02000c, 0x02000d,
+  0x02000e, 0x02000f, 0x020000, 0x020000, 0x020002, 0x020002,
+  0x020005, 0x020005, 0x020007, 0x020007, 0x020008, 0x020008,
+  0x02000a, 0x02000a, 0x02000d, 0x02000d, 0x02000f, 0x02000f,
+  0x020000, 0x020001, 0x020002, 0x020003, 0x020004, 0x020005,
+  0x020006, 0x020007, 0x020008, 0x020009, 0x02000a, 0x02000b,
+  0x02000c, 0x02000d, 0x02000e, 0x02000f, 0x020000, 0x020001,
+  0x020001, 0x020002, 0x020005, 0x020006, 0x020006, 0x020007,
+  0x020008, 0x020009, 0x020009, 0x02000a, 0x02000d, 0x02000e,
+  0x02000e, 0x02000f, 0x020000, 0x020001, 0x020002, 0x020003,
+  0x020004, 0x020005, 0x020006, 0x020007, 0x020008, 0x020009,
+  0x02000a, 0x02000b, 0x02000c, 0x02000d, 0x02000e, 0x02000f,
+  0x020001, 0x020002, 0x020002, 0x020003, 0x020004, 0x020005,
+  0x020005, 0x020006, 0x020009, 0x02000a, 0x02000a, 0x02000b,
+  0x02000c, 0x02000d, 0x02000d, 0x02000e, 0x020000, 0x020001,
+  0x020002, 0x020003, 0x020004, 0x020005, 0x020006, 0x020007,
+  0x020008, 0x020009, 0x02000a, 0x02000b, 0x02000c, 0x02000d,
+  0x02000e, 0x02000f, 0x020001, 0x020001, 0x020001, 0x020001,
+  0x020005, 0x020005, 0x020005, 0x020005, 0x020009, 0x020009,
+  0x020009, 0x020009, 0x02000d, 0x02000d, 0x02000d, 0x02000d,
+  0x020000, 0x020001, 0x020002, 0x020003, 0x020004, 0x020005,
+  0x020006, 0x020007, 0x020008, 0x020009, 0x02000a, 0x02000b,
+  0x02000c, 0x02000d, 0x02000e, 0x02000f, 0x020401, 0x020401,
+  0x020403, 0x020403, 0x020405, 0x020004, 0x020407, 0x020006,
+  0x020409, 0x020409, 0x02040b, 0x02040b, 0x02040d, 0x02000c,
+  0x02040f, 0x02000e, 0x020000, 0x020001, 0x020002, 0x020003,
+  0x020004, 0x020005, 0x020006, 0x020007, 0x020008, 0x020009,
+  0x02000a, 0x02000b, 0x02000c, 0x02000d, 0x02000e, 0x02000f,
+  0x020000, 0x020401, 0x020002, 0x020403, 0x020405, 0x020405,
+  0x020407, 0x020407, 0x020008, 0x020409, 0x02000a, 0x02040b,
+  0x02040d, 0x02040d, 0x02040f, 0x02040f, 0x020000, 0x020001,
+  0x020002, 0x020003, 0x020004, 0x020005, 0x020006, 0x020007,
+  0x020008, 0x020009, 0x02000a, 0x02000b, 0x02000c, 0x02000d,
+  0x02000e, 0x02000f, 0x020000, 0x020401, 0x020002, 0x020403,
+  0x020405, 0x020004, 0x020407, 0x020006, 0x020008, 0x020409,
+  0x02000a, 0x02040b, 0x02040d, 0x02000c, 0x02040f, 0x02000e,
+  0x020000, 0x020001, 0x020002, 0x020003, 0x020004, 0x020005,
+  0x020006, 0x020007, 0x020008, 0x020009, 0x02000a, 0x02000b,
+  0x02000c, 0x02000d, 0x02000e, 0x02000f, 0x020800, 0x021801,
+  0x020802, 0x021803, 0x020804, 0x021805, 0x020806, 0x021807,
+  0x020828, 0x021829, 0x02082a, 0x02182b, 0x02082c, 0x02182d,
+  0x02082e, 0x02182f, 0x020000, 0x020001, 0x020002, 0x020003,
+  0x020004, 0x020005, 0x020006, 0x020007, 0x020008, 0x020009,
+  0x02000a, 0x02000b, 0x02000c, 0x02000d, 0x02000e, 0x02000f,
+  0x021800, 0x020801, 0x021802, 0x020803, 0x021804, 0x020805,
+  0x021806, 0x020807, 0x021828, 0x020829, 0x02182a, 0x02082b,
+  0x02182c, 0x02082d, 0x02182e, 0x02082f, 0x020000, 0x020001,
+  0x020002, 0x020003, 0x020004, 0x020005, 0x020006, 0x020007,
+  0x020008, 0x020009, 0x02000a, 0x02000b, 0x02000c, 0x02000d,
+  0x02000e, 0x02000f, 0x020004, 0x020005, 0x020006, 0x020007,
+  0x020004, 0x020005, 0x020006, 0x020007, 0x02000c, 0x02000d,
+  0x02000e, 0x02000f, 0x02000c, 0x02000d, 0x02000e, 0x02000f,
+  0x020000, 0x020001, 0x020002, 0x020003, 0x020004, 0x020005,
+  0x020006, 0x020007, 0x020008, 0x020009, 0x02000a, 0x02000b,
+  0x02000c, 0x02000d, 0x02000e, 0x02000f, 0x020000, 0x020001,
+  0x020002, 0x020003, 0x02000c, 0x02000d, 0x02000e, 0x02000f,
+  0x020000, 0x020001, 0x020002, 0x020003, 0x02000c, 0x02000d,
+  0x02000e, 0x02000f, 0x020000, 0x020001, 0x020002, 0x020003,
+  0x020004, 0x020005, 0x020006, 0x020007, 0x020008, 0x020009,
+  0x02000a, 0x02000b, 0x02000c, 0x02000d, 0x02000e, 0x02000f,
+  0x020080, 0x020081, 0x020082, 0x020083, 0x020084, 0x020085,
+  0x020086, 0x020087, 0x020088, 0x020089, 0x02008a, 0x02008b,
+  0x02008c, 0x02008d, 0x02008e, 0x02008f, 0x020000, 0x020001,
+  0x020002, 0x020003, 0x020004, 0x020005, 0x020006, 0x020007,
+  0x020008, 0x020009, 0x02000a, 0x02000b, 0x02000c, 0x02000d,
+  0x02000e, 0x02000f, 0x000100, 0x000101, 0x000102, 0x000103,
+  0x000104, 0x000105, 0x000106, 0x000107, 0x000108, 0x000109,
+  0x00010a, 0x00010b, 0x00010c, 0x00010d, 0x00010e, 0x00010f,
+  0x020000, 0x020001, 0x020002, 0x020003, 0x020004, 0x020005,
+  0x020006, 0x020007, 0x020008, 0x020009, 0x02000a, 0x02000b,
+  0x02000c, 0x02000d, 0x02000e, 0x02000f, 0x000000, 0x020001,
+  0x000002, 0x020003, 0x000004, 0x020005, 0x000006, 0x020007,
+  0x000008, 0x020009, 0x00000a, 0x02000b, 0x00000c, 0x02000d,
+  0x00000e, 0x02000f, 0x020000, 0x020001, 0x020002, 0x020003,
+  0x020004, 0x020005, 0x020006, 0x020007, 0x020008, 0x020009,
+  0x02000a, 0x02000b, 0x02000c, 0x02000d, 0x02000e, 0x02000f,
+  0x020200, 0x020201, 0x020202, 0x020203, 0x020204, 0x020205,
+  0x020206, 0x020207, 0x020208, 0x020209, 0x02020a, 0x02020b,
+  0x02020c, 0x02020d, 0x02020e, 0x02020f, 0x020000, 0x020001,
+  0x020002, 0x020003, 0x020004, 0x020005, 0x020006, 0x020007,
+  0x020008, 0x020009, 0x02000a, 0x02000b, 0x02000c, 0x02000d,
+  0x02000e, 0x02000f
+};
+#endif
+
+/* Pack the state of a CPU for indexing. */
+static inline unsigned table_state(const cpu_state *cpu)
+{
+  return cpu->rr | cpu->cr << 1 | cpu->ien << 2 | cpu->oen << 3 |
+         cpu->skip << 4;
+}
+
+/* Same as cpu_clock_high() but by table lookup. */
+static inline cpu_state table_clock_high(cpu_state cpu, unsigned inst,
+                                         unsigned data)
+{
+  unsigned entry = table_step[TABLE_INDEX(table_state(&cpu), inst,
+                                          data)];
+
+  cpu.ir = cpu.skip ? i_nopf : (instruction)inst;
+  cpu.rr = entry & 1;
+  cpu.cr = (entry >> 1) & 1;
+  cpu.ien = (entry >> 2) & 1;
+  cpu.oen = (entry >> 3) & 1;
+  cpu.skip = (entry >> 4) & 1;
+  cpu.outputs = (cpu.outputs & co_write) | TABLE_OUTPUTS(entry);
+  cpu.bus = cpu.outputs & co_store ? TABLE_BUS(entry) : cpu.bus;
+  return cpu;
+}
+
+#endif
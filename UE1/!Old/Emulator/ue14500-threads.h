@@ -0,0 +1,180 @@
+/* UE14500 emulator threads.
+
+   License: Public Domain
+
+   What the emulator's execution, render and input threads share, so that a
+   slow terminal never holds up the emulated machine:
+
+     - A frame: the few things the screen shows (display items, cursor,
+       status text and clocks), published by the execution thread after each
+       step through a seqlock (ue14500-seqlock.h). Publishing never waits;
+       the render thread copies out the latest frame whenever it is ready to
+       draw, and frames published in between are simply never drawn.
+     - A key queue: a single-producer, single-consumer ring from the input
+       thread to the execution thread. Pushing and popping are lock-free; the
+       lock is only taken to wake the execution thread when it is asleep
+       waiting for a key.
+
+   Needs C11 atomics and POSIX threads. The wait for a key uses the
+   CLOCK_MONOTONIC clock, as the scheduler does, so deadlines from
+   sched_now() can be passed straight in.
+*/
+#ifndef UE14500_THREADS_H
+#define UE14500_THREADS_H
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <time.h>
+
+#include "ue14500-seqlock.h"
+
+/* Keys the queue holds (a power of 2), and what key_wait() returns when
+   the time is up. */
+#define KEY_QUEUE_SIZE 256
+#define KEY_NONE (-1)
+
+/* What is on the screen. */
+typedef struct panel_frame_
+{
+  /* display_item bits and the selected control. */
+  unsigned items;
+  unsigned control;
+
+  /* Clocks so far and the status text. */
+  unsigned long long clocks;
+  char status[26];
+} panel_frame;
+
+/* A frame and its sequence number, odd while it is being written. */
+typedef struct frame_pub_
+{
+  atomic_uint seq;
+  panel_frame frame;
+} frame_pub;
+
+typedef struct key_queue_
+{
+  int keys[KEY_QUEUE_SIZE];
+
+  /* Keys popped (only the consumer writes it) and pushed (only the
+     producer writes it). */
+  atomic_uint head;
+  atomic_uint tail;
+
+  /* Set while the consumer sleeps, so the producer knows to wake it. */
+  atomic_int waiting;
+  pthread_mutex_t lock;
+  pthread_cond_t wake;
+} key_queue;
+
+/* Publish a frame. Only one thread may publish. */
+static inline void frame_publish(frame_pub *pub, const panel_frame *frame)
+{
+  seqlock_publish(&pub->seq, &pub->frame, frame, sizeof(*frame));
+}
+
+/* Copy out the latest frame. Returns its sequence number, which only
+   changes when a new frame has been published. */
+static inline unsigned frame_read(frame_pub *pub, panel_frame *frame)
+{
+  return seqlock_read(&pub->seq, frame, &pub->frame, sizeof(*frame));
+}
+
+/* Returns 0 on success. */
+static inline int key_queue_init(key_queue *q)
+{
+  pthread_condattr_t attr;
+
+  atomic_init(&q->head, 0);
+  atomic_init(&q->tail, 0);
+  atomic_init(&q->waiting, 0);
+  if (pthread_condattr_init(&attr) != 0)
+  {
+    return 1;
+  }
+  pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+  pthread_mutex_init(&q->lock, NULL);
+  pthread_cond_init(&q->wake, &attr);
+  pthread_condattr_destroy(&attr);
+  return 0;
+}
+
+static inline void key_queue_free(key_queue *q)
+{
+  pthread_mutex_destroy(&q->lock);
+  pthread_cond_destroy(&q->wake);
+}
+
+/* Push a key. Returns nonzero if the queue is full. */
+static inline int key_push(key_queue *q, int key)
+{
+  unsigned tail = atomic_load_explicit(&q->tail, memory_order_relaxed);
+
+  if (tail - atomic_load_explicit(&q->head, memory_order_acquire) ==
+      KEY_QUEUE_SIZE)
+  {
+    return 1;
+  }
+  q->keys[tail % KEY_QUEUE_SIZE] = key;
+  atomic_store(&q->tail, tail + 1);
+
+  /* The consumer sets waiting before it looks at tail and this looks at
+     waiting after setting tail, so one of them always sees the other. */
+  if (atomic_load(&q->waiting))
+  {
+    pthread_mutex_lock(&q->lock);
+    pthread_cond_signal(&q->wake);
+    pthread_mutex_unlock(&q->lock);
+  }
+  return 0;
+}
+
+/* Pop a key, or return KEY_NONE if there is none. */
+static inline int key_pop(key_queue *q)
+{
+  int key;
+  unsigned head = atomic_load_explicit(&q->head, memory_order_relaxed);
+
+  if (atomic_load_explicit(&q->tail, memory_order_acquire) == head)
+  {
+    return KEY_NONE;
+  }
+  key = q->keys[head % KEY_QUEUE_SIZE];
+  atomic_store_explicit(&q->head, head + 1, memory_order_release);
+  return key;
+}
+
+/* Pop a key, waiting for one until the given time (ns on the sched_now()
+   clock, ~0 for no limit). Returns KEY_NONE if there was none by then. */
+static inline int key_wait(key_queue *q, unsigned long long until)
+{
+  int key = key_pop(q);
+  struct timespec ts;
+
+  if (key != KEY_NONE)
+  {
+    return key;
+  }
+  ts.tv_sec = (time_t)(until / 1000000000ull);
+  ts.tv_nsec = (long)(until % 1000000000ull);
+
+  pthread_mutex_lock(&q->lock);
+  atomic_store(&q->waiting, 1);
+  while (atomic_load(&q->tail) == atomic_load(&q->head))
+  {
+    if (until == ~0ull)
+    {
+      pthread_cond_wait(&q->wake, &q->lock);
+    }
+    else if (pthread_cond_timedwait(&q->wake, &q->lock, &ts) != 0 &&
+             atomic_load(&q->tail) == atomic_load(&q->head))
+    {
+      break;
+    }
+  }
+  atomic_store(&q->waiting, 0);
+  pthread_mutex_unlock(&q->lock);
+  return key_pop(q);
+}
+
+#endif
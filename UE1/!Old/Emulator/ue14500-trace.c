@@ -0,0 +1,190 @@
+/* UE14500 trace reader.
+
+   License: Public Domain
+
+   Prints the clock edges recorded by ue14500-emu --trace (the format is in
+   ue14500-trace.h, which must be in the same directory). The trace is
+   indexed, so starting at any clock only decodes the block holding it.
+   Build and run instructions (there are many ways - use these as a guide):
+
+   Linux/Mac/Windows (MSYS2):
+     - gcc -O2 -o ue14500-trace ue14500-trace.c
+     - ./ue14500-trace run.trace 1000 20
+
+   Command line:
+     ue14500-trace [--info] TRACE [CLOCK [COUNT]]
+
+     - Prints COUNT edges (default all) starting from the rising edge of
+       clock CLOCK (the first clock is 1; the default, 0, is the start of
+       the trace).
+     - --info prints the size of the trace instead.
+
+   Each edge is printed as the clock number, H or L for the rising or falling
+   edge, the instruction and data on the switches, the registers after the
+   edge, and the output lines that are high after it (W: write, 0: flag 0,
+   J: jump, R: return, F: flag F).
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ue14500-trace.h"
+
+static void print_record(unsigned long long clock, unsigned record);
+static int print_info(trace_reader *r);
+
+int main(int argc, char **argv)
+{
+  FILE *file;
+  trace_reader r;
+  const char *error;
+  unsigned *records;
+  unsigned n;
+  unsigned i;
+  unsigned info = 0;
+  unsigned started;
+  size_t block;
+  unsigned long long clock = 0;
+  unsigned long long count = ~0ull;
+  unsigned long long clocks;
+  int arg = 1;
+  int status = 0;
+
+  if (arg < argc && strcmp(argv[arg], "--info") == 0)
+  {
+    info = 1;
+    ++arg;
+  }
+  if (arg >= argc || argc - arg > 3)
+  {
+    fputs("Usage: ue14500-trace [--info] TRACE [CLOCK [COUNT]]\n", stderr);
+    return 1;
+  }
+  if (arg + 1 < argc)
+  {
+    clock = strtoull(argv[arg + 1], NULL, 10);
+  }
+  if (arg + 2 < argc)
+  {
+    count = strtoull(argv[arg + 2], NULL, 10);
+  }
+
+  file = fopen(argv[arg], "rb");
+  if (file == NULL)
+  {
+    fputs("Error opening trace file.\n", stderr);
+    return 1;
+  }
+  error = trace_read_open(&r, file);
+  if (error != NULL)
+  {
+    fprintf(stderr, "%s\n", error);
+    fclose(file);
+    return 1;
+  }
+  if (info)
+  {
+    n = (unsigned)print_info(&r);
+    trace_read_close(&r);
+    fclose(file);
+    return (int)n;
+  }
+
+  records = (unsigned *)malloc(r.block_records * sizeof(unsigned));
+  if (records == NULL)
+  {
+    fputs("Out of memory.\n", stderr);
+    trace_read_close(&r);
+    fclose(file);
+    return 1;
+  }
+
+  /* Decode from the block holding the clock, printing from its rising
+     edge on. */
+  started = clock == 0;
+  for (block = trace_find_clock(&r, clock);
+       block < r.num_blocks && count > 0; ++block)
+  {
+    n = trace_read_block(&r, block, records);
+    if (n == 0)
+    {
+      fputs("Trace file is corrupt.\n", stderr);
+      status = 1;
+      break;
+    }
+    clocks = r.index[block].clocks;
+    for (i = 0; i < n && count > 0; ++i)
+    {
+      clocks += (records[i] & TRACE_HIGH) != 0;
+      started |= clocks == clock && (records[i] & TRACE_HIGH);
+      if (started)
+      {
+        print_record(clocks, records[i]);
+        --count;
+      }
+    }
+  }
+  if (!started && status == 0)
+  {
+    fputs("The trace does not reach that clock.\n", stderr);
+    status = 1;
+  }
+
+  free(records);
+  trace_read_close(&r);
+  fclose(file);
+  return status;
+}
+
+static void print_record(unsigned long long clock, unsigned record)
+{
+  unsigned regs = record >> TRACE_REGS;
+  unsigned outputs = record >> TRACE_OUTPUTS;
+
+  printf("%10llu %c %-4s D%u  RR %u CR %u IEN %u OEN %u SKIP %u  %c%c%c%c%c\n",
+         clock, record & TRACE_HIGH ? 'H' : 'L',
+         instructions[record & TRACE_INST], (record & TRACE_DATA) != 0,
+         regs & 1, (regs >> 1) & 1, (regs >> 2) & 1, (regs >> 3) & 1,
+         (regs >> 4) & 1,
+         outputs & co_write ? 'W' : '-', outputs & co_flg0 ? '0' : '-',
+         outputs & co_jump ? 'J' : '-', outputs & co_return ? 'R' : '-',
+         outputs & co_flgf ? 'F' : '-');
+}
+
+static int print_info(trace_reader *r)
+{
+  long size;
+  unsigned *records;
+  unsigned n;
+  unsigned i;
+  unsigned long long clocks = 0;
+
+  if (fseek(r->file, 0, SEEK_END) != 0 || (size = ftell(r->file)) < 0)
+  {
+    fputs("Error reading trace file.\n", stderr);
+    return 1;
+  }
+  if (r->num_blocks != 0)
+  {
+    /* Count the rising edges in the last block. */
+    records = (unsigned *)malloc(r->block_records * sizeof(unsigned));
+    if (records == NULL)
+    {
+      fputs("Out of memory.\n", stderr);
+      return 1;
+    }
+    n = trace_read_block(r, r->num_blocks - 1, records);
+    clocks = r->index[r->num_blocks - 1].clocks;
+    for (i = 0; i < n; ++i)
+    {
+      clocks += (records[i] & TRACE_HIGH) != 0;
+    }
+    free(records);
+  }
+
+  printf("%llu edges (%llu clocks) in %lu blocks of up to %u, %ld bytes "
+         "(%.3f bytes an edge).\n", r->records, clocks,
+         (unsigned long)r->num_blocks, r->block_records, size,
+         r->records ? (double)size / (double)r->records : 0.0);
+  return 0;
+}
@@ -0,0 +1,641 @@
+/* UE14500 execution trace.
+
+   License: Public Domain
+
+   A trace is one 16-bit record per clock edge:
+
+     bits 0-3  instruction on the switches
+     bit 4     data on the switch
+     bits 5-9  RR, carry, IEN, OEN and skip after the edge
+     bits 10-14 write, flag 0, jump, return and flag F after the edge
+     bit 15    set for a rising edge, clear for a falling one
+
+   Records are stored in blocks of a fixed number of records. Within a
+   block, each record is predicted twice over:
+
+     - by following on from earlier in the block: after a record that had
+       to be written out, from just after the last three records the last
+       time those came up (found by a hash of them), and from there on
+       record by record, which a program in a loop of any length keeps
+       getting right once it has been round once;
+     - failing that, by the last record written out with the same switches
+       on the same edge, which leaves only what the instruction did
+       differently.
+
+   A run of records the first prediction gets right is a byte or two, and
+   any other record one to three bytes:
+
+     0nnnnnnn                   n + 1 records as predicted
+     111nnnnn nnnnnnnn          n + 1 records as predicted (n in bits 0-12,
+                                the low byte second)
+     100sssss                   switches s (bits 0-4), bits 5-14 as the
+                                last record written out with s
+     101sssss dddddddd          the same, bits 5-12 differing by d
+     110sssss dddddddd 000000dd the same, bits 5-14 differing by d (low
+                                byte first)
+
+   Bit 15 is not stored: edges alternate within a block, so it follows from
+   that of the first record, which is kept in the block header. Each block
+   starts afresh (nothing is predicted, and the last records are all taken
+   as zero), so any block can be decoded on its own. The file is:
+
+     "UE14TRAC", version (4 bytes), records per block (4)
+     blocks: records (4, bit 31 set if the first is a rising edge), bytes
+       (4), the encoded records
+     index: for each block its file offset, first record and the number of
+       rising edges before it (8 bytes each)
+     index offset (8), blocks (8), records (8), "UE14TEND"
+
+   all little-endian. The index lets a reader go straight to the block
+   holding any clock. If the run never finished, the index is missing but
+   the finished blocks are all there, and trace_read_open() rebuilds it by
+   skipping from block header to block header.
+
+   Clocks count the rising edges recorded. Going back in a run does not
+   take records out, so the edges run again follow on, and from then on the
+   trace's clocks are ahead of the machine's.
+*/
+#ifndef UE14500_TRACE_H
+#define UE14500_TRACE_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ue14500-core.h"
+#include "ue14500-snap.h"
+
+/* File layout. */
+#define TRACE_MAGIC "UE14TRAC"
+#define TRACE_END "UE14TEND"
+#define TRACE_VERSION 2u
+#define TRACE_BLOCK 65536u
+#define TRACE_HEADER 16
+#define TRACE_FOOTER 32
+#define TRACE_COUNT 0x7fffffffu
+#define TRACE_FIRST_HIGH 0x80000000u
+
+/* Record fields. */
+#define TRACE_INST 0x000fu
+#define TRACE_DATA 0x0010u
+#define TRACE_REGS 5
+#define TRACE_OUTPUTS 10
+#define TRACE_HIGH 0x8000u
+#define TRACE_SWITCHES 0x001fu
+#define TRACE_REST 0x7fe0u
+
+/* Encoding: the longest runs, where three records were last seen (one for
+   each hash of those: the position after them, stamped above it with the
+   block they were seen in), and the last record written out for each
+   switch setting and edge. */
+#define TRACE_SHORT_RUN 128u
+#define TRACE_LONG_RUN 8192u
+#define TRACE_SEEN_BITS 16
+#define TRACE_SEEN (1u << TRACE_SEEN_BITS)
+#define TRACE_SEEN_AT 0x1ffffu
+#define TRACE_SEEN_GEN 17
+#define TRACE_NONE 0x10000u
+#define TRACE_LAST 64u
+
+/* Largest encoding of a block: every record three bytes. */
+#define TRACE_MAX_BYTES (TRACE_BLOCK * 3)
+
+/* What the encoder and decoder both keep for the predictions. */
+typedef struct trace_model_
+{
+  unsigned gen;
+  unsigned from;
+  unsigned predicted;
+  unsigned *seen;
+  unsigned short last[TRACE_LAST];
+} trace_model;
+
+/* Index entry for one block. */
+typedef struct trace_block_
+{
+  unsigned long long offset;
+  unsigned long long first;
+  unsigned long long clocks;
+} trace_block;
+
+/* Trace being written. */
+typedef struct trace_writer_
+{
+  FILE *file;
+  int error;
+
+  /* The block being encoded: records in it, whether the first is a rising
+     edge, the records themselves, the predictions, the pending run of
+     predicted records, and the encoding. */
+  unsigned count;
+  unsigned first_high;
+  unsigned *block;
+  trace_model model;
+  unsigned run;
+  size_t len;
+  unsigned char *buff;
+
+  /* Totals up to the block being encoded, and the index so far. */
+  unsigned long long records;
+  unsigned long long clocks;
+  unsigned long long offset;
+  size_t num_blocks;
+  size_t max_blocks;
+  trace_block *index;
+} trace_writer;
+
+/* Trace being read. */
+typedef struct trace_reader_
+{
+  FILE *file;
+  unsigned block_records;
+  unsigned long long records;
+  size_t num_blocks;
+  trace_block *index;
+  unsigned char *buff;
+  trace_model model;
+} trace_reader;
+
+/* The record for a clock edge, given the switches (the instruction in the
+   low 4 bits of inst and data in bit 4, as in program_step) and the CPU
+   after the edge. */
+static inline unsigned trace_record(unsigned inst, const cpu_state *cpu,
+                                    unsigned high)
+{
+  return inst |
+         (cpu->rr | cpu->cr << 1 | cpu->ien << 2 | cpu->oen << 3 |
+          cpu->skip << 4) << TRACE_REGS |
+         (cpu->outputs & (co_write | co_flg0 | co_jump | co_return |
+                          co_flgf)) << TRACE_OUTPUTS |
+         (high ? TRACE_HIGH : 0);
+}
+
+/* Set up the predictions (the table of 256 KiB is allocated here).
+   Returns nonzero if out of memory. */
+static inline int trace_model_init(trace_model *m)
+{
+  m->gen = 0;
+  m->seen = (unsigned *)calloc(TRACE_SEEN, sizeof(unsigned));
+  return m->seen == NULL;
+}
+
+/* Start a block: nothing is known. The table of where records were seen is
+   stamped rather than cleared, and only cleared when the stamps wrap. */
+static inline void trace_model_block(trace_model *m)
+{
+  if (++m->gen == 1u << (32 - TRACE_SEEN_GEN))
+  {
+    memset(m->seen, 0, TRACE_SEEN * sizeof(unsigned));
+    m->gen = 1;
+  }
+  memset(m->last, 0, sizeof(m->last));
+  m->from = 0;
+  m->predicted = TRACE_NONE;
+}
+
+/* Move on past a record of the block that was the one predicted: the next
+   is predicted to be the one that followed it before. */
+static inline void trace_model_hit(trace_model *m, const unsigned *records)
+{
+  m->predicted = records[++m->from];
+}
+
+/* Move on past the n-th record of the block when it was not the one
+   predicted: keep it as the last with its switches, and follow on from just
+   after the last three records the last time those came up, if they have.
+   The three are hashed to TRACE_SEEN_BITS bits (Fibonacci hashing); the odd
+   collision only costs a miss. */
+static inline void trace_model_miss(trace_model *m, const unsigned *records,
+                                    unsigned n)
+{
+  unsigned record = records[n];
+  unsigned key;
+  unsigned entry;
+  unsigned found;
+
+  m->last[(record & TRACE_SWITCHES) | (record >> 10 & 0x20)] =
+    (unsigned short)record;
+  m->predicted = TRACE_NONE;
+  if (n < 2)
+  {
+    return;
+  }
+  key = (unsigned)(((unsigned long long)records[n - 2] << 32 |
+                    (unsigned long long)records[n - 1] << 16 | record) *
+                   0x9e3779b97f4a7c15ull >> (64 - TRACE_SEEN_BITS));
+  entry = m->seen[key];
+  found = entry >> TRACE_SEEN_GEN == m->gen;
+  m->from = found ? entry & TRACE_SEEN_AT : n;
+  m->predicted = found ? records[m->from] : TRACE_NONE;
+  m->seen[key] = m->gen << TRACE_SEEN_GEN | (n + 1);
+}
+
+/* Start a trace in a file open for writing. Returns 0 on success. */
+static inline int trace_open(trace_writer *w, FILE *file)
+{
+  unsigned char header[TRACE_HEADER];
+
+  memset(w, 0, sizeof(*w));
+  w->file = file;
+  w->buff = (unsigned char *)malloc(TRACE_MAX_BYTES);
+  w->block = (unsigned *)malloc(TRACE_BLOCK * sizeof(unsigned));
+  if (w->buff == NULL || w->block == NULL || trace_model_init(&w->model))
+  {
+    return 1;
+  }
+  memcpy(header, TRACE_MAGIC, 8);
+  snap_put(header + 8, TRACE_VERSION, 4);
+  snap_put(header + 12, TRACE_BLOCK, 4);
+  w->offset = TRACE_HEADER;
+  w->error = fwrite(header, TRACE_HEADER, 1, file) != 1;
+  return w->error;
+}
+
+static inline void trace_flush_run(trace_writer *w)
+{
+  if (w->run > TRACE_SHORT_RUN)
+  {
+    w->buff[w->len++] = (unsigned char)(0xe0 | (w->run - 1) >> 8);
+    w->buff[w->len++] = (unsigned char)(w->run - 1);
+  }
+  else if (w->run != 0)
+  {
+    w->buff[w->len++] = (unsigned char)(w->run - 1);
+  }
+  w->run = 0;
+}
+
+/* Write out the block being encoded and add it to the index. */
+static inline void trace_end_block(trace_writer *w)
+{
+  unsigned char header[8];
+  trace_block *block;
+
+  trace_flush_run(w);
+  if (w->num_blocks == w->max_blocks)
+  {
+    w->max_blocks = w->max_blocks ? w->max_blocks * 2 : 64;
+    block = (trace_block *)realloc(w->index,
+                                   w->max_blocks * sizeof(trace_block));
+    if (block == NULL)
+    {
+      w->error = 1;
+      return;
+    }
+    w->index = block;
+  }
+  block = w->index + w->num_blocks++;
+  block->offset = w->offset;
+  block->first = w->records;
+  block->clocks = w->clocks;
+  w->records += w->count;
+
+  /* Edges alternate, so the rising ones follow from the first. */
+  w->clocks += (w->count + w->first_high) / 2;
+
+  snap_put(header, w->count | (w->first_high ? TRACE_FIRST_HIGH : 0), 4);
+  snap_put(header + 4, w->len, 4);
+  if (fwrite(header, 8, 1, w->file) != 1 ||
+      fwrite(w->buff, 1, w->len, w->file) != w->len)
+  {
+    w->error = 1;
+  }
+  w->offset += 8 + w->len;
+
+  /* The next block starts from nothing. */
+  w->count = 0;
+  w->len = 0;
+}
+
+/* Write a record the model did not predict. */
+static inline void trace_put_miss(trace_writer *w, unsigned record,
+                                  unsigned high)
+{
+  unsigned switches = record & TRACE_SWITCHES;
+  unsigned delta;
+  unsigned extra;
+  unsigned char *p;
+
+  trace_flush_run(w);
+
+  /* All three bytes are written, and the extra ones kept as needed: which
+     form a record takes is no more predictable than the record. */
+  delta = (record ^ w->model.last[switches | high << 5]) >> 5 & 0x3ff;
+  extra = (delta != 0) + (delta >= 0x100);
+  p = w->buff + w->len;
+  p[0] = (unsigned char)(0x80 | extra << 5 | switches);
+  p[1] = (unsigned char)delta;
+  p[2] = (unsigned char)(delta >> 8);
+  w->len += 1 + extra;
+}
+
+/* Add a record. */
+static inline void trace_put(trace_writer *w, unsigned record)
+{
+  unsigned high = record >> 15;
+
+  /* Edges alternate within a block, so one that does not (after going back
+     in a run, say) starts a new block. */
+  if (w->count != 0 && high != (w->first_high ^ (w->count & 1)))
+  {
+    trace_end_block(w);
+  }
+  if (w->count == 0)
+  {
+    w->first_high = high;
+    trace_model_block(&w->model);
+  }
+
+  w->block[w->count] = record;
+  if (record != w->model.predicted)
+  {
+    trace_put_miss(w, record, high);
+    trace_model_miss(&w->model, w->block, w->count);
+  }
+  else
+  {
+    trace_model_hit(&w->model, w->block);
+    if (++w->run == TRACE_LONG_RUN)
+    {
+      trace_flush_run(w);
+    }
+  }
+  if (++w->count == TRACE_BLOCK)
+  {
+    trace_end_block(w);
+  }
+}
+
+/* Finish the trace: the last block, the index and the footer. The file is
+   left open. Returns nonzero if there was any error. */
+static inline int trace_close(trace_writer *w)
+{
+  size_t i;
+  unsigned char entry[24];
+  unsigned long long index_offset;
+
+  if (w->count != 0)
+  {
+    trace_end_block(w);
+  }
+  index_offset = w->offset;
+  for (i = 0; i < w->num_blocks && !w->error; ++i)
+  {
+    snap_put(entry, w->index[i].offset, 8);
+    snap_put(entry + 8, w->index[i].first, 8);
+    snap_put(entry + 16, w->index[i].clocks, 8);
+    w->error = fwrite(entry, sizeof(entry), 1, w->file) != 1;
+  }
+  snap_put(entry, index_offset, 8);
+  snap_put(entry + 8, w->num_blocks, 8);
+  snap_put(entry + 16, w->records, 8);
+  if (!w->error && (fwrite(entry, sizeof(entry), 1, w->file) != 1 ||
+                    fwrite(TRACE_END, 8, 1, w->file) != 1))
+  {
+    w->error = 1;
+  }
+  free(w->buff);
+  free(w->block);
+  free(w->index);
+  free(w->model.seen);
+  w->buff = NULL;
+  w->block = NULL;
+  w->index = NULL;
+  w->model.seen = NULL;
+  return w->error;
+}
+
+static inline void trace_read_close(trace_reader *r)
+{
+  free(r->index);
+  free(r->buff);
+  free(r->model.seen);
+  r->index = NULL;
+  r->buff = NULL;
+  r->model.seen = NULL;
+}
+
+/* Add a block to a reader's index as it is rebuilt. */
+static inline int trace_read_add(trace_reader *r, size_t *max_blocks,
+                                 const trace_block *block)
+{
+  trace_block *index;
+
+  if (r->num_blocks == *max_blocks)
+  {
+    *max_blocks = *max_blocks ? *max_blocks * 2 : 64;
+    index = (trace_block *)realloc(r->index,
+                                   *max_blocks * sizeof(trace_block));
+    if (index == NULL)
+    {
+      return 1;
+    }
+    r->index = index;
+  }
+  r->index[r->num_blocks++] = *block;
+  return 0;
+}
+
+/* Open a trace in a file open for reading. Returns NULL on success or an
+   error message. */
+static inline const char *trace_read_open(trace_reader *r, FILE *file)
+{
+  unsigned char buff[TRACE_FOOTER];
+  unsigned long long index_offset;
+  unsigned long long count;
+  unsigned long long end;
+  size_t max_blocks = 0;
+  size_t i;
+  long size;
+  trace_block block = { TRACE_HEADER, 0, 0 };
+
+  memset(r, 0, sizeof(*r));
+  r->file = file;
+  if (fread(buff, TRACE_HEADER, 1, file) != 1 ||
+      memcmp(buff, TRACE_MAGIC, 8) != 0)
+  {
+    return "Not a trace file.";
+  }
+  if (snap_get(buff + 8, 4) != TRACE_VERSION)
+  {
+    return "Trace file is from a different version.";
+  }
+  r->block_records = (unsigned)snap_get(buff + 12, 4);
+  if (r->block_records == 0 || r->block_records > TRACE_COUNT)
+  {
+    return "Trace file is corrupt.";
+  }
+  r->buff = (unsigned char *)malloc((size_t)r->block_records * 3);
+  if (r->buff == NULL || trace_model_init(&r->model))
+  {
+    trace_read_close(r);
+    return "Out of memory.";
+  }
+
+  /* Use the index if the trace was finished. */
+  if (fseek(file, -TRACE_FOOTER, SEEK_END) == 0 &&
+      fread(buff, TRACE_FOOTER, 1, file) == 1 &&
+      memcmp(buff + 24, TRACE_END, 8) == 0)
+  {
+    index_offset = snap_get(buff, 8);
+    r->num_blocks = (size_t)snap_get(buff + 8, 8);
+    r->records = snap_get(buff + 16, 8);
+    r->index = (trace_block *)malloc((r->num_blocks + 1) *
+                                     sizeof(trace_block));
+    if (r->index == NULL || fseek(file, (long)index_offset, SEEK_SET) != 0)
+    {
+      trace_read_close(r);
+      return "Trace file is corrupt.";
+    }
+    for (i = 0; i < r->num_blocks; ++i)
+    {
+      if (fread(buff, 24, 1, file) != 1)
+      {
+        trace_read_close(r);
+        return "Trace file is corrupt.";
+      }
+      r->index[i].offset = snap_get(buff, 8);
+      r->index[i].first = snap_get(buff + 8, 8);
+      r->index[i].clocks = snap_get(buff + 16, 8);
+    }
+    return NULL;
+  }
+
+  /* Otherwise walk the block headers, up to the last block that was
+     written out in full. Edges alternate within a block, so the rising
+     edges in it follow from the first edge and the count. */
+  size = fseek(file, 0, SEEK_END) == 0 ? ftell(file) : -1;
+  while (fseek(file, (long)block.offset, SEEK_SET) == 0 &&
+         fread(buff, 8, 1, file) == 1)
+  {
+    count = snap_get(buff, 4) & TRACE_COUNT;
+    end = block.offset + 8 + snap_get(buff + 4, 4);
+    if (count == 0 || count > r->block_records ||
+        snap_get(buff + 4, 4) > count * 3 ||
+        size < 0 || end > (unsigned long long)size)
+    {
+      break;
+    }
+    if (trace_read_add(r, &max_blocks, &block))
+    {
+      trace_read_close(r);
+      return "Out of memory.";
+    }
+    block.first += count;
+    block.clocks += (count + (buff[3] >> 7)) / 2;
+    block.offset = end;
+  }
+  r->records = block.first;
+  return NULL;
+}
+
+/* Decode the ith block into records (room for block_records). Returns the
+   number of records, or 0 on error. */
+static inline unsigned trace_read_block(trace_reader *r, size_t i,
+                                        unsigned *records)
+{
+  unsigned char header[8];
+  unsigned count;
+  unsigned high;
+  unsigned n;
+  unsigned run;
+  unsigned code;
+  unsigned edge;
+  unsigned record;
+  size_t len;
+  size_t j;
+  trace_model *m = &r->model;
+
+  if (i >= r->num_blocks ||
+      fseek(r->file, (long)r->index[i].offset, SEEK_SET) != 0 ||
+      fread(header, 8, 1, r->file) != 1)
+  {
+    return 0;
+  }
+  count = (unsigned)snap_get(header, 4) & TRACE_COUNT;
+  high = header[3] >> 7;
+  len = (size_t)snap_get(header + 4, 4);
+  if (count > r->block_records || len > (size_t)count * 3 ||
+      fread(r->buff, 1, len, r->file) != len)
+  {
+    return 0;
+  }
+
+  trace_model_block(m);
+  for (n = 0, j = 0; j < len && n < count; )
+  {
+    code = r->buff[j++];
+    edge = (high ^ (n & 1)) ? TRACE_HIGH : 0;
+
+    /* A run of predicted records. */
+    if (code < 0x80 || code >= 0xe0)
+    {
+      run = code + 1;
+      if (code >= 0xe0)
+      {
+        if (j == len)
+        {
+          return 0;
+        }
+        run = ((code & 0x1f) << 8 | r->buff[j++]) + 1;
+      }
+      for (; run > 0 && n < count; --run, ++n)
+      {
+        if (m->predicted == TRACE_NONE)
+        {
+          return 0;
+        }
+        records[n] = m->predicted;
+        trace_model_hit(m, records);
+      }
+      continue;
+    }
+
+    /* A record from the last with the same switches. */
+    record = m->last[(code & TRACE_SWITCHES) | edge >> 10];
+    if (code >= 0xa0)
+    {
+      if (j + (code >= 0xc0) >= len)
+      {
+        return 0;
+      }
+      record ^= (unsigned)r->buff[j++] << 5;
+      if (code >= 0xc0)
+      {
+        record ^= (unsigned)(r->buff[j++] & 3) << 13;
+      }
+    }
+    record = (record & TRACE_REST) | (code & TRACE_SWITCHES) | edge;
+    records[n] = record;
+    trace_model_miss(m, records, n);
+    ++n;
+  }
+  return n == count ? count : 0;
+}
+
+/* The block holding the given clock (the rising edge that makes that many),
+   or the first block if it is clock 0. */
+static inline size_t trace_find_clock(const trace_reader *r,
+                                      unsigned long long clock)
+{
+  size_t lo = 0;
+  size_t hi = r->num_blocks;
+  size_t mid;
+
+  /* The last block with fewer clocks before it than the one wanted. */
+  while (hi - lo > 1)
+  {
+    mid = lo + (hi - lo) / 2;
+    if (r->index[mid].clocks < clock)
+    {
+      lo = mid;
+    }
+    else
+    {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+#endif
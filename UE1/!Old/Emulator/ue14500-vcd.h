@@ -0,0 +1,317 @@
+/* UE14500 VCD waveform writer.
+
+   License: Public Domain
+
+   Writes the clock edges of a run as a Value Change Dump (IEEE 1364), which
+   GTKWave and most logic analyser software can open next to a scope
+   capture. The signals are those of the chip's pins:
+
+     clk, i0-i3, data        the switches
+     rr, carry, ien, oen, skip
+     write, flg0, flgf, jmp, rtn
+
+   Only changes are written, and only for the signals selected. The time
+   unit is 1 ns and edges are a half period apart, the rising edge of clock
+   N at 2N - 1 half periods and its falling edge at 2N. The switches are
+   set before the edge they are used on, so their changes are put a quarter
+   period before it, where a scope would see them.
+
+   A window of clocks can be given to keep the file small: nothing is
+   written before the rising edge of its first clock, where every selected
+   signal is dumped, or after the falling edge of its last.
+
+   Time cannot go back in a VCD, so going back in a run does not either:
+   the edges run again follow on, and the clocks (and the window) count the
+   rising edges written, not the machine's clock. A comment marks the place
+   with the clock the machine went back to.
+
+   The text is put together in a buffer of its own and written a buffer at
+   a time, so writing is a few stores per change.
+*/
+#ifndef UE14500_VCD_H
+#define UE14500_VCD_H
+
+#include <stdio.h>
+#include <string.h>
+
+#include "ue14500-core.h"
+
+/* Size of the text buffer, and room left for one edge's worth. */
+#define VCD_BUFFER 65536
+#define VCD_EDGE 128
+
+/* The signals, in the order they are declared. */
+typedef enum vcd_signal_
+{
+  vs_clk, vs_i0, vs_i1, vs_i2, vs_i3, vs_data,
+  vs_rr, vs_carry, vs_ien, vs_oen, vs_skip,
+  vs_write, vs_flg0, vs_flgf, vs_jmp, vs_rtn,
+  num_vcd_signals
+} vcd_signal;
+
+static const char *const vcd_names[num_vcd_signals] =
+{
+  "clk", "i0", "i1", "i2", "i3", "data",
+  "rr", "carry", "ien", "oen", "skip",
+  "write", "flg0", "flgf", "jmp", "rtn"
+};
+
+/* All signals, and those set on the switches rather than by an edge. */
+#define VCD_ALL ((1u << num_vcd_signals) - 1)
+#define VCD_SWITCHES (1u << vs_i0 | 1u << vs_i1 | 1u << vs_i2 | \
+                      1u << vs_i3 | 1u << vs_data)
+
+typedef struct vcd_writer_
+{
+  FILE *file;
+
+  /* Selected signals, nanoseconds between edges, and the window of clocks
+     to write (to is 0 for no end). */
+  unsigned signals;
+  unsigned long long half_period;
+  unsigned long long from;
+  unsigned long long to;
+
+  /* Edges and clocks so far, the values last written, and whether the
+     window has been reached. */
+  unsigned long long edges;
+  unsigned long long clocks;
+  unsigned values;
+  unsigned started;
+
+  /* Text not yet written, and whether writing has failed. */
+  char buff[VCD_BUFFER];
+  size_t len;
+  int error;
+} vcd_writer;
+
+/* Parse a comma-separated list of signal names. Returns the set, or 0 if a
+   name is not known. */
+static inline unsigned vcd_parse_signals(const char *list)
+{
+  unsigned signals = 0;
+  unsigned i;
+  size_t len;
+
+  while (*list != '\0')
+  {
+    len = strcspn(list, ",");
+    for (i = 0; i < num_vcd_signals; ++i)
+    {
+      if (strlen(vcd_names[i]) == len &&
+          strncmp(list, vcd_names[i], len) == 0)
+      {
+        break;
+      }
+    }
+    if (i == num_vcd_signals)
+    {
+      return 0;
+    }
+    signals |= 1u << i;
+    list += len;
+    list += *list == ',';
+  }
+  return signals;
+}
+
+/* The value of every signal after an edge, one bit each. */
+static inline unsigned vcd_values(unsigned inst, const cpu_state *cpu,
+                                  unsigned clk)
+{
+  return (clk != 0) << vs_clk |
+         (inst & 0x1fu) << vs_i0 |
+         (cpu->rr != 0) << vs_rr |
+         (cpu->cr != 0) << vs_carry |
+         (cpu->ien != 0) << vs_ien |
+         (cpu->oen != 0) << vs_oen |
+         (cpu->skip != 0) << vs_skip |
+         ((cpu->outputs & co_write) != 0) << vs_write |
+         ((cpu->outputs & co_flg0) != 0) << vs_flg0 |
+         ((cpu->outputs & co_flgf) != 0) << vs_flgf |
+         ((cpu->outputs & co_jump) != 0) << vs_jmp |
+         ((cpu->outputs & co_return) != 0) << vs_rtn;
+}
+
+static inline void vcd_flush(vcd_writer *w)
+{
+  if (w->len != 0 && !w->error &&
+      fwrite(w->buff, 1, w->len, w->file) != w->len)
+  {
+    w->error = 1;
+  }
+  w->len = 0;
+}
+
+static inline void vcd_text(vcd_writer *w, const char *text)
+{
+  size_t len = strlen(text);
+
+  if (w->len + len > VCD_BUFFER)
+  {
+    vcd_flush(w);
+  }
+  memcpy(w->buff + w->len, text, len);
+  w->len += len;
+}
+
+/* "#time\n". The caller makes sure there is room. */
+static inline void vcd_time(vcd_writer *w, unsigned long long time)
+{
+  char digits[20];
+  unsigned n = 0;
+
+  do
+  {
+    digits[n++] = (char)('0' + time % 10);
+    time /= 10;
+  } while (time != 0);
+  w->buff[w->len++] = '#';
+  while (n > 0)
+  {
+    w->buff[w->len++] = digits[--n];
+  }
+  w->buff[w->len++] = '\n';
+}
+
+/* A line for each signal in the set, with its value. The identifiers are
+   single characters from '!'. */
+static inline void vcd_changes(vcd_writer *w, unsigned set, unsigned values)
+{
+  unsigned i;
+
+  for (i = 0; set != 0; ++i, set >>= 1)
+  {
+    if (set & 1)
+    {
+      w->buff[w->len++] = (char)('0' + ((values >> i) & 1));
+      w->buff[w->len++] = (char)('!' + i);
+      w->buff[w->len++] = '\n';
+    }
+  }
+}
+
+/* Start writing to the given file. The run has had the given number of
+   clocks already and the clock is at the given level; edges are the given
+   number of nanoseconds apart (at least 2). Returns nonzero on error. */
+static inline int vcd_open(vcd_writer *w, FILE *file, unsigned signals,
+                           unsigned long long half_period,
+                           unsigned long long from, unsigned long long to,
+                           unsigned long long clocks, unsigned clk)
+{
+  unsigned i;
+  char line[64];
+
+  w->file = file;
+  w->signals = signals;
+  w->half_period = half_period;
+  w->from = from;
+  w->to = to;
+  w->clocks = clocks;
+  w->edges = clocks * 2 - (clocks != 0 && clk);
+  w->values = 0;
+  w->started = 0;
+  w->len = 0;
+  w->error = 0;
+
+  vcd_text(w, "$version ue14500-emu $end\n$timescale 1ns $end\n"
+              "$scope module ue14500 $end\n");
+  for (i = 0; i < num_vcd_signals; ++i)
+  {
+    if (signals & 1u << i)
+    {
+      sprintf(line, "$var wire 1 %c %s $end\n", '!' + i, vcd_names[i]);
+      vcd_text(w, line);
+    }
+  }
+  vcd_text(w, "$upscope $end\n$enddefinitions $end\n");
+  vcd_flush(w);
+  return w->error;
+}
+
+/* Record the edge the chip has just been through, with the given switches
+   (as in program_step) and clock level. */
+static inline void vcd_edge(vcd_writer *w, unsigned inst,
+                            const cpu_state *cpu, unsigned clk)
+{
+  unsigned values;
+  unsigned changed;
+  unsigned long long time;
+
+  ++w->edges;
+  w->clocks += clk != 0;
+  if (w->clocks < w->from || (w->to != 0 && w->clocks > w->to))
+  {
+    return;
+  }
+  if (w->len + VCD_EDGE > VCD_BUFFER)
+  {
+    vcd_flush(w);
+  }
+  values = vcd_values(inst, cpu, clk);
+  time = w->edges * w->half_period;
+
+  /* The first edge in the window dumps everything. */
+  if (!w->started)
+  {
+    w->started = 1;
+    w->values = values;
+    vcd_time(w, time);
+    memcpy(w->buff + w->len, "$dumpvars\n", 10);
+    w->len += 10;
+    vcd_changes(w, w->signals, values);
+    memcpy(w->buff + w->len, "$end\n", 5);
+    w->len += 5;
+    return;
+  }
+
+  /* Switches first, then the edge. */
+  changed = (values ^ w->values) & w->signals;
+  w->values = values;
+  if (changed & VCD_SWITCHES)
+  {
+    vcd_time(w, time - w->half_period / 2);
+    vcd_changes(w, changed & VCD_SWITCHES, values);
+  }
+  if (changed & ~VCD_SWITCHES)
+  {
+    vcd_time(w, time);
+    vcd_changes(w, changed & ~VCD_SWITCHES, values);
+  }
+}
+
+/* Mark where the run went back to the given clock. */
+static inline void vcd_comment_back(vcd_writer *w, unsigned long long clock)
+{
+  char line[64];
+
+  if (w->started && (w->to == 0 || w->clocks <= w->to))
+  {
+    sprintf(line, "$comment back to clock %llu $end\n", clock);
+    vcd_text(w, line);
+  }
+}
+
+/* Write the end time and anything buffered. Returns nonzero if there was
+   ever an error. */
+static inline int vcd_close(vcd_writer *w)
+{
+  unsigned long long edges = w->edges;
+
+  if (w->started)
+  {
+    if (w->to != 0 && edges > w->to * 2)
+    {
+      edges = w->to * 2;
+    }
+    if (w->len + VCD_EDGE > VCD_BUFFER)
+    {
+      vcd_flush(w);
+    }
+    vcd_time(w, (edges + 1) * w->half_period);
+  }
+  vcd_flush(w);
+  return w->error;
+}
+
+#endif
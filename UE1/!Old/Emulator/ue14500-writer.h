@@ -0,0 +1,196 @@
+/* UE14500 output writer.
+
+   License: Public Domain
+
+   Writes the output bitstream from a thread of its own so the clock never
+   waits on the file. Bytes go into a ring buffer, which is handed to the
+   writer thread a chunk at a time and written with large write() calls.
+   Putting a byte is just a store unless a chunk is complete, when the
+   thread is woken, or the ring is full, when it waits for room.
+
+   writer_flush() waits until everything put so far is in the file, so the
+   file can be trusted (for a snapshot, say). A write error stops the writer;
+   anything put after it is dropped and every call reports the error from
+   then on. writer_close() flushes and stops the thread.
+*/
+#ifndef UE14500_WRITER_H
+#define UE14500_WRITER_H
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+/* Ring buffer size and how much is handed over at a time (bytes). */
+#define WRITER_RING (1u << 20)
+#define WRITER_CHUNK (1u << 16)
+
+typedef struct out_writer_
+{
+  int fd;
+  unsigned char *ring;
+
+  /* Bytes put, and how many of them the thread has been given. Only the
+     putting thread uses these. */
+  unsigned long long put;
+  unsigned long long given_seen;
+
+  /* Bytes written as last seen, and whether there was an error then. Also
+     only for the putting thread. */
+  unsigned long long done_seen;
+  int error_seen;
+
+  /* Shared with the thread, under the lock. */
+  pthread_mutex_t lock;
+  pthread_cond_t more;
+  pthread_cond_t room;
+  unsigned long long given;
+  unsigned long long done;
+  int stop;
+  int error;
+  pthread_t thread;
+} out_writer;
+
+static inline void *writer_thread(void *arg)
+{
+  out_writer *w = (out_writer *)arg;
+  unsigned long long done;
+  size_t len;
+  size_t off;
+  ssize_t n;
+  int error;
+
+  pthread_mutex_lock(&w->lock);
+  for (;;)
+  {
+    while (w->done == w->given && !w->stop)
+    {
+      pthread_cond_wait(&w->more, &w->lock);
+    }
+    if (w->done == w->given)
+    {
+      break;
+    }
+
+    /* Write as much as is contiguous in the ring without the lock. */
+    done = w->done;
+    off = (size_t)(done % WRITER_RING);
+    len = (size_t)(w->given - done);
+    len = len < WRITER_RING - off ? len : WRITER_RING - off;
+    error = w->error;
+    pthread_mutex_unlock(&w->lock);
+
+    while (!error && len > 0)
+    {
+      n = write(w->fd, w->ring + off, len);
+      if (n < 0 && errno != EINTR)
+      {
+        error = 1;
+      }
+      else if (n > 0)
+      {
+        off += (size_t)n;
+        len -= (size_t)n;
+        done += (unsigned long long)n;
+      }
+    }
+
+    /* After an error, the rest is dropped. */
+    pthread_mutex_lock(&w->lock);
+    w->error = error;
+    w->done = error ? w->given : done;
+    pthread_cond_broadcast(&w->room);
+  }
+  pthread_mutex_unlock(&w->lock);
+  return NULL;
+}
+
+/* Start writing to the given file descriptor. Returns 0 on success. */
+static inline int writer_open(out_writer *w, int fd)
+{
+  w->fd = fd;
+  w->put = 0;
+  w->given_seen = 0;
+  w->done_seen = 0;
+  w->error_seen = 0;
+  w->given = 0;
+  w->done = 0;
+  w->stop = 0;
+  w->error = 0;
+  w->ring = (unsigned char *)malloc(WRITER_RING);
+  if (w->ring == NULL)
+  {
+    return 1;
+  }
+  pthread_mutex_init(&w->lock, NULL);
+  pthread_cond_init(&w->more, NULL);
+  pthread_cond_init(&w->room, NULL);
+  if (pthread_create(&w->thread, NULL, writer_thread, w) != 0)
+  {
+    free(w->ring);
+    w->ring = NULL;
+    return 1;
+  }
+  return 0;
+}
+
+/* Hand everything put so far to the thread. If wait is set, wait until it
+   has all been written, or else only until there is room to put more.
+   Returns nonzero if there has been an error. */
+static inline int writer_give(out_writer *w, int wait)
+{
+  pthread_mutex_lock(&w->lock);
+  w->given = w->put;
+  pthread_cond_signal(&w->more);
+  while (!w->error &&
+         (wait ? w->done != w->given : w->put - w->done == WRITER_RING))
+  {
+    pthread_cond_wait(&w->room, &w->lock);
+  }
+  w->given_seen = w->given;
+  w->done_seen = w->done;
+  w->error_seen = w->error;
+  pthread_mutex_unlock(&w->lock);
+  return w->error_seen;
+}
+
+/* Put a byte. Returns nonzero if there has been an error. */
+static inline int writer_put(out_writer *w, unsigned char byte)
+{
+  if (w->put - w->done_seen == WRITER_RING && writer_give(w, 0))
+  {
+    return 1;
+  }
+  w->ring[w->put++ % WRITER_RING] = byte;
+  if (w->put - w->given_seen >= WRITER_CHUNK)
+  {
+    return writer_give(w, 0);
+  }
+  return w->error_seen;
+}
+
+/* Wait until everything put is in the file. Returns nonzero on error. */
+static inline int writer_flush(out_writer *w)
+{
+  return writer_give(w, 1);
+}
+
+/* Flush and stop the thread. Returns nonzero if there was ever an error. */
+static inline int writer_close(out_writer *w)
+{
+  int error = writer_flush(w);
+
+  pthread_mutex_lock(&w->lock);
+  w->stop = 1;
+  pthread_cond_signal(&w->more);
+  pthread_mutex_unlock(&w->lock);
+  pthread_join(w->thread, NULL);
+  pthread_mutex_destroy(&w->lock);
+  pthread_cond_destroy(&w->more);
+  pthread_cond_destroy(&w->room);
+  free(w->ring);
+  w->ring = NULL;
+  return error;
+}
+
+#endif